@@ -16,6 +16,7 @@
 #include <opc/common/class_pointers.h>
 #include <opc/common/interface.h>
 #include <opc/common/logger.h>
+#include <chrono>
 #include <string>
 #include <vector>
 
@@ -34,6 +35,13 @@ struct AddonInformation
   AddonParameters Parameters;
 };
 
+/// @brief Time spent creating and initializing an addon.
+struct AddonStartupTime
+{
+  AddonId Id;
+  std::chrono::microseconds Duration;
+};
+
 class AddonsManager : private Interface
 {
 public:
@@ -87,6 +95,14 @@ public:
   // @brief Stopping all addons;
   virtual void Stop() = 0;
 
+  /// @brief Number of threads initializing addons whose dependencies are started.
+  /// 0 uses one thread per core, 1 initializes addons one by one in the calling thread.
+  // must be called before Start()
+  virtual void SetStartupThreads(unsigned threads) = 0;
+
+  /// @brief Startup time of every initialized addon, in the order they were initialized.
+  virtual std::vector<AddonStartupTime> GetStartupTimes() const = 0;
+
   virtual const Logger::SharedPtr & GetLogger() const { return Logger; }
 
 protected:
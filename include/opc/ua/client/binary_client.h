@@ -10,11 +10,14 @@
 
 #pragma once
 
+#include <opc/common/class_pointers.h>
+#include <opc/common/interface.h>
 #include <opc/ua/protocol/channel.h>
 #include <opc/ua/services/services.h>
 #include <opc/common/logger.h>
 
 
+#include <functional>
 #include <memory>
 
 namespace OpcUa
@@ -34,6 +37,22 @@ struct SecureConnectionParams
   }
 };
 
+/// @brief Connection of a binary client, lets the owner of the client restore a lost connection.
+/// Services created with CreateBinaryClient() implement it.
+class BinaryClientTransport : private Common::Interface
+{
+public:
+  DEFINE_CLASS_POINTERS(BinaryClientTransport)
+
+  /// @brief Called from the receive thread after the connection failed.
+  /// Requests waiting for a response fail at once with BadConnectionClosed.
+  virtual void SetConnectionLostCallback(std::function<void ()> callback) = 0;
+
+  /// @brief Continues on a new connection to the same endpoint.
+  /// The secure channel has to be opened and the session activated again by the caller.
+  virtual void Reconnect(IOChannel::SharedPtr channel) = 0;
+};
+
 /// @brief Create server based on opc ua binary protocol.
 /// @param channel channel wich will be used for sending requests data.
 Services::SharedPtr CreateBinaryClient(IOChannel::SharedPtr channel, const SecureConnectionParams & params, const Common::Logger::SharedPtr & logger = nullptr);
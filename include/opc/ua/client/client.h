@@ -31,6 +31,8 @@
 #include <condition_variable>
 #include <chrono>
 #include <atomic>
+#include <functional>
+#include <vector>
 
 
 namespace OpcUa
@@ -60,6 +62,40 @@ private:
   Common::Logger::SharedPtr Logger;
 };
 
+/// @brief Automatic reconnection of UaClient after its connection was lost, disabled by default.
+struct ReconnectParameters
+{
+  bool Enabled = false;
+  Duration InitialDelay = 500; // before the first attempt, doubled after each failed one
+  Duration MaxDelay = 30000;
+  uint32_t MaxItemsPerRequest = 1000; // monitored items per request when subscriptions are created again
+};
+
+class ReconnectThread
+{
+public:
+  /// @brief Internal
+  // Calls reconnect with a growing delay once the connection is lost, until it returns true
+  ReconnectThread(const Common::Logger::SharedPtr & logger = nullptr) : Logger(logger) {}
+  void Start(std::function<bool ()> reconnect, const ReconnectParameters & params);
+  void Stop();
+  // Called from the receive thread of the binary client
+  void ConnectionLost();
+
+  void SetLogger(const Common::Logger::SharedPtr & logger) { Logger = logger; }
+
+private:
+  void Run();
+  std::thread Thread;
+  std::function<bool ()> Reconnect;
+  ReconnectParameters Parameters;
+  bool Lost = false;
+  bool StopRequest = false;
+  std::condition_variable Condition;
+  std::mutex Mutex;
+  Common::Logger::SharedPtr Logger;
+};
+
 
 class UaClient
 {
@@ -74,7 +110,7 @@ public:
   /// opc.tcp://192.168.1.1:4840/opcua/server
   /// opc.tcp://server.freeopca.org:4841/opcua/server
   UaClient(bool debug = false);
-  UaClient(std::shared_ptr<spdlog::logger> logger) :  KeepAlive(logger), Logger(logger) {}
+  UaClient(std::shared_ptr<spdlog::logger> logger) :  KeepAlive(logger), Reconnector(logger), Logger(logger) {}
   virtual ~UaClient();
 
   UaClient(const UaClient &&) = delete;
@@ -104,6 +140,18 @@ public:
   // Like Disconnect() but without CloseSession() call, which is not possible on faulty connection anyway
   void Abort();
 
+  /// @brief Reconnect automatically after the connection was lost, applies to the next Connect()
+  // the session is activated again on the new connection and the subscriptions created by
+  // CreateSubscription() are transferred to it, notification messages missed meanwhile are republished.
+  // When the server lost the session a new one is created with the subscriptions and monitored items
+  // created again, the handles of the monitored items stay the same.
+  void SetReconnectParameters(const ReconnectParameters & params) { ReconnectParams = params; }
+  ReconnectParameters GetReconnectParameters() const { return ReconnectParams; }
+
+  /// @brief Restore the connection, session and subscriptions at once
+  // used by the automatic reconnection, returns false if the server could not be reached
+  bool Reconnect();
+
   /// @brief  Connect to server and get endpoints
   std::vector<EndpointDescription> GetServerEndpoints(const std::string & endpoint);
 
@@ -157,6 +205,9 @@ public:
 private:
   void OpenSecureChannel();
   void CloseSecureChannel();
+  void StartSession();
+  void RestoreSubscriptions(bool newSession);
+  void StopReconnect();
 
   std::vector<OpcUa::Node> AddChilds(std::vector<OpcUa::Node> nodes);
 
@@ -170,6 +221,11 @@ protected:
   std::string ProductUri = "urn:freeopcua.github.no:client";
   std::string SecurityPolicy = "none";
   KeepAliveThread KeepAlive;
+  ReconnectThread Reconnector;
+  ReconnectParameters ReconnectParams;
+  ActivateSessionParameters SessionActivation;
+  std::vector<std::weak_ptr<Subscription>> Subscriptions;
+  std::mutex SubscriptionsMutex;
   uint32_t SecureChannelId;
   Common::Logger::SharedPtr Logger;
   uint32_t DefaultTimeout = 3600000;
@@ -44,6 +44,9 @@ struct DataValue
   }
 
   DataValue(const DataValue & data) = default;
+  DataValue(DataValue && data) = default;
+  DataValue & operator= (const DataValue & data) = default;
+  DataValue & operator= (DataValue && data) = default;
 
   explicit DataValue(const Variant & value)
     : DataValue()
@@ -55,6 +55,12 @@ enum MessageId
   UNREGISTER_NODES_REQUEST  = 0x234, // 564
   UNREGISTER_NODES_RESPONSE = 0x237, // 567
 
+  QUERY_FIRST_REQUEST  = 0x267, // 615
+  QUERY_FIRST_RESPONSE = 0x26A, // 618
+
+  QUERY_NEXT_REQUEST  = 0x26D, // 621
+  QUERY_NEXT_RESPONSE = 0x270, // 624
+
   READ_REQUEST  = 0x277, // 631
   READ_RESPONSE = 0x27A, // 634
 
@@ -86,6 +92,9 @@ enum MessageId
   REPUBLISH_REQUEST = 832,
   REPUBLISH_RESPONSE = 835,
 
+  TRANSFER_SUBSCRIPTIONS_REQUEST = 0x349,  // 841
+  TRANSFER_SUBSCRIPTIONS_RESPONSE = 0x34C, // 844
+
   SET_PUBLISHING_MODE_REQUEST = 0x31F,  // 799
   SET_PUBLISHING_MODE_RESPONSE = 0x322, // 802
 
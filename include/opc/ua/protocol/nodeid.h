@@ -121,6 +121,7 @@ struct NodeId
 
   NodeId();
   NodeId(const NodeId & node);
+  NodeId(NodeId && node) noexcept;
   NodeId(const ExpandedNodeId & node);
   NodeId(MessageId messageId);
   NodeId(ReferenceId referenceId);
@@ -130,6 +131,7 @@ struct NodeId
   NodeId(std::string stringId, uint16_t index);
 
   NodeId & operator= (const NodeId & node);
+  NodeId & operator= (NodeId && node) noexcept;
   NodeId & operator= (const ExpandedNodeId & node);
 
   explicit operator ExpandedNodeId();
@@ -196,6 +198,7 @@ struct NodeId
 
 protected:
   void CopyNodeId(const NodeId & node);
+  void MoveNodeId(NodeId && node) noexcept;
 };
 
 inline NodeId TwoByteNodeId(uint8_t value)
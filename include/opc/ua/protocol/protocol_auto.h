@@ -2846,56 +2846,41 @@ struct RepublishResponse
   RepublishResponse();
 };
 
-/* DISABLED
-
-    struct TransferResult
-    {
-         OpcUa::StatusCode Status;
-         std::vector<uint32_t> AvailableSequenceNumbers;
-    };
-*/
-
-/* DISABLED
-
-    struct TransferSubscriptionsParameters
-    {
-         std::vector<uint32_t> SubscriptionIds;
-         bool SendInitialValues;
-    };
-*/
-
-/* DISABLED
-
-    struct TransferSubscriptionsRequest
-    {
-         OpcUa::NodeId TypeId;
-         OpcUa::RequestHeader Header;
-         OpcUa::TransferSubscriptionsParameters Parameters;
+struct TransferResult
+{
+  OpcUa::StatusCode Status;
+  std::vector<uint32_t> AvailableSequenceNumbers;
+};
 
-         TransferSubscriptionsRequest();
-    };
-*/
+struct TransferSubscriptionsParameters
+{
+  std::vector<uint32_t> SubscriptionIds;
+  bool SendInitialValues;
+};
 
-/* DISABLED
+struct TransferSubscriptionsRequest
+{
+  OpcUa::NodeId TypeId;
+  OpcUa::RequestHeader Header;
+  OpcUa::TransferSubscriptionsParameters Parameters;
 
-    struct TransferSubscriptionsResult
-    {
-         std::vector<OpcUa::TransferResult> Results;
-         std::vector<OpcUa::DiagnosticInfo> DiagnosticInfos;
-    };
-*/
+  TransferSubscriptionsRequest();
+};
 
-/* DISABLED
+struct TransferSubscriptionsResult
+{
+  std::vector<OpcUa::TransferResult> Results;
+  std::vector<OpcUa::DiagnosticInfo> DiagnosticInfos;
+};
 
-    struct TransferSubscriptionsResponse
-    {
-         OpcUa::NodeId TypeId;
-         OpcUa::ResponseHeader Header;
-         OpcUa::TransferSubscriptionsResult Parameters;
+struct TransferSubscriptionsResponse
+{
+  OpcUa::NodeId TypeId;
+  OpcUa::ResponseHeader Header;
+  OpcUa::TransferSubscriptionsResult Parameters;
 
-         TransferSubscriptionsResponse();
-    };
-*/
+  TransferSubscriptionsResponse();
+};
 
 struct DeleteSubscriptionsRequest
 {
@@ -25,6 +25,7 @@
 #include <opc/ua/protocol/utils.h>
 #include <opc/ua/protocol/types_manual.h>
 #include <opc/ua/protocol/view.h>
+#include <boost/utility/string_view.hpp>
 #include <ostream>
 #include <limits>
 
@@ -95,9 +96,24 @@ std::string ToString(const T & value)
   return result.str();
 }
 
-Guid ToGuid(const std::string & str);
-NodeId ToNodeId(const std::string & str, uint32_t defaultNamespace = 0);
-QualifiedName ToQualifiedName(const std::string & str, uint32_t default_ns = 0);
+/// @brief Name of the id, nullptr if the id is unknown.
+const char * GetObjectIdName(ObjectId id);
+const char * GetStatusCodeName(StatusCode code);
+
+/// @brief Id of the name, throws if the name is unknown.
+ObjectId ToObjectId(boost::string_view name);
+StatusCode ToStatusCode(boost::string_view name);
+
+/// @brief Parse in one pass without temporary strings.
+Guid ToGuid(boost::string_view str);
+NodeId ToNodeId(boost::string_view str, uint32_t defaultNamespace = 0);
+QualifiedName ToQualifiedName(boost::string_view str, uint32_t default_ns = 0);
+
+/// @brief Write the text of ToString without allocating. Returns the length
+/// of the whole text; only its first size characters are written and no
+/// terminating zero is added.
+std::size_t ToChars(const NodeId & id, char * buffer, std::size_t size);
+std::size_t ToChars(const QualifiedName & name, char * buffer, std::size_t size);
 
 inline std::ostream & operator<<(std::ostream & os, const OpcUa::AggregateFilter & value)
 {
@@ -169,6 +169,12 @@ public:
   {
   }
 
+  Variant(Variant && var) noexcept
+    : Value(std::move(var.Value))
+    , Dimensions(std::move(var.Dimensions))
+  {
+  }
+
   template <typename T>
   Variant(const T & value) : Value(value) {}
   Variant(const char * value) : Variant(std::string(value)) {}
@@ -185,6 +191,13 @@ public:
     return *this;
   }
 
+  Variant & operator= (Variant && variant) noexcept
+  {
+    this->Value = std::move(variant.Value);
+    this->Dimensions = std::move(variant.Dimensions);
+    return *this;
+  }
+
   template <typename T>
   Variant & operator=(const T & value)
   {
@@ -12,6 +12,7 @@
 #define __OPC_UA_BINARY_VIEW_H__
 
 #include <opc/ua/protocol/types.h>
+#include <opc/ua/protocol/types_manual.h>
 
 namespace OpcUa
 {
@@ -215,6 +216,123 @@ struct UnregisterNodesResponse
   UnregisterNodesResponse();
 };
 
+//---------------------------------------------------
+// QueryFirst
+//---------------------------------------------------
+
+struct QueryDataDescription
+{
+  RelativePath Path; // from the instance to the node of the attribute
+  AttributeId Attribute = AttributeId::Value;
+  std::string IndexRange;
+};
+
+struct NodeTypeDescription
+{
+  NodeId TypeDefinitionNode;
+  bool IncludeSubtypes = false;
+  std::vector<QueryDataDescription> DataToReturn;
+};
+
+struct QueryDataSet
+{
+  NodeId Node;
+  NodeId TypeDefinitionNode;
+  std::vector<Variant> Values; // one for every DataToReturn of the type
+};
+
+struct ContentFilterElementResult
+{
+  StatusCode Status = StatusCode::Good;
+  std::vector<StatusCode> OperandStatusCodes;
+  DiagnosticInfoList OperandDiagnosticInfos;
+};
+
+struct ContentFilterResult
+{
+  std::vector<ContentFilterElementResult> ElementResults;
+  DiagnosticInfoList ElementDiagnosticInfos;
+};
+
+struct ParsingResult
+{
+  StatusCode Status = StatusCode::Good;
+  std::vector<StatusCode> DataStatusCodes;
+  DiagnosticInfoList DataDiagnosticInfos;
+};
+
+struct QueryFirstParameters
+{
+  ViewDescription View;
+  std::vector<NodeTypeDescription> NodeTypes;
+  std::vector<ContentFilterElement> Filter;
+  uint32_t MaxDataSetsToReturn = 0; // 0 lets the server decide
+  uint32_t MaxReferencesToReturn = 0;
+};
+
+struct QueryFirstRequest
+{
+  NodeId TypeId;
+  RequestHeader Header;
+  QueryFirstParameters Parameters;
+
+  QueryFirstRequest();
+};
+
+struct QueryFirstResult
+{
+  StatusCode Status = StatusCode::Good; // returned as service result
+  std::vector<QueryDataSet> QueryDataSets;
+  std::vector<uint8_t> ContinuationPoint;
+  std::vector<ParsingResult> ParsingResults;
+  DiagnosticInfoList Diagnostics;
+  ContentFilterResult FilterResult;
+};
+
+struct QueryFirstResponse
+{
+  NodeId TypeId;
+  ResponseHeader Header;
+  QueryFirstResult Result;
+
+  QueryFirstResponse();
+};
+
+//---------------------------------------------------
+// QueryNext
+//---------------------------------------------------
+
+struct QueryNextParameters
+{
+  bool ReleaseContinuationPoint = false;
+  std::vector<uint8_t> ContinuationPoint;
+};
+
+struct QueryNextRequest
+{
+  NodeId TypeId;
+  RequestHeader Header;
+  QueryNextParameters Parameters;
+
+  QueryNextRequest();
+};
+
+struct QueryNextResult
+{
+  StatusCode Status = StatusCode::Good; // returned as service result
+  std::vector<QueryDataSet> QueryDataSets;
+  std::vector<uint8_t> RevisedContinuationPoint;
+};
+
+struct QueryNextResponse
+{
+  NodeId TypeId;
+  ResponseHeader Header;
+  QueryNextResult Result;
+
+  QueryNextResponse();
+};
+
 } // namespace OpcUa
 
 #endif // __OPC_UA_BINARY_VIEW_H__
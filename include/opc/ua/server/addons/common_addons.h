@@ -39,6 +39,11 @@ struct Parameters
   EndpointDescription Endpoint;
   unsigned ThreadsCount = 1;
   bool Debug = false;
+  /// @brief Periodically write request metrics in plain text to this file.
+  std::string MetricsDumpFile;
+  /// @brief Close connections of clients not reading their responses, see AsyncOpcTcp::Parameters.
+  std::size_t MaxSendQueueBytes = 64 * 1024 * 1024;
+  unsigned SendStallTimeout = 30;
 };
 
 /// @brief parameters of server.
@@ -59,6 +64,7 @@ Common::AddonInformation CreateOpcTcpAsyncAddon();
 Common::AddonInformation CreateServerObjectAddon();
 Common::AddonInformation CreateAsioAddon();
 Common::AddonInformation CreateSubscriptionServiceAddon();
+Common::AddonInformation CreateServiceMetricsAddon();
 
 
 }
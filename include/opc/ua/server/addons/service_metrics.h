@@ -0,0 +1,39 @@
+/// @brief Addon which collects request metrics and publishes them.
+/// Metrics are written to the ServerDiagnostics nodes of the address space and,
+/// if 'dump_file' parameter is set, to a plain text file.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#pragma once
+
+#include <opc/common/addons_core/addon.h>
+#include <opc/ua/server/service_metrics.h>
+
+namespace OpcUa
+{
+namespace Server
+{
+
+const char ServiceMetricsAddonId[] = "service_metrics";
+
+class ServiceMetricsAddon : public Common::Addon
+{
+public:
+  DEFINE_CLASS_POINTERS(ServiceMetricsAddon)
+
+public:
+  virtual ServiceMetrics::SharedPtr GetMetrics() const = 0;
+};
+
+class ServiceMetricsAddonFactory : public Common::AddonFactory
+{
+public:
+  Common::Addon::UniquePtr CreateAddon() override;
+};
+
+}
+}
@@ -17,6 +17,10 @@
 #include <opc/ua/services/view.h>
 #include <opc/ua/services/subscriptions.h>
 
+#include <chrono>
+#include <map>
+#include <memory>
+#include <vector>
 
 namespace OpcUa
 {
@@ -25,6 +29,86 @@ namespace Server
 
 typedef void DataChangeCallback(const NodeId & node, AttributeId attribute, DataValue);
 
+/// @brief New Value attribute of a node.
+struct ValueUpdate
+{
+  NodeId Node;
+  DataValue Value;
+
+  ValueUpdate() = default;
+  ValueUpdate(const NodeId & node, const DataValue & value)
+    : Node(node)
+    , Value(value)
+  {
+  }
+};
+
+/// @brief New Value attribute of a node given by AddressSpace::GetValueHandle.
+struct HandleValueUpdate
+{
+  uint32_t Handle = 0;
+  DataValue Value;
+
+  HandleValueUpdate() = default;
+  HandleValueUpdate(uint32_t handle, const DataValue & value)
+    : Handle(handle)
+    , Value(value)
+  {
+  }
+};
+
+/// @brief Binary encoding kept by the address space, shared by the responses which copy it.
+typedef std::shared_ptr<const std::vector<char>> EncodedData;
+
+/// @brief Value returned by AddressSpace::ReadEncoded.
+struct EncodedDataValue
+{
+  DataValue Value;
+  /// @brief Encoding of Value.Value kept by EnableEncodedValueCache, null if there is none.
+  EncodedData EncodedVariant;
+};
+
+/// @brief Result returned by AddressSpace::BrowseEncoded.
+struct EncodedBrowseResult
+{
+  BrowseResult Result;
+  /// @brief Encoding of the references of a cached result, null if there is none.
+  // Result.Referencies is left empty when it is set.
+  EncodedData EncodedReferences;
+};
+
+/// @brief Handle of a method call which completes asynchronously.
+class MethodCompletion
+{
+public:
+  DEFINE_CLASS_POINTERS(MethodCompletion)
+
+  virtual ~MethodCompletion() {}
+
+  /// @brief Finish the call, may be called from any thread.
+  // Only the first Complete or Fail of a call counts. A handle released
+  // without either fails the call with BadInternalError.
+  virtual void Complete(const std::vector<Variant> & outputArguments) = 0;
+  virtual void Fail(StatusCode status) = 0;
+};
+
+/// @brief Method which passes its result to the completion handle.
+typedef void AsyncMethod(NodeId context, std::vector<Variant> arguments, MethodCompletion::SharedPtr completion);
+
+struct MethodPoolParameters
+{
+  uint32_t ThreadsCount = 4;
+  /// @brief Calls waiting for a thread, further calls fail with BadTooManyOperations.
+  uint32_t QueueSize = 1024;
+  /// @brief Calls of one method node running at once, 0 is unlimited.
+  uint32_t MethodConcurrency = 0;
+  /// @brief MethodConcurrency of single method nodes.
+  std::map<NodeId, uint32_t> MethodConcurrencyLimits;
+  /// @brief Time from the request until a call fails with BadTimeout, 0 is none.
+  // A late result of a method which timed out is ignored.
+  std::chrono::milliseconds Timeout = std::chrono::milliseconds(0);
+};
+
 class AddressSpace
   : public ViewServices
   , public AttributeServices
@@ -39,7 +123,33 @@ public:
   virtual void DeleteDataChangeCallback(uint32_t clienthandle) = 0;
   virtual StatusCode SetValueCallback(const NodeId & node, AttributeId attribute, std::function<DataValue(void)> callback) = 0;
   virtual void SetMethod(const NodeId & node, std::function<std::vector<OpcUa::Variant> (NodeId context, std::vector<OpcUa::Variant> arguments)> callback) = 0;
+  virtual void SetAsyncMethod(const NodeId & node, std::function<AsyncMethod> callback) = 0;
+  /// @brief Run methods on a bounded thread pool instead of the thread of the request.
+  // Calls queued in a replaced pool fail with BadShutdown.
+  virtual void EnableMethodPool(const MethodPoolParameters & params) = 0;
   //FIXME : SHould we also expose SetValue and GetValue on server side? then we need to lock them ...
+
+  /// @brief Set Value attributes of many nodes at once.
+  // The address space is locked once and all values get the same server
+  // timestamp. Data change callbacks are called once all values are stored
+  // and only a shared lock is held, so readers are not blocked by them.
+  virtual std::vector<StatusCode> UpdateValues(const std::vector<ValueUpdate> & updates) = 0;
+  virtual std::vector<StatusCode> UpdateValues(const std::vector<HandleValueUpdate> & updates) = 0;
+  /// @brief Handle of a node which is valid for the lifetime of the address space.
+  // throws if the node does not exist
+  virtual uint32_t GetValueHandle(const NodeId & node) const = 0;
+
+  /// @brief Keep the binary encoding of the Value attribute of a node.
+  // The value is encoded once when it is set, Read responses of the binary
+  // protocol copy the encoded bytes instead of encoding it for every client.
+  // Worth it for values many clients read.
+  virtual StatusCode EnableEncodedValueCache(const NodeId & node, bool enable) = 0;
+  /// @brief Read which also returns the encodings kept by EnableEncodedValueCache.
+  virtual std::vector<EncodedDataValue> ReadEncoded(const ReadParameters & params) const = 0;
+  /// @brief Browse which returns cached results by the encodings of their references.
+  // Nodes of namespace 0 and type nodes are cached. The binary protocol
+  // copies the encodings instead of the ReferenceDescriptions.
+  virtual std::vector<EncodedBrowseResult> BrowseEncoded(const NodesQuery & query) const = 0;
 };
 
 AddressSpace::UniquePtr CreateAddressSpace(const Common::Logger::SharedPtr & logger);
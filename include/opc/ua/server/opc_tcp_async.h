@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <opc/ua/server/service_metrics.h>
 #include <opc/ua/services/services.h>
 #include <opc/common/interface.h>
 
@@ -38,6 +39,10 @@ public:
     std::string Host;
     unsigned Port = 4840;
     bool DebugMode = false;
+    /// @brief Close a connection when more response bytes wait to be written, 0 means no limit.
+    std::size_t MaxSendQueueBytes = 64 * 1024 * 1024;
+    /// @brief Close a connection when a write did not complete within this many seconds, 0 means no limit.
+    unsigned SendStallTimeout = 30;
   };
 
 public:
@@ -45,7 +50,8 @@ public:
   virtual void Shutdown() = 0;
 };
 
-AsyncOpcTcp::UniquePtr CreateAsyncOpcTcp(const AsyncOpcTcp::Parameters & params, Services::SharedPtr server, boost::asio::io_service & io, const Common::Logger::SharedPtr & logger);
+/// @param metrics optional request metrics updated by all connections.
+AsyncOpcTcp::UniquePtr CreateAsyncOpcTcp(const AsyncOpcTcp::Parameters & params, Services::SharedPtr server, boost::asio::io_service & io, const Common::Logger::SharedPtr & logger, ServiceMetrics::SharedPtr metrics = ServiceMetrics::SharedPtr());
 
 }
 }
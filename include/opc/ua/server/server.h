@@ -4,8 +4,11 @@
 #include <opc/common/addons_core/addon_manager.h>
 #include <opc/ua/event.h>
 #include <opc/ua/node.h>
+#include <opc/ua/server/address_space.h>
+#include <opc/ua/server/service_metrics.h>
 #include <opc/ua/server/services_registry.h>
 #include <opc/ua/server/subscription_service.h>
+#include <opc/ua/server/value_ingest.h>
 #include <opc/ua/services/services.h>
 #include <opc/ua/subscription.h>
 #include <opc/ua/server_operations.h>
@@ -35,6 +38,29 @@ public:
   void SetServerURI(const std::string & uri);
   void SetServerName(const std::string & name);
 
+  /// @brief periodically write request metrics in plain text to this file.
+  // must be called before Start()
+  void SetMetricsDumpFile(const std::string & path);
+
+  /// @brief close connections of clients which do not read their responses:
+  /// more than maxQueuedBytes waiting or a write pending for stallTimeout seconds, 0 disables a check.
+  // must be called before Start()
+  void SetSendLimits(std::size_t maxQueuedBytes, unsigned stallTimeout);
+
+  /// @brief number of threads initializing independent addons, see AddonsManager::SetStartupThreads.
+  // must be called before Start()
+  void SetStartupThreads(unsigned threads);
+
+  /// @brief time spent initializing every addon at Start()
+  std::vector<Common::AddonStartupTime> GetStartupTimes() const;
+
+  /// @brief write current request and subscription metrics in plain text
+  void DumpMetrics(std::ostream & os) const;
+
+  /// @brief write recent request history in Chrome trace JSON format
+  // empty unless built with OPCUA_TRACE_RING
+  void DumpTrace(std::ostream & os) const;
+
   /// @brief load xml addressspace. This is not implemented yet!!!
   void AddAddressSpace(const std::string & path);
 
@@ -74,6 +100,37 @@ public:
   Node GetNodeFromPath(const std::vector<QualifiedName> & path) const;
   Node GetNodeFromPath(const std::vector<std::string> & path) const;
 
+  /// @brief Set the Value attribute of many nodes at once
+  // much cheaper than Node::SetValue for every node: the address space is
+  // locked once, all values get the same server timestamp and subscriptions
+  // are notified once all values are stored
+  std::vector<StatusCode> UpdateValues(const std::vector<Server::ValueUpdate> & updates);
+
+  /// @brief Same as above with handles from GetValueHandle which skip the NodeId lookup
+  uint32_t GetValueHandle(const NodeId & nodeid) const;
+  std::vector<StatusCode> UpdateValues(const std::vector<Server::HandleValueUpdate> & updates);
+
+  /// @brief Encode the value of a variable once per change instead of once per reader
+  // for values which many clients read
+  void EnableEncodedValueCache(const NodeId & nodeid, bool enable = true);
+
+  /// @brief Create queues for threads which must never block on the address space
+  // producers queue values by handle, a separate thread stores them in bulk.
+  // the ingest must be destroyed before the server is stopped
+  Server::ValueIngest::UniquePtr CreateValueIngest(const Server::IngestParameters & params = Server::IngestParameters());
+
+  /// @brief Run methods of Call requests on a bounded thread pool
+  // the Call response is sent once all methods of the request completed.
+  // without a pool methods run on the thread which received the request
+  void EnableMethodPool(const Server::MethodPoolParameters & params = Server::MethodPoolParameters());
+
+  /// @brief Set a method which completes through its completion handle, possibly from another thread
+  void SetAsyncMethod(const NodeId & node, std::function<Server::AsyncMethod> method);
+
+  /// @brief Set how subscriptions created afterwards publish
+  // in low latency mode changes are sent as soon as a publish request is available
+  void SetPublishParameters(const Server::PublishParameters & params);
+
   /// @brief Trigger and event
   // Event will be send from Server node.
   // It is possible to send events from arbitrarily nodes but it looks like
@@ -95,6 +152,10 @@ protected:
   std::string ServerUri = "urn:freeopcua:server";
   std::string ProductUri = "urn:freeopcua.github.no:server";
   std::string Name = "FreeOpcUa Server";
+  std::string MetricsDumpFile;
+  std::size_t MaxSendQueueBytes = 64 * 1024 * 1024;
+  unsigned SendStallTimeout = 30;
+  unsigned StartupThreads = 0;
   Common::Logger::SharedPtr Logger;
   bool LoadCppAddressSpace = true;
   OpcUa::MessageSecurityMode SecurityMode = OpcUa::MessageSecurityMode::None;
@@ -102,7 +163,9 @@ protected:
 
   Common::AddonsManager::SharedPtr Addons;
   Server::ServicesRegistry::SharedPtr Registry;
+  Server::AddressSpace::SharedPtr AddressSpace;
   Server::SubscriptionService::SharedPtr SubscriptionService;
+  Server::ServiceMetrics::SharedPtr Metrics;
 };
 
 }
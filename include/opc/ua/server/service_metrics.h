@@ -0,0 +1,165 @@
+/// @brief Per service request metrics of the binary protocol server.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#pragma once
+
+#include <opc/common/class_pointers.h>
+#include <opc/ua/protocol/message_identifiers.h>
+#include <opc/ua/protocol/status_codes.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace OpcUa
+{
+namespace Server
+{
+
+struct SubscriptionDiagnostics;
+
+/// @brief Lock free log-linear latency histogram.
+/// Every power of two range is split into 8 linear sub buckets, so a recorded
+/// value is reported with at most 12.5% error. Values are nanoseconds.
+class LatencyHistogram
+{
+public:
+  LatencyHistogram();
+
+  LatencyHistogram(const LatencyHistogram &) = delete;
+  LatencyHistogram & operator=(const LatencyHistogram &) = delete;
+
+  void Record(uint64_t value);
+
+  uint64_t Count() const;
+  uint64_t Sum() const;
+  uint64_t Max() const;
+  /// @brief Upper bound of the bucket holding the value at percentile p (0 < p <= 1).
+  uint64_t Percentile(double p) const;
+
+  static std::size_t GetBucketIndex(uint64_t value);
+  static uint64_t GetBucketUpperBound(std::size_t index);
+
+public:
+  static const std::size_t BucketCount = 16 + 60 * 8;
+
+private:
+  std::atomic<uint64_t> Buckets[BucketCount];
+  std::atomic<uint64_t> Total;
+  std::atomic<uint64_t> Maximum;
+};
+
+/// @brief Counters of one service type.
+struct ServiceCounters
+{
+  ServiceCounters(OpcUa::MessageId id, const std::string & name);
+
+  const OpcUa::MessageId Id;
+  const std::string Name;
+
+  std::atomic<uint64_t> Requests;
+  std::atomic<uint64_t> Errors;
+  std::atomic<uint64_t> BytesIn;
+  std::atomic<uint64_t> BytesOut;
+
+  LatencyHistogram DecodeTime;
+  LatencyHistogram ServiceTime;
+  LatencyHistogram EncodeTime;
+};
+
+/// @brief Server wide request metrics.
+/// Counters are updated with relaxed atomics from the connection threads and
+/// can be read at any time from any thread.
+class ServiceMetrics
+{
+public:
+  DEFINE_CLASS_POINTERS(ServiceMetrics)
+
+public:
+  ServiceMetrics();
+
+  /// @brief Counters for request type; unknown requests share one entry.
+  ServiceCounters & GetCounters(OpcUa::MessageId requestId);
+  void ForEachService(const std::function<void(const ServiceCounters &)> & callback) const;
+
+  void SessionCreated();
+  void SessionClosed();
+  void SubscriptionCreated();
+  void SubscriptionsDeleted(uint32_t count);
+  void RequestRejected();
+
+  uint32_t GetCurrentSessionCount() const;
+  uint32_t GetCumulatedSessionCount() const;
+  uint32_t GetCurrentSubscriptionCount() const;
+  uint32_t GetCumulatedSubscriptionCount() const;
+  uint32_t GetRejectedRequestsCount() const;
+
+  /// @brief Write all metrics in plain text, one 'name{labels} value' per line.
+  void Dump(std::ostream & os) const;
+
+private:
+  std::vector<std::unique_ptr<ServiceCounters>> Services;
+  std::unique_ptr<ServiceCounters> Unsupported;
+
+  std::atomic<uint32_t> CurrentSessions;
+  std::atomic<uint32_t> CumulatedSessions;
+  std::atomic<uint32_t> CurrentSubscriptions;
+  std::atomic<uint32_t> CumulatedSubscriptions;
+  std::atomic<uint32_t> RejectedRequests;
+};
+
+/// @brief Measures phases of one request.
+/// Created when request processing starts. Decoded(), Serviced() and Sent()
+/// mark the end of each phase; a request destroyed before Sent() or
+/// Completed() is counted as an error. A null metrics pointer disables it.
+/// Phases are also recorded in the trace ring if it is compiled in.
+class RequestMetrics
+{
+public:
+  typedef std::chrono::steady_clock Clock;
+
+  RequestMetrics(ServiceMetrics * metrics, std::size_t bytesIn);
+  ~RequestMetrics();
+
+  RequestMetrics(const RequestMetrics &) = delete;
+  RequestMetrics & operator=(const RequestMetrics &) = delete;
+
+  void SetService(OpcUa::MessageId requestId, uint32_t connectionId = 0, uint32_t requestHandle = 0);
+  void Decoded();
+  void Serviced(OpcUa::StatusCode serviceResult);
+  void Sent(std::size_t bytesOut);
+  /// @brief Request finished without a response, Publish answers later.
+  void Completed();
+
+private:
+  ServiceMetrics * Metrics;
+  ServiceCounters * Counters = nullptr;
+  OpcUa::MessageId Service = OpcUa::INVALID;
+  uint32_t ConnectionId = 0;
+  uint32_t RequestHandle = 0;
+  std::size_t BytesIn;
+  Clock::time_point Start;
+  Clock::time_point Mark;
+  bool Failed = false;
+  bool Started = false;
+  bool Done = false;
+};
+
+/// @brief Short name of a service, "Unsupported" for unknown request ids.
+const char * GetServiceName(OpcUa::MessageId requestId);
+
+/// @brief Write subscription counters in the format of ServiceMetrics::Dump().
+void DumpSubscriptionDiagnostics(std::ostream & os, const std::vector<SubscriptionDiagnostics> & subscriptions);
+
+} // namespace Server
+} // namespace OpcUa
@@ -14,17 +14,87 @@
 #include <opc/ua/server/address_space.h>
 #include <opc/ua/services/subscriptions.h>
 
+#include <chrono>
+
 namespace OpcUa
 {
 namespace Server
 {
 
+/// @brief Snapshot of the counters of one subscription.
+/// Field names follow SubscriptionDiagnosticsDataType where an equivalent exists.
+struct SubscriptionDiagnostics
+{
+  NodeId SessionId;
+  uint32_t SubscriptionId = 0;
+  double PublishingInterval = 0;
+  uint32_t MaxKeepAliveCount = 0;
+  uint32_t MaxLifetimeCount = 0;
+  uint32_t PublishRequestCount = 0;           // publish requests consumed by the subscription
+  uint32_t RepublishRequestCount = 0;
+  uint32_t DataChangeNotificationsCount = 0;  // data change notifications sent
+  uint32_t EventNotificationsCount = 0;       // event notifications sent
+  uint32_t NotificationsCount = 0;            // notification messages sent
+  uint32_t KeepAliveCount = 0;                // keep-alive messages sent
+  uint32_t LatePublishRequestCount = 0;       // publishing cycles which found no publish request
+  uint32_t CurrentKeepAliveCount = 0;
+  uint32_t UnacknowledgedMessageCount = 0;    // depth of the retransmission queue
+  uint32_t QueuedNotificationsCount = 0;      // notifications waiting for the next publish
+  uint32_t DiscardedNotificationsCount = 0;   // queued notifications dropped with their monitored item or by the slow consumer policy
+  uint32_t MonitoredItemCount = 0;
+  uint32_t MonitoringQueueOverflowCount = 0;  // data changes coalesced within one publishing cycle
+};
+
+/// @brief Handling of notifications a session does not fetch fast enough.
+enum class SlowConsumerPolicy
+{
+  DropOldest,      // discard the oldest queued notifications
+  CoalesceLatest,  // keep only the latest value of every monitored item, then drop oldest events
+  CloseSession,    // terminate the subscription and close the session
+};
+
+/// @brief Publishing behaviour of subscriptions.
+struct PublishParameters
+{
+  /// @brief Send a notification message as soon as a change is queued and a publish
+  /// request of the session is available, instead of at the next publishing interval.
+  bool LowLatency = false;
+  /// @brief Minimum time between two notification messages of a subscription in low latency mode.
+  std::chrono::milliseconds MinPublishSpacing = std::chrono::milliseconds(2);
+  /// @brief Publish requests queued per session, further ones are answered with BadTooManyPublishRequests.
+  /// Also bounds the notification messages kept per subscription for republishing.
+  uint32_t MaxPublishRequests = 100;
+  /// @brief Encoded size of the notifications a subscription queues between two publishes, 0 for no limit.
+  std::size_t MaxQueuedNotificationBytes = 0;
+  SlowConsumerPolicy Policy = SlowConsumerPolicy::DropOldest;
+};
+
 class SubscriptionService : public SubscriptionServices
 {
 public:
   DEFINE_CLASS_POINTERS(SubscriptionService)
 
   virtual void TriggerEvent(NodeId node, Event event) = 0;
+
+  /// @brief Counters of all subscriptions. Does not block the publishing path.
+  virtual std::vector<SubscriptionDiagnostics> GetSubscriptionDiagnostics() const = 0;
+
+  /// @brief Applies to subscriptions created afterwards, the publish request limit at once.
+  virtual void SetPublishParameters(const PublishParameters & params) = 0;
+  virtual PublishParameters GetPublishParameters() const = 0;
+
+  /// @brief Forgets the publish requests queued for a session, e.g. when its secure channel is gone.
+  virtual void DropPublishRequests(const NodeId & session) = 0;
+
+  /// @brief Diagnostics of the subscriptions of a registered session report its SessionId,
+  /// the authentication token identifying the session in requests is secret.
+  virtual void RegisterSession(const NodeId & authenticationToken, const NodeId & sessionId) = 0;
+  virtual void UnregisterSession(const NodeId & authenticationToken) = 0;
+
+  /// @brief Called on the io_service with the authentication token of a session
+  /// which SlowConsumerPolicy::CloseSession terminated, after its status change was sent if possible.
+  typedef std::function<void (const NodeId & session)> SessionTerminationHandler;
+  virtual void SetSessionTerminationHandler(SessionTerminationHandler handler) = 0;
 };
 
   SubscriptionService::UniquePtr CreateSubscriptionService(std::shared_ptr<AddressSpace> addressspace, boost::asio::io_service & io, const Common::Logger::SharedPtr & logger);
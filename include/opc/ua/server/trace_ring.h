@@ -0,0 +1,71 @@
+/// @brief Per thread ring buffers of binary hot path events.
+/// Every thread records into its own fixed size ring without locking, a new
+/// thread reuses the ring of an exited one; the recent history of all threads
+/// can be exported as Chrome trace JSON (chrome://tracing,
+/// https://ui.perfetto.dev) at any time.
+/// Recording is compiled in only when OPCUA_TRACE_RING is defined.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+namespace OpcUa
+{
+namespace Server
+{
+
+enum class TracePhase : uint8_t
+{
+  RequestBegin = 0,
+  RequestDecoded,
+  RequestServiced,
+  RequestEnd,
+  RequestDeferred,   // request completed without response, e.g. Publish
+  RequestAborted,    // request processing failed
+  PublishCycle,      // subscription sent a notification message
+  PublishLate,       // subscription had data but no publish request
+  PublishSent,       // publish response written to the connection
+  ConnectionOpened,
+  ConnectionClosed,
+};
+
+struct TraceEvent
+{
+  uint64_t Timestamp;      // steady clock, nanoseconds
+  uint32_t ConnectionId;
+  uint32_t RequestHandle;  // subscription id for PublishCycle and PublishLate
+  uint16_t ServiceId;      // OpcUa::MessageId of the request
+  TracePhase Phase;
+  uint32_t ThreadIndex;
+};
+
+/// @brief Number of slots per thread; the slot next to be written is never read.
+const std::size_t TraceRingSize = 4096;
+
+/// @brief Record an event in the ring of the calling thread. Use OPCUA_TRACE.
+void RecordTraceEvent(uint32_t connectionId, uint32_t requestHandle, uint16_t serviceId, TracePhase phase);
+
+/// @brief Copy recent events of all threads ordered by time.
+std::vector<TraceEvent> GetTraceEvents();
+
+/// @brief Write events in Chrome trace event format.
+void WriteChromeTrace(std::ostream & os, const std::vector<TraceEvent> & events);
+void WriteChromeTrace(std::ostream & os);
+
+} // namespace Server
+} // namespace OpcUa
+
+#ifdef OPCUA_TRACE_RING
+#define OPCUA_TRACE(connectionId, requestHandle, serviceId, phase) \
+  ::OpcUa::Server::RecordTraceEvent(connectionId, requestHandle, static_cast<uint16_t>(serviceId), ::OpcUa::Server::TracePhase::phase)
+#else
+#define OPCUA_TRACE(connectionId, requestHandle, serviceId, phase) do {} while (false)
+#endif
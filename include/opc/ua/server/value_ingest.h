@@ -0,0 +1,92 @@
+/// @brief Queues of values from producer threads into the address space.
+/// Every producer thread owns a bounded single producer single consumer
+/// queue, so queuing a value never takes a lock and never waits for the
+/// address space or for subscriptions. One applier thread drains all queues
+/// and stores the values with AddressSpace::UpdateValues.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#pragma once
+
+#include <opc/common/class_pointers.h>
+#include <opc/ua/server/address_space.h>
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+
+namespace OpcUa
+{
+namespace Server
+{
+
+struct IngestParameters
+{
+  /// @brief Values a producer queue can hold, rounded up to a power of two.
+  uint32_t QueueCapacity = 4096;
+  /// @brief Longest time the applier sleeps while all queues are empty.
+  std::chrono::milliseconds IdleInterval = std::chrono::milliseconds(1);
+  /// @brief Store every queued value instead of the last value of a node
+  /// per drain cycle. Needed when monitored items queue more than one value.
+  bool KeepAll = false;
+};
+
+/// @brief Counters of a ValueIngest.
+struct IngestStatistics
+{
+  uint64_t QueuedCount = 0;    // values accepted by producer queues
+  uint64_t DroppedCount = 0;   // values not queued because a queue was full
+  uint64_t AppliedCount = 0;   // values stored in the address space
+  uint64_t CoalescedCount = 0; // values replaced by a later value of the same node
+  uint64_t RejectedCount = 0;  // values the address space did not accept
+  uint64_t DrainCount = 0;     // drain cycles which found values
+  uint32_t QueueDepth = 0;     // values waiting in all queues
+  uint32_t ProducerCount = 0;
+};
+
+/// @brief Queue of one producer thread.
+class IngestProducer
+{
+public:
+  DEFINE_CLASS_POINTERS(IngestProducer)
+
+  virtual ~IngestProducer() {}
+
+  /// @brief Queue a new Value attribute of a node without blocking.
+  /// Must be called by one thread at a time.
+  /// @param handle handle of the node from AddressSpace::GetValueHandle.
+  /// @return false if the queue is full and the value was dropped.
+  virtual bool Push(uint32_t handle, const DataValue & value) = 0;
+};
+
+class ValueIngest
+{
+public:
+  DEFINE_CLASS_POINTERS(ValueIngest)
+
+  virtual ~ValueIngest() {}
+
+  /// @brief Queue for a new producer thread.
+  // The queue is drained until the producer releases it.
+  virtual IngestProducer::SharedPtr CreateProducer() = 0;
+
+  virtual IngestStatistics GetStatistics() const = 0;
+
+  /// @brief Store all queued values and stop the applier thread.
+  // Values queued afterwards are dropped. Called by the destructor.
+  virtual void Stop() = 0;
+};
+
+/// @brief Start the applier thread of a new ingest.
+// The address space must outlive the ingest.
+ValueIngest::UniquePtr CreateValueIngest(AddressSpace & addressSpace, const IngestParameters & params = IngestParameters());
+
+/// @brief Write ingest counters in the format of ServiceMetrics::Dump().
+void DumpIngestStatistics(std::ostream & os, const IngestStatistics & statistics);
+
+} // namespace Server
+} // namespace OpcUa
@@ -21,6 +21,9 @@
 namespace OpcUa
 {
 
+/// @brief Receives the results of a Call, one per requested method.
+typedef void CallCompletion(std::vector<CallMethodResult> results);
+
 class MethodServices : private Common::Interface
 {
 public:
@@ -29,6 +32,14 @@ public:
 public:
   virtual std::vector<CallMethodResult> Call(const std::vector<CallMethodRequest> & methodsToCall) = 0;
   virtual void SetMethod(const NodeId & node, std::function<std::vector<OpcUa::Variant> (NodeId context, std::vector<OpcUa::Variant> arguments)> callback) = 0;
+
+  /// @brief Call methods without waiting for them.
+  // done may be called before CallAsync returns or later from another thread.
+  // By default the methods are called synchronously.
+  virtual void CallAsync(const std::vector<CallMethodRequest> & methodsToCall, std::function<CallCompletion> done)
+  {
+    done(Call(methodsToCall));
+  }
 };
 
 } // namespace OpcUa
@@ -31,6 +31,8 @@ public:
   virtual std::vector<StatusCode> DeleteSubscriptions(const std::vector<uint32_t> & subscriptions) = 0;
   virtual void Publish(const PublishRequest & request) = 0;
   virtual RepublishResponse Republish(const RepublishParameters & params) = 0;
+  /// @brief Moves subscriptions to the session of the request, their results are passed to the callback afterwards.
+  virtual std::vector<TransferResult> TransferSubscriptions(const TransferSubscriptionsRequest & request, std::function<void (PublishResult)> callbackPublish) = 0;
 
   //FIXME: Spec says MonitoredItems methods should be in their own service
   virtual std::vector<MonitoredItemCreateResult> CreateMonitoredItems(const MonitoredItemsParameters & parameters) = 0;
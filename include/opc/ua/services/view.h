@@ -32,6 +32,9 @@ public:
   virtual std::vector<BrowsePathResult> TranslateBrowsePathsToNodeIds(const TranslateBrowsePathsParameters & params) const = 0;
   virtual std::vector<NodeId> RegisterNodes(const std::vector<NodeId> & params) const = 0;
   virtual void UnregisterNodes(const std::vector<NodeId> & params) const = 0;
+  /// @brief Find instances of types whose attributes match a filter.
+  virtual QueryFirstResult QueryFirst(const QueryFirstParameters & params) const = 0;
+  virtual QueryNextResult QueryNext(const QueryNextParameters & params) const = 0;
 };
 
 } // namespace OpcUa
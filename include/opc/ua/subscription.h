@@ -25,9 +25,11 @@
 #include <opc/ua/event.h>
 #include <opc/ua/services/subscriptions.h>
 
+#include <atomic>
 #include <sstream>
 #include <map>
 #include <mutex>
+#include <vector>
 
 #include <iostream> //debug
 
@@ -47,6 +49,15 @@ struct MonitoredItemData
   UserData * usrVar;
 };
 
+// One data change of a publish response
+struct DataChangeItem
+{
+  uint32_t Handle;
+  Node TargetNode;
+  const DataValue * Value; // valid during the callback only
+  AttributeId Attribute;
+};
+
 typedef std::map<uint32_t, MonitoredItemData> AttValMap;
 typedef std::map<uint32_t, EventFilter> SimpleAttOpMap;
 
@@ -72,6 +83,16 @@ public:
     OPCUA_UNUSED(val);
     OPCUA_UNUSED(attribute);
   }
+  //Called once per publish response with all its datachange events
+  //The default implementation calls DataValueChange() and DataChange() for each of them
+  virtual void DataChanges(const std::vector<DataChangeItem> & changes)
+  {
+    for (const DataChangeItem & change : changes)
+      {
+        DataValueChange(change.Handle, change.TargetNode, *change.Value, change.Attribute);
+        DataChange(change.Handle, change.TargetNode, change.Value->Value, change.Attribute);
+      }
+  }
   //Called for every events receive from server
   virtual void Event(uint32_t handle, const Event & event)
   {
@@ -141,19 +162,34 @@ public:
   //SequenceNumber are send by server in PublishResult struct
   RepublishResponse Republish(uint32_t sequenceNumber);
 
+  //Sequence number of the last notification message received, 0 before the first one
+  uint32_t GetLastSequenceNumber() const { return LastSequenceNumber; }
 
+  //Called by UaClient after it restored a lost connection
+  //The subscription still exists on the server: the notification messages missed meanwhile
+  //are requested with Republish() from availableSequenceNumbers before publishing continues
+  void Resume(const std::vector<uint32_t> & availableSequenceNumbers);
+  //The server lost the subscription: it is created again with its data change and event items
+  //in CreateMonitoredItems requests of at most maxItemsPerRequest items
+  //Handles passed to the SubscriptionHandler and to UnSubscribe() stay the same
+  //Items created with Subscribe() are not restored
+  void Recreate(uint32_t maxItemsPerRequest);
 
 private:
+  void CallCallbacks(const NotificationMessage & message);
   void CallDataChangeCallback(const NotificationData & data);
   void CallEventCallback(const NotificationData & data);
   void CallStatusChangeCallback(const NotificationData & data);
 
   Services::SharedPtr Server;
+  CreateSubscriptionParameters Parameters;
   SubscriptionData Data;
   SubscriptionHandler & Client;
   uint32_t LastMonitoredItemHandle = 1;
+  std::atomic<uint32_t> LastSequenceNumber;
   AttValMap AttributeValueMap;
-  SimpleAttOpMap SimpleAttributeOperandMap; //Not used currently
+  SimpleAttOpMap SimpleAttributeOperandMap; //Filters of event items, used to create them again
+  std::map<uint32_t, uint32_t> ServerItemIds; //MonitoredItemId known to the application -> id of the recreated item
   std::mutex Mutex;
   Common::Logger::SharedPtr Logger;
 };
@@ -4,6 +4,7 @@ from distutils.core import setup, Extension
 import sys
 import os
 import platform
+import ctypes.util
 
 opcua_server_path = os.environ.get('OPCUA_Server_PATH','..')
 
@@ -28,6 +29,7 @@ library_dirs = [
 ]
 
 boost_library='boost_python3' if sys.version_info[0] == 3 and platform.dist()[0] == 'fedora' else 'boost_python'
+boost_numpy_library='boost_numpy3' if sys.version_info[0] == 3 and platform.dist()[0] == 'fedora' else 'boost_numpy'
 
 libraries = [
   boost_library,
@@ -35,6 +37,13 @@ libraries = [
   'opcuaserver',
 ]
 
+define_macros = []
+
+# Boost.NumPy is optional: without it read_values returns lists instead of numpy arrays
+if ctypes.util.find_library(boost_numpy_library):
+  libraries.append(boost_numpy_library)
+  define_macros.append(('HAVE_BOOST_NUMPY', None))
+
 if sys.version_info[0] == 2: name='python-freeopcua'
 else: name='python{}-freeopcua'.format(sys.version_info.major)
 
@@ -57,6 +66,7 @@ setup(name=name,
         'src/py_opcua_subscriptionclient.cpp',
       ],
       include_dirs = include_dirs,
+      define_macros = define_macros,
       extra_compile_args = extra_compile_args,
       extra_link_args = extra_link_args,
       library_dirs = library_dirs,
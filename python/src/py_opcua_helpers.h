@@ -11,6 +11,7 @@
 #pragma once
 
 #include <vector>
+#include <boost/noncopyable.hpp>
 #include <boost/python.hpp>
 
 using namespace boost::python;
@@ -98,3 +99,51 @@ struct vector_from_python_converter
 
 };
 
+//
+// GIL release around blocking calls
+//
+
+// python objects must not be used while the GIL is released,
+// arguments are converted before and results after
+class ScopedGILRelease : private boost::noncopyable
+{
+public:
+  ScopedGILRelease()
+    : State(PyEval_SaveThread())
+  {
+  }
+
+  ~ScopedGILRelease()
+  {
+    PyEval_RestoreThread(State);
+  }
+
+private:
+  PyThreadState * State;
+};
+
+template <typename Signature, Signature Method>
+struct WithoutGIL;
+
+template <typename Result, typename Class, typename... Args, Result(Class::*Method)(Args...) const>
+struct WithoutGIL<Result(Class::*)(Args...) const, Method>
+{
+  static Result Call(const Class & self, Args... args)
+  {
+    ScopedGILRelease release;
+    return (self.*Method)(args...);
+  }
+};
+
+template <typename Result, typename Class, typename... Args, Result(Class::*Method)(Args...)>
+struct WithoutGIL<Result(Class::*)(Args...), Method>
+{
+  static Result Call(Class & self, Args... args)
+  {
+    ScopedGILRelease release;
+    return (self.*Method)(args...);
+  }
+};
+
+// member function called with the GIL released, SIGNATURE selects an overload
+#define RELEASE_GIL(SIGNATURE, METHOD) &WithoutGIL<SIGNATURE, METHOD>::Call
@@ -43,7 +43,6 @@ using namespace OpcUa;
 //--------------------------------------------------------------------------
 
 BOOST_PYTHON_FUNCTION_OVERLOADS(DateTimeFromTimeT_stub, DateTime::FromTimeT, 1, 2);
-BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(SubscriptionSubscribeDataChange_stubs, Subscription::SubscribeDataChange, 1, 2);
 //BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(NodeGetBrowseName_stubs, Node::GetBrowseName, 0, 1);
 
 
@@ -236,7 +235,88 @@ static void DataValue_set_server_picoseconds(DataValue & self, uint16_t ps)
 //
 
 static void Node_SetValue(Node & self, const object & obj, VariantType vtype)
-{ self.SetValue(ToVariant2(obj, vtype)); }
+{
+  const Variant value = ToVariant2(obj, vtype);
+  ScopedGILRelease release;
+  self.SetValue(value);
+}
+
+//--------------------------------------------------------------------------
+// Bulk helpers
+//--------------------------------------------------------------------------
+
+// values of all nodes with one Read request, numeric arrays as numpy arrays when built with Boost.NumPy
+static list ReadValues(const Services::SharedPtr & services, const std::vector<Node> & nodes)
+{
+  ReadParameters params;
+  params.AttributesToRead.reserve(nodes.size());
+
+  for (const Node & node : nodes)
+    {
+      ReadValueId id;
+      id.NodeId = node.GetId();
+      id.AttributeId = AttributeId::Value;
+      params.AttributesToRead.push_back(id);
+    }
+
+  std::vector<DataValue> values;
+
+  {
+    ScopedGILRelease release;
+    values = services->Attributes()->Read(params);
+  }
+
+  list result;
+
+  for (DataValue & value : values)
+    {
+      result.append(ToArrayObject(std::move(value.Value)));
+    }
+
+  return result;
+}
+
+// values of all nodes with one Write request, numeric buffers are copied at once
+static list WriteValues(const Services::SharedPtr & services, const std::vector<Node> & nodes, const object & values)
+{
+  if (len(values) != static_cast<ssize_t>(nodes.size()))
+    {
+      throw std::invalid_argument("number of values differs from number of nodes");
+    }
+
+  std::vector<WriteValue> params;
+  params.reserve(nodes.size());
+
+  for (std::size_t i = 0; i < nodes.size(); ++i)
+    {
+      WriteValue value;
+      value.NodeId = nodes[i].GetId();
+      value.AttributeId = AttributeId::Value;
+      value.Value = DataValue(ToVariant(values[i]));
+      params.push_back(value);
+    }
+
+  std::vector<StatusCode> statuses;
+
+  {
+    ScopedGILRelease release;
+    statuses = services->Attributes()->Write(params);
+  }
+
+  return ToList(statuses);
+}
+
+template <typename Owner>
+static list Owner_ReadValues(const Owner & self, const std::vector<Node> & nodes)
+{
+  return ReadValues(self.GetRootNode().GetServices(), nodes);
+}
+
+template <typename Owner>
+static list Owner_WriteValues(const Owner & self, const std::vector<Node> & nodes, const object & values)
+{
+  return WriteValues(self.GetRootNode().GetServices(), nodes, values);
+}
 
 //--------------------------------------------------------------------------
 // UaClient helpers
@@ -244,6 +324,7 @@ static void Node_SetValue(Node & self, const object & obj, VariantType vtype)
 
 static std::shared_ptr<Subscription> UaClient_CreateSubscription(UaClient & self, uint period, PySubscriptionHandler & callback)
 {
+  ScopedGILRelease release;
   return self.CreateSubscription(period, callback);
 }
 
@@ -258,6 +339,7 @@ static Node UaClient_GetNode(UaClient & self, ObjectId objectid)
 
 static std::shared_ptr<Subscription> UaServer_CreateSubscription(UaServer & self, uint period, PySubscriptionHandler & callback)
 {
+  ScopedGILRelease release;
   return self.CreateSubscription(period, callback);
 }
 
@@ -281,6 +363,13 @@ BOOST_PYTHON_MODULE(opcua)
 
   py_opcua_enums();
 
+  // read_values and batch delivery return numpy arrays only with Boost.NumPy
+#ifdef HAVE_BOOST_NUMPY
+  scope().attr("has_numpy") = true;
+#else
+  scope().attr("has_numpy") = false;
+#endif
+
   DateTimePythonToOpcUaConverter();
   PythonStringToLocalizedTextConverter();
   to_python_converter<LocalizedText, LocalizedTextToPythonConverter>();
@@ -436,30 +525,30 @@ BOOST_PYTHON_MODULE(opcua)
   class_<Node>("Node", init<Services::SharedPtr, NodeId>())
   .def(init<Node>())
   .def("get_id", &Node::GetId)
-  .def("get_attribute", &Node::GetAttribute)
-  .def("set_attribute", &Node::SetAttribute)
-  .def("get_value", &Node::GetValue)
-  .def("set_value", (void(Node::*)(const DataValue &) const) &Node::SetValue)
-  .def("set_value", (void(Node::*)(const Variant &) const) &Node::SetValue)
+  .def("get_attribute", RELEASE_GIL(decltype(&Node::GetAttribute), &Node::GetAttribute))
+  .def("set_attribute", RELEASE_GIL(decltype(&Node::SetAttribute), &Node::SetAttribute))
+  .def("get_value", RELEASE_GIL(decltype(&Node::GetValue), &Node::GetValue))
+  .def("set_value", RELEASE_GIL(void(Node::*)(const DataValue &) const, &Node::SetValue))
+  .def("set_value", RELEASE_GIL(void(Node::*)(const Variant &) const, &Node::SetValue))
   .def("set_value", &Node_SetValue)
-  .def("get_properties", &Node::GetProperties)
-  .def("get_variables", &Node::GetVariables)
-  .def("get_browse_name", &Node::GetBrowseName)
-  .def("get_children", (std::vector<Node> (Node::*)() const) &Node::GetChildren)
-  .def("get_child", (Node(Node::*)(const std::vector<std::string> &) const) &Node::GetChild)
-  .def("get_child", (Node(Node::*)(const std::string &) const) &Node::GetChild)
-  .def("add_folder", (Node(Node::*)(const NodeId &, const QualifiedName &) const) &Node::AddFolder)
-  .def("add_folder", (Node(Node::*)(const std::string &, const std::string &) const) &Node::AddFolder)
-  .def("add_folder", (Node(Node::*)(uint32_t, const std::string &) const) &Node::AddFolder)
-  .def("add_object", (Node(Node::*)(const NodeId &, const QualifiedName &) const) &Node::AddObject)
-  .def("add_object", (Node(Node::*)(const std::string &, const std::string &) const) &Node::AddObject)
-  .def("add_object", (Node(Node::*)(uint32_t, const std::string &) const) &Node::AddObject)
-  .def("add_variable", (Node(Node::*)(const NodeId &, const QualifiedName &, const Variant &) const) &Node::AddVariable)
-  .def("add_variable", (Node(Node::*)(const std::string &, const std::string &, const Variant &) const) &Node::AddVariable)
-  .def("add_variable", (Node(Node::*)(uint32_t, const std::string &, const Variant &) const) &Node::AddVariable)
-  .def("add_property", (Node(Node::*)(const NodeId &, const QualifiedName &, const Variant &) const) &Node::AddProperty)
-  .def("add_property", (Node(Node::*)(const std::string &, const std::string &, const Variant &) const) &Node::AddProperty)
-  .def("add_property", (Node(Node::*)(uint32_t, const std::string &, const Variant &) const) &Node::AddProperty)
+  .def("get_properties", RELEASE_GIL(decltype(&Node::GetProperties), &Node::GetProperties))
+  .def("get_variables", RELEASE_GIL(decltype(&Node::GetVariables), &Node::GetVariables))
+  .def("get_browse_name", RELEASE_GIL(decltype(&Node::GetBrowseName), &Node::GetBrowseName))
+  .def("get_children", RELEASE_GIL(std::vector<Node> (Node::*)() const, &Node::GetChildren))
+  .def("get_child", RELEASE_GIL(Node(Node::*)(const std::vector<std::string> &) const, &Node::GetChild))
+  .def("get_child", RELEASE_GIL(Node(Node::*)(const std::string &) const, &Node::GetChild))
+  .def("add_folder", RELEASE_GIL(Node(Node::*)(const NodeId &, const QualifiedName &) const, &Node::AddFolder))
+  .def("add_folder", RELEASE_GIL(Node(Node::*)(const std::string &, const std::string &) const, &Node::AddFolder))
+  .def("add_folder", RELEASE_GIL(Node(Node::*)(uint32_t, const std::string &) const, &Node::AddFolder))
+  .def("add_object", RELEASE_GIL(Node(Node::*)(const NodeId &, const QualifiedName &) const, &Node::AddObject))
+  .def("add_object", RELEASE_GIL(Node(Node::*)(const std::string &, const std::string &) const, &Node::AddObject))
+  .def("add_object", RELEASE_GIL(Node(Node::*)(uint32_t, const std::string &) const, &Node::AddObject))
+  .def("add_variable", RELEASE_GIL(Node(Node::*)(const NodeId &, const QualifiedName &, const Variant &) const, &Node::AddVariable))
+  .def("add_variable", RELEASE_GIL(Node(Node::*)(const std::string &, const std::string &, const Variant &) const, &Node::AddVariable))
+  .def("add_variable", RELEASE_GIL(Node(Node::*)(uint32_t, const std::string &, const Variant &) const, &Node::AddVariable))
+  .def("add_property", RELEASE_GIL(Node(Node::*)(const NodeId &, const QualifiedName &, const Variant &) const, &Node::AddProperty))
+  .def("add_property", RELEASE_GIL(Node(Node::*)(const std::string &, const std::string &, const Variant &) const, &Node::AddProperty))
+  .def("add_property", RELEASE_GIL(Node(Node::*)(uint32_t, const std::string &, const Variant &) const, &Node::AddProperty))
   .def(str(self))
   .def(repr(self))
   .def(self == self)
@@ -471,6 +560,10 @@ BOOST_PYTHON_MODULE(opcua)
   class_<SubscriptionHandler, PySubscriptionHandler, boost::noncopyable>("SubscriptionHandler", init<>())
   .def("data_change", &PySubscriptionHandler::DefaultDataChange)
   .staticmethod("data_change")
+  .def("data_change_batch", &PySubscriptionHandler::DefaultDataChangeBatch)
+  .staticmethod("data_change_batch")
+  .def("enable_batch_delivery", &PySubscriptionHandler::EnableBatchDelivery, (arg("as_numpy") = false, arg("queue_size") = 0))
+  .add_property("dropped_batches", &PySubscriptionHandler::GetDroppedBatches)
   .def("event", &PySubscriptionHandler::DefaultEvent)
   .staticmethod("event")
   .def("status_change", &PySubscriptionHandler::DefaultStatusChange)
@@ -496,21 +589,21 @@ BOOST_PYTHON_MODULE(opcua)
   ;
 
   class_<Subscription, std::shared_ptr<Subscription>, boost::noncopyable>("Subscription", no_init)
-  .def("subscribe_data_change", (uint32_t (Subscription::*)(const Node &, AttributeId)) &Subscription::SubscribeDataChange, SubscriptionSubscribeDataChange_stubs((arg("node"), arg("attr") = AttributeId::Value)))
-  .def("delete", &Subscription::Delete)
-  .def("unsubscribe", (void (Subscription::*)(uint32_t)) &Subscription::UnSubscribe)
-  .def("subscribe_events", (uint32_t (Subscription::*)()) &Subscription::SubscribeEvents)
-  .def("subscribe_events", (uint32_t (Subscription::*)(const Node &, const Node &)) &Subscription::SubscribeEvents)
+  .def("subscribe_data_change", RELEASE_GIL(uint32_t (Subscription::*)(const Node &, AttributeId), &Subscription::SubscribeDataChange), (arg("node"), arg("attr") = AttributeId::Value))
+  .def("delete", RELEASE_GIL(decltype(&Subscription::Delete), &Subscription::Delete))
+  .def("unsubscribe", RELEASE_GIL(void (Subscription::*)(uint32_t), &Subscription::UnSubscribe))
+  .def("subscribe_events", RELEASE_GIL(uint32_t (Subscription::*)(), &Subscription::SubscribeEvents))
+  .def("subscribe_events", RELEASE_GIL(uint32_t (Subscription::*)(const Node &, const Node &), &Subscription::SubscribeEvents))
   //.def(str(self))
   //.def(repr(self))
   ;
 
   class_<UaClient, boost::noncopyable>("Client", init<>())
   .def(init<bool>())
-  .def("connect", (void (UaClient::*)(const std::string &)) &UaClient::Connect)
-  .def("connect", (void (UaClient::*)(const EndpointDescription &)) &UaClient::Connect)
-  .def("disconnect", &UaClient::Disconnect)
-  .def("get_namespace_index", &UaClient::GetNamespaceIndex)
+  .def("connect", RELEASE_GIL(void (UaClient::*)(const std::string &), &UaClient::Connect))
+  .def("connect", RELEASE_GIL(void (UaClient::*)(const EndpointDescription &), &UaClient::Connect))
+  .def("disconnect", RELEASE_GIL(decltype(&UaClient::Disconnect), &UaClient::Disconnect))
+  .def("get_namespace_index", RELEASE_GIL(decltype(&UaClient::GetNamespaceIndex), &UaClient::GetNamespaceIndex))
   .def("get_root_node", &UaClient::GetRootNode)
   .def("get_objects_node", &UaClient::GetObjectsNode)
   .def("get_server_node", &UaClient::GetServerNode)
@@ -518,8 +611,8 @@ BOOST_PYTHON_MODULE(opcua)
   .def("get_node", (Node(UaClient::*)(const NodeId &) const) &UaClient::GetNode)
   .def("get_node", &UaClient_GetNode)
   .def("get_endpoint", &UaClient::GetEndpoint)
-  .def("get_server_endpoints", (std::vector<EndpointDescription> (UaClient::*)(const std::string &)) &UaClient::GetServerEndpoints)
-  .def("get_server_endpoints", (std::vector<EndpointDescription> (UaClient::*)()) &UaClient::GetServerEndpoints)
+  .def("get_server_endpoints", RELEASE_GIL(std::vector<EndpointDescription> (UaClient::*)(const std::string &), &UaClient::GetServerEndpoints))
+  .def("get_server_endpoints", RELEASE_GIL(std::vector<EndpointDescription> (UaClient::*)(), &UaClient::GetServerEndpoints))
   .def("set_session_name", &UaClient::SetSessionName)
   .def("get_session_name", &UaClient::GetSessionName)
   .def("get_application_uri", &UaClient::GetApplicationURI)
@@ -527,16 +620,18 @@ BOOST_PYTHON_MODULE(opcua)
   .def("set_security_policy", &UaClient::SetSecurityPolicy)
   .def("get_security_policy", &UaClient::GetSecurityPolicy)
   .def("create_subscription", &UaClient_CreateSubscription)
+  .def("read_values", &Owner_ReadValues<UaClient>)
+  .def("write_values", &Owner_WriteValues<UaClient>)
   //.def(str(self))
   //.def(repr(self))
   ;
 
   class_<UaServer, boost::noncopyable >("Server", init<>())
   .def(init<bool>())
-  .def("start", &UaServer::Start)
-  .def("stop", &UaServer::Stop)
-  .def("register_namespace", &UaServer::RegisterNamespace)
-  .def("get_namespace_index", &UaServer::GetNamespaceIndex)
+  .def("start", RELEASE_GIL(decltype(&UaServer::Start), &UaServer::Start))
+  .def("stop", RELEASE_GIL(decltype(&UaServer::Stop), &UaServer::Stop))
+  .def("register_namespace", RELEASE_GIL(decltype(&UaServer::RegisterNamespace), &UaServer::RegisterNamespace))
+  .def("get_namespace_index", RELEASE_GIL(decltype(&UaServer::GetNamespaceIndex), &UaServer::GetNamespaceIndex))
   .def("get_root_node", &UaServer::GetRootNode)
   .def("get_objects_node", &UaServer::GetObjectsNode)
   .def("get_server_node", &UaServer::GetServerNode)
@@ -548,7 +643,9 @@ BOOST_PYTHON_MODULE(opcua)
   .def("set_server_name", &UaServer::SetServerName)
   .def("set_endpoint", &UaServer::SetEndpoint)
   .def("create_subscription", &UaServer_CreateSubscription)
-  .def("trigger_event", &UaServer::TriggerEvent)
+  .def("trigger_event", RELEASE_GIL(decltype(&UaServer::TriggerEvent), &UaServer::TriggerEvent))
+  .def("read_values", &Owner_ReadValues<UaServer>)
+  .def("write_values", &Owner_WriteValues<UaServer>)
   //.def(str(self))
   //.def(repr(self))
   ;
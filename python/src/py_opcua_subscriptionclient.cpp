@@ -9,6 +9,11 @@
 ///
 
 #include "py_opcua_subscriptionclient.h"
+#include "py_opcua_helpers.h"
+#include "py_opcua_variant.h"
+
+#include <cstring>
+#include <stdexcept>
 
 static std::string parse_python_exception()
 {
@@ -73,10 +78,258 @@ static std::string parse_python_exception()
   return ret;
 }
 
+//
+// batch conversion
+//
+
+#ifdef HAVE_BOOST_NUMPY
+
+template <typename T>
+static object ToNumpyColumn(const std::vector<Variant> & values)
+{
+  np::ndarray array = np::empty(make_tuple(values.size()), np::dtype::get_builtin<T>());
+  T * data = reinterpret_cast<T *>(array.get_data());
+
+  for (const Variant & value : values)
+    {
+      *data++ = value.As<T>();
+    }
+
+  return array;
+}
+
+// values of one numeric scalar type as a numpy array, None otherwise
+static object ToNumpyValues(const std::vector<Variant> & values)
+{
+  if (values.empty())
+    {
+      return object();
+    }
+
+  const VariantType type = values.front().Type();
+
+  for (const Variant & value : values)
+    {
+      if (value.Type() != type || value.IsArray())
+        {
+          return object();
+        }
+    }
+
+  switch (type)
+    {
+    case VariantType::BOOLEAN: return ToNumpyColumn<bool>(values);
+
+    case VariantType::SBYTE:   return ToNumpyColumn<int8_t>(values);
+
+    case VariantType::BYTE:    return ToNumpyColumn<uint8_t>(values);
+
+    case VariantType::INT16:   return ToNumpyColumn<int16_t>(values);
+
+    case VariantType::UINT16:  return ToNumpyColumn<uint16_t>(values);
+
+    case VariantType::INT32:   return ToNumpyColumn<int32_t>(values);
+
+    case VariantType::UINT32:  return ToNumpyColumn<uint32_t>(values);
+
+    case VariantType::INT64:   return ToNumpyColumn<int64_t>(values);
+
+    case VariantType::UINT64:  return ToNumpyColumn<uint64_t>(values);
+
+    case VariantType::FLOAT:   return ToNumpyColumn<float>(values);
+
+    case VariantType::DOUBLE:  return ToNumpyColumn<double>(values);
+
+    default: return object();
+    }
+}
+
+// numpy datetime64[us] since 1970
+static object ToNumpyTimestamps(const std::vector<DateTime> & timestamps)
+{
+  static const int64_t epoch = DateTime::FromTimeT(0).Value;
+  np::ndarray array = np::empty(make_tuple(timestamps.size()), np::dtype(str("datetime64[us]")));
+  int64_t * data = reinterpret_cast<int64_t *>(array.get_data());
+
+  for (const DateTime & timestamp : timestamps)
+    {
+      *data++ = (timestamp.Value - epoch) / 10;
+    }
+
+  return array;
+}
+
+#endif
+
 PySubscriptionHandler::PySubscriptionHandler(PyObject * p)
   : self(p)
 {}
 
+PySubscriptionHandler::~PySubscriptionHandler()
+{
+  {
+    std::unique_lock<std::mutex> lock(BatchMutex);
+    Stopping = true;
+  }
+  BatchQueued.notify_all();
+
+  if (DeliveryThread.joinable())
+    {
+      // the delivery thread may wait for the GIL
+      ScopedGILRelease release;
+      DeliveryThread.join();
+    }
+}
+
+void PySubscriptionHandler::EnableBatchDelivery(bool asNumpy, std::size_t queueSize)
+{
+#ifndef HAVE_BOOST_NUMPY
+
+  if (asNumpy)
+    {
+      throw std::logic_error("numpy arrays are not available: the module was built without Boost.NumPy");
+    }
+
+#endif
+  std::unique_lock<std::mutex> lock(BatchMutex);
+  Batched = true;
+  AsNumpy = asNumpy;
+  QueueSize = queueSize;
+
+  if (QueueSize && !DeliveryThread.joinable())
+    {
+      DeliveryThread = std::thread([this]() { RunDelivery(); });
+    }
+}
+
+uint64_t PySubscriptionHandler::GetDroppedBatches()
+{
+  std::unique_lock<std::mutex> lock(BatchMutex);
+  return DroppedBatches;
+}
+
+void PySubscriptionHandler::DataChanges(const std::vector<DataChangeItem> & changes)
+{
+  std::unique_lock<std::mutex> lock(BatchMutex);
+
+  if (!Batched)
+    {
+      lock.unlock();
+      SubscriptionHandler::DataChanges(changes);
+      return;
+    }
+
+  DataChangeBatch batch;
+  batch.Handles.reserve(changes.size());
+  batch.Values.reserve(changes.size());
+  batch.Timestamps.reserve(changes.size());
+
+  for (const DataChangeItem & change : changes)
+    {
+      batch.Handles.push_back(change.Handle);
+      batch.Values.push_back(change.Value->Value);
+      batch.Timestamps.push_back(change.Value->Encoding & DATA_VALUE_SOURCE_TIMESTAMP ? change.Value->SourceTimestamp : change.Value->ServerTimestamp);
+    }
+
+  if (!QueueSize)
+    {
+      const bool asNumpy = AsNumpy;
+      lock.unlock();
+      DeliverBatch(batch, asNumpy);
+      return;
+    }
+
+  // the publish thread never waits for python: the oldest response is dropped instead
+  if (Queue.size() >= QueueSize)
+    {
+      Queue.pop_front();
+      ++DroppedBatches;
+    }
+
+  Queue.push_back(std::move(batch));
+  lock.unlock();
+  BatchQueued.notify_one();
+}
+
+void PySubscriptionHandler::RunDelivery()
+{
+  for (;;)
+    {
+      DataChangeBatch batch;
+      bool asNumpy = false;
+
+      {
+        std::unique_lock<std::mutex> lock(BatchMutex);
+        BatchQueued.wait(lock, [this]() { return Stopping || !Queue.empty(); });
+
+        if (Stopping)
+          {
+            return;
+          }
+
+        batch = std::move(Queue.front());
+        Queue.pop_front();
+        asNumpy = AsNumpy;
+      }
+
+      DeliverBatch(batch, asNumpy);
+    }
+}
+
+void PySubscriptionHandler::DeliverBatch(const DataChangeBatch & batch, bool asNumpy)
+{
+  PyGILState_STATE state = PyGILState_Ensure();
+
+  try
+    {
+      object handles;
+      object values;
+      object timestamps;
+
+#ifdef HAVE_BOOST_NUMPY
+
+      if (asNumpy)
+        {
+          InitializeNumpy();
+          np::ndarray array = np::empty(make_tuple(batch.Handles.size()), np::dtype::get_builtin<uint32_t>());
+          std::memcpy(array.get_data(), batch.Handles.data(), batch.Handles.size() * sizeof(uint32_t));
+          handles = array;
+          values = ToNumpyValues(batch.Values);
+          timestamps = ToNumpyTimestamps(batch.Timestamps);
+        }
+
+      else
+#endif
+        {
+          handles = ToList(batch.Handles);
+          timestamps = ToList(batch.Timestamps);
+        }
+
+      // values that do not fit in one numpy array are delivered as a list
+      if (values.is_none())
+        {
+          list valueList;
+
+          for (const Variant & value : batch.Values)
+            {
+              valueList.append(ToObject(value));
+            }
+
+          values = valueList;
+        }
+
+      call_method<void>(self, "data_change_batch", handles, values, timestamps);
+    }
+
+  catch (const error_already_set & ex)
+    {
+      std::string perror_str = parse_python_exception();
+      std::cout << "Error in 'data_change_batch' method handler: " << perror_str << std::endl;
+    }
+
+  PyGILState_Release(state);
+}
+
 void PySubscriptionHandler::DataChange(uint32_t handle, const Node & node, const Variant & val, AttributeId attribute)
 {
   PyGILState_STATE state = PyGILState_Ensure();
@@ -136,6 +389,11 @@ void PySubscriptionHandler::DefaultDataChange(const SubscriptionHandler & self_,
   std::cout << "'data_change' virtual in this context" << std::endl;
 }
 
+void PySubscriptionHandler::DefaultDataChangeBatch(const SubscriptionHandler & self_, const object & handles, const object & values, const object & timestamps)
+{
+  std::cout << "'data_change_batch' virtual in this context" << std::endl;
+}
+
 void PySubscriptionHandler::DefaultEvent(const SubscriptionHandler & self_, uint32_t handle, const OpcUa::Event & event)
 {
   std::cout << "'event' virtual in this context" << std::endl;
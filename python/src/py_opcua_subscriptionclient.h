@@ -16,6 +16,11 @@
 #include "opc/ua/event.h"
 #include "opc/ua/subscription.h"
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 using namespace boost::python;
 using namespace OpcUa;
 
@@ -24,15 +29,41 @@ class PySubscriptionHandler: public SubscriptionHandler
 public:
 
   PySubscriptionHandler(PyObject * p);
+  ~PySubscriptionHandler();
   void DataChange(uint32_t handle, const Node & node, const Variant & val, AttributeId attribute) override;
+  void DataChanges(const std::vector<DataChangeItem> & changes) override;
   void Event(uint32_t handle, const OpcUa::Event & event) override;
   void StatusChange(StatusCode status) override;
+  // deliver each publish response to 'data_change_batch' with one GIL acquisition,
+  // from a delivery thread fed by a queue of queueSize responses if queueSize is not 0
+  void EnableBatchDelivery(bool asNumpy, std::size_t queueSize);
+  uint64_t GetDroppedBatches();
   static void DefaultDataChange(const SubscriptionHandler & self_, uint32_t handle, const Node & node, const object & val, uint32_t attribute);
+  static void DefaultDataChangeBatch(const SubscriptionHandler & self_, const object & handles, const object & values, const object & timestamps);
   static void DefaultEvent(const SubscriptionHandler & self_, uint32_t handle, const OpcUa::Event & event);
   static void DefaultStatusChange(const SubscriptionHandler & self_, StatusCode status);
 
 private:
-  PyObject * self;
+  struct DataChangeBatch
+  {
+    std::vector<uint32_t> Handles;
+    std::vector<Variant> Values;
+    std::vector<DateTime> Timestamps;
+  };
+
+  void DeliverBatch(const DataChangeBatch & batch, bool asNumpy);
+  void RunDelivery();
 
+private:
+  PyObject * self;
+  std::mutex BatchMutex;
+  std::condition_variable BatchQueued;
+  bool Batched = false;
+  bool AsNumpy = false;
+  std::size_t QueueSize = 0;
+  std::deque<DataChangeBatch> Queue;
+  uint64_t DroppedBatches = 0;
+  bool Stopping = false;
+  std::thread DeliveryThread;
 };
 
@@ -11,10 +11,20 @@
 #pragma once
 
 #include <boost/python.hpp>
+#ifdef HAVE_BOOST_NUMPY
+#include <boost/python/numpy.hpp>
+#endif
 
 #include "opc/ua/protocol/variant_visitor.h"
 
+#include <cctype>
+#include <memory>
+#include <type_traits>
+
 using namespace boost::python;
+#ifdef HAVE_BOOST_NUMPY
+namespace np = boost::python::numpy;
+#endif
 
 template <typename T>
 list ToList(const std::vector<T> objects)
@@ -75,7 +85,7 @@ struct VariantToPythonObjectConverter
   }
 };
 
-object ToObject(const Variant & var)
+inline object ToObject(const Variant & var)
 {
   if (var.IsNul())
     {
@@ -88,10 +98,209 @@ object ToObject(const Variant & var)
   return objectConverter.Result;
 }
 
-Variant ToVariant(const object & obj)
+//
+// numeric arrays as numpy arrays
+//
+
+#ifdef HAVE_BOOST_NUMPY
+
+// numpy is imported by the first call returning an array, not with the module
+inline void InitializeNumpy()
+{
+  static bool initialized = false;
+
+  if (!initialized)
+    {
+      np::initialize();
+      initialized = true;
+    }
+}
+
+inline void DeleteCapsuleVariant(PyObject * capsule)
+{
+  delete static_cast<Variant *>(PyCapsule_GetPointer(capsule, NULL));
+}
+
+// the array uses the memory of the variant owned by Owner
+struct VariantToNumpyConverter
+{
+  object Owner;
+  std::vector<uint32_t> Dimensions;
+  object Result;
+
+  template <typename T>
+  void OnContainer(const std::vector<T> & val)
+  {
+    OnContainer(val, std::integral_constant < bool, std::is_arithmetic<T>::value && !std::is_same<T, bool>::value > ());
+  }
+
+  template <typename T>
+  void OnContainer(const std::vector<T> & val, std::true_type)
+  {
+    InitializeNumpy();
+    np::ndarray array = np::from_data(val.data(), np::dtype::get_builtin<T>(), make_tuple(val.size()), make_tuple(sizeof(T)), Owner);
+    std::size_t size = 1;
+    list shape;
+
+    for (uint32_t dimension : Dimensions)
+      {
+        size *= dimension;
+        shape.append(dimension);
+      }
+
+    Result = Dimensions.size() > 1 && size == val.size() ? array.reshape(tuple(shape)) : array;
+  }
+
+  template <typename T>
+  void OnContainer(const std::vector<T> & val, std::false_type)
+  {
+    Result = ToList(val);
+  }
+
+  template <typename T>
+  void OnScalar(const T & val)
+  {
+    Result = object(val);
+  }
+};
+
+// like ToObject but numeric arrays are returned as numpy arrays without copying them
+inline object ToArrayObject(Variant && var)
+{
+  if (var.IsNul())
+    {
+      return object();
+    }
+
+  Variant * owned = new Variant(std::move(var));
+  VariantToNumpyConverter arrayConverter;
+  arrayConverter.Owner = object(handle<>(PyCapsule_New(owned, NULL, &DeleteCapsuleVariant)));
+  arrayConverter.Dimensions = owned->Dimensions;
+  OpcUa::TypedVisitor<VariantToNumpyConverter> visitor(arrayConverter);
+  owned->Visit(visitor);
+  return arrayConverter.Result;
+}
+
+#else
+
+// built without Boost.NumPy: numeric arrays are flat lists like in ToObject
+inline object ToArrayObject(Variant && var)
+{
+  return ToObject(var);
+}
+
+#endif
+
+//
+// numeric buffers (numpy arrays, array.array, memoryview) to variant at once
+//
+
+template <typename T>
+Variant BufferToVariant(const Py_buffer & buffer)
+{
+  const T * data = static_cast<const T *>(buffer.buf);
+  Variant var(std::vector<T>(data, data + buffer.len / sizeof(T)));
+
+  if (buffer.ndim > 1)
+    {
+      var.Dimensions.assign(buffer.shape, buffer.shape + buffer.ndim);
+    }
+
+  return var;
+}
+
+template <typename Signed, typename Unsigned>
+bool IntegerBufferToVariant(const Py_buffer & buffer, bool isSigned, Variant & var)
+{
+  if (buffer.itemsize != sizeof(Signed))
+    {
+      return false;
+    }
+
+  var = isSigned ? BufferToVariant<Signed>(buffer) : BufferToVariant<Unsigned>(buffer);
+  return true;
+}
+
+inline bool BufferToVariant(const Py_buffer & buffer, Variant & var)
+{
+  std::string format = buffer.format ? buffer.format : "B";
+
+  // native byte order only
+  if (!format.empty() && (format[0] == '@' || format[0] == '=' || format[0] == '<'))
+    {
+      format.erase(0, 1);
+    }
+
+  if (format.size() != 1)
+    {
+      return false;
+    }
+
+  switch (format[0])
+    {
+    case '?':
+      return buffer.itemsize == sizeof(bool) && (var = BufferToVariant<bool>(buffer), true);
+
+    case 'b':
+    case 'h':
+    case 'i':
+    case 'l':
+    case 'q':
+    case 'B':
+    case 'H':
+    case 'I':
+    case 'L':
+    case 'Q':
+      {
+        const bool isSigned = std::islower(format[0]);
+        return IntegerBufferToVariant<int8_t, uint8_t>(buffer, isSigned, var)
+               || IntegerBufferToVariant<int16_t, uint16_t>(buffer, isSigned, var)
+               || IntegerBufferToVariant<int32_t, uint32_t>(buffer, isSigned, var)
+               || IntegerBufferToVariant<int64_t, uint64_t>(buffer, isSigned, var);
+      }
+
+    case 'f':
+      return buffer.itemsize == sizeof(float) && (var = BufferToVariant<float>(buffer), true);
+
+    case 'd':
+      return buffer.itemsize == sizeof(double) && (var = BufferToVariant<double>(buffer), true);
+
+    default:
+      return false;
+    }
+}
+
+inline bool ToVariantFromBuffer(const object & obj, Variant & var)
+{
+  PyObject * ptr = obj.ptr();
+
+  if (!PyObject_CheckBuffer(ptr) || PyBytes_Check(ptr) || PyByteArray_Check(ptr))
+    {
+      return false;
+    }
+
+  Py_buffer buffer;
+
+  if (PyObject_GetBuffer(ptr, &buffer, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) != 0)
+    {
+      PyErr_Clear();
+      return false;
+    }
+
+  const bool converted = buffer.ndim > 0 && BufferToVariant(buffer, var);
+  PyBuffer_Release(&buffer);
+  return converted;
+}
+
+inline Variant ToVariant(const object & obj)
 {
   Variant var;
 
+  if (ToVariantFromBuffer(obj, var))
+    {
+      return var;
+    }
+
   if (extract<std::string>(obj).check())
     {
       var = extract<std::string>(obj)();
@@ -164,10 +373,16 @@ Variant ToVariant(const object & obj)
 
 
 //similar to ToVariant but gives a hint to what c++ object type the python object should be converted to
-Variant ToVariant2(const object & obj, VariantType vtype)
+// the element type of a numeric buffer is kept
+inline Variant ToVariant2(const object & obj, VariantType vtype)
 {
   Variant var;
 
+  if (ToVariantFromBuffer(obj, var))
+    {
+      return var;
+    }
+
   if (extract<list>(obj).check())
     {
 
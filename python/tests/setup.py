@@ -3,6 +3,7 @@
 from distutils.core import setup
 from distutils.extension import Extension
 import os
+import ctypes.util
 
 opcua_server_path = os.environ['OPCUA_Server_PATH']
 
@@ -32,6 +33,12 @@ libs = [
 	'boost_python',
 ]
 
+macros = []
+
+if ctypes.util.find_library('boost_numpy'):
+	libs.append('boost_numpy')
+	macros.append(('HAVE_BOOST_NUMPY', None))
+
 ldirs = [
 	opcua_server_path + '/lib',
 	opcua_server_path + '/.libs',
@@ -41,6 +48,7 @@ opcua_client = Extension(
     'test_opcua', 
     sources,
     include_dirs = includes,
+    define_macros = macros,
     extra_compile_args = cpp_flags,
     library_dirs = ldirs,
     libraries = libs,
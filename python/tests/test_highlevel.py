@@ -2,6 +2,7 @@
 
 import sys
 sys.path.insert(0, "../../build/bin/")
+import array
 import datetime
 import unittest
 from threading import Thread, Event
@@ -52,6 +53,25 @@ class MySubHandler(opcua.SubscriptionHandler):
         with self.cond:
             self.cond.notify_all()
 
+class MyBatchHandler(opcua.SubscriptionHandler):
+    '''
+    Subscription client receiving whole publish responses
+    '''
+    def setup(self):
+        self.cond = Condition()
+        self.handles = None
+        self.values = None
+        self.timestamps = None
+        self.enable_batch_delivery()
+        return self.cond
+
+    def data_change_batch(self, handles, values, timestamps):
+        self.handles = list(handles)
+        self.values = list(values)
+        self.timestamps = list(timestamps)
+        with self.cond:
+            self.cond.notify_all()
+
 class Unit(unittest.TestCase):
     '''
     Simple unit test that do not need to setup a server or a client 
@@ -305,6 +325,57 @@ class CommonTests(object):
         val = v.get_value()
         self.assertEqual([1], val) 
 
+    def test_read_write_values(self):
+        o = self.opc.get_objects_node()
+        v1 = o.add_variable(3, 'BulkIntValue', 1)
+        v2 = o.add_variable(3, 'BulkDoubleArrayValue', [1.5])
+        v3 = o.add_variable(3, 'BulkStringValue', 'a')
+        statuses = self.opc.write_values([v1, v2, v3], [7, [2.5, 3.5], 'b'])
+        self.assertEqual([0] * 3, list(statuses)) # Good
+        values = self.opc.read_values([v1, v2, v3])
+        self.assertEqual(7, values[0])
+        self.assertEqual([2.5, 3.5], list(values[1]))
+        self.assertEqual('b', values[2])
+
+    def test_write_values_count_mismatch(self):
+        o = self.opc.get_objects_node()
+        v = o.add_variable(3, 'BulkMismatchValue', 1)
+        with self.assertRaises(Exception):
+            self.opc.write_values([v], [1, 2])
+
+    def test_buffer_value(self):
+        o = self.opc.get_objects_node()
+        v = o.add_variable(3, 'BufferValue', array.array('d', [1.0, 2.0, 3.0]))
+        self.assertEqual([1.0, 2.0, 3.0], v.get_value())
+        v.set_value(array.array('i', [4, 5]))
+        self.assertEqual([4, 5], v.get_value())
+
+    def test_buffer_array_dimensions(self):
+        o = self.opc.get_objects_node()
+        v = o.add_variable(3, 'BufferMatrixValue', [0])
+        matrix = memoryview(array.array('i', range(6))).cast('B').cast('i', [2, 3])
+        self.assertEqual([0], list(self.opc.write_values([v], [matrix]))) # Good
+        value = self.opc.read_values([v])[0]
+        if opcua.has_numpy:
+            self.assertEqual((2, 3), value.shape)
+            self.assertEqual([[0, 1, 2], [3, 4, 5]], value.tolist())
+        else:
+            self.assertEqual(list(range(6)), value)
+
+    @unittest.skipUnless(opcua.has_numpy, 'built without Boost.NumPy')
+    def test_numpy_round_trip(self):
+        import numpy
+        o = self.opc.get_objects_node()
+        v = o.add_variable(3, 'NumpyValue', [0])
+        data = numpy.arange(6, dtype=numpy.int16).reshape(2, 3)
+        self.opc.write_values([v], [data])
+        value = self.opc.read_values([v])[0]
+        self.assertEqual(numpy.int16, value.dtype)
+        self.assertTrue((data == value).all())
+        # the array uses the memory of the decoded value
+        self.assertFalse(value.flags['OWNDATA'])
+        self.assertIsNotNone(value.base)
+
     def test_create_delete_subscription(self):
         o = self.opc.get_objects_node()
         v = o.add_variable(3, 'SubscriptionVariable', [1, 2, 3])
@@ -404,6 +475,30 @@ class CommonTests(object):
         sub.unsubscribe(handle1)
         sub.delete()
 
+    def test_subscription_data_change_batch(self):
+        msclt = MyBatchHandler()
+        cond = msclt.setup()
+
+        o = self.opc.get_objects_node()
+        v1 = o.add_variable(3, 'SubscriptionBatchV1', 1.5)
+        v2 = o.add_variable(3, 'SubscriptionBatchV2', 'text')
+        sub = self.opc.create_subscription(100, msclt)
+        handle1 = sub.subscribe_data_change(v1)
+        handle2 = sub.subscribe_data_change(v2)
+        time.sleep(0.5) # start values
+        self.assertEqual(len(msclt.values), len(msclt.timestamps))
+
+        with cond:
+            v1.set_value(2.5)
+            ret = cond.wait(0.5)
+        self.assertEqual(ret, True)
+        self.assertEqual(msclt.handles, [handle1])
+        self.assertEqual(msclt.values, [2.5])
+
+        sub.unsubscribe(handle1)
+        sub.unsubscribe(handle2)
+        sub.delete()
+
     def test_get_node_by_nodeid(self):
         root = self.opc.get_root_node()
         server_time_node = root.get_child(['0:Objects', '0:Server', '0:ServerStatus', '0:CurrentTime'])
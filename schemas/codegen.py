@@ -49,37 +49,148 @@ enum class ObjectId : uint32_t
 }
 ''')
 
+def hash_name(name):
+  # must match HashName of src/protocol/perfect_hash.h
+  data = name.encode('utf-8')
+  h = 0xcbf29ce484222325 ^ len(data)
+  for pos in range(0, len(data), 8):
+    word = int.from_bytes(data[pos:pos + 8], 'little')
+    h = ((h ^ word) * 0x9e3779b97f4a7c15) & 0xffffffffffffffff
+    h ^= h >> 32
+  return h & 0xffffffff
+
+def hash_value(value, seed):
+  # MurmurHash3 finalizer, must match HashValue of src/protocol/perfect_hash.h
+  h = (value + seed * 0x9e3779b9) & 0xffffffff
+  h ^= h >> 16
+  h = (h * 0x85ebca6b) & 0xffffffff
+  h ^= h >> 13
+  h = (h * 0xc2b2ae35) & 0xffffffff
+  h ^= h >> 16
+  return h
+
+def build_perfect_hash(keys):
+  # Hash and displace: keys are split into buckets of about 4 keys, then for
+  # every bucket, largest first, a seed is searched which moves all its keys
+  # to free slots. Every slot gets exactly one key.
+  if len(set(keys)) != len(keys):
+    raise Exception('duplicated keys')
+  slot_count = len(keys)
+  seed_count = (len(keys) + 3) // 4
+  buckets = [[] for _ in range(seed_count)]
+  for idx, key in enumerate(keys):
+    buckets[hash_value(key, 0) % seed_count].append(idx)
+
+  seeds = [0] * seed_count
+  slots = [None] * slot_count
+  for bucket in sorted(range(seed_count), key=lambda b: -len(buckets[b])):
+    if not buckets[bucket]:
+      continue
+    for seed in range(1, 0x10000):
+      taken = [hash_value(keys[idx], seed) % slot_count for idx in buckets[bucket]]
+      if len(set(taken)) == len(taken) and all(slots[slot] is None for slot in taken):
+        break
+    else:
+      raise Exception('no seed found for bucket {0}'.format(bucket))
+    seeds[bucket] = seed
+    for idx, slot in zip(buckets[bucket], taken):
+      slots[slot] = idx
+  return seeds, slots
+
+def cxx_uint16_array(name, values):
+  print('const uint16_t {0}[] =\n{{'.format(name))
+  for start in range(0, len(values), 16):
+    print('  ' + ' '.join('{0},'.format(v) for v in values[start:start + 16]))
+  print('};\n')
+
+def cxx_perfect_hash(prefix, keys):
+  # names are reduced to their hash first
+  seeds, slots = build_perfect_hash(keys)
+  cxx_uint16_array(prefix + 'Seeds', seeds)
+  cxx_uint16_array(prefix + 'Slots', slots)
+
+def cxx_names_table(name, strings):
+  # all strings in one array to avoid a relocated pointer per string
+  print('const char {0}[] ='.format(name))
+  offsets = []
+  offset = 0
+  for string in strings:
+    offsets.append(offset)
+    offset += len(string.encode('utf-8')) + 1
+    print('  "{0}\\0"'.format(string.replace('\\', '\\\\').replace('"', '\\"')))
+  print('  ;\n')
+  return offsets
+
 def cxx_object_ids_tostring(fname):
+  with open(fname) as fd:
+    entries = [('Null', 0)] + [(e[0], int(e[1])) for e in csv.reader(fd, delimiter=',')]
+
   print('''//
 // DO NOT EDIT THIS FILE!
 // It is automatically generated from opcfoundation.org schemas.
 //
 
+#include "perfect_hash.h"
+
 #include <sstream>
+#include <stdexcept>
 #include <string>
 
 #include "opc/ua/protocol/object_ids.h"
+#include "opc/ua/protocol/string_utils.h"
+
+namespace
+{
+
+struct ObjectIdEntry
+{
+  uint32_t Value;
+  uint32_t Name; // offset in ObjectIdNames
+};
+''')
+
+  offsets = cxx_names_table('ObjectIdNames', [name for name, value in entries])
+  print('const ObjectIdEntry ObjectIdEntries[] =\n{')
+  for (name, value), offset in zip(entries, offsets):
+    print('  {{{0}, {1}}},'.format(value, offset))
+  print('};\n')
+  cxx_perfect_hash('ObjectIdValue', [value for name, value in entries])
+  cxx_perfect_hash('ObjectIdName', [hash_name(name) for name, value in entries])
+
+  print('''} // namespace
 
 namespace OpcUa
 {
 
-std::string ToString(const ObjectId & value)
+const char * GetObjectIdName(ObjectId id)
 {
-  switch (value)
-  {''')
+  const uint32_t value = static_cast<uint32_t>(id);
+  const ObjectIdEntry & entry = ObjectIdEntries[PerfectHash::FindValue(ObjectIdValueSeeds, ObjectIdValueSlots, value)];
+  return entry.Value == value ? ObjectIdNames + entry.Name : nullptr;
+}
 
-  with open(fname) as fd:
-    for e in csv.reader(fd, delimiter=','):
-      print ('''    case ObjectId::{0}:
-      return "{1}";'''.format(e[0],e[0]))
+ObjectId ToObjectId(boost::string_view name)
+{
+  const ObjectIdEntry & entry = ObjectIdEntries[PerfectHash::FindName(ObjectIdNameSeeds, ObjectIdNameSlots, name)];
 
-  print ('''    default:
-      {
-        std::stringstream result;
-        result << "unknown(" << static_cast<int>(value) << ")";
-        return result.str();
-      }
-  }
+  if (!PerfectHash::IsName(name, ObjectIdNames + entry.Name))
+    {
+      throw std::runtime_error("Unknown ObjectId name: '" + name.to_string() + "'");
+    }
+
+  return static_cast<ObjectId>(entry.Value);
+}
+
+std::string ToString(const ObjectId & value)
+{
+  if (const char * name = GetObjectIdName(value))
+    {
+      return name;
+    }
+
+  std::stringstream result;
+  result << "unknown(" << static_cast<int>(value) << ")";
+  return result.str();
 }
 
 } // namespace OpcUa
@@ -114,20 +225,76 @@ void CheckStatusCode(StatusCode code);
 ''')
 
 def cxx_status_codes_tostring(fname):
+  with open(fname) as fd:
+    entries = [('Good', 0, '')] + [(e[0], int(e[1], 16), e[2]) for e in csv.reader(fd, delimiter=',')]
+
   print('''//
 // DO NOT EDIT THIS FILE!
 // It is automatically generated from opcfoundation.org schemas.
 //
 
-#include <string>
-#include <sstream>
+#include "perfect_hash.h"
+
 #include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <string>
 
 #include "opc/ua/protocol/status_codes.h"
+#include "opc/ua/protocol/string_utils.h"
+
+namespace
+{
+
+struct StatusCodeEntry
+{
+  uint32_t Value;
+  uint32_t Name;        // offset in StatusCodeStrings
+  uint32_t Description; // offset in StatusCodeStrings
+};
+''')
+
+  strings = []
+  for name, value, description in entries:
+    strings += [name, description]
+  offsets = cxx_names_table('StatusCodeStrings', strings)
+  print('const StatusCodeEntry StatusCodeEntries[] =\n{')
+  for idx, (name, value, description) in enumerate(entries):
+    print('  {{0x{0:08x}, {1}, {2}}},'.format(value, offsets[2 * idx], offsets[2 * idx + 1]))
+  print('};\n')
+  cxx_perfect_hash('StatusCodeValue', [value for name, value, description in entries])
+  cxx_perfect_hash('StatusCodeName', [hash_name(name) for name, value, description in entries])
+
+  print('''const StatusCodeEntry * FindStatusCode(OpcUa::StatusCode code)
+{
+  const uint32_t value = static_cast<uint32_t>(code);
+  const StatusCodeEntry & entry = StatusCodeEntries[OpcUa::PerfectHash::FindValue(StatusCodeValueSeeds, StatusCodeValueSlots, value)];
+  return entry.Value == value ? &entry : nullptr;
+}
+
+} // namespace
 
 namespace OpcUa
 {
 
+const char * GetStatusCodeName(StatusCode code)
+{
+  const StatusCodeEntry * entry = FindStatusCode(code);
+  return entry ? StatusCodeStrings + entry->Name : nullptr;
+}
+
+StatusCode ToStatusCode(boost::string_view name)
+{
+  const StatusCodeEntry & entry = StatusCodeEntries[PerfectHash::FindName(StatusCodeNameSeeds, StatusCodeNameSlots, name)];
+
+  if (!PerfectHash::IsName(name, StatusCodeStrings + entry.Name))
+    {
+      throw std::runtime_error("Unknown StatusCode name: '" + name.to_string() + "'");
+    }
+
+  return static_cast<StatusCode>(entry.Value);
+}
+
 std::string ToString(const StatusCode & code)
 {
   if (code == StatusCode::Good)
@@ -135,23 +302,9 @@ std::string ToString(const StatusCode & code)
       return std::string();
     }
 
+  const StatusCodeEntry * entry = FindStatusCode(code);
   std::stringstream stream;
-
-  switch (code)
-    {''')
-
-  with open(fname) as fd:
-    for e in csv.reader(fd, delimiter=','):
-      print ('''    case StatusCode::{0}:
-      stream << "{1}";
-      break;
-'''.format(e[0],e[2]))
-
-  print ('''    default:
-      stream << "Unknown StatusCode?";
-      break;
-    }
-
+  stream << (entry ? StatusCodeStrings + entry->Description : "Unknown StatusCode?");
   stream << " (0x" << std::setfill('0') << std::setw(8) << std::hex << (unsigned)code << ")";
 
   return stream.str();
@@ -251,9 +251,11 @@ EnabledStructs = [\
     'RepublishParameters',
     'RepublishRequest',
     'RepublishResponse',
-    #'TransferResult',
-    #'TransferSubscriptionsRequest',
-    #'TransferSubscriptionsResponse',
+    'TransferResult',
+    'TransferSubscriptionsParameters',
+    'TransferSubscriptionsRequest',
+    'TransferSubscriptionsResult',
+    'TransferSubscriptionsResponse',
     'DeleteSubscriptionsRequest',
     'DeleteSubscriptionsResponse',
     #'ScalarTestType',
@@ -347,13 +349,12 @@ def override_types(model):
 
 
 class CodeGenerator(object):
-    def __init__(self, model, h_path, enum_path, size_path, ser_path, deser_path, const_path):
+    def __init__(self, model, h_path, enum_path, fields_path, codec_path, const_path):
         self.model = model
         self.h_path = h_path
         self.enum_path = enum_path
-        self.rawsize_path = size_path
-        self.serialize_path = ser_path
-        self.deserialize_path = deser_path
+        self.fields_path = fields_path
+        self.codec_path = codec_path
         self.constructors_path = const_path
         self.h_file = None
         self.cpp_file = None
@@ -365,26 +366,23 @@ class CodeGenerator(object):
         self.h_file = open(self.h_path, "w")
         print("Generating: ", self.enum_path)
         self.enum_file = open(self.enum_path, "w")
-        print("Generating: ", self.rawsize_path)
-        self.rawsize_file = open(self.rawsize_path, "w")
-        print("Generating: ", self.serialize_path)
-        self.serialize_file = open(self.serialize_path, "w")
-        print("Generating: ", self.deserialize_path)
-        self.deserialize_file = open(self.deserialize_path, "w")
+        print("Generating: ", self.fields_path)
+        self.fields_file = open(self.fields_path, "w")
+        print("Generating: ", self.codec_path)
+        self.codec_file = open(self.codec_path, "w")
         print("Generating: ", self.constructors_path)
         self.constructors_file = open(self.constructors_path, "w")
 
         self.make_header_h()
         self.make_header_enum()
-        self.make_header_rawsize()
-        self.make_header_serialize()
-        self.make_header_deserialize()
+        self.make_header_fields()
+        self.make_header_codec()
         self.make_header_constructors()
 
         for enum in self.model.enums:
             if not enum.name in IgnoredEnums:
                 self.make_enum_h(enum)
-                self.make_struct_ser(enum)
+                self.make_enum_codec(enum)
         for struct in self.model.structs:
             self.rename_fields(struct)
             if struct.name in NeedConstructor:
@@ -392,28 +390,23 @@ class CodeGenerator(object):
             #if not struct.name.endswith("Node") and not struct.name.endswith("NodeId"):
             if not struct.name in EnabledStructs:
                 self.write_h("\n/* DISABLED")
-                self.write_size("\n/* DISABLED")
-                self.write_ser("\n/*  DISABLED")
-                self.write_deser("\n/*  DISABLED")
                 if struct.needconstructor:
                     self.write_const("\n/*  DISABLED")
             self.make_struct_h(struct)
-            self.make_struct_ser(struct)
+            if struct.name in EnabledStructs:
+                self.make_struct_fields(struct)
+                self.make_struct_codec(struct)
             if struct.isrequest:
                 self.make_request_constructors(struct)
             if not struct.name in EnabledStructs:
                 self.write_h("*/")
-                self.write_size("*/")
-                self.write_ser("*/")
-                self.write_deser("*/")
                 if struct.needconstructor:
                     self.write_const("*/")
 
         self.make_footer_h()
         self.make_footer_enum()
-        self.make_footer_rawsize()
-        self.make_footer_serialize()
-        self.make_footer_deserialize()
+        self.make_footer_fields()
+        self.make_footer_codec()
         self.make_footer_constructors()
 
     def rename_fields(self, struct):
@@ -446,99 +439,77 @@ class CodeGenerator(object):
 
         self.write_h("    };")
 
-    def make_raw_size(self, struct):
-        self.write_size("")
-        self.write_size("    template<>")
-        self.write_size("    std::size_t RawSize<{}>(const {}& data)".format(struct.name, struct.name))
-        self.write_size("    {")
-
-        if type(struct) == gm.Enum:
-            self.write_size("        return sizeof({});".format(struct.get_ctype()))
-        else:
-            self.write_size("        size_t size = 0;")
-            for field in struct.fields:
-                switch = ""
-                if field.switchfield:
-                    if field.switchvalue:
-                        switch = "if ((data.{}) & (1<<({}))) ".format(field.switchfield, field.switchvalue)
-                    else:
-                        container = struct.bits[field.switchfield].container
-                        idx = struct.bits[field.switchfield].idx
-                        switch = "if ((data.{}) & (1<<({}))) ".format(container, idx)
-                prefix = ""
-                if field.get_ctype() == struct.name:
-                    prefix = "*"
-                if field.length:
-                    self.write_size("        {}size += RawSizeContainer({}data.{});".format(switch, prefix, field.name))
-                else:
-                    self.write_size("        {}size += RawSize({}data.{});".format(switch, prefix, field.name))
-            self.write_size("        return size;")
-        self.write_size("    }")
-        self.write_size("")
-
-    def make_serialize(self, struct):
-        self.write_ser("")
-        self.write_ser("    template<>")
-        self.write_ser("    void DataSerializer::Serialize<{}>(const {}& data)".format(struct.name, struct.name))
-        self.write_ser("    {")
-        if type(struct) == gm.Enum:
-            self.write_ser("        *this << static_cast<{}>(data);".format(struct.get_ctype()))
-        else:
-            for idx, field in enumerate(struct.fields):
-                if field.name == "Body" and idx != (len(struct.fields) - 1):
-                    self.write_ser("        int32_t bodylength = RawSize(data) - RawSize(data.Encoding);")
-                    self.write_ser("        if ((data.Encoding) & (1<<(0))) bodylength -= RawSize(data.TypeId);")
-                    self.write_ser("        *this << bodylength;")
-                    continue
-
-                switch = ""
-                if field.switchfield:
-                    if field.switchvalue:
-                        switch = "if ((data.{}) & (1<<({}))) ".format(field.switchfield, field.switchvalue)
-                    else:
-                        container = struct.bits[field.switchfield].container
-                        idx = struct.bits[field.switchfield].idx
-                        switch = "if ((data.{}) & (1<<({}))) ".format(container, idx)
-                prefix = ""
-                if field.get_ctype() == struct.name:
-                    prefix = "*"
-                if field.length:
-                    self.write_ser("        {}SerializeContainer(*this, {}data.{});".format(switch, prefix, field.name))
-                else:
-                    self.write_ser("        {}*this << {}data.{};".format(switch, prefix, field.name))
-        self.write_ser("    }")
-        self.write_ser("")
-
-    def make_deserialize(self, struct):
-        self.write_deser("")
-        self.write_deser("    template<>")
-        self.write_deser("    void DataDeserializer::Deserialize<{}>({}& data)".format(struct.name, struct.name))
-        self.write_deser("    {")
-        if type(struct) == gm.Enum:
-            self.write_deser("        {} tmp;".format(struct.get_ctype()))
-            self.write_deser("        *this >> tmp;")
-            #self.write_deser("        data = static_cast<{}>(tmp);".format(struct.get_ctype()))
-            self.write_deser("        data = static_cast<{}>(tmp);".format(struct.name))
-        else:
-            for idx, field in enumerate(struct.fields):
-                if field.name == "Body" and idx != (len(struct.fields) - 1):
-                    self.write_deser("        int32_t tmp; //Not used")
-                    self.write_deser("        *this >> tmp;")
-                    continue
-                switch = ""
-                if field.switchfield:
-                    if field.switchvalue:
-                        switch = "if ((data.{}) & (1>>({}))) ".format(field.switchfield, field.switchvalue)
-                    else:
-                        container = struct.bits[field.switchfield].container
-                        idx = struct.bits[field.switchfield].idx
-                        switch = "if ((data.{}) & (1>>({}))) ".format(container, idx)
-                if field.length:
-                    self.write_deser("        {}DeserializeContainer(*this, data.{});".format(switch, field.name))
+    def make_enum_codec(self, enum):
+        ctype = enum.get_ctype()
+        self.write_fields("template<> struct FixedSize<{}> : std::integral_constant<std::size_t, sizeof({})> {{}};".format(enum.name, ctype))
+
+        self.write_codec("")
+        self.write_codec("template<>")
+        self.write_codec("std::size_t RawSize<{0}>(const {0} &)".format(enum.name))
+        self.write_codec("{")
+        self.write_codec("  return sizeof({});".format(ctype))
+        self.write_codec("}")
+        self.write_codec("")
+        self.write_codec("template<>")
+        self.write_codec("void DataSerializer::Serialize<{0}>(const {0} & data)".format(enum.name))
+        self.write_codec("{")
+        self.write_codec("  *this << static_cast<{}>(data);".format(ctype))
+        self.write_codec("}")
+        self.write_codec("")
+        self.write_codec("template<>")
+        self.write_codec("void DataDeserializer::Deserialize<{0}>({0} & data)".format(enum.name))
+        self.write_codec("{")
+        self.write_codec("  {} tmp;".format(ctype))
+        self.write_codec("  *this >> tmp;")
+        self.write_codec("  data = static_cast<{}>(tmp);".format(enum.name))
+        self.write_codec("}")
+
+    def make_struct_fields(self, struct):
+        fields = []
+        for idx, field in enumerate(struct.fields):
+            if field.get_ctype() == "OpcUa::" + struct.name:
+                raise Exception("self referencing field {}.{} is not supported".format(struct.name, field.name))
+            if field.name == "Body" and idx != (len(struct.fields) - 1):
+                raise Exception("body length of {} is not supported".format(struct.name))
+            if field.switchfield:
+                if field.switchvalue:
+                    mask, bit = field.switchfield, field.switchvalue
                 else:
-                    self.write_deser("        {}*this >> data.{};".format(switch, field.name))
-        self.write_deser("    }")
-        self.write_deser("")
+                    mask, bit = struct.bits[field.switchfield].container, struct.bits[field.switchfield].idx
+                fields.append("OPCUA_OPTIONAL_FIELD({}, {}, {}, {})".format(struct.name, field.name, mask, bit))
+            elif field.length:
+                fields.append("OPCUA_ARRAY_FIELD({}, {})".format(struct.name, field.name))
+            else:
+                fields.append("OPCUA_FIELD({}, {})".format(struct.name, field.name))
+
+        self.write_fields("")
+        self.write_fields("template<>")
+        self.write_fields("struct StructFields<{}>".format(struct.name))
+        self.write_fields("{")
+        self.write_fields("  typedef FieldList<")
+        self.write_fields(",\n".join("    " + f for f in fields))
+        self.write_fields("  > Type;")
+        self.write_fields("};")
+
+    def make_struct_codec(self, struct):
+        self.write_codec("")
+        self.write_codec("template<>")
+        self.write_codec("std::size_t RawSize<{0}>(const {0} & data)".format(struct.name))
+        self.write_codec("{")
+        self.write_codec("  return RawSizeFields(data, StructFields<{}>::Type());".format(struct.name))
+        self.write_codec("}")
+        self.write_codec("")
+        self.write_codec("template<>")
+        self.write_codec("void DataSerializer::Serialize<{0}>(const {0} & data)".format(struct.name))
+        self.write_codec("{")
+        self.write_codec("  SerializeFields(*this, data, StructFields<{}>::Type());".format(struct.name))
+        self.write_codec("}")
+        self.write_codec("")
+        self.write_codec("template<>")
+        self.write_codec("void DataDeserializer::Deserialize<{0}>({0} & data)".format(struct.name))
+        self.write_codec("{")
+        self.write_codec("  DeserializeFields(*this, data, StructFields<{}>::Type());".format(struct.name))
+        self.write_codec("}")
 
     def make_request_constructors(self, struct):
         if not struct.needconstructor:
@@ -550,11 +521,6 @@ class CodeGenerator(object):
         self.write_const("    {")
         self.write_const("    }")
 
-    def make_struct_ser(self, struct):
-        self.make_raw_size(struct)
-        self.make_serialize(struct)
-        self.make_deserialize(struct)
-
     def make_enum_h(self, enum):
         self.write_enum("\n")
         if enum.doc: self.write_enum("    //", enum.doc)
@@ -578,14 +544,11 @@ class CodeGenerator(object):
     def write_enum(self, *args):
         self.enum_file.write(" ".join(args) + "\n")
 
-    def write_ser(self, *args):
-        self.serialize_file.write(" ".join(args) + "\n")
-
-    def write_size(self, *args):
-        self.rawsize_file.write(" ".join(args) + "\n")
+    def write_fields(self, *args):
+        self.fields_file.write(" ".join(args) + "\n")
 
-    def write_deser(self, *args):
-        self.deserialize_file.write(" ".join(args) + "\n")
+    def write_codec(self, *args):
+        self.codec_file.write(" ".join(args) + "\n")
 
     def write_const(self, *args):
         self.constructors_file.write(" ".join(args) + "\n")
@@ -653,14 +616,12 @@ namespace OpcUa
 } // namespace
     ''')
 
-    def make_header_rawsize(self, ):
-        self.write_size('''// DO NOT EDIT THIS FILE!
+    def make_header_fields(self, ):
+        self.write_fields('''// DO NOT EDIT THIS FILE!
 // It is automatically generated from opcfoundation.org schemas.
 //
 
-/// @author Olivier Roulet-Dubonnet
-/// @email olivier@sintef.no
-/// @brief Opc Ua Binary.
+/// @brief Field lists of Opc Ua structures.
 /// @license GNU LGPL
 ///
 /// Distributed under the GNU LGPL License
@@ -668,64 +629,27 @@ namespace OpcUa
 /// http://www.gnu.org/licenses/lgpl.html)
 ///
 
-#include "binary_serialization.h"
-#include <opc/ua/protocol/protocol.h>
-
-#include <opc/ua/protocol/binary/stream.h>
-
-namespace OpcUa
-{
-    namespace Binary
-    {''')
-
-    def make_footer_rawsize(self):
-        self.write_size('''
-   }
-
-} // namespace
-    ''')
-
-
-
-    def make_header_serialize(self, ):
-        self.write_ser('''// DO NOT EDIT THIS FILE!
-// It is automatically generated from opcfoundation.org schemas.
-//
-
-/// @author Olivier Roulet-Dubonnet
-/// @email olivier@sintef.no
-/// @brief Opc Ua Binary.
-/// @license GNU LGPL
-///
-/// Distributed under the GNU LGPL License
-/// (See accompanying file LICENSE or copy at
-/// http://www.gnu.org/licenses/lgpl.html)
-///
+#pragma once
 
-#include "binary_serialization.h"
+#include "binary_fields.h"
 #include <opc/ua/protocol/protocol.h>
 
-#include <opc/ua/protocol/binary/stream.h>
-
 namespace OpcUa
 {
-    namespace Binary
-    {''')
-
-    def make_footer_serialize(self):
-        self.write_ser('''
-   }
+namespace Binary
+{
+''')
 
-} // namespace
-    ''')
+    def make_footer_fields(self):
+        self.write_fields('''
+} // namespace Binary
+} // namespace OpcUa''')
 
-    def make_header_deserialize(self, ):
-        self.write_deser('''// DO NOT EDIT THIS FILE!
+    def make_header_codec(self, ):
+        self.write_codec('''// DO NOT EDIT THIS FILE!
 // It is automatically generated from opcfoundation.org schemas.
 //
 
-/// @author Olivier Roulet-Dubonnet
-/// @email olivier@sintef.no
 /// @brief Opc Ua Binary.
 /// @license GNU LGPL
 ///
@@ -734,23 +658,17 @@ namespace OpcUa
 /// http://www.gnu.org/licenses/lgpl.html)
 ///
 
-#include "binary_serialization.h"
-#include <opc/ua/protocol/protocol.h>
-
-#include <opc/ua/protocol/binary/stream.h>
+#include "fields_auto.h"
 
 namespace OpcUa
 {
-    namespace Binary
-    {''')
-
-    def make_footer_deserialize(self):
-        self.write_deser('''
-   }
-
-} // namespace
-    ''')
+namespace Binary
+{''')
 
+    def make_footer_codec(self):
+        self.write_codec('''
+} // namespace Binary
+} // namespace OpcUa''')
 
     def make_header_constructors(self, ):
         self.write_const('''// DO NOT EDIT THIS FILE!
@@ -785,9 +703,8 @@ if __name__ == "__main__":
     xmlpath = "Opc.Ua.Types.bsd"
     hpath = "../include/opc/ua/protocol/protocol_auto.h"
     enumpath = "../include/opc/ua/protocol/enums.h"
-    serializerpath = "../src/protocol/serialize_auto.cpp"
-    rawsizepath = "../src/protocol/rawsize_auto.cpp"
-    deserializerpath = "../src/protocol/deserialize_auto.cpp"
+    fieldspath = "../src/protocol/fields_auto.h"
+    codecpath = "../src/protocol/codec_auto.cpp"
     constructorspath = "../src/protocol/constructors_auto.cpp"
 
     p = gm.Parser(xmlpath)
@@ -818,7 +735,7 @@ if __name__ == "__main__":
     f.write("]")
 
 
-    c = CodeGenerator(model, hpath, enumpath, rawsizepath, serializerpath, deserializerpath, constructorspath)
+    c = CodeGenerator(model, hpath, enumpath, fieldspath, codecpath, constructorspath)
     c.run()
 
 
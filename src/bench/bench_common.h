@@ -0,0 +1,146 @@
+/// @brief Helpers shared by the benchmark executables.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace OpcUa
+{
+namespace Bench
+{
+
+typedef std::chrono::steady_clock Clock;
+
+/// @brief Collects latency samples (in nanoseconds) of one operation type.
+/// Every worker thread owns its own recorder, recorders are merged at the end
+/// of the run so recording never needs a lock.
+class LatencyRecorder
+{
+public:
+  void Add(Clock::duration latency)
+  {
+    Samples.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count());
+  }
+
+  void AddError()
+  {
+    ++Errors;
+  }
+
+  void Merge(const LatencyRecorder & other)
+  {
+    Samples.insert(Samples.end(), other.Samples.begin(), other.Samples.end());
+    Errors += other.Errors;
+  }
+
+  std::size_t Count() const
+  {
+    return Samples.size();
+  }
+
+  uint64_t ErrorCount() const
+  {
+    return Errors;
+  }
+
+  /// @brief Return the latency at percentile p (0 < p <= 1) in nanoseconds.
+  /// Samples are sorted lazily on first call.
+  uint64_t Percentile(double p)
+  {
+    if (Samples.empty())
+      {
+        return 0;
+      }
+
+    if (!Sorted)
+      {
+        std::sort(Samples.begin(), Samples.end());
+        Sorted = true;
+      }
+
+    std::size_t rank = static_cast<std::size_t>(std::ceil(p * Samples.size()));
+    rank = std::max<std::size_t>(rank, 1);
+    return Samples[std::min(rank, Samples.size()) - 1];
+  }
+
+  uint64_t Mean() const
+  {
+    if (Samples.empty())
+      {
+        return 0;
+      }
+
+    long double total = 0;
+
+    for (uint64_t sample : Samples)
+      {
+        total += sample;
+      }
+
+    return static_cast<uint64_t>(total / Samples.size());
+  }
+
+private:
+  std::vector<uint64_t> Samples;
+  uint64_t Errors = 0;
+  bool Sorted = false;
+};
+
+/// @brief Write recorder statistics as a JSON object, latencies in microseconds.
+inline void WriteJsonStats(std::ostream & os, LatencyRecorder & recorder, double seconds)
+{
+  const double toUs = 1e-3;
+  os << "{"
+     << "\"count\": " << recorder.Count()
+     << ", \"errors\": " << recorder.ErrorCount()
+     << ", \"ops_per_sec\": " << (seconds > 0 ? recorder.Count() / seconds : 0)
+     << ", \"mean_us\": " << recorder.Mean() * toUs
+     << ", \"p50_us\": " << recorder.Percentile(0.50) * toUs
+     << ", \"p99_us\": " << recorder.Percentile(0.99) * toUs
+     << ", \"p999_us\": " << recorder.Percentile(0.999) * toUs
+     << ", \"max_us\": " << recorder.Percentile(1.0) * toUs
+     << "}";
+}
+
+/// @brief Small xorshift generator, deterministic per worker and cheap enough
+/// not to show up in the measurements.
+class Random
+{
+public:
+  explicit Random(uint64_t seed)
+    : State(seed ? seed : 0x9E3779B97F4A7C15ull)
+  {
+  }
+
+  uint64_t Next()
+  {
+    State ^= State << 13;
+    State ^= State >> 7;
+    State ^= State << 17;
+    return State;
+  }
+
+  /// @brief Uniform value in [0, bound).
+  uint32_t Below(uint32_t bound)
+  {
+    return bound ? static_cast<uint32_t>(Next() % bound) : 0;
+  }
+
+private:
+  uint64_t State;
+};
+
+} // namespace Bench
+} // namespace OpcUa
@@ -0,0 +1,634 @@
+/// @brief Microbenchmarks of the binary protocol codec.
+/// Encodes, decodes and sizes representative service messages and Variant
+/// arrays of the built-in types. Every benchmark reports processed bytes per
+/// second and the number of heap allocations per message. Lookups in the
+/// ObjectId and StatusCode name tables and the NodeId and QualifiedName
+/// text conversions are measured as well.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include <opc/ua/protocol/binary/stream.h>
+#include <opc/ua/protocol/input_from_buffer.h>
+#include <opc/ua/protocol/protocol.h>
+#include <opc/ua/protocol/string_utils.h>
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <unordered_map>
+
+//
+// Allocation counting. Replacing the global operators is the only way to see
+// allocations made deep inside the generated codec without instrumenting it.
+//
+
+namespace
+{
+std::atomic<uint64_t> AllocationCount(0);
+}
+
+void * operator new(std::size_t size)
+{
+  AllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+  if (void * ptr = std::malloc(size ? size : 1))
+    {
+      return ptr;
+    }
+
+  throw std::bad_alloc();
+}
+
+void * operator new[](std::size_t size)
+{
+  return operator new(size);
+}
+
+void operator delete(void * ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void * ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void * ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void * ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+namespace
+{
+using namespace OpcUa;
+
+/// @brief Output channel which keeps the encoded message, reusing its storage.
+class BufferChannel
+{
+public:
+  void Send(const char * data, std::size_t size)
+  {
+    Data.assign(data, data + size);
+  }
+
+  std::vector<char> Data;
+};
+
+class AllocationCounter
+{
+public:
+  explicit AllocationCounter(benchmark::State & state)
+    : State(state)
+    , Start(AllocationCount.load(std::memory_order_relaxed))
+  {
+  }
+
+  ~AllocationCounter()
+  {
+    const double allocations = AllocationCount.load(std::memory_order_relaxed) - Start;
+    State.counters["allocs_per_msg"] = benchmark::Counter(allocations, benchmark::Counter::kAvgIterations);
+  }
+
+private:
+  benchmark::State & State;
+  uint64_t Start;
+};
+
+template <typename T>
+std::vector<char> Encode(const T & message)
+{
+  BufferChannel channel;
+  Binary::OStream<BufferChannel> os(channel);
+  os << message << Binary::flush;
+  return channel.Data;
+}
+
+template <typename T>
+void EncodeMessage(benchmark::State & state, const T & message)
+{
+  BufferChannel channel;
+  Binary::OStream<BufferChannel> os(channel);
+  std::size_t bytes = 0;
+  AllocationCounter allocations(state);
+
+  for (auto _ : state)
+    {
+      os << message << Binary::flush;
+      bytes += channel.Data.size();
+      benchmark::DoNotOptimize(channel.Data.data());
+    }
+
+  state.SetBytesProcessed(bytes);
+}
+
+template <typename T>
+void DecodeMessage(benchmark::State & state, const T & message)
+{
+  const std::vector<char> encoded = Encode(message);
+  std::size_t bytes = 0;
+  AllocationCounter allocations(state);
+
+  for (auto _ : state)
+    {
+      InputFromBuffer input(encoded.data(), encoded.size());
+      Binary::IStream<InputFromBuffer> is(input);
+      T decoded;
+      is >> decoded;
+      bytes += encoded.size();
+      benchmark::DoNotOptimize(&decoded);
+    }
+
+  state.SetBytesProcessed(bytes);
+}
+
+template <typename T>
+void SizeMessage(benchmark::State & state, const T & message)
+{
+  std::size_t bytes = 0;
+  AllocationCounter allocations(state);
+
+  for (auto _ : state)
+    {
+      const std::size_t size = Binary::RawSize(message);
+      bytes += size;
+      benchmark::DoNotOptimize(size);
+    }
+
+  state.SetBytesProcessed(bytes);
+}
+
+//
+// Representative messages.
+//
+
+NodeId MakeNodeId(uint32_t idx)
+{
+  if (idx % 2)
+    {
+      return StringNodeId("Plant.Line" + std::to_string(idx % 16) + ".Sensor" + std::to_string(idx), 2);
+    }
+
+  return NumericNodeId(idx, 2);
+}
+
+ReadResponse MakeReadResponse(uint32_t count)
+{
+  ReadResponse response;
+  response.Results.reserve(count);
+
+  for (uint32_t i = 0; i < count; ++i)
+    {
+      DataValue value(static_cast<double>(i) * 0.5);
+      value.Status = StatusCode::Good;
+      value.SourceTimestamp = DateTime::Current();
+      value.ServerTimestamp = value.SourceTimestamp;
+      value.Encoding |= DATA_VALUE_STATUS_CODE | DATA_VALUE_SOURCE_TIMESTAMP | DATA_VALUE_Server_TIMESTAMP;
+      response.Results.push_back(value);
+    }
+
+  return response;
+}
+
+ReadRequest MakeReadRequest(uint32_t count)
+{
+  ReadRequest request;
+  request.Parameters.TimestampsToReturn = TimestampsToReturn::Both;
+  request.Parameters.AttributesToRead.reserve(count);
+
+  for (uint32_t i = 0; i < count; ++i)
+    {
+      ReadValueId id;
+      id.NodeId = MakeNodeId(i);
+      id.AttributeId = AttributeId::Value;
+      request.Parameters.AttributesToRead.push_back(id);
+    }
+
+  return request;
+}
+
+BrowseRequest MakeBrowseRequest(uint32_t count)
+{
+  BrowseRequest request;
+  request.Query.NodesToBrowse.reserve(count);
+
+  for (uint32_t i = 0; i < count; ++i)
+    {
+      BrowseDescription desc;
+      desc.NodeToBrowse = MakeNodeId(i);
+      desc.Direction = BrowseDirection::Forward;
+      desc.ReferenceTypeId = ObjectId::HierarchicalReferences;
+      desc.IncludeSubtypes = true;
+      desc.ResultMask = BrowseResultMask::All;
+      request.Query.NodesToBrowse.push_back(desc);
+    }
+
+  return request;
+}
+
+PublishResponse MakePublishResponse(uint32_t count)
+{
+  DataChangeNotification change;
+  change.Notification.reserve(count);
+
+  for (uint32_t i = 0; i < count; ++i)
+    {
+      MonitoredItems item;
+      item.ClientHandle = i;
+      item.Value = DataValue(static_cast<int32_t>(i));
+      item.Value.SourceTimestamp = DateTime::Current();
+      item.Value.Encoding |= DATA_VALUE_SOURCE_TIMESTAMP;
+      change.Notification.push_back(item);
+    }
+
+  PublishResponse response;
+  response.Parameters.SubscriptionId = 1;
+  response.Parameters.AvailableSequenceNumbers = {1, 2, 3};
+  response.Parameters.NotificationMessage.SequenceNumber = 3;
+  response.Parameters.NotificationMessage.PublishTime = DateTime::Current();
+  response.Parameters.NotificationMessage.NotificationData.push_back(NotificationData(change));
+  return response;
+}
+
+BrowseResponse MakeBrowseResponse(uint32_t count)
+{
+  BrowseResult result;
+  result.Status = StatusCode::Good;
+  result.Referencies.reserve(count);
+
+  for (uint32_t i = 0; i < count; ++i)
+    {
+      ReferenceDescription ref;
+      ref.ReferenceTypeId = ObjectId::HasComponent;
+      ref.IsForward = true;
+      ref.TargetNodeId = MakeNodeId(i);
+      ref.BrowseName = QualifiedName("Sensor" + std::to_string(i), 2);
+      ref.DisplayName = LocalizedText("Sensor" + std::to_string(i));
+      ref.TargetNodeClass = NodeClass::Variable;
+      ref.TargetNodeTypeDefinition = ObjectId::BaseDataVariableType;
+      result.Referencies.push_back(ref);
+    }
+
+  BrowseResponse response;
+  response.Results.push_back(result);
+  return response;
+}
+
+CreateMonitoredItemsRequest MakeCreateMonitoredItemsRequest(uint32_t count)
+{
+  CreateMonitoredItemsRequest request;
+  request.Parameters.SubscriptionId = 1;
+  request.Parameters.TimestampsToReturn = TimestampsToReturn::Both;
+  request.Parameters.ItemsToCreate.reserve(count);
+
+  for (uint32_t i = 0; i < count; ++i)
+    {
+      MonitoredItemCreateRequest item;
+      item.ItemToMonitor.NodeId = MakeNodeId(i);
+      item.ItemToMonitor.AttributeId = AttributeId::Value;
+      item.MonitoringMode = MonitoringMode::Reporting;
+      item.RequestedParameters.ClientHandle = i;
+      item.RequestedParameters.SamplingInterval = 100;
+      item.RequestedParameters.QueueSize = 1;
+      item.RequestedParameters.DiscardOldest = true;
+      request.Parameters.ItemsToCreate.push_back(item);
+    }
+
+  return request;
+}
+
+template <typename T>
+Variant MakeArray(std::size_t count, T (*make)(std::size_t))
+{
+  std::vector<T> values;
+  values.reserve(count);
+
+  for (std::size_t i = 0; i < count; ++i)
+    {
+      values.push_back(make(i));
+    }
+
+  return Variant(values);
+}
+
+template <typename T>
+T MakeNumber(std::size_t i)
+{
+  return static_cast<T>(i);
+}
+
+bool MakeBool(std::size_t i)
+{
+  return i % 2;
+}
+
+std::string MakeString(std::size_t i)
+{
+  return "value_" + std::to_string(i);
+}
+
+DateTime MakeDateTime(std::size_t i)
+{
+  return DateTime(static_cast<int64_t>(i) + 130000000000000000ll);
+}
+
+Guid MakeGuid(std::size_t i)
+{
+  Guid guid;
+  guid.Data1 = static_cast<uint32_t>(i);
+  return guid;
+}
+
+ByteString MakeByteString(std::size_t i)
+{
+  return ByteString(std::vector<uint8_t>(16, static_cast<uint8_t>(i)));
+}
+
+NodeId MakeArrayNodeId(std::size_t i)
+{
+  return MakeNodeId(static_cast<uint32_t>(i));
+}
+
+StatusCode MakeStatusCode(std::size_t i)
+{
+  return i % 2 ? StatusCode::Good : StatusCode::BadNodeIdUnknown;
+}
+
+QualifiedName MakeQualifiedName(std::size_t i)
+{
+  return QualifiedName(MakeString(i), 2);
+}
+
+LocalizedText MakeLocalizedText(std::size_t i)
+{
+  return LocalizedText(MakeString(i), "en");
+}
+
+Variant MakeVariant(std::size_t i)
+{
+  return Variant(static_cast<uint32_t>(i));
+}
+
+//
+// Name tables
+//
+
+std::vector<ObjectId> GetKnownObjectIds()
+{
+  std::vector<ObjectId> ids;
+
+  for (uint32_t value = 0; value < 20000; ++value)
+    {
+      if (GetObjectIdName(static_cast<ObjectId>(value)))
+        {
+          ids.push_back(static_cast<ObjectId>(value));
+        }
+    }
+
+  return ids;
+}
+
+std::vector<std::string> GetObjectIdNames()
+{
+  std::vector<std::string> names;
+
+  for (ObjectId id : GetKnownObjectIds())
+    {
+      names.push_back(GetObjectIdName(id));
+    }
+
+  return names;
+}
+
+void ObjectIdToString(benchmark::State & state)
+{
+  const std::vector<ObjectId> ids = GetKnownObjectIds();
+  std::size_t idx = 0;
+
+  for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(ToString(ids[idx++ % ids.size()]));
+    }
+}
+
+void ObjectIdName(benchmark::State & state)
+{
+  const std::vector<ObjectId> ids = GetKnownObjectIds();
+  std::size_t idx = 0;
+
+  for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(GetObjectIdName(ids[idx++ % ids.size()]));
+    }
+}
+
+void ObjectIdFromName(benchmark::State & state)
+{
+  const std::vector<std::string> names = GetObjectIdNames();
+  std::size_t idx = 0;
+
+  for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(ToObjectId(names[idx++ % names.size()]));
+    }
+}
+
+// what callers had to build before ToObjectId existed
+void ObjectIdFromNameMap(benchmark::State & state)
+{
+  const std::vector<std::string> names = GetObjectIdNames();
+  std::unordered_map<std::string, ObjectId> map;
+
+  for (ObjectId id : GetKnownObjectIds())
+    {
+      map[ToString(id)] = id;
+    }
+
+  std::size_t idx = 0;
+
+  for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(map.find(names[idx++ % names.size()]));
+    }
+}
+
+void StatusCodeToString(benchmark::State & state)
+{
+  const std::vector<StatusCode> codes = {StatusCode::BadNodeIdUnknown, StatusCode::BadTimeout, StatusCode::BadAttributeIdInvalid, StatusCode::BadSessionIdInvalid};
+  std::size_t idx = 0;
+
+  for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(ToString(codes[idx++ % codes.size()]));
+    }
+}
+
+void StatusCodeFromName(benchmark::State & state)
+{
+  const std::vector<std::string> names = {"BadNodeIdUnknown", "BadTimeout", "BadAttributeIdInvalid", "BadSessionIdInvalid"};
+  std::size_t idx = 0;
+
+  for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(ToStatusCode(names[idx++ % names.size()]));
+    }
+}
+
+void NodeIdFromString(benchmark::State & state, const std::string & text)
+{
+  AllocationCounter allocations(state);
+
+  for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(ToNodeId(text));
+    }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+void NodeIdToString(benchmark::State & state, const NodeId & id)
+{
+  AllocationCounter allocations(state);
+
+  for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(ToString(id));
+    }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+void NodeIdToChars(benchmark::State & state, const NodeId & id)
+{
+  char buffer[64];
+  AllocationCounter allocations(state);
+
+  for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(ToChars(id, buffer, sizeof(buffer)));
+      benchmark::DoNotOptimize(buffer);
+    }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+void QualifiedNameFromString(benchmark::State & state)
+{
+  const std::string text = "2:Sensor42";
+  AllocationCounter allocations(state);
+
+  for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(ToQualifiedName(text));
+    }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+const uint32_t ReadValues = 10000;
+const uint32_t PublishItems = 1000;
+const uint32_t BrowseReferences = 50000;
+const uint32_t BrowseNodes = 1000;
+const uint32_t MonitoredItemsCount = 1000;
+const std::size_t ArraySize = 1000;
+
+template <typename T>
+void RegisterMessage(const std::string & name, const T & message)
+{
+  benchmark::RegisterBenchmark((name + "/Encode").c_str(), [message](benchmark::State & state) { EncodeMessage(state, message); });
+  benchmark::RegisterBenchmark((name + "/Decode").c_str(), [message](benchmark::State & state) { DecodeMessage(state, message); });
+  benchmark::RegisterBenchmark((name + "/RawSize").c_str(), [message](benchmark::State & state) { SizeMessage(state, message); });
+}
+
+void RegisterAll()
+{
+  RegisterMessage("ReadRequest/" + std::to_string(ReadValues), MakeReadRequest(ReadValues));
+  RegisterMessage("ReadResponse/" + std::to_string(ReadValues), MakeReadResponse(ReadValues));
+  RegisterMessage("BrowseRequest/" + std::to_string(BrowseNodes), MakeBrowseRequest(BrowseNodes));
+  RegisterMessage("PublishResponse/" + std::to_string(PublishItems), MakePublishResponse(PublishItems));
+  RegisterMessage("BrowseResponse/" + std::to_string(BrowseReferences), MakeBrowseResponse(BrowseReferences));
+  RegisterMessage("CreateMonitoredItemsRequest/" + std::to_string(MonitoredItemsCount), MakeCreateMonitoredItemsRequest(MonitoredItemsCount));
+
+  const std::vector<std::pair<std::string, Variant>> arrays =
+  {
+    {"Boolean", MakeArray<bool>(ArraySize, MakeBool)},
+    {"SByte", MakeArray<int8_t>(ArraySize, MakeNumber<int8_t>)},
+    {"Byte", MakeArray<uint8_t>(ArraySize, MakeNumber<uint8_t>)},
+    {"Int16", MakeArray<int16_t>(ArraySize, MakeNumber<int16_t>)},
+    {"UInt16", MakeArray<uint16_t>(ArraySize, MakeNumber<uint16_t>)},
+    {"Int32", MakeArray<int32_t>(ArraySize, MakeNumber<int32_t>)},
+    {"UInt32", MakeArray<uint32_t>(ArraySize, MakeNumber<uint32_t>)},
+    {"Int64", MakeArray<int64_t>(ArraySize, MakeNumber<int64_t>)},
+    {"UInt64", MakeArray<uint64_t>(ArraySize, MakeNumber<uint64_t>)},
+    {"Float", MakeArray<float>(ArraySize, MakeNumber<float>)},
+    {"Double", MakeArray<double>(ArraySize, MakeNumber<double>)},
+    {"String", MakeArray<std::string>(ArraySize, MakeString)},
+    {"DateTime", MakeArray<DateTime>(ArraySize, MakeDateTime)},
+    {"Guid", MakeArray<Guid>(ArraySize, MakeGuid)},
+    {"ByteString", MakeArray<ByteString>(ArraySize, MakeByteString)},
+    {"NodeId", MakeArray<NodeId>(ArraySize, MakeArrayNodeId)},
+    {"StatusCode", MakeArray<StatusCode>(ArraySize, MakeStatusCode)},
+    {"QualifiedName", MakeArray<QualifiedName>(ArraySize, MakeQualifiedName)},
+    {"LocalizedText", MakeArray<LocalizedText>(ArraySize, MakeLocalizedText)},
+    {"Variant", MakeArray<Variant>(ArraySize, MakeVariant)},
+  };
+
+  for (const auto & array : arrays)
+    {
+      RegisterMessage("VariantArray/" + array.first + "/" + std::to_string(ArraySize), array.second);
+    }
+
+  benchmark::RegisterBenchmark("Names/ObjectId/ToString", ObjectIdToString);
+  benchmark::RegisterBenchmark("Names/ObjectId/GetObjectIdName", ObjectIdName);
+  benchmark::RegisterBenchmark("Names/ObjectId/ToObjectId", ObjectIdFromName);
+  benchmark::RegisterBenchmark("Names/ObjectId/UnorderedMap", ObjectIdFromNameMap);
+  benchmark::RegisterBenchmark("Names/StatusCode/ToString", StatusCodeToString);
+  benchmark::RegisterBenchmark("Names/StatusCode/ToStatusCode", StatusCodeFromName);
+
+  const std::vector<std::pair<std::string, std::string>> nodeIds =
+  {
+    {"Standard", "i=51"},
+    {"Numeric", "ns=2;i=1001;"},
+    {"String", "ns=2;s=Plant.Line3.Sensor42;"},
+    {"Guid", "ns=1;g=01020304-0506-0708-090A-0B0C0D0E0F10;"},
+  };
+
+  for (const auto & nodeId : nodeIds)
+    {
+      const std::string text = nodeId.second;
+      const NodeId id = ToNodeId(text);
+      benchmark::RegisterBenchmark(("Strings/NodeId/" + nodeId.first + "/Parse").c_str(), [text](benchmark::State & state) { NodeIdFromString(state, text); });
+      benchmark::RegisterBenchmark(("Strings/NodeId/" + nodeId.first + "/ToString").c_str(), [id](benchmark::State & state) { NodeIdToString(state, id); });
+      benchmark::RegisterBenchmark(("Strings/NodeId/" + nodeId.first + "/ToChars").c_str(), [id](benchmark::State & state) { NodeIdToChars(state, id); });
+    }
+
+  benchmark::RegisterBenchmark("Strings/QualifiedName/Parse", QualifiedNameFromString);
+}
+
+} // namespace
+
+int main(int argc, char ** argv)
+{
+  RegisterAll();
+  benchmark::Initialize(&argc, argv);
+
+  if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+      return 1;
+    }
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,516 @@
+/// @brief End-to-end server load generator.
+/// Starts an in-process UaServer with a synthetic address space and drives it
+/// over loopback with several UaClient instances running a mixed
+/// Read/Write/Browse/Subscribe workload. Results are printed as JSON.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include "bench_common.h"
+
+#include <opc/ua/client/client.h>
+#include <opc/ua/node.h>
+#include <opc/ua/server/server.h>
+#include <opc/ua/subscription.h>
+
+#include <boost/program_options/options_description.hpp>
+#include <boost/program_options/parsers.hpp>
+#include <boost/program_options/variables_map.hpp>
+
+#include <atomic>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+namespace
+{
+namespace po = boost::program_options;
+using namespace OpcUa;
+using namespace OpcUa::Bench;
+
+enum Operation
+{
+  OP_READ = 0,
+  OP_WRITE,
+  OP_BROWSE,
+  OP_SUBSCRIBE,
+  OP_COUNT
+};
+
+const char * OperationNames[OP_COUNT] = {"read", "write", "browse", "subscribe"};
+
+struct BenchConfig
+{
+  std::string Endpoint;
+  uint32_t Nodes = 10000;
+  uint32_t Clients = 4;
+  uint32_t Duration = 10;
+  uint32_t Warmup = 1;
+  uint32_t Batch = 1;
+  uint32_t PublishingInterval = 100;
+  uint32_t SubscribedItems = 100;
+  bool LowLatency = false;
+  bool EncodedValueCache = false;
+  uint32_t Weights[OP_COUNT] = {70, 20, 5, 5};
+  std::string Output;
+  bool Debug = false;
+};
+
+struct WorkerResult
+{
+  LatencyRecorder Ops[OP_COUNT];
+  uint64_t Notifications = 0;
+  LatencyRecorder NotificationDelays;
+  std::string Error;
+};
+
+class NotificationCounter : public SubscriptionHandler
+{
+public:
+  explicit NotificationCounter(Clock::time_point measureFrom)
+    : MeasureFrom(measureFrom)
+  {
+  }
+
+  void DataChange(uint32_t, const Node &, const Variant &, AttributeId) override
+  {
+  }
+
+  void DataValueChange(uint32_t, const Node &, const DataValue & value, AttributeId) override
+  {
+    ++Count;
+
+    // delay from the write stored on the server, both run in this process
+    if ((value.Encoding & DATA_VALUE_Server_TIMESTAMP) && Clock::now() >= MeasureFrom)
+      {
+        const int64_t ticks = DateTime::Current().Value - value.ServerTimestamp.Value;
+        std::lock_guard<std::mutex> lock(Mutex);
+        Delays.Add(std::chrono::nanoseconds(ticks * 100));
+      }
+  }
+
+  LatencyRecorder GetDelays()
+  {
+    std::lock_guard<std::mutex> lock(Mutex);
+    return Delays;
+  }
+
+  std::atomic<uint64_t> Count{0};
+
+private:
+  const Clock::time_point MeasureFrom;
+  std::mutex Mutex;
+  LatencyRecorder Delays;
+};
+
+void ParseMix(const std::string & mix, uint32_t (&weights)[OP_COUNT])
+{
+  std::istringstream is(mix);
+  std::string item;
+  unsigned idx = 0;
+
+  while (std::getline(is, item, ':'))
+    {
+      if (idx >= OP_COUNT)
+        {
+          throw std::invalid_argument("mix must contain at most four weights: read:write:browse:subscribe");
+        }
+
+      weights[idx++] = std::stoul(item);
+    }
+
+  for (; idx < OP_COUNT; ++idx)
+    {
+      weights[idx] = 0;
+    }
+}
+
+bool ParseCommandLine(int argc, char ** argv, BenchConfig & config)
+{
+  std::string mix = "70:20:5:5";
+
+  po::options_description desc("Parameters");
+  desc.add_options()
+  ("help", "Print help message and exit.")
+  ("endpoint", po::value<std::string>(&config.Endpoint)->default_value("opc.tcp://127.0.0.1:4845/freeopcua/bench"), "Endpoint the in-process server listens on.")
+  ("nodes", po::value<uint32_t>(&config.Nodes)->default_value(config.Nodes), "Number of variables in the synthetic address space.")
+  ("clients", po::value<uint32_t>(&config.Clients)->default_value(config.Clients), "Number of concurrent clients.")
+  ("duration", po::value<uint32_t>(&config.Duration)->default_value(config.Duration), "Measured run time in seconds.")
+  ("warmup", po::value<uint32_t>(&config.Warmup)->default_value(config.Warmup), "Warmup time in seconds, not included in results.")
+  ("batch", po::value<uint32_t>(&config.Batch)->default_value(config.Batch), "Nodes per Read/Write/Browse request.")
+  ("mix", po::value<std::string>(&mix)->default_value(mix), "Operation weights as read:write:browse:subscribe.")
+  ("publishing-interval", po::value<uint32_t>(&config.PublishingInterval)->default_value(config.PublishingInterval), "Publishing interval of client subscriptions in ms.")
+  ("subscribed-items", po::value<uint32_t>(&config.SubscribedItems)->default_value(config.SubscribedItems), "Monitored items each client keeps during the run.")
+  ("low-latency", "Send data changes as soon as a publish request is available instead of once per publishing interval.")
+  ("encoded-value-cache", "Encode every value once per change instead of once per Read.")
+  ("output", po::value<std::string>(&config.Output), "Write JSON result to this file instead of stdout.")
+  ("debug", "Enable server and client debug logging.");
+
+  po::variables_map vm;
+  po::store(po::parse_command_line(argc, argv, desc), vm);
+  po::notify(vm);
+
+  if (vm.count("help"))
+    {
+      std::cout << desc << std::endl;
+      return false;
+    }
+
+  config.Debug = vm.count("debug") != 0;
+  config.LowLatency = vm.count("low-latency") != 0;
+  config.EncodedValueCache = vm.count("encoded-value-cache") != 0;
+  ParseMix(mix, config.Weights);
+
+  if (!config.Nodes || !config.Clients || !config.Batch)
+    {
+      throw std::invalid_argument("nodes, clients and batch must be greater than zero");
+    }
+
+  return true;
+}
+
+NodeId BenchNodeId(uint32_t idx, uint16_t ns)
+{
+  return NumericNodeId(idx + 1, ns);
+}
+
+void FillAddressSpace(UaServer & server, const BenchConfig & config, uint16_t ns)
+{
+  Node folder = server.GetObjectsNode().AddFolder(NumericNodeId(0x7FFFFFFF, ns), QualifiedName("Bench", ns));
+
+  for (uint32_t i = 0; i < config.Nodes; ++i)
+    {
+      std::stringstream name;
+      name << "Var" << i;
+      folder.AddVariable(BenchNodeId(i, ns), QualifiedName(name.str(), ns), Variant(static_cast<double>(i)));
+
+      if (config.EncodedValueCache)
+        {
+          server.EnableEncodedValueCache(BenchNodeId(i, ns));
+        }
+    }
+}
+
+Operation PickOperation(Random & rnd, const BenchConfig & config, uint32_t totalWeight)
+{
+  uint32_t pick = rnd.Below(totalWeight);
+
+  for (unsigned op = 0; op < OP_COUNT; ++op)
+    {
+      if (pick < config.Weights[op])
+        {
+          return static_cast<Operation>(op);
+        }
+
+      pick -= config.Weights[op];
+    }
+
+  return OP_READ;
+}
+
+bool AllGood(const std::vector<StatusCode> & statuses)
+{
+  return std::all_of(statuses.begin(), statuses.end(), [](StatusCode s) { return s == StatusCode::Good; });
+}
+
+void RunWorker(unsigned id, const BenchConfig & config, uint16_t ns, const Common::Logger::SharedPtr & logger,
+               Clock::time_point measureFrom, Clock::time_point stopAt, WorkerResult & result)
+{
+  try
+    {
+      UaClient client(logger);
+      client.Connect(config.Endpoint);
+      Services::SharedPtr services = client.GetRootNode().GetServices();
+
+      NotificationCounter counter(measureFrom);
+      Subscription::SharedPtr sub = client.CreateSubscription(config.PublishingInterval, counter);
+
+      std::vector<ReadValueId> monitored;
+
+      for (uint32_t i = 0; i < std::min(config.SubscribedItems, config.Nodes); ++i)
+        {
+          ReadValueId item;
+          item.NodeId = BenchNodeId((id * config.SubscribedItems + i) % config.Nodes, ns);
+          item.AttributeId = AttributeId::Value;
+          monitored.push_back(item);
+        }
+
+      if (!monitored.empty())
+        {
+          sub->SubscribeDataChange(monitored);
+        }
+
+      Random rnd(0x5DEECE66Dull * (id + 1));
+      uint32_t totalWeight = 0;
+
+      for (uint32_t w : config.Weights)
+        {
+          totalWeight += w;
+        }
+
+      while (Clock::now() < stopAt)
+        {
+          const Operation op = PickOperation(rnd, config, totalWeight);
+          bool ok = true;
+          const Clock::time_point start = Clock::now();
+
+          try
+            {
+              switch (op)
+                {
+                case OP_READ:
+                {
+                  ReadParameters params;
+
+                  for (uint32_t i = 0; i < config.Batch; ++i)
+                    {
+                      params.AttributesToRead.push_back(ToReadValueId(BenchNodeId(rnd.Below(config.Nodes), ns), AttributeId::Value));
+                    }
+
+                  std::vector<DataValue> values = services->Attributes()->Read(params);
+                  ok = values.size() == params.AttributesToRead.size();
+                  break;
+                }
+
+                case OP_WRITE:
+                {
+                  std::vector<WriteValue> values;
+
+                  for (uint32_t i = 0; i < config.Batch; ++i)
+                    {
+                      WriteValue value;
+                      value.NodeId = BenchNodeId(rnd.Below(config.Nodes), ns);
+                      value.AttributeId = AttributeId::Value;
+                      value.Value = DataValue(static_cast<double>(rnd.Next() % 1000000));
+                      values.push_back(value);
+                    }
+
+                  ok = AllGood(services->Attributes()->Write(values));
+                  break;
+                }
+
+                case OP_BROWSE:
+                {
+                  NodesQuery query;
+
+                  for (uint32_t i = 0; i < config.Batch; ++i)
+                    {
+                      BrowseDescription desc;
+                      desc.NodeToBrowse = BenchNodeId(rnd.Below(config.Nodes), ns);
+                      desc.Direction = BrowseDirection::Both;
+                      desc.ReferenceTypeId = ObjectId::References;
+                      desc.IncludeSubtypes = true;
+                      query.NodesToBrowse.push_back(desc);
+                    }
+
+                  ok = services->Views()->Browse(query).size() == query.NodesToBrowse.size();
+                  break;
+                }
+
+                case OP_SUBSCRIBE:
+                {
+                  ReadValueId item;
+                  item.NodeId = BenchNodeId(rnd.Below(config.Nodes), ns);
+                  item.AttributeId = AttributeId::Value;
+                  std::vector<uint32_t> handles = sub->SubscribeDataChange(std::vector<ReadValueId>(1, item));
+                  sub->UnSubscribe(handles);
+                  break;
+                }
+
+                default:
+                  break;
+                }
+            }
+
+          catch (const std::exception & exc)
+            {
+              LOG_DEBUG(logger, "opcua_bench           | client {} operation {} failed: {}", id, OperationNames[op], exc.what());
+              ok = false;
+            }
+
+          const Clock::time_point end = Clock::now();
+
+          if (start < measureFrom)
+            {
+              continue;
+            }
+
+          if (ok)
+            {
+              result.Ops[op].Add(end - start);
+            }
+
+          else
+            {
+              result.Ops[op].AddError();
+            }
+        }
+
+      result.Notifications = counter.Count;
+      result.NotificationDelays = counter.GetDelays();
+      sub->Delete();
+      client.Disconnect();
+    }
+
+  catch (const std::exception & exc)
+    {
+      result.Error = exc.what();
+    }
+}
+
+void WriteReport(std::ostream & os, const BenchConfig & config, std::vector<WorkerResult> & results, double seconds)
+{
+  LatencyRecorder merged[OP_COUNT];
+  LatencyRecorder all;
+  uint64_t notifications = 0;
+  LatencyRecorder delays;
+  unsigned failedClients = 0;
+
+  for (WorkerResult & result : results)
+    {
+      for (unsigned op = 0; op < OP_COUNT; ++op)
+        {
+          merged[op].Merge(result.Ops[op]);
+          all.Merge(result.Ops[op]);
+        }
+
+      notifications += result.Notifications;
+      delays.Merge(result.NotificationDelays);
+
+      if (!result.Error.empty())
+        {
+          ++failedClients;
+        }
+    }
+
+  os << "{\n";
+  os << "  \"config\": {\"nodes\": " << config.Nodes
+     << ", \"clients\": " << config.Clients
+     << ", \"duration_s\": " << config.Duration
+     << ", \"batch\": " << config.Batch
+     << ", \"publishing_interval_ms\": " << config.PublishingInterval
+     << ", \"subscribed_items\": " << config.SubscribedItems
+     << ", \"low_latency\": " << (config.LowLatency ? "true" : "false")
+     << ", \"encoded_value_cache\": " << (config.EncodedValueCache ? "true" : "false")
+     << ", \"mix\": {";
+
+  for (unsigned op = 0; op < OP_COUNT; ++op)
+    {
+      os << (op ? ", " : "") << "\"" << OperationNames[op] << "\": " << config.Weights[op];
+    }
+
+  os << "}},\n";
+  os << "  \"elapsed_s\": " << seconds << ",\n";
+  os << "  \"failed_clients\": " << failedClients << ",\n";
+  os << "  \"total\": ";
+  WriteJsonStats(os, all, seconds);
+  os << ",\n  \"operations\": {\n";
+
+  for (unsigned op = 0; op < OP_COUNT; ++op)
+    {
+      os << "    \"" << OperationNames[op] << "\": ";
+      WriteJsonStats(os, merged[op], seconds);
+      os << (op + 1 < OP_COUNT ? ",\n" : "\n");
+    }
+
+  os << "  },\n";
+  os << "  \"notifications\": {\"received\": " << notifications
+     << ", \"per_sec\": " << (seconds > 0 ? notifications / seconds : 0)
+     << ", \"delay_p50_us\": " << delays.Percentile(0.50) * 1e-3
+     << ", \"delay_p99_us\": " << delays.Percentile(0.99) * 1e-3 << "}\n";
+  os << "}" << std::endl;
+}
+
+int RunBenchmark(const BenchConfig & config)
+{
+  Common::Logger::SharedPtr logger = spdlog::stderr_color_mt("opcua_bench");
+  logger->set_level(config.Debug ? spdlog::level::debug : spdlog::level::warn);
+  // the standard address space reports a few known inconsistencies at startup,
+  // keep them out of the benchmark output unless debugging
+  Common::Logger::SharedPtr serverLogger = spdlog::stderr_color_mt("opcua_bench_server");
+  serverLogger->set_level(config.Debug ? spdlog::level::debug : spdlog::level::critical);
+
+  UaServer server(serverLogger);
+  server.SetEndpoint(config.Endpoint);
+  server.SetServerURI("urn://bench.freeopcua.github.io");
+  server.Start();
+
+  if (config.LowLatency)
+    {
+      Server::PublishParameters publish;
+      publish.LowLatency = true;
+      server.SetPublishParameters(publish);
+    }
+
+  const uint16_t ns = static_cast<uint16_t>(server.RegisterNamespace("http://bench.freeopcua.github.io"));
+  FillAddressSpace(server, config, ns);
+
+  std::vector<WorkerResult> results(config.Clients);
+  std::vector<std::thread> workers;
+  const Clock::time_point begin = Clock::now();
+  const Clock::time_point measureFrom = begin + std::chrono::seconds(config.Warmup);
+  const Clock::time_point stopAt = measureFrom + std::chrono::seconds(config.Duration);
+
+  for (unsigned i = 0; i < config.Clients; ++i)
+    {
+      workers.push_back(std::thread(RunWorker, i, std::cref(config), ns, logger, measureFrom, stopAt, std::ref(results[i])));
+    }
+
+  for (std::thread & worker : workers)
+    {
+      worker.join();
+    }
+
+  const double seconds = std::chrono::duration<double>(Clock::now() - measureFrom).count();
+
+  for (unsigned i = 0; i < results.size(); ++i)
+    {
+      if (!results[i].Error.empty())
+        {
+          LOG_ERROR(logger, "opcua_bench           | client {} failed: {}", i, results[i].Error);
+        }
+    }
+
+  if (config.Output.empty())
+    {
+      WriteReport(std::cout, config, results, seconds);
+    }
+
+  else
+    {
+      std::ofstream out(config.Output);
+      WriteReport(out, config, results, seconds);
+    }
+
+  server.Stop();
+  return 0;
+}
+
+}
+
+int main(int argc, char ** argv)
+{
+  try
+    {
+      BenchConfig config;
+
+      if (!ParseCommandLine(argc, argv, config))
+        {
+          return 0;
+        }
+
+      return RunBenchmark(config);
+    }
+
+  catch (const std::exception & exc)
+    {
+      std::cerr << exc.what() << std::endl;
+    }
+
+  return -1;
+}
@@ -0,0 +1,254 @@
+/// @brief Throughput of server side value updates.
+/// Starts an in-process UaServer with a synthetic address space and compares
+/// Node::SetValue, a batched Write, UaServer::UpdateValues by NodeId and
+/// by handle and queuing values into a ValueIngest. Every benchmark runs on
+/// variables without monitored items and on variables monitored by a server
+/// side subscription.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include <opc/ua/node.h>
+#include <opc/ua/server/server.h>
+#include <opc/ua/subscription.h>
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <sstream>
+
+namespace
+{
+using namespace OpcUa;
+
+const uint32_t VariablesCount = 1000;
+const char Endpoint[] = "opc.tcp://127.0.0.1:4846/freeopcua/update_bench";
+
+class NotificationCounter : public SubscriptionHandler
+{
+public:
+  void DataChange(uint32_t, const Node &, const Variant &, AttributeId) override
+  {
+  }
+
+  void DataValueChange(uint32_t, const Node &, const DataValue &, AttributeId) override
+  {
+    Count.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  std::atomic<uint64_t> Count{0};
+};
+
+/// @brief Variables of one benchmark run, the monitored set is subscribed.
+struct Variables
+{
+  std::vector<Node> Nodes;
+  std::vector<uint32_t> Handles;
+};
+
+UaServer * Instance = nullptr;
+Variables Plain;
+Variables Monitored;
+
+Variables AddVariables(Node & folder, uint16_t ns, uint32_t first)
+{
+  Variables result;
+
+  for (uint32_t i = 0; i < VariablesCount; ++i)
+    {
+      std::stringstream name;
+      name << "Var" << first + i;
+      Node node = folder.AddVariable(NumericNodeId(first + i + 1, ns), QualifiedName(name.str(), ns), Variant(0.0));
+      result.Nodes.push_back(node);
+      result.Handles.push_back(Instance->GetValueHandle(node.GetId()));
+    }
+
+  return result;
+}
+
+const Variables & Select(const benchmark::State & state)
+{
+  return state.range(1) ? Monitored : Plain;
+}
+
+void Finish(benchmark::State & state)
+{
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void NodeSetValue(benchmark::State & state)
+{
+  const Variables & vars = Select(state);
+  double value = 0;
+
+  for (auto _ : state)
+    {
+      for (int64_t i = 0; i < state.range(0); ++i)
+        {
+          Node node = vars.Nodes[i];
+          node.SetValue(Variant(++value));
+        }
+    }
+
+  Finish(state);
+}
+
+void Write(benchmark::State & state)
+{
+  const Variables & vars = Select(state);
+  ServerOperations operations = Instance->CreateServerOperations();
+  double value = 0;
+
+  for (auto _ : state)
+    {
+      std::vector<WriteValue> values(state.range(0));
+
+      for (int64_t i = 0; i < state.range(0); ++i)
+        {
+          values[i].NodeId = vars.Nodes[i].GetId();
+          values[i].AttributeId = AttributeId::Value;
+          values[i].Value = DataValue(++value);
+        }
+
+      operations.WriteAttributes(values);
+    }
+
+  Finish(state);
+}
+
+void UpdateValues(benchmark::State & state)
+{
+  const Variables & vars = Select(state);
+  double value = 0;
+
+  for (auto _ : state)
+    {
+      std::vector<Server::ValueUpdate> updates(state.range(0));
+
+      for (int64_t i = 0; i < state.range(0); ++i)
+        {
+          updates[i].Node = vars.Nodes[i].GetId();
+          updates[i].Value = DataValue(++value);
+        }
+
+      benchmark::DoNotOptimize(Instance->UpdateValues(updates));
+    }
+
+  Finish(state);
+}
+
+void UpdateValuesByHandle(benchmark::State & state)
+{
+  const Variables & vars = Select(state);
+  double value = 0;
+
+  for (auto _ : state)
+    {
+      std::vector<Server::HandleValueUpdate> updates(state.range(0));
+
+      for (int64_t i = 0; i < state.range(0); ++i)
+        {
+          updates[i].Handle = vars.Handles[i];
+          updates[i].Value = DataValue(++value);
+        }
+
+      benchmark::DoNotOptimize(Instance->UpdateValues(updates));
+    }
+
+  Finish(state);
+}
+
+void Ingest(benchmark::State & state)
+{
+  const Variables & vars = Select(state);
+  Server::ValueIngest::UniquePtr ingest = Instance->CreateValueIngest();
+  Server::IngestProducer::SharedPtr producer = ingest->CreateProducer();
+  double value = 0;
+
+  for (auto _ : state)
+    {
+      for (int64_t i = 0; i < state.range(0); ++i)
+        {
+          producer->Push(vars.Handles[i], DataValue(++value));
+        }
+    }
+
+  producer.reset();
+  ingest->Stop();
+  const Server::IngestStatistics stats = ingest->GetStatistics();
+  state.counters["dropped"] = static_cast<double>(stats.DroppedCount);
+  state.counters["coalesced"] = static_cast<double>(stats.CoalescedCount);
+  Finish(state);
+}
+
+void RegisterAll()
+{
+  const std::vector<std::pair<const char *, void (*)(benchmark::State &)>> benchmarks =
+  {
+    {"Update/NodeSetValue", NodeSetValue},
+    {"Update/Write", Write},
+    {"Update/UpdateValues", UpdateValues},
+    {"Update/UpdateValuesByHandle", UpdateValuesByHandle},
+    {"Update/Ingest", Ingest},
+  };
+
+  for (const auto & bench : benchmarks)
+    {
+      benchmark::RegisterBenchmark(bench.first, bench.second)
+      ->ArgNames({"batch", "monitored"})
+      ->ArgsProduct({{1, 100, static_cast<int64_t>(VariablesCount)}, {0, 1}});
+    }
+}
+
+} // namespace
+
+int main(int argc, char ** argv)
+{
+  benchmark::Initialize(&argc, argv);
+
+  if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+      return 1;
+    }
+
+  // the standard address space reports a few known inconsistencies at startup
+  Common::Logger::SharedPtr logger = spdlog::stderr_color_mt("update_bench");
+  logger->set_level(spdlog::level::critical);
+
+  UaServer server(logger);
+  server.SetEndpoint(Endpoint);
+  server.Start();
+  Instance = &server;
+
+  const uint16_t ns = static_cast<uint16_t>(server.RegisterNamespace("http://bench.freeopcua.github.io"));
+  Node folder = server.GetObjectsNode().AddFolder(NumericNodeId(0x7FFFFFFF, ns), QualifiedName("Bench", ns));
+  Plain = AddVariables(folder, ns, 0);
+  Monitored = AddVariables(folder, ns, VariablesCount);
+
+  NotificationCounter counter;
+  Subscription::SharedPtr subscription = server.CreateSubscription(100, counter);
+  std::vector<ReadValueId> items;
+
+  for (const Node & node : Monitored.Nodes)
+    {
+      ReadValueId item;
+      item.NodeId = node.GetId();
+      item.AttributeId = AttributeId::Value;
+      items.push_back(item);
+    }
+
+  subscription->SubscribeDataChange(items);
+
+  RegisterAll();
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+
+  subscription->Delete();
+  Plain = Variables();
+  Monitored = Variables();
+  server.Stop();
+  return 0;
+}
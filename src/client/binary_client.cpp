@@ -90,15 +90,29 @@ public:
   void OnData(std::vector<char> data, ResponseHeader h)
   {
     //std::cout << ToHexDump(data);
+    // the requesting thread holds the lock until it waits, so taking it here
+    // guarantees the notification cannot be lost when the response is faster
+    std::lock_guard<std::mutex> guard(m);
     Data = std::move(data);
     this->header = std::move(h);
+    Done = true;
     doneEvent.notify_all();
   }
 
   T WaitForData(std::chrono::milliseconds msec)
   {
-    if (doneEvent.wait_for(lock, msec) == std::cv_status::timeout)
-      { throw std::runtime_error("Response timed out"); }
+    if (!doneEvent.wait_for(lock, msec, [this]() { return Done; }))
+      {
+        // release before the caller takes the callbacks mutex: a late response
+        // may be blocked in OnData while holding it
+        lock.unlock();
+        throw std::runtime_error("Response timed out");
+      }
+
+    if (Data.empty() && this->header.ServiceResult == StatusCode::BadConnectionClosed)
+      {
+        throw std::runtime_error("Connection closed");
+      }
 
     T result;
     result.Header = std::move(this->header);
@@ -125,6 +139,7 @@ private:
   std::mutex m;
   std::unique_lock<std::mutex> lock;
   std::condition_variable doneEvent;
+  bool Done = false;
 };
 
 class CallbackThread
@@ -203,6 +218,7 @@ class BinaryClient
   , public NodeManagementServices
   , public SubscriptionServices
   , public ViewServices
+  , public BinaryClientTransport
   , public std::enable_shared_from_this<BinaryClient>
 {
 private:
@@ -213,12 +229,13 @@ private:
 public:
   BinaryClient(std::shared_ptr<IOChannel> channel, const SecureConnectionParams & params, const Common::Logger::SharedPtr & logger)
     : Channel(channel)
-    , Stream(channel)
+    , Stream(new IOStreamBinary(channel))
     , Params(params)
     , SequenceNumber(1)
     , RequestNumber(1)
     , RequestHandle(0)
     , Logger(logger)
+    , Finished(false)
     , CallbackService(logger)
 
   {
@@ -235,21 +252,7 @@ public:
         throw;
       }
 
-    ReceiveThread = std::thread([this]()
-    {
-      try
-        {
-          while (!Finished)
-            { Receive(); }
-        }
-
-      catch (const std::exception & exc)
-        {
-          if (Finished) { return; }
-
-          LOG_ERROR(Logger, "binary_client         | ReceiveThread: error receiving data: {}", exc.what());
-        }
-    });
+    StartReceiveThread();
   }
 
   ~BinaryClient()
@@ -268,11 +271,54 @@ public:
 
     LOG_DEBUG(Logger, "binary_client         | joining receive thread");
 
-    ReceiveThread.join();
+    if (ReceiveThread.joinable())
+      {
+        ReceiveThread.join();
+      }
 
     LOG_DEBUG(Logger, "binary_client         | receive thread stopped");
   }
 
+  ////////////////////////////////////////////////////////////////
+  /// Transport
+  ////////////////////////////////////////////////////////////////
+  virtual void SetConnectionLostCallback(std::function<void ()> callback) override
+  {
+    std::lock_guard<std::mutex> lock(ConnectionLostMutex);
+    ConnectionLost = callback;
+  }
+
+  virtual void Reconnect(IOChannel::SharedPtr channel) override
+  {
+    LOG_DEBUG(Logger, "binary_client         | Reconnect -->");
+
+    // the receive thread must not report the connection it is stopped on as lost
+    Finished = true;
+    Channel->Stop();
+
+    if (ReceiveThread.joinable())
+      {
+        ReceiveThread.join();
+      }
+
+    FailPendingRequests();
+
+    {
+      std::unique_lock<std::mutex> send_lock(send_mutex);
+      Channel = channel;
+      Stream.reset(new IOStreamBinary(channel));
+      ChannelSecurityToken = SecurityToken();
+      messageBuffer.clear();
+      firstMsgParsed = false;
+      HelloServer(Params);
+    }
+
+    Finished = false;
+    StartReceiveThread();
+
+    LOG_DEBUG(Logger, "binary_client         | Reconnect <--");
+  }
+
   ////////////////////////////////////////////////////////////////
   /// Session Services
   ////////////////////////////////////////////////////////////////
@@ -670,6 +716,29 @@ public:
     return response;
   }
 
+  virtual std::vector<TransferResult> TransferSubscriptions(const TransferSubscriptionsRequest & params, std::function<void (PublishResult)> callback) override
+  {
+    LOG_DEBUG(Logger, "binary_client         | TransferSubscriptions -->");
+
+    TransferSubscriptionsRequest request;
+    request.Header = CreateRequestHeader();
+    request.Parameters = params.Parameters;
+
+    const TransferSubscriptionsResponse response = Send<TransferSubscriptionsResponse>(request);
+
+    for (std::size_t i = 0; i < response.Parameters.Results.size() && i < request.Parameters.SubscriptionIds.size(); ++i)
+      {
+        if (response.Parameters.Results[i].Status == StatusCode::Good && callback)
+          {
+            PublishCallbacks[request.Parameters.SubscriptionIds[i]] = callback;
+          }
+      }
+
+    LOG_DEBUG(Logger, "binary_client         | TransferSubscriptions  <--");
+
+    return response.Parameters.Results;
+  }
+
   ////////////////////////////////////////////////////////////////
   /// View Services
   ////////////////////////////////////////////////////////////////
@@ -805,6 +874,32 @@ public:
     LOG_DEBUG(Logger, "binary_client         | UnregisterNodes <--");
   }
 
+  QueryFirstResult QueryFirst(const QueryFirstParameters & params) const override
+  {
+    LOG_DEBUG(Logger, "binary_client         | QueryFirst -->");
+
+    QueryFirstRequest request;
+    request.Header = CreateRequestHeader();
+    request.Parameters = params;
+    QueryFirstResponse response = Send<QueryFirstResponse>(request);
+
+    LOG_DEBUG(Logger, "binary_client         | QueryFirst <--");
+    return std::move(response.Result);
+  }
+
+  QueryNextResult QueryNext(const QueryNextParameters & params) const override
+  {
+    LOG_DEBUG(Logger, "binary_client         | QueryNext -->");
+
+    QueryNextRequest request;
+    request.Header = CreateRequestHeader();
+    request.Parameters = params;
+    QueryNextResponse response = Send<QueryNextResponse>(request);
+
+    LOG_DEBUG(Logger, "binary_client         | QueryNext <--");
+    return std::move(response.Result);
+  }
+
 private:
   //FIXME: this method should be removed, better add realease option to BrowseNext
   void Release() const
@@ -853,7 +948,7 @@ public:
         //request. ChannelId = channelId; FIXME: spec says it hsould be here, in practice it is not even sent?!?!
         hdr.AddSize(RawSize(request));
 
-        Stream << hdr << algorithmHeader << sequence << request << flush;
+        *Stream << hdr << algorithmHeader << sequence << request << flush;
       }
 
     catch (const std::exception & exc)
@@ -919,7 +1014,7 @@ private:
     hdr.AddSize(RawSize(sequence));
     hdr.AddSize(RawSize(request));
 
-    Stream << hdr << algorithmHeader << sequence << request << flush;
+    *Stream << hdr << algorithmHeader << sequence << request << flush;
   }
 
 
@@ -927,7 +1022,7 @@ private:
   void Receive()
   {
     Binary::SecureHeader responseHeader;
-    Stream >> responseHeader;
+    *Stream >> responseHeader;
     LOG_DEBUG(Logger, "binary_client         | received message: Type: {}, ChunkType: {}, Size: {}, ChannelId: {}", responseHeader.Type, responseHeader.Chunk, responseHeader.Size, responseHeader.ChannelId);
 
     size_t algo_size;
@@ -935,7 +1030,7 @@ private:
     if (responseHeader.Type == MessageType::MT_SECURE_OPEN)
       {
         AsymmetricAlgorithmHeader responseAlgo;
-        Stream >> responseAlgo;
+        *Stream >> responseAlgo;
         algo_size = RawSize(responseAlgo);
       }
 
@@ -943,8 +1038,8 @@ private:
       {
         StatusCode error;
         std::string msg;
-        Stream >> error;
-        Stream >> msg;
+        *Stream >> error;
+        *Stream >> msg;
         std::stringstream stream;
         stream << "Received error message from server: " << ToString(error) << ", " << msg ;
         throw std::runtime_error(stream.str());
@@ -953,13 +1048,13 @@ private:
     else //(responseHeader.Type == MessageType::MT_SECURE_MESSAGE )
       {
         Binary::SymmetricAlgorithmHeader responseAlgo;
-        Stream >> responseAlgo;
+        *Stream >> responseAlgo;
         algo_size = RawSize(responseAlgo);
       }
 
     NodeId id;
     Binary::SequenceHeader responseSequence;
-    Stream >> responseSequence; // TODO Check for request Number
+    *Stream >> responseSequence; // TODO Check for request Number
 
     const std::size_t expectedHeaderSize = RawSize(responseHeader) + algo_size + RawSize(responseSequence);
 
@@ -1004,7 +1099,7 @@ private:
     std::vector<char> buffer(dataSize);
     BufferInputChannel bufferInput(buffer);
     Binary::RawBuffer raw(&buffer[0], dataSize);
-    Stream >> raw;
+    *Stream >> raw;
     LOG_TRACE(Logger, "binary_client         | received message data: {}", ToHexDump(buffer));
 
     if (!firstMsgParsed)
@@ -1033,6 +1128,52 @@ private:
       }
   }
 
+  void StartReceiveThread()
+  {
+    ReceiveThread = std::thread([this]()
+    {
+      try
+        {
+          while (!Finished)
+            { Receive(); }
+        }
+
+      catch (const std::exception & exc)
+        {
+          if (Finished) { return; }
+
+          LOG_ERROR(Logger, "binary_client         | ReceiveThread: error receiving data: {}", exc.what());
+
+          FailPendingRequests();
+
+          std::lock_guard<std::mutex> lock(ConnectionLostMutex);
+
+          if (ConnectionLost)
+            {
+              ConnectionLost();
+            }
+        }
+    });
+  }
+
+  // Answers requests sent on a lost connection at once instead of letting them time out
+  void FailPendingRequests()
+  {
+    CallbackMap callbacks;
+    {
+      std::unique_lock<std::mutex> lock(Mutex);
+      callbacks.swap(Callbacks);
+    }
+
+    for (const auto & pair : callbacks)
+      {
+        ResponseHeader header;
+        header.RequestHandle = pair.first;
+        header.ServiceResult = StatusCode::BadConnectionClosed;
+        pair.second(std::vector<char>(), header);
+      }
+  }
+
   Binary::Acknowledge HelloServer(const SecureConnectionParams & params)
   {
     LOG_DEBUG(Logger, "binary_client         | HelloServer -->");
@@ -1048,13 +1189,13 @@ private:
     Binary::Header hdr(Binary::MT_HELLO, Binary::CHT_SINGLE);
     hdr.AddSize(RawSize(hello));
 
-    Stream << hdr << hello << flush;
+    *Stream << hdr << hello << flush;
 
     Header respHeader;
-    Stream >> respHeader; // TODO add check for acknowledge header
+    *Stream >> respHeader; // TODO add check for acknowledge header
 
     Acknowledge ack;
-    Stream >> ack; // TODO check for connection parameters
+    *Stream >> ack; // TODO check for connection parameters
 
     LOG_DEBUG(Logger, "binary_client         | HelloServer <--");
 
@@ -1102,7 +1243,7 @@ private:
 
 private:
   std::shared_ptr<IOChannel> Channel;
-  mutable IOStreamBinary Stream;
+  mutable std::unique_ptr<IOStreamBinary> Stream;
   SecureConnectionParams Params;
   std::thread ReceiveThread;
 
@@ -1115,7 +1256,9 @@ private:
   mutable std::vector<std::vector<uint8_t>> ContinuationPoints;
   mutable CallbackMap Callbacks;
   Common::Logger::SharedPtr Logger;
-  bool Finished = false;
+  std::atomic<bool> Finished;
+  std::function<void ()> ConnectionLost;
+  std::mutex ConnectionLostMutex;
 
   std::thread callback_thread;
   CallbackThread CallbackService;
@@ -1140,7 +1283,7 @@ void BinaryClient::Send<OpenSecureChannelRequest>(OpenSecureChannelRequest reque
 
   const SequenceHeader sequence = CreateSequenceHeader();
   hdr.AddSize(RawSize(sequence));
-  Stream << hdr << algorithmHeader << sequence << request << flush;
+  *Stream << hdr << algorithmHeader << sequence << request << flush;
 }
 
 } // namespace
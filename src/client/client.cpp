@@ -25,6 +25,8 @@
 #include <opc/ua/node.h>
 #include <opc/ua/protocol/string_utils.h>
 
+#include <algorithm>
+
 #ifdef SSL_SUPPORT_MBEDTLS
 #define MBEDTLS_X509_CRT_PARSE_C
 #include <mbedtls/entropy.h>
@@ -72,16 +74,26 @@ void KeepAliveThread::Run()
       params.SecurityMode = MessageSecurityMode::None;
       params.ClientNonce = std::vector<uint8_t>(1, 0);
       params.RequestLifeTime = Period;
-      OpenSecureChannelResponse response = Server->OpenSecureChannel(params);
 
-      if ((response.ChannelSecurityToken.RevisedLifetime < Period) && (response.ChannelSecurityToken.RevisedLifetime > 0))
+      try
         {
-          Period = response.ChannelSecurityToken.RevisedLifetime;
-        }
+          OpenSecureChannelResponse response = Server->OpenSecureChannel(params);
+
+          if ((response.ChannelSecurityToken.RevisedLifetime < Period) && (response.ChannelSecurityToken.RevisedLifetime > 0))
+            {
+              Period = response.ChannelSecurityToken.RevisedLifetime;
+            }
+
+          LOG_DEBUG(Logger, "keep_alive_thread     | read a variable from address space to keep session open");
 
-      LOG_DEBUG(Logger, "keep_alive_thread     | read a variable from address space to keep session open");
+          NodeToRead.GetValue();
+        }
 
-      NodeToRead.GetValue();
+      catch (const std::exception & ex)
+        {
+          // the connection is lost, the reconnection (if enabled) restarts this thread
+          LOG_WARN(Logger, "keep_alive_thread     | keep alive failed: {}", ex.what());
+        }
     }
 
   Running = false;
@@ -111,6 +123,76 @@ void KeepAliveThread::Stop()
     }
 }
 
+void ReconnectThread::Start(std::function<bool ()> reconnect, const ReconnectParameters & params)
+{
+  Reconnect = reconnect;
+  Parameters = params;
+  Lost = false;
+  StopRequest = false;
+  Thread = std::thread([this] { this->Run(); });
+}
+
+void ReconnectThread::ConnectionLost()
+{
+  std::unique_lock<std::mutex> lock(Mutex);
+  Lost = true;
+  Condition.notify_all();
+}
+
+void ReconnectThread::Run()
+{
+  LOG_INFO(Logger, "reconnect_thread      | starting");
+
+  std::unique_lock<std::mutex> lock(Mutex);
+
+  while (!StopRequest)
+    {
+      Condition.wait(lock, [this]() { return StopRequest || Lost; });
+
+      Duration delay = Parameters.InitialDelay;
+
+      while (!StopRequest)
+        {
+          LOG_INFO(Logger, "reconnect_thread      | reconnecting in {}ms", delay);
+
+          if (Condition.wait_for(lock, std::chrono::milliseconds(static_cast<int64_t>(delay)), [this]() { return StopRequest; }))
+            {
+              break;
+            }
+
+          // a connection lost while restoring it is reported again
+          Lost = false;
+          lock.unlock();
+          const bool restored = Reconnect();
+          lock.lock();
+
+          if (restored)
+            {
+              break;
+            }
+
+          delay = std::min(delay * 2, Parameters.MaxDelay);
+        }
+    }
+
+  LOG_INFO(Logger, "reconnect_thread      | stopped");
+}
+
+void ReconnectThread::Stop()
+{
+  if (!Thread.joinable()) { return; }
+
+  LOG_DEBUG(Logger, "reconnect_thread      | stopping");
+
+  {
+    std::unique_lock<std::mutex> lock(Mutex);
+    StopRequest = true;
+    Condition.notify_all();
+  }
+
+  Thread.join();
+}
+
 UaClient::UaClient(bool debug)
   : KeepAlive(nullptr)
 {
@@ -128,6 +210,7 @@ UaClient::UaClient(bool debug)
       Logger->set_level(spdlog::level::info);
     }
   KeepAlive.SetLogger(Logger);
+  Reconnector.SetLogger(Logger);
 }
 
 std::vector<EndpointDescription> UaClient::GetServerEndpoints(const std::string & endpoint)
@@ -230,8 +313,21 @@ void UaClient::Connect(const EndpointDescription & endpoint)
   Server = OpcUa::CreateBinaryClient(channel, params, Logger);
 
   OpenSecureChannel();
+  StartSession();
 
+  KeepAlive.Start(Server, Node(Server, ObjectId::Server_ServerStatus_State), DefaultTimeout);
+
+  BinaryClientTransport::SharedPtr transport = std::dynamic_pointer_cast<BinaryClientTransport>(Server);
+
+  if (ReconnectParams.Enabled && transport)
+    {
+      Reconnector.Start([this]() { return Reconnect(); }, ReconnectParams);
+      transport->SetConnectionLostCallback([this]() { Reconnector.ConnectionLost(); });
+    }
+}
 
+void UaClient::StartSession()
+{
   LOG_INFO(Logger, "ua_client             | creating session ...");
 
   OpcUa::RemoteSessionParameters session;
@@ -240,9 +336,9 @@ void UaClient::Connect(const EndpointDescription & endpoint)
   session.ClientDescription.ApplicationName = LocalizedText(SessionName);
   session.ClientDescription.ApplicationType = OpcUa::ApplicationType::Client;
   session.SessionName = SessionName;
-  session.EndpointUrl = endpoint.EndpointUrl;
+  session.EndpointUrl = Endpoint.EndpointUrl;
   session.Timeout = DefaultTimeout;
-  session.ServerURI = endpoint.Server.ApplicationUri;
+  session.ServerURI = Endpoint.Server.ApplicationUri;
 
   CreateSessionResponse createSessionResponse = Server->CreateSession(session);
   CheckStatusCode(createSessionResponse.Header.ServiceResult);
@@ -301,6 +397,7 @@ void UaClient::Connect(const EndpointDescription & endpoint)
         throw std::runtime_error("Cannot find suitable user identify token for session");
       }
   }
+  SessionActivation = sessionParameters;
   ActivateSessionResponse aresponse = Server->ActivateSession(sessionParameters);
   CheckStatusCode(aresponse.Header.ServiceResult);
 
@@ -310,8 +407,106 @@ void UaClient::Connect(const EndpointDescription & endpoint)
     {
       DefaultTimeout = createSessionResponse.Parameters.RevisedSessionTimeout;
     }
+}
+
+bool UaClient::Reconnect()
+{
+  BinaryClientTransport::SharedPtr transport = std::dynamic_pointer_cast<BinaryClientTransport>(Server);
+
+  if (!transport) { throw std::runtime_error("Not connected"); }
+
+  LOG_INFO(Logger, "ua_client             | reconnecting to: {}", Endpoint.EndpointUrl);
+
+  KeepAlive.Stop();
+
+  try
+    {
+      const Common::Uri serverUri(Endpoint.EndpointUrl);
+      transport->Reconnect(OpcUa::Connect(serverUri.Host(), serverUri.Port(), Logger));
+      OpenSecureChannel();
+
+      ActivateSessionResponse response = Server->ActivateSession(SessionActivation);
+      const bool newSession = response.Header.ServiceResult != StatusCode::Good;
+
+      if (newSession)
+        {
+          LOG_INFO(Logger, "ua_client             | session was not activated again: {}, creating a new one", ToString(response.Header.ServiceResult));
+
+          StartSession();
+        }
+
+      RestoreSubscriptions(newSession);
+    }
+
+  catch (const std::exception & ex)
+    {
+      LOG_WARN(Logger, "ua_client             | reconnecting failed: {}", ex.what());
+
+      return false;
+    }
 
   KeepAlive.Start(Server, Node(Server, ObjectId::Server_ServerStatus_State), DefaultTimeout);
+
+  LOG_INFO(Logger, "ua_client             | connection restored");
+
+  return true;
+}
+
+void UaClient::RestoreSubscriptions(bool newSession)
+{
+  std::vector<Subscription::SharedPtr> subscriptions;
+  {
+    std::lock_guard<std::mutex> lock(SubscriptionsMutex);
+
+    std::vector<std::weak_ptr<Subscription>> alive;
+
+    for (const std::weak_ptr<Subscription> & weak : Subscriptions)
+      {
+        if (Subscription::SharedPtr subscription = weak.lock())
+          {
+            subscriptions.push_back(subscription);
+            alive.push_back(weak);
+          }
+      }
+
+    Subscriptions.swap(alive);
+  }
+
+  if (subscriptions.empty())
+    {
+      return;
+    }
+
+  // one request for all subscriptions, it also returns their retransmission queues
+  TransferSubscriptionsRequest request;
+  request.Parameters.SendInitialValues = false;
+
+  for (const Subscription::SharedPtr & subscription : subscriptions)
+    {
+      request.Parameters.SubscriptionIds.push_back(subscription->GetId());
+    }
+
+  // the binary client keeps the callbacks of the subscriptions it already knows
+  std::vector<TransferResult> results = Server->Subscriptions()->TransferSubscriptions(request, std::function<void (PublishResult)>());
+
+  for (std::size_t i = 0; i < subscriptions.size(); ++i)
+    {
+      if (i < results.size() && results[i].Status == StatusCode::Good)
+        {
+          subscriptions[i]->Resume(results[i].AvailableSequenceNumbers);
+        }
+
+      else if (results.empty() && !newSession)
+        {
+          // server without TransferSubscriptions, the subscriptions stayed with the session
+          subscriptions[i]->Resume(std::vector<uint32_t>());
+        }
+
+      else
+        {
+          subscriptions[i]->Recreate(ReconnectParams.MaxItemsPerRequest);
+        }
+    }
 }
 
 void UaClient::OpenSecureChannel()
@@ -344,8 +539,21 @@ UaClient::~UaClient()
   Disconnect();//Do not leave any thread or connection running
 }
 
+void UaClient::StopReconnect()
+{
+  Reconnector.Stop();
+
+  BinaryClientTransport::SharedPtr transport = std::dynamic_pointer_cast<BinaryClientTransport>(Server);
+
+  if (transport)
+    {
+      transport->SetConnectionLostCallback(std::function<void ()>());
+    }
+}
+
 void UaClient::Disconnect()
 {
+  StopReconnect();
   KeepAlive.Stop();
 
   if (Server.get())
@@ -362,6 +570,7 @@ void UaClient::Disconnect()
 
 void UaClient::Abort()
 {
+  StopReconnect();
   KeepAlive.Stop();
 
   Server.reset(); //FIXME: check if we still need this
@@ -481,7 +690,11 @@ Subscription::SharedPtr UaClient::CreateSubscription(unsigned int period, Subscr
   CreateSubscriptionParameters params;
   params.RequestedPublishingInterval = period;
 
-  return std::make_shared<Subscription>(Server, params, callback, Logger);
+  Subscription::SharedPtr subscription = std::make_shared<Subscription>(Server, params, callback, Logger);
+
+  std::lock_guard<std::mutex> lock(SubscriptionsMutex);
+  Subscriptions.push_back(subscription);
+  return subscription;
 }
 
 ServerOperations UaClient::CreateServerOperations()
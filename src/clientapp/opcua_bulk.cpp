@@ -0,0 +1,522 @@
+/// @brief Bulk read/write of node lists and load generation for the command line client.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include "opcua_bulk.h"
+
+#include "../bench/bench_common.h"
+
+#include <opc/ua/protocol/string_utils.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+
+using namespace OpcUa;
+using namespace OpcUa::Bench;
+
+std::string Trim(const std::string & str)
+{
+  const std::size_t first = str.find_first_not_of(" \t\r");
+
+  if (first == std::string::npos)
+    {
+      return std::string();
+    }
+
+  const std::size_t last = str.find_last_not_of(" \t\r");
+  return str.substr(first, last - first + 1);
+}
+
+NodeId ParseNodeId(const std::string & value)
+{
+  // standard node name like 'Server'
+  if (value.find('=') == std::string::npos)
+    {
+      return NodeId(OpcUa::ToObjectId(value));
+    }
+
+  return OpcUa::ToNodeId(value);
+}
+
+Variant ParseValue(const std::string & type, const std::string & value)
+{
+  if (type == "byte") { return Variant(static_cast<uint8_t>(std::stoul(value))); }
+
+  if (type == "sbyte") { return Variant(static_cast<int8_t>(std::stol(value))); }
+
+  if (type == "uint16") { return Variant(static_cast<uint16_t>(std::stoul(value))); }
+
+  if (type == "int16") { return Variant(static_cast<int16_t>(std::stol(value))); }
+
+  if (type == "uint32") { return Variant(static_cast<uint32_t>(std::stoul(value))); }
+
+  if (type == "int32") { return Variant(static_cast<int32_t>(std::stol(value))); }
+
+  if (type == "uint64") { return Variant(static_cast<uint64_t>(std::stoull(value))); }
+
+  if (type == "int64") { return Variant(static_cast<int64_t>(std::stoll(value))); }
+
+  if (type == "float") { return Variant(std::stof(value)); }
+
+  if (type == "double") { return Variant(std::stod(value)); }
+
+  if (type == "bool") { return Variant(value == "true" || value == "1"); }
+
+  if (type == "string") { return Variant(value); }
+
+  throw std::invalid_argument("unknown value type '" + type + "'");
+}
+
+StatusCode GetStatus(const DataValue & value)
+{
+  return (value.Encoding & DATA_VALUE_STATUS_CODE) ? value.Status : StatusCode::Good;
+}
+
+std::string FormatStatus(StatusCode status)
+{
+  char result[11];
+  std::snprintf(result, sizeof(result), "0x%08x", static_cast<uint32_t>(status));
+  return result;
+}
+
+std::string FormatValue(const Variant & value)
+{
+  return value.IsNul() ? std::string() : value.ToString();
+}
+
+std::vector<ReadValueId> GetReadIds(const std::vector<NodeListEntry> & nodes, std::size_t first, std::size_t count, AttributeId attribute)
+{
+  std::vector<ReadValueId> ids;
+  ids.reserve(count);
+
+  for (std::size_t i = 0; i < count; ++i)
+    {
+      ReadValueId id;
+      id.NodeId = nodes[(first + i) % nodes.size()].Node;
+      id.AttributeId = attribute;
+      ids.push_back(id);
+    }
+
+  return ids;
+}
+
+std::vector<WriteValue> GetWriteValues(const std::vector<NodeListEntry> & nodes, std::size_t first, std::size_t count, AttributeId attribute)
+{
+  std::vector<WriteValue> values;
+  values.reserve(count);
+
+  for (std::size_t i = 0; i < count; ++i)
+    {
+      const NodeListEntry & entry = nodes[(first + i) % nodes.size()];
+      WriteValue value;
+      value.NodeId = entry.Node;
+      value.AttributeId = attribute;
+      value.Value = entry.Value;
+      values.push_back(value);
+    }
+
+  return values;
+}
+
+/// @brief Requests of one worker, with an optional fixed interval between their start times.
+void RunRequests(Services::SharedPtr services, const std::vector<NodeListEntry> & nodes, AttributeId attribute, const BenchParameters & params,
+                 std::size_t firstNode, Clock::time_point stopAt, LatencyRecorder & recorder)
+{
+  const bool write = params.Mode == "write";
+  const uint32_t batch = std::max<uint32_t>(params.BatchSize, 1);
+  const Clock::duration interval = params.Rate
+                                   ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(double(params.Concurrency) / params.Rate))
+                                   : Clock::duration::zero();
+  Clock::time_point next = Clock::now();
+  std::size_t cursor = firstNode;
+
+  while (next < stopAt)
+    {
+      if (interval != Clock::duration::zero())
+        {
+          std::this_thread::sleep_until(next);
+          next += interval;
+        }
+
+      else
+        {
+          next = Clock::now();
+        }
+
+      const Clock::time_point start = Clock::now();
+      bool failed = false;
+
+      try
+        {
+          if (write)
+            {
+              const std::vector<StatusCode> results = services->Attributes()->Write(GetWriteValues(nodes, cursor, batch, attribute));
+              failed = std::any_of(results.begin(), results.end(), [](StatusCode status) { return status != StatusCode::Good; });
+            }
+
+          else
+            {
+              ReadParameters read;
+              read.AttributesToRead = GetReadIds(nodes, cursor, batch, attribute);
+              const std::vector<DataValue> values = services->Attributes()->Read(read);
+              failed = values.size() != batch || std::any_of(values.begin(), values.end(), [](const DataValue & value) { return GetStatus(value) != StatusCode::Good; });
+            }
+        }
+
+      catch (const std::exception &)
+        {
+          failed = true;
+        }
+
+      if (failed)
+        {
+          recorder.AddError();
+        }
+
+      else
+        {
+          recorder.Add(Clock::now() - start);
+        }
+
+      cursor = (cursor + batch) % nodes.size();
+    }
+}
+
+/// @brief State of a subscription run shared with its publish callback, which
+/// the client may still call after the subscription was deleted.
+struct SubscriptionRun
+{
+  std::mutex Mutex;
+  LatencyRecorder Recorder;
+  bool Ended = false;
+};
+
+/// @brief One subscription with all nodes, the latency of a data change is its age on arrival.
+void RunSubscription(Services::SharedPtr services, const std::vector<NodeListEntry> & nodes, AttributeId attribute, const BenchParameters & params,
+                     Clock::time_point stopAt, LatencyRecorder & recorder)
+{
+  std::shared_ptr<SubscriptionRun> run = std::make_shared<SubscriptionRun>();
+  // initial values of the monitored items are older than the run
+  const DateTime since = DateTime::Current();
+
+  CreateSubscriptionRequest request;
+  request.Parameters.RequestedPublishingInterval = params.PublishingInterval;
+  request.Parameters.RequestedLifetimeCount = 100;
+  request.Parameters.RequestedMaxKeepAliveCount = 10;
+  request.Parameters.PublishingEnabled = true;
+
+  std::shared_ptr<SubscriptionServices> subscriptions = services->Subscriptions();
+  // the client owns the callback, a strong reference would keep both alive
+  std::weak_ptr<SubscriptionServices> weakSubscriptions = subscriptions;
+  const SubscriptionData data = subscriptions->CreateSubscription(request, [run, since, weakSubscriptions](PublishResult result)
+  {
+    const int64_t now = DateTime::Current().Value;
+    {
+      std::lock_guard<std::mutex> lock(run->Mutex);
+
+      if (run->Ended)
+        {
+          return;
+        }
+
+      for (const NotificationData & notification : result.NotificationMessage.NotificationData)
+        {
+          for (const MonitoredItems & item : notification.DataChange.Notification)
+            {
+              const DateTime & timestamp = (item.Value.Encoding & DATA_VALUE_SOURCE_TIMESTAMP) ? item.Value.SourceTimestamp : item.Value.ServerTimestamp;
+
+              if (timestamp.Value >= since.Value)
+                {
+                  // DateTime counts 100 ns intervals
+                  run->Recorder.Add(std::chrono::nanoseconds(std::max<int64_t>(now - timestamp.Value, 0) * 100));
+                }
+            }
+        }
+    }
+
+    std::shared_ptr<SubscriptionServices> subscriptions = weakSubscriptions.lock();
+
+    if (!subscriptions)
+      {
+        return;
+      }
+
+    PublishRequest next;
+    SubscriptionAcknowledgement ack;
+    ack.SubscriptionId = result.SubscriptionId;
+    ack.SequenceNumber = result.NotificationMessage.SequenceNumber;
+    next.SubscriptionAcknowledgements.push_back(ack);
+    subscriptions->Publish(next);
+  });
+
+  const uint32_t batch = std::max<uint32_t>(params.BatchSize, 1);
+
+  for (std::size_t first = 0; first < nodes.size(); first += batch)
+    {
+      MonitoredItemsParameters items;
+      items.SubscriptionId = data.SubscriptionId;
+      items.TimestampsToReturn = TimestampsToReturn::Both;
+
+      for (std::size_t i = first; i < std::min(nodes.size(), first + batch); ++i)
+        {
+          MonitoredItemCreateRequest item;
+          item.ItemToMonitor.NodeId = nodes[i].Node;
+          item.ItemToMonitor.AttributeId = attribute;
+          item.MonitoringMode = MonitoringMode::Reporting;
+          item.RequestedParameters.ClientHandle = static_cast<uint32_t>(i + 1);
+          item.RequestedParameters.SamplingInterval = params.PublishingInterval;
+          item.RequestedParameters.QueueSize = 1;
+          item.RequestedParameters.DiscardOldest = true;
+          items.ItemsToCreate.push_back(item);
+        }
+
+      subscriptions->CreateMonitoredItems(items);
+    }
+
+  subscriptions->Publish(PublishRequest());
+  subscriptions->Publish(PublishRequest());
+
+  std::this_thread::sleep_until(stopAt);
+
+  // responses arriving later neither record nor publish again
+  {
+    std::lock_guard<std::mutex> lock(run->Mutex);
+    run->Ended = true;
+    recorder.Merge(run->Recorder);
+  }
+
+  subscriptions->DeleteSubscriptions(std::vector<uint32_t>(1, data.SubscriptionId));
+}
+
+}
+
+namespace OpcUa
+{
+
+std::vector<NodeListEntry> ReadNodeList(std::istream & input)
+{
+  std::vector<NodeListEntry> nodes;
+  std::string line;
+  unsigned number = 0;
+
+  while (std::getline(input, line))
+    {
+      ++number;
+      line = Trim(line);
+
+      if (line.empty() || line[0] == '#')
+        {
+          continue;
+        }
+
+      // the value is the rest of the line, it may contain commas
+      const std::size_t typeBegin = line.find(',');
+      const std::size_t valueBegin = typeBegin == std::string::npos ? std::string::npos : line.find(',', typeBegin + 1);
+
+      try
+        {
+          NodeListEntry entry;
+          entry.Node = ParseNodeId(Trim(line.substr(0, typeBegin)));
+
+          if (typeBegin != std::string::npos)
+            {
+              if (valueBegin == std::string::npos)
+                {
+                  throw std::invalid_argument("expected 'node-id,type,value'");
+                }
+
+              entry.Value = ParseValue(Trim(line.substr(typeBegin + 1, valueBegin - typeBegin - 1)), Trim(line.substr(valueBegin + 1)));
+            }
+
+          nodes.push_back(entry);
+        }
+
+      catch (const std::exception & exc)
+        {
+          std::stringstream stream;
+          stream << "Invalid node list line " << number << ": " << exc.what();
+          throw std::runtime_error(stream.str());
+        }
+    }
+
+  return nodes;
+}
+
+std::vector<NodeListEntry> ReadNodeList(const std::string & path)
+{
+  if (path == "-")
+    {
+      return ReadNodeList(std::cin);
+    }
+
+  std::ifstream file(path);
+
+  if (!file)
+    {
+      throw std::runtime_error("Cannot open node list '" + path + "'");
+    }
+
+  return ReadNodeList(file);
+}
+
+void BulkRead(AttributeServices & attributes, const std::vector<NodeListEntry> & nodes, AttributeId attribute, uint32_t batchSize, std::ostream & os)
+{
+  const std::size_t batch = std::max<uint32_t>(batchSize, 1);
+
+  for (std::size_t first = 0; first < nodes.size(); first += batch)
+    {
+      ReadParameters params;
+      params.AttributesToRead = GetReadIds(nodes, first, std::min(batch, nodes.size() - first), attribute);
+      const std::vector<DataValue> values = attributes.Read(params);
+
+      for (std::size_t i = 0; i < params.AttributesToRead.size(); ++i)
+        {
+          os << ToString(params.AttributesToRead[i].NodeId) << ",";
+
+          if (i >= values.size())
+            {
+              os << FormatStatus(StatusCode::BadNoData) << "," << std::endl;
+              continue;
+            }
+
+          const StatusCode status = GetStatus(values[i]);
+          os << FormatStatus(status) << "," << (status == StatusCode::Good ? FormatValue(values[i].Value) : std::string()) << std::endl;
+        }
+    }
+}
+
+std::size_t BulkWrite(AttributeServices & attributes, const std::vector<NodeListEntry> & nodes, AttributeId attribute, uint32_t batchSize, std::ostream & os)
+{
+  const std::size_t batch = std::max<uint32_t>(batchSize, 1);
+  std::size_t failed = 0;
+
+  for (std::size_t first = 0; first < nodes.size(); first += batch)
+    {
+      const std::vector<WriteValue> values = GetWriteValues(nodes, first, std::min(batch, nodes.size() - first), attribute);
+      const std::vector<StatusCode> results = attributes.Write(values);
+
+      for (std::size_t i = 0; i < values.size(); ++i)
+        {
+          const StatusCode status = i < results.size() ? results[i] : StatusCode::BadNoData;
+          failed += status != StatusCode::Good;
+          os << ToString(values[i].NodeId) << "," << FormatStatus(status) << std::endl;
+        }
+    }
+
+  return failed;
+}
+
+void RunBench(std::function<Services::SharedPtr ()> connect, const std::vector<NodeListEntry> & nodes, AttributeId attribute, const BenchParameters & params, std::ostream & os)
+{
+  if (nodes.empty())
+    {
+      throw std::runtime_error("No nodes to run the benchmark on");
+    }
+
+  if (params.Mode != "read" && params.Mode != "write" && params.Mode != "subscribe")
+    {
+      throw std::runtime_error("Unknown benchmark mode '" + params.Mode + "', expected read, write or subscribe");
+    }
+
+  std::vector<NodeListEntry> targets(nodes);
+  const uint32_t concurrency = std::max<uint32_t>(params.Concurrency, 1);
+  std::vector<Services::SharedPtr> connections;
+
+  for (uint32_t i = 0; i < concurrency; ++i)
+    {
+      connections.push_back(connect());
+    }
+
+  // without values in the node list the current ones are written back
+  if (params.Mode == "write" && std::any_of(targets.begin(), targets.end(), [](const NodeListEntry & entry) { return entry.Value.IsNul(); }))
+    {
+      ReadParameters read;
+      read.AttributesToRead = GetReadIds(targets, 0, targets.size(), attribute);
+      const std::vector<DataValue> values = connections.front()->Attributes()->Read(read);
+
+      for (std::size_t i = 0; i < targets.size() && i < values.size(); ++i)
+        {
+          if (targets[i].Value.IsNul())
+            {
+              targets[i].Value = values[i].Value;
+            }
+        }
+    }
+
+  std::vector<LatencyRecorder> recorders(concurrency);
+  std::vector<std::thread> workers;
+  const Clock::time_point start = Clock::now();
+  const Clock::time_point stopAt = start + std::chrono::seconds(params.Duration);
+
+  for (uint32_t i = 0; i < concurrency; ++i)
+    {
+      workers.push_back(std::thread([&, i]()
+      {
+        try
+          {
+            if (params.Mode == "subscribe")
+              {
+                RunSubscription(connections[i], targets, attribute, params, stopAt, recorders[i]);
+              }
+
+            else
+              {
+                // workers start at different nodes to spread the requests over the list
+                RunRequests(connections[i], targets, attribute, params, i * targets.size() / concurrency, stopAt, recorders[i]);
+              }
+          }
+
+        catch (const std::exception & exc)
+          {
+            std::cerr << "worker " << i << " failed: " << exc.what() << std::endl;
+            recorders[i].AddError();
+          }
+      }));
+    }
+
+  for (std::thread & worker : workers)
+    {
+      worker.join();
+    }
+
+  const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+  for (Services::SharedPtr & connection : connections)
+    {
+      connection->CloseSession();
+    }
+
+  LatencyRecorder all;
+
+  for (const LatencyRecorder & recorder : recorders)
+    {
+      all.Merge(recorder);
+    }
+
+  os << "{"
+     << "\"mode\": \"" << params.Mode << "\""
+     << ", \"nodes\": " << targets.size()
+     << ", \"concurrency\": " << concurrency
+     << ", \"rate\": " << params.Rate
+     << ", \"batch_size\": " << params.BatchSize
+     << ", \"seconds\": " << seconds
+     << ", \"" << (params.Mode == "subscribe" ? "notifications" : "requests") << "\": ";
+  WriteJsonStats(os, all, seconds);
+  os << "}" << std::endl;
+}
+
+}
@@ -0,0 +1,62 @@
+/// @brief Bulk read/write of node lists and load generation for the command line client.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#pragma once
+
+#include <opc/ua/protocol/attribute_ids.h>
+#include <opc/ua/protocol/types.h>
+#include <opc/ua/protocol/variant.h>
+#include <opc/ua/services/services.h>
+
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace OpcUa
+{
+
+/// @brief One line of a node list: 'node-id[,type,value]'.
+/// Type is one of the value option suffixes (byte, sbyte, uint16, int16, uint32, int32,
+/// uint64, int64, float, double, string) or bool. Empty lines and lines starting with '#' are skipped.
+struct NodeListEntry
+{
+  NodeId Node;
+  Variant Value;
+};
+
+std::vector<NodeListEntry> ReadNodeList(std::istream & input);
+/// @param path file name, '-' reads standard input.
+std::vector<NodeListEntry> ReadNodeList(const std::string & path);
+
+/// @brief Read the attribute of all nodes, batchSize nodes per request.
+/// Prints 'node-id,status,value' lines, the status in hex.
+void BulkRead(AttributeServices & attributes, const std::vector<NodeListEntry> & nodes, AttributeId attribute, uint32_t batchSize, std::ostream & os);
+/// @brief Write the values of the list, batchSize nodes per request.
+/// Prints 'node-id,status' lines.
+/// @return number of failed writes.
+std::size_t BulkWrite(AttributeServices & attributes, const std::vector<NodeListEntry> & nodes, AttributeId attribute, uint32_t batchSize, std::ostream & os);
+
+struct BenchParameters
+{
+  std::string Mode = "read"; // read, write or subscribe
+  uint32_t Duration = 10; // seconds
+  uint32_t Concurrency = 1; // workers, each one with its own connection
+  uint32_t Rate = 0; // requests per second of all workers, 0 - unlimited
+  uint32_t BatchSize = 1; // nodes per request, monitored items per CreateMonitoredItems
+  uint32_t PublishingInterval = 100; // milliseconds, subscribe mode
+};
+
+/// @brief Run read, write or subscribe loops against the nodes and print the latencies as JSON.
+/// In subscribe mode latencies are measured from the timestamps of the notifications,
+/// so client and server clocks have to be synchronized.
+/// @param connect opens a connection with an activated session.
+void RunBench(std::function<Services::SharedPtr ()> connect, const std::vector<NodeListEntry> & nodes, AttributeId attribute, const BenchParameters & params, std::ostream & os);
+
+}
@@ -9,6 +9,7 @@
 ///
 
 
+#include "opcua_bulk.h"
 #include "opcua_options.h"
 
 #include <opc/ua/client/addon.h>
@@ -665,6 +666,24 @@ void CreateSubscription(OpcUa::SubscriptionServices & subscriptions)
   std::cout << "RevisedMaxKeepAliveCount: " << data.RevisedMaxKeepAliveCount << std::endl;
 }
 
+const uint32_t DefaultBulkBatchSize = 1000;
+
+void OpenSession(OpcUa::Services & computer, const std::string & serverURI)
+{
+  OpcUa::RemoteSessionParameters session;
+  session.ClientDescription.ApplicationUri = "https://github.com/treww/opc_layer.git";
+  session.ClientDescription.ProductUri = "https://github.com/treww/opc_layer.git";
+  session.ClientDescription.ApplicationName.Text = "opcua client";
+  session.ClientDescription.ApplicationType = OpcUa::ApplicationType::Client;
+  session.SessionName = "opua command line";
+  session.EndpointUrl = serverURI;
+  session.Timeout = 1200000;
+
+  CreateSessionResponse resp = computer.CreateSession(session);
+  ActivateSessionParameters session_parameters;
+  computer.ActivateSession(session_parameters);
+}
+
 void Process(OpcUa::CommandLine & cmd, const Common::AddonsManager & addons)
 {
   const std::string serverURI = cmd.GetServerURI();
@@ -683,20 +702,38 @@ void Process(OpcUa::CommandLine & cmd, const Common::AddonsManager & addons)
       PrintServers(*computer);
     }
 
-  OpcUa::RemoteSessionParameters session;
-  session.ClientDescription.ApplicationUri = "https://github.com/treww/opc_layer.git";
-  session.ClientDescription.ProductUri = "https://github.com/treww/opc_layer.git";
-  session.ClientDescription.ApplicationName.Text = "opcua client";
-  session.ClientDescription.ApplicationType = OpcUa::ApplicationType::Client;
-  session.SessionName = "opua command line";
-  session.EndpointUrl = serverURI;
-  session.Timeout = 1200000;
+  OpenSession(*computer, serverURI);
 
-  CreateSessionResponse resp = computer->CreateSession(session);
-  ActivateSessionParameters session_parameters;
-  computer->ActivateSession(session_parameters);
+  // bulk operations work on the value unless another attribute was asked for
+  const OpcUa::AttributeId bulkAttribute = cmd.GetAttribute() == OpcUa::AttributeId::Unknown ? OpcUa::AttributeId::Value : cmd.GetAttribute();
+
+  if (cmd.IsBenchOperation())
+    {
+      const std::vector<NodeListEntry> nodes = ReadNodeList(cmd.GetNodesFile());
+      RunBench([addon, serverURI]()
+      {
+        std::shared_ptr<OpcUa::Services> connection = addon->Connect(serverURI);
+        OpenSession(*connection, serverURI);
+        return connection;
+      }, nodes, bulkAttribute, cmd.GetBenchParameters(), std::cout);
+    }
+
+  else if (cmd.IsReadOperation() && !cmd.GetNodesFile().empty())
+    {
+      BulkRead(*computer->Attributes(), ReadNodeList(cmd.GetNodesFile()), bulkAttribute, cmd.GetBatchSize() ? cmd.GetBatchSize() : DefaultBulkBatchSize, std::cout);
+    }
+
+  else if (cmd.IsWriteOperation() && !cmd.GetNodesFile().empty())
+    {
+      const std::size_t failed = BulkWrite(*computer->Attributes(), ReadNodeList(cmd.GetNodesFile()), bulkAttribute, cmd.GetBatchSize() ? cmd.GetBatchSize() : DefaultBulkBatchSize, std::cout);
+
+      if (failed)
+        {
+          std::cerr << failed << " writes failed." << std::endl;
+        }
+    }
 
-  if (cmd.IsBrowseOperation())
+  else if (cmd.IsBrowseOperation())
     {
       const OpcUa::NodeId nodeId = cmd.GetNodeId();
       Print(nodeId, Tabs(0));
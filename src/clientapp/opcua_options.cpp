@@ -32,6 +32,7 @@ const char * OPTION_BROWSE = "browse";
 const char * OPTION_READ = "read";
 const char * OPTION_WRITE = "write";
 const char * OPTION_CREATE_SUBSCRIPTION = "create-subscription";
+const char * OPTION_BENCH = "bench";
 const char * OPTION_FIND_ServerS = "find-servers";
 const char * OPTION_REGISTER_MODULE = "register-module";
 const char * OPTION_UNREGISTER_MODULE = "unregister-module";
@@ -43,6 +44,14 @@ const char * OPTION_CONFIG_DIR = "config-dir";
 const char * OPTION_Server_URI = "uri";
 const char * OPTION_ATTRIBUTE = "attribute";
 const char * OPTION_NODE_Id = "node-id";
+const char * OPTION_NODES_FILE = "nodes-file";
+const char * OPTION_BATCH_SIZE = "batch-size";
+
+const char * OPTION_BENCH_MODE = "bench-mode";
+const char * OPTION_DURATION = "duration";
+const char * OPTION_CONCURRENCY = "concurrency";
+const char * OPTION_RATE = "rate";
+const char * OPTION_PUBLISHING_INTERVAL = "publishing-interval";
 
 
 const char * OPTION_VALUE_BYTE  = "value-byte";
@@ -63,6 +72,13 @@ const char * OPTION_VALUE_STRING = "value-string";
 NodeId GetNodeIdOptionValue(const po::variables_map & vm)
 {
   const std::string & value = vm[OPTION_NODE_Id].as<std::string>();
+
+  // standard node name like 'Server'
+  if (value.find('=') == std::string::npos)
+    {
+      return NodeId(OpcUa::ToObjectId(value));
+    }
+
   return OpcUa::ToNodeId(value);
 }
 
@@ -135,12 +151,14 @@ namespace OpcUa
 CommandLine::CommandLine(int argc, char ** argv)
   : NamespaceIndex(0)
   , Attribute(AttributeId::Unknown)
+  , BatchSize(0)
   , IsHelp(false)
   , IsGetEndpoints(false)
   , IsBrowse(false)
   , IsRead(false)
   , IsWrite(false)
   , IsCreateSubscription(false)
+  , IsBench(false)
   , IsFindServers(false)
   , IsAddModule(false)
   , IsRemoveModule(false)
@@ -154,13 +172,21 @@ CommandLine::CommandLine(int argc, char ** argv)
   (OPTION_READ, "read command.")
   (OPTION_WRITE, "write command.")
   (OPTION_CREATE_SUBSCRIPTION, "create subscription command.")
+  (OPTION_BENCH, "Measure latencies of read, write or subscribe requests on the nodes of the nodes file.")
   (OPTION_FIND_ServerS, "find servers command.")
   (OPTION_REGISTER_MODULE, "Register new module.")
   (OPTION_UNREGISTER_MODULE, "Unregister module.")
 
   (OPTION_Server_URI, po::value<std::string>(), "Uri of the server.")
   (OPTION_ATTRIBUTE, po::value<std::string>(), "Name of attribute.")
-  (OPTION_NODE_Id, po::value<std::string>(), "NodeId in the form 'nsu=uri;srv=1;ns=0;i=84.")
+  (OPTION_NODE_Id, po::value<std::string>(), "NodeId in the form 'nsu=uri;srv=1;ns=0;i=84' or name of a standard node like 'Server'.")
+  (OPTION_NODES_FILE, po::value<std::string>(), "File with one node per line, '-' for standard input. Read prints 'node-id,status,value' lines, write expects 'node-id,type,value' lines where type is the suffix of a value option or 'bool'.")
+  (OPTION_BATCH_SIZE, po::value<uint32_t>(), "Nodes per request. By default 1000 for read and write of a nodes file and 1 for bench.")
+  (OPTION_BENCH_MODE, po::value<std::string>()->default_value("read"), "Bench requests: read, write or subscribe.")
+  (OPTION_DURATION, po::value<uint32_t>()->default_value(10), "Bench duration in seconds.")
+  (OPTION_CONCURRENCY, po::value<uint32_t>()->default_value(1), "Bench workers, each one with its own connection.")
+  (OPTION_RATE, po::value<uint32_t>()->default_value(0), "Bench requests per second of all workers, 0 for no limit.")
+  (OPTION_PUBLISHING_INTERVAL, po::value<uint32_t>()->default_value(100), "Publishing interval of the bench subscriptions in milliseconds.")
   (OPTION_VALUE_BYTE, po::value<uint8_t>(), "Byte value.")
   (OPTION_VALUE_SBYTE, po::value<int8_t>(), "Signed byte value.")
   (OPTION_VALUE_UINT16, po::value<uint16_t>(), "UInt16 value.")
@@ -204,12 +230,30 @@ CommandLine::CommandLine(int argc, char ** argv)
       Attribute = GetAttributeIdOptionValue(vm);
     }
 
+  if (vm.count(OPTION_NODES_FILE))
+    {
+      NodesFile = vm[OPTION_NODES_FILE].as<std::string>();
+    }
+
+  if (vm.count(OPTION_BATCH_SIZE))
+    {
+      BatchSize = vm[OPTION_BATCH_SIZE].as<uint32_t>();
+    }
+
+  Bench.Mode = vm[OPTION_BENCH_MODE].as<std::string>();
+  Bench.Duration = vm[OPTION_DURATION].as<uint32_t>();
+  Bench.Concurrency = vm[OPTION_CONCURRENCY].as<uint32_t>();
+  Bench.Rate = vm[OPTION_RATE].as<uint32_t>();
+  Bench.BatchSize = BatchSize ? BatchSize : 1;
+  Bench.PublishingInterval = vm[OPTION_PUBLISHING_INTERVAL].as<uint32_t>();
+
   Value = GetOptionValue(vm);
   IsGetEndpoints = vm.count(OPTION_GET_ENDPOINTS) != 0;
   IsBrowse = vm.count(OPTION_BROWSE) != 0;
   IsRead = vm.count(OPTION_READ) != 0;
   IsWrite = vm.count(OPTION_WRITE) != 0;
   IsCreateSubscription = vm.count(OPTION_CREATE_SUBSCRIPTION) != 0;
+  IsBench = vm.count(OPTION_BENCH) != 0;
   IsFindServers = vm.count(OPTION_FIND_ServerS) != 0;
 
   if (vm.count(OPTION_REGISTER_MODULE))
@@ -13,6 +13,8 @@
 #include <opc/ua/protocol/variant.h>
 #include <opc/ua/protocol/data_value.h>
 
+#include "opcua_bulk.h"
+
 #include <string>
 
 namespace OpcUa
@@ -63,6 +65,23 @@ public:
     return ConfigDir;
   }
 
+  /// @return file with the nodes of bulk operations, '-' for standard input, empty if not set.
+  std::string GetNodesFile() const
+  {
+    return NodesFile;
+  }
+
+  /// @return nodes per request, 0 if not set.
+  uint32_t GetBatchSize() const
+  {
+    return BatchSize;
+  }
+
+  BenchParameters GetBenchParameters() const
+  {
+    return Bench;
+  }
+
   bool IsGetEndpointsOperation() const
   {
     return IsGetEndpoints;
@@ -88,6 +107,11 @@ public:
     return IsCreateSubscription;
   }
 
+  bool IsBenchOperation() const
+  {
+    return IsBench;
+  }
+
   bool IsFindServersOperation() const
   {
     return IsFindServers;
@@ -117,6 +141,9 @@ private:
   std::string ModuleId;
   std::string ModulePath;
   std::string ConfigDir;
+  std::string NodesFile;
+  uint32_t BatchSize;
+  BenchParameters Bench;
 
   bool IsHelp;
   bool IsGetEndpoints;
@@ -124,6 +151,7 @@ private:
   bool IsRead;
   bool IsWrite;
   bool IsCreateSubscription;
+  bool IsBench;
   bool IsFindServers;
   bool IsAddModule;
   bool IsRemoveModule;
@@ -13,8 +13,13 @@
 #include <opc/common/addons_core/errors.h>
 #include <opc/common/exception.h>
 
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
 #include <iostream>
 #include <map>
+#include <mutex>
+#include <thread>
 
 namespace
 {
@@ -25,12 +30,14 @@ struct AddonData
   std::vector<Common::AddonId> Dependencies;
   Common::AddonParameters Parameters;
   Common::Addon::SharedPtr Addon;
+  bool Starting; // initialized by a startup thread now
 
   AddonData(const Common::AddonInformation & configuration)
     : Id(configuration.Id)
     , Factory(configuration.Factory)
     , Dependencies(configuration.Dependencies)
     , Parameters(configuration.Parameters)
+    , Starting(false)
   {
   }
 };
@@ -48,6 +55,10 @@ public:
   AddonsManagerImpl(const Common::Logger::SharedPtr & logger)
     : Common::AddonsManager(logger)
     , ManagerStarted(false)
+    , StartupThreads(0)
+    , StartRunning(false)
+    , AddonsStarting(0)
+    , StartFailed(false)
   {
   }
 
@@ -81,8 +92,17 @@ public:
         THROW_ERROR1(UnableToRegisterAddonWhenStarted, addonConfiguration.Id);
       }
 
-    EnsureAddonNotRegistered(addonConfiguration.Id);
-    Addons.insert(std::make_pair(addonConfiguration.Id, AddonData(addonConfiguration)));
+    {
+      std::lock_guard<std::mutex> lock(Mutex);
+      EnsureAddonNotRegistered(addonConfiguration.Id);
+      Addons.insert(std::make_pair(addonConfiguration.Id, AddonData(addonConfiguration)));
+
+      // registered by an addon being initialized, the running startup picks it up
+      if (StartRunning)
+        {
+          return;
+        }
+    }
 
     if (ManagerStarted)
       {
@@ -106,7 +126,7 @@ public:
 
   virtual Common::Addon::SharedPtr GetAddon(const Common::AddonId & id) const
   {
-    // TODO lock manager
+    std::lock_guard<std::mutex> lock(Mutex);
     EnsureAddonRegistered(id);
     EnsureAddonInitialized(id);
     return Addons.find(id)->second.Addon;
@@ -119,6 +139,8 @@ public:
         THROW_ERROR(AddonsManagerAlreadyStarted);
       }
 
+    StartupTimes.clear();
+
     // TODO lock manager
     if (!DoStart())
       {
@@ -139,6 +161,18 @@ public:
     StopAddons();
     ManagerStarted = false;
   }
+
+  virtual void SetStartupThreads(unsigned threads)
+  {
+    StartupThreads = threads;
+  }
+
+  virtual std::vector<Common::AddonStartupTime> GetStartupTimes() const
+  {
+    std::lock_guard<std::mutex> lock(Mutex);
+    return StartupTimes;
+  }
+
 private:
   void StopAddons()
   {
@@ -164,38 +198,146 @@ private:
     Addons.clear();
   }
 
+  // addons whose dependencies are started are initialized by several threads at once
   bool DoStart()
   {
-    while (AddonData * addonData = GetNextAddonDataForStart())
+    std::unique_lock<std::mutex> lock(Mutex);
+    EnsureDependenciesRegistered();
+
+    const std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+    const std::size_t pending = std::count_if(Addons.begin(), Addons.end(), IsAddonNotStarted);
+    unsigned threads = StartupThreads ? StartupThreads : std::thread::hardware_concurrency();
+    threads = static_cast<unsigned>(std::max<std::size_t>(1, std::min<std::size_t>(threads, pending)));
+
+    StartRunning = true;
+    StartFailed = false;
+    StartError = std::exception_ptr();
+    lock.unlock();
+
+    std::vector<std::thread> workers;
+
+    for (unsigned i = 1; i < threads; ++i)
+      {
+        workers.emplace_back([this]()
+        {
+          StartAddons();
+        });
+      }
+
+    StartAddons();
+
+    for (std::thread & worker : workers)
+      {
+        worker.join();
+      }
+
+    lock.lock();
+    StartRunning = false;
+
+    if (StartError)
+      {
+        std::rethrow_exception(StartError);
+      }
+
+    if (StartFailed)
+      {
+        return false;
+      }
+
+    const std::chrono::milliseconds elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started);
+    LOG_INFO(Logger, "addons_manager | started {} addons with {} threads in {} ms", pending, threads, elapsed.count());
+
+    EnsureAllAddonsStarted();
+    return true;
+  }
+
+  // startup thread, runs until no addon is left to initialize or one failed
+  void StartAddons()
+  {
+    std::unique_lock<std::mutex> lock(Mutex);
+
+    while (!StartFailed)
       {
-        //std::cout << "Creating addon '" << addonData->Id << "'" <<  std::endl;
-        Common::Addon::SharedPtr addon = addonData->Factory->CreateAddon();
+        AddonData * addonData = GetNextAddonDataForStart();
+
+        if (!addonData)
+          {
+            // the rest waits for addons being initialized by other threads
+            if (!AddonsStarting)
+              {
+                break;
+              }
+
+            StartCondition.wait(lock);
+            continue;
+          }
+
+        addonData->Starting = true;
+        ++AddonsStarting;
+        lock.unlock();
+
+        const std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+        std::exception_ptr error;
+        Common::Addon::SharedPtr addon = CreateAddon(*addonData, error);
+        const std::chrono::microseconds elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started);
+
+        lock.lock();
+        addonData->Starting = false;
+        --AddonsStarting;
+
+        if (addon)
+          {
+            addonData->Addon = addon;
+            StartupTimes.push_back(Common::AddonStartupTime{addonData->Id, elapsed});
+            LOG_DEBUG(Logger, "addons_manager | addon '{}' initialized in {} us", addonData->Id, elapsed.count());
+          }
+
+        else
+          {
+            StartFailed = true;
+
+            if (error && !StartError)
+              {
+                StartError = error;
+              }
+          }
+
+        StartCondition.notify_all();
+      }
+  }
+
+  Common::Addon::SharedPtr CreateAddon(const AddonData & addonData, std::exception_ptr & error)
+  {
+    try
+      {
+        Common::Addon::SharedPtr addon = addonData.Factory->CreateAddon();
 
-        //std::cout << "Initializing addon '" << addonData->Id << "'" <<  std::endl;
         try
           {
-            addon->Initialize(*this, addonData->Parameters);
-            //std::cout << "Addon '" << addonData->Id << "' successfully initialized." <<  std::endl;
+            addon->Initialize(*this, addonData.Parameters);
+            return addon;
           }
 
         catch (const std::exception & exc)
           {
-            LOG_ERROR(Logger, "addons_manager | failed to initialize addon '{}': {}", addonData->Id, exc.what());
-            return false;
+            LOG_ERROR(Logger, "addons_manager | failed to initialize addon '{}': {}", addonData.Id, exc.what());
           }
+      }
 
-        addonData->Addon = addon;
+    catch (...)
+      {
+        // passed to the caller of Start() by the thread which started
+        error = std::current_exception();
       }
 
-    EnsureAllAddonsStarted();
-    return true;
+    return Common::Addon::SharedPtr();
   }
 
   AddonData * GetNextAddonDataForStart()
   {
     for (AddonList::iterator it = Addons.begin(); it != Addons.end(); ++it)
       {
-        if (!IsAddonStarted(it->second) && IsAllAddonsStarted(it->second.Dependencies))
+        if (!IsAddonStarted(it->second) && !it->second.Starting && IsAllAddonsStarted(it->second.Dependencies))
           {
             return &it->second;
           }
@@ -265,6 +407,20 @@ private:
     return true;
   }
 
+  void EnsureDependenciesRegistered() const
+  {
+    for (const AddonList::value_type & addonIt : Addons)
+      {
+        for (const Common::AddonId & id : addonIt.second.Dependencies)
+          {
+            if (!IsAddonRegistered(id))
+              {
+                THROW_ERROR1(AddonNotFound, id);
+              }
+          }
+      }
+  }
+
   void EnsureAddonInitialized(Common::AddonId id) const
   {
     if (!Addons.find(id)->second.Addon)
@@ -307,6 +463,14 @@ private:
 private:
   AddonList Addons;
   bool ManagerStarted;
+  unsigned StartupThreads;
+  std::vector<Common::AddonStartupTime> StartupTimes;
+  mutable std::mutex Mutex;
+  std::condition_variable StartCondition;
+  bool StartRunning;
+  std::size_t AddonsStarting;
+  bool StartFailed;
+  std::exception_ptr StartError;
 };
 }
 
@@ -196,7 +196,7 @@ std::vector<ReferenceDescription> Object::BrowseObjectsAndVariables(const NodeId
   desc.NodeClasses =   NodeClass::Object | NodeClass::Variable | NodeClass::Method;
   desc.ReferenceTypeId = ObjectId::HierarchicalReferences;
   desc.NodeToBrowse = id;
-  desc.ResultMask = BrowseResultMask::NodeClass | BrowseResultMask::TypeDefinition | BrowseResultMask::BrowseName | BrowseResultMask::DisplayName;
+  desc.ResultMask = BrowseResultMask::ReferenceTypeId | BrowseResultMask::NodeClass | BrowseResultMask::TypeDefinition | BrowseResultMask::BrowseName | BrowseResultMask::DisplayName;
 
   // browse sub objects and variables.
   NodesQuery query;
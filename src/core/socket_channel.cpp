@@ -46,11 +46,17 @@ OpcUa::SocketChannel::SocketChannel(int sock)
 OpcUa::SocketChannel::~SocketChannel()
 {
   Stop();
+  close(Socket);
 }
 
 void OpcUa::SocketChannel::Stop()
 {
-  close(Socket);
+  // unlike close() it also wakes up a thread blocked in Receive()
+#ifdef _WIN32
+  shutdown(Socket, SD_BOTH);
+#else
+  shutdown(Socket, SHUT_RDWR);
+#endif
 }
 
 std::size_t OpcUa::SocketChannel::Receive(char * data, std::size_t size)
@@ -22,12 +22,14 @@
 #include <opc/ua/protocol/string_utils.h>
 
 #include <boost/asio.hpp>
+#include <algorithm>
 #include <iostream>
+#include <limits>
 
 namespace OpcUa
 {
 Subscription::Subscription(Services::SharedPtr server, const CreateSubscriptionParameters & params, SubscriptionHandler & callback, const Common::Logger::SharedPtr & logger)
-  : Server(server), Client(callback), Logger(logger)
+  : Server(server), Parameters(params), Client(callback), LastSequenceNumber(0), Logger(logger)
 {
   CreateSubscriptionRequest request;
   request.Parameters = params;
@@ -53,7 +55,20 @@ void Subscription::PublishCallback(Services::SharedPtr server, const PublishResu
 
   LOG_DEBUG(Logger, "subscription          | Suscription::PublishCallback called with {} notifications", result.NotificationMessage.NotificationData.size());
 
-  for (const NotificationData & data : result.NotificationMessage.NotificationData)
+  CallCallbacks(result.NotificationMessage);
+  LastSequenceNumber = result.NotificationMessage.SequenceNumber;
+
+  OpcUa::SubscriptionAcknowledgement ack;
+  ack.SubscriptionId = GetId();
+  ack.SequenceNumber = result.NotificationMessage.SequenceNumber;
+  PublishRequest request;
+  request.SubscriptionAcknowledgements.push_back(ack);
+  server->Subscriptions()->Publish(request);
+}
+
+void Subscription::CallCallbacks(const NotificationMessage & message)
+{
+  for (const NotificationData & data : message.NotificationData)
     {
       if (data.Header.TypeId == ExpandedObjectId::DataChangeNotification)
         {
@@ -81,39 +96,37 @@ void Subscription::PublishCallback(Services::SharedPtr server, const PublishResu
           LOG_WARN(Logger, "subscription          | unknown notficiation type received: {}", data.Header.TypeId);
         }
     }
-
-  OpcUa::SubscriptionAcknowledgement ack;
-  ack.SubscriptionId = GetId();
-  ack.SequenceNumber = result.NotificationMessage.SequenceNumber;
-  PublishRequest request;
-  request.SubscriptionAcknowledgements.push_back(ack);
-  server->Subscriptions()->Publish(request);
 }
 
 void Subscription::CallDataChangeCallback(const NotificationData & data)
 {
-  for (const MonitoredItems & item : data.DataChange.Notification)
-    {
-      std::unique_lock<std::mutex> lock(Mutex); //could used boost::shared_lock to improve perf
+  std::vector<DataChangeItem> changes;
+  changes.reserve(data.DataChange.Notification.size());
 
-      AttValMap::iterator mapit = AttributeValueMap.find(item.ClientHandle);
+  {
+    std::unique_lock<std::mutex> lock(Mutex); //could used boost::shared_lock to improve perf
 
-      if (mapit == AttributeValueMap.end())
-        {
-          LOG_WARN(Logger, "subscription          | got PublishResult for an unknown monitoreditem id: {}", item.ClientHandle);
-        }
+    for (const MonitoredItems & item : data.DataChange.Notification)
+      {
+        AttValMap::iterator mapit = AttributeValueMap.find(item.ClientHandle);
 
-      else
-        {
-          AttributeId attr = mapit->second.Attribute;
-          Node node = mapit->second.TargetNode;
-          lock.unlock(); //unlock before calling client cades, you never know what they may do
+        if (mapit == AttributeValueMap.end())
+          {
+            LOG_WARN(Logger, "subscription          | got PublishResult for an unknown monitoreditem id: {}", item.ClientHandle);
+          }
 
-          LOG_DEBUG(Logger, "subscription          | calling DataChange user callback: {} and node: {}", item.ClientHandle, mapit->second.TargetNode);
+        else
+          {
+            LOG_DEBUG(Logger, "subscription          | calling DataChange user callback: {} and node: {}", item.ClientHandle, mapit->second.TargetNode);
 
-          Client.DataValueChange(mapit->second.MonitoredItemId, node, item.Value, attr);
-          Client.DataChange(mapit->second.MonitoredItemId, node, item.Value.Value, attr);
-        }
+            changes.push_back(DataChangeItem{mapit->second.MonitoredItemId, mapit->second.TargetNode, &item.Value, mapit->second.Attribute});
+          }
+      }
+  } //unlock before calling client cades, you never know what they may do
+
+  if (!changes.empty())
+    {
+      Client.DataChanges(changes);
     }
 }
 
@@ -229,6 +242,122 @@ RepublishResponse Subscription::Republish(uint32_t sequenceNumber)
   return response;
 }
 
+void Subscription::Resume(const std::vector<uint32_t> & availableSequenceNumbers)
+{
+  std::vector<uint32_t> missed;
+  PublishRequest request;
+
+  for (uint32_t sequenceNumber : availableSequenceNumbers)
+    {
+      if (sequenceNumber > LastSequenceNumber)
+        {
+          missed.push_back(sequenceNumber);
+          continue;
+        }
+
+      // received before the connection was lost, only its acknowledgement is missing
+      SubscriptionAcknowledgement ack;
+      ack.SubscriptionId = GetId();
+      ack.SequenceNumber = sequenceNumber;
+      request.SubscriptionAcknowledgements.push_back(ack);
+    }
+
+  std::sort(missed.begin(), missed.end());
+
+  LOG_INFO(Logger, "subscription          | resuming subscription: {}, {} notification messages to republish", GetId(), missed.size());
+
+  for (uint32_t sequenceNumber : missed)
+    {
+      RepublishResponse response = Republish(sequenceNumber);
+
+      if (response.Header.ServiceResult != StatusCode::Good)
+        {
+          LOG_WARN(Logger, "subscription          | notification message: {} of subscription: {} is lost: {}", sequenceNumber, GetId(), ToString(response.Header.ServiceResult));
+          continue;
+        }
+
+      CallCallbacks(response.NotificationMessage);
+      LastSequenceNumber = sequenceNumber;
+
+      SubscriptionAcknowledgement ack;
+      ack.SubscriptionId = GetId();
+      ack.SequenceNumber = sequenceNumber;
+      request.SubscriptionAcknowledgements.push_back(ack);
+    }
+
+  // publish requests sent on the lost connection are gone
+  Server->Subscriptions()->Publish(request);
+  Server->Subscriptions()->Publish(PublishRequest());
+}
+
+void Subscription::Recreate(uint32_t maxItemsPerRequest)
+{
+  std::unique_lock<std::mutex> lock(Mutex);
+
+  CreateSubscriptionRequest request;
+  request.Parameters = Parameters;
+  Services::SharedPtr serverptr = Server;
+  Data = Server->Subscriptions()->CreateSubscription(request, [this, serverptr](PublishResult i) { this->PublishCallback(serverptr, i); });
+  LastSequenceNumber = 0;
+  ServerItemIds.clear();
+
+  std::vector<MonitoredItemCreateRequest> items;
+  std::vector<uint32_t> itemIds;
+
+  for (const auto & pair : AttributeValueMap)
+    {
+      MonitoredItemCreateRequest req;
+      req.ItemToMonitor.NodeId = pair.second.TargetNode.GetId();
+      req.ItemToMonitor.AttributeId = pair.second.Attribute;
+      req.MonitoringMode = MonitoringMode::Reporting;
+      req.RequestedParameters.SamplingInterval = Data.RevisedPublishingInterval;
+      req.RequestedParameters.QueueSize = 1;
+      req.RequestedParameters.DiscardOldest = true;
+      req.RequestedParameters.ClientHandle = pair.first;
+
+      if (pair.second.Attribute == AttributeId::EventNotifier)
+        {
+          req.RequestedParameters.QueueSize = std::numeric_limits<uint32_t>::max();
+          req.RequestedParameters.Filter = MonitoringFilter(SimpleAttributeOperandMap[pair.second.MonitoredItemId]);
+        }
+
+      items.push_back(req);
+      itemIds.push_back(pair.second.MonitoredItemId);
+    }
+
+  LOG_INFO(Logger, "subscription          | subscription created again with id: {}, restoring {} monitored items", Data.SubscriptionId, items.size());
+
+  const std::size_t batchSize = maxItemsPerRequest ? maxItemsPerRequest : items.size();
+
+  for (std::size_t first = 0; first < items.size(); first += batchSize)
+    {
+      const std::size_t last = std::min(items.size(), first + batchSize);
+
+      MonitoredItemsParameters itemsParams;
+      itemsParams.SubscriptionId = Data.SubscriptionId;
+      itemsParams.TimestampsToReturn = TimestampsToReturn(2); // Don't know for better
+      itemsParams.ItemsToCreate.assign(items.begin() + first, items.begin() + last);
+
+      std::vector<MonitoredItemCreateResult> results = Server->Subscriptions()->CreateMonitoredItems(itemsParams);
+
+      for (std::size_t i = 0; i < results.size() && first + i < last; ++i)
+        {
+          if (results[i].Status != StatusCode::Good)
+            {
+              LOG_WARN(Logger, "subscription          | failed to create MonitoredItem id: {} again: {}", itemIds[first + i], ToString(results[i].Status));
+              continue;
+            }
+
+          ServerItemIds[itemIds[first + i]] = results[i].MonitoredItemId;
+        }
+    }
+
+  lock.unlock();
+
+  Server->Subscriptions()->Publish(PublishRequest());
+  Server->Subscriptions()->Publish(PublishRequest());
+}
+
 uint32_t Subscription::SubscribeDataChange(const Node & node, AttributeId attr)
 {
   ReadValueId avid;
@@ -334,7 +463,19 @@ void Subscription::UnSubscribe(std::vector<uint32_t> handles)
   for (auto id : handles)
     {
       LOG_DEBUG(Logger, "subscription          | sending unsubscribe for MonitoredItem id: {}", id);
-      mids.push_back(uint32_t(id));
+
+      std::map<uint32_t, uint32_t>::iterator serverId = ServerItemIds.find(id);
+
+      if (serverId == ServerItemIds.end())
+        {
+          mids.push_back(uint32_t(id));
+        }
+
+      else
+        {
+          mids.push_back(serverId->second);
+          ServerItemIds.erase(serverId);
+        }
 
       //Now trying to remove monitoreditem from our internal cache
       for (auto pair : AttributeValueMap)
@@ -433,7 +574,7 @@ uint32_t Subscription::SubscribeEvents(const Node & node, const EventFilter & ev
   AttributeValueMap[params.ClientHandle] = mdata;
 
   CheckStatusCode(result.Status);
-  SimpleAttributeOperandMap[result.MonitoredItemId] = eventfilter; //Not used
+  SimpleAttributeOperandMap[result.MonitoredItemId] = eventfilter;
   return result.MonitoredItemId;
 }
 
@@ -0,0 +1,350 @@
+/// @brief Opc Ua binary encoding of structures described by field lists.
+/// A structure is encoded as its fields in declaration order. Field lists
+/// are types, so the encoders below are expanded by the compiler for every
+/// structure and nested structures with field lists are encoded inline.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#ifndef __OPC_UA_BINARY_FIELDS_H__
+#define __OPC_UA_BINARY_FIELDS_H__
+
+#include "binary_serialization.h"
+
+#include <opc/ua/protocol/binary/stream.h>
+#include <opc/ua/protocol/datetime.h>
+#include <opc/ua/protocol/guid.h>
+#include <opc/ua/protocol/status_codes.h>
+
+#include <cstddef>
+#include <stdint.h>
+#include <type_traits>
+#include <utility>
+
+namespace OpcUa
+{
+namespace Binary
+{
+
+/// @brief Member encoded as is.
+template <typename Struct, typename Type, Type Struct::*Member>
+struct Field
+{
+  typedef Type ValueType;
+
+  static const Type & Get(const Struct & data)
+  {
+    return data.*Member;
+  }
+
+  static Type & Get(Struct & data)
+  {
+    return data.*Member;
+  }
+};
+
+/// @brief Container member encoded as length followed by elements.
+template <typename Struct, typename Type, Type Struct::*Member>
+struct ArrayField : Field<Struct, Type, Member>
+{
+};
+
+/// @brief Member present only if bit Bit of the Mask member is set.
+template <typename Struct, typename Type, Type Struct::*Member, typename MaskType, MaskType Struct::*Mask, unsigned Bit>
+struct OptionalField : Field<Struct, Type, Member>
+{
+  static bool IsSet(const Struct & data)
+  {
+    return (data.*Mask) & (1 << Bit);
+  }
+};
+
+#define OPCUA_FIELD(Struct, Name) \
+  ::OpcUa::Binary::Field<Struct, decltype(Struct::Name), &Struct::Name>
+#define OPCUA_ARRAY_FIELD(Struct, Name) \
+  ::OpcUa::Binary::ArrayField<Struct, decltype(Struct::Name), &Struct::Name>
+#define OPCUA_OPTIONAL_FIELD(Struct, Name, Mask, Bit) \
+  ::OpcUa::Binary::OptionalField<Struct, decltype(Struct::Name), &Struct::Name, decltype(Struct::Mask), &Struct::Mask, Bit>
+
+template <typename... Fields>
+struct FieldList
+{
+};
+
+/// @brief Field list of a structure, void if the structure is encoded by hand.
+template <typename T>
+struct StructFields
+{
+  typedef void Type;
+};
+
+template <typename T>
+struct HasFields : std::integral_constant<bool, !std::is_void<typename StructFields<T>::Type>::value>
+{
+};
+
+/// @brief Encoded size of types which always have the same size, 0 for others.
+template <typename T, typename Enable = void>
+struct FixedSize : std::integral_constant<std::size_t, 0>
+{
+};
+
+template <> struct FixedSize<bool> : std::integral_constant<std::size_t, 1> {};
+template <> struct FixedSize<int8_t> : std::integral_constant<std::size_t, 1> {};
+template <> struct FixedSize<uint8_t> : std::integral_constant<std::size_t, 1> {};
+template <> struct FixedSize<int16_t> : std::integral_constant<std::size_t, 2> {};
+template <> struct FixedSize<uint16_t> : std::integral_constant<std::size_t, 2> {};
+template <> struct FixedSize<int32_t> : std::integral_constant<std::size_t, 4> {};
+template <> struct FixedSize<uint32_t> : std::integral_constant<std::size_t, 4> {};
+template <> struct FixedSize<int64_t> : std::integral_constant<std::size_t, 8> {};
+template <> struct FixedSize<uint64_t> : std::integral_constant<std::size_t, 8> {};
+template <> struct FixedSize<float> : std::integral_constant<std::size_t, 4> {};
+template <> struct FixedSize<double> : std::integral_constant<std::size_t, 8> {};
+template <> struct FixedSize<DateTime> : std::integral_constant<std::size_t, 8> {};
+template <> struct FixedSize<Guid> : std::integral_constant<std::size_t, 16> {};
+template <> struct FixedSize<StatusCode> : std::integral_constant<std::size_t, 4> {};
+
+template <typename F>
+struct FieldSize : FixedSize<typename F::ValueType>
+{
+};
+
+template <typename Struct, typename Type, Type Struct::*Member>
+struct FieldSize<ArrayField<Struct, Type, Member>> : std::integral_constant<std::size_t, 0>
+{
+};
+
+template <typename Struct, typename Type, Type Struct::*Member, typename MaskType, MaskType Struct::*Mask, unsigned Bit>
+struct FieldSize<OptionalField<Struct, Type, Member, MaskType, Mask, Bit>> : std::integral_constant<std::size_t, 0>
+{
+};
+
+template <typename... Fields>
+struct FieldsSize;
+
+template <typename Last>
+struct FieldsSize<Last> : FieldSize<Last>
+{
+};
+
+template <typename First, typename... Rest>
+struct FieldsSize<First, Rest...> : std::integral_constant < std::size_t,
+  FieldSize<First>::value && FieldsSize<Rest...>::value ? FieldSize<First>::value + FieldsSize<Rest...>::value : 0 >
+{
+};
+
+template <typename... Fields>
+struct FixedSize<FieldList<Fields...>> : FieldsSize<Fields...>
+{
+};
+
+/// @brief A structure has a fixed size if all its fields have.
+template <typename T>
+struct FixedSize<T, typename std::enable_if<HasFields<T>::value>::type> : FixedSize<typename StructFields<T>::Type>
+{
+};
+
+// Helper to expand a function call for every field of a pack in order.
+typedef int ExpandFields[];
+
+////////////////////////////////////////////////////////////////////
+// Serialize
+////////////////////////////////////////////////////////////////////
+
+template <typename T>
+inline typename std::enable_if < !HasFields<T>::value >::type SerializeValue(DataSerializer & out, const T & value)
+{
+  out.Serialize(value);
+}
+
+template <typename T>
+inline typename std::enable_if<HasFields<T>::value>::type SerializeValue(DataSerializer & out, const T & value);
+
+template <typename Struct, typename Type, Type Struct::*Member>
+inline void SerializeField(DataSerializer & out, const Struct & data, Field<Struct, Type, Member> *)
+{
+  SerializeValue(out, data.*Member);
+}
+
+template <typename Struct, typename Type, Type Struct::*Member>
+inline void SerializeField(DataSerializer & out, const Struct & data, ArrayField<Struct, Type, Member> *)
+{
+  const Type & container = data.*Member;
+
+  if (container.empty())
+    {
+      out.Serialize(~uint32_t());
+      return;
+    }
+
+  out.Serialize(static_cast<uint32_t>(container.size()));
+
+  for (const typename Type::value_type & value : container)
+    {
+      SerializeValue(out, value);
+    }
+}
+
+template <typename Struct, typename Type, Type Struct::*Member, typename MaskType, MaskType Struct::*Mask, unsigned Bit>
+inline void SerializeField(DataSerializer & out, const Struct & data, OptionalField<Struct, Type, Member, MaskType, Mask, Bit> *)
+{
+  if (OptionalField<Struct, Type, Member, MaskType, Mask, Bit>::IsSet(data))
+    {
+      SerializeValue(out, data.*Member);
+    }
+}
+
+template <typename Struct, typename... Fields>
+inline void SerializeFields(DataSerializer & out, const Struct & data, FieldList<Fields...>)
+{
+  (void)ExpandFields {0, (SerializeField(out, data, static_cast<Fields *>(nullptr)), 0)...};
+}
+
+template <typename T>
+inline typename std::enable_if<HasFields<T>::value>::type SerializeValue(DataSerializer & out, const T & value)
+{
+  SerializeFields(out, value, typename StructFields<T>::Type());
+}
+
+////////////////////////////////////////////////////////////////////
+// Deserialize
+////////////////////////////////////////////////////////////////////
+
+template <typename T>
+inline typename std::enable_if < !HasFields<T>::value >::type DeserializeValue(DataDeserializer & in, T & value)
+{
+  in.Deserialize(value);
+}
+
+template <typename T>
+inline typename std::enable_if<HasFields<T>::value>::type DeserializeValue(DataDeserializer & in, T & value);
+
+template <typename Struct, typename Type, Type Struct::*Member>
+inline void DeserializeField(DataDeserializer & in, Struct & data, Field<Struct, Type, Member> *)
+{
+  DeserializeValue(in, data.*Member);
+}
+
+template <typename Struct, typename Type, Type Struct::*Member>
+inline void DeserializeField(DataDeserializer & in, Struct & data, ArrayField<Struct, Type, Member> *)
+{
+  Type & container = data.*Member;
+  uint32_t size = 0;
+  in.Deserialize(size);
+
+  container.clear();
+
+  if (!size || size == ~uint32_t())
+    {
+      return;
+    }
+
+  ReserveElements(container, size);
+
+  for (uint32_t i = 0; i < size; ++i)
+    {
+      typename Type::value_type value;
+      DeserializeValue(in, value);
+      container.push_back(std::move(value));
+    }
+}
+
+template <typename Struct, typename Type, Type Struct::*Member, typename MaskType, MaskType Struct::*Mask, unsigned Bit>
+inline void DeserializeField(DataDeserializer & in, Struct & data, OptionalField<Struct, Type, Member, MaskType, Mask, Bit> *)
+{
+  if (OptionalField<Struct, Type, Member, MaskType, Mask, Bit>::IsSet(data))
+    {
+      DeserializeValue(in, data.*Member);
+    }
+}
+
+template <typename Struct, typename... Fields>
+inline void DeserializeFields(DataDeserializer & in, Struct & data, FieldList<Fields...>)
+{
+  (void)ExpandFields {0, (DeserializeField(in, data, static_cast<Fields *>(nullptr)), 0)...};
+}
+
+template <typename T>
+inline typename std::enable_if<HasFields<T>::value>::type DeserializeValue(DataDeserializer & in, T & value)
+{
+  DeserializeFields(in, value, typename StructFields<T>::Type());
+}
+
+////////////////////////////////////////////////////////////////////
+// RawSize
+////////////////////////////////////////////////////////////////////
+
+template <typename T>
+inline typename std::enable_if < !HasFields<T>::value, std::size_t >::type RawSizeValue(const T & value)
+{
+  return FixedSize<T>::value ? FixedSize<T>::value : RawSize(value);
+}
+
+template <typename T>
+inline typename std::enable_if<HasFields<T>::value, std::size_t>::type RawSizeValue(const T & value);
+
+template <typename Struct, typename Type, Type Struct::*Member>
+inline std::size_t RawSizeField(const Struct & data, Field<Struct, Type, Member> *)
+{
+  return RawSizeValue(data.*Member);
+}
+
+template <typename Struct, typename Type, Type Struct::*Member>
+inline std::size_t RawSizeField(const Struct & data, ArrayField<Struct, Type, Member> *)
+{
+  typedef typename Type::value_type ValueType;
+  const Type & container = data.*Member;
+  const std::size_t headerSize = 4;
+
+  if (FixedSize<ValueType>::value)
+    {
+      return headerSize + container.size() * FixedSize<ValueType>::value;
+    }
+
+  std::size_t size = headerSize;
+
+  for (const ValueType & value : container)
+    {
+      size += RawSizeValue(value);
+    }
+
+  return size;
+}
+
+template <typename Struct, typename Type, Type Struct::*Member, typename MaskType, MaskType Struct::*Mask, unsigned Bit>
+inline std::size_t RawSizeField(const Struct & data, OptionalField<Struct, Type, Member, MaskType, Mask, Bit> *)
+{
+  if (OptionalField<Struct, Type, Member, MaskType, Mask, Bit>::IsSet(data))
+    {
+      return RawSizeValue(data.*Member);
+    }
+
+  return 0;
+}
+
+template <typename Struct, typename... Fields>
+inline std::size_t RawSizeFields(const Struct & data, FieldList<Fields...>)
+{
+  if (FixedSize<Struct>::value)
+    {
+      return FixedSize<Struct>::value;
+    }
+
+  std::size_t size = 0;
+  (void)ExpandFields {0, (size += RawSizeField(data, static_cast<Fields *>(nullptr)), 0)...};
+  return size;
+}
+
+template <typename T>
+inline typename std::enable_if<HasFields<T>::value, std::size_t>::type RawSizeValue(const T & value)
+{
+  return RawSizeFields(value, typename StructFields<T>::Type());
+}
+
+} // namespace Binary
+} // namespace OpcUa
+
+#endif // __OPC_UA_BINARY_FIELDS_H__
@@ -17,6 +17,17 @@
 
 namespace OpcUa
 {
+
+/// @brief Reserve room for decoded elements.
+// The element count comes from the peer, so large counts only reserve
+// a bounded amount and the container grows as elements are decoded.
+template<class Container>
+inline void ReserveElements(Container & c, uint32_t size)
+{
+  const uint32_t maxReserved = 4096;
+  c.reserve(std::min(size, maxReserved));
+}
+
 template<class Stream, class Container>
 inline void SerializeContainer(Stream & out, const Container & c, uint32_t emptySizeValue = ~uint32_t())
 {
@@ -45,11 +56,13 @@ inline void DeserializeContainer(Stream & in, Container & c)
       return;
     }
 
+  ReserveElements(c, size);
+
   for (uint32_t i = 0; i < size; ++i)
     {
       typename Container::value_type val;
       in.Deserialize(val);
-      c.push_back(val);
+      c.push_back(std::move(val));
     }
 }
 }
@@ -475,133 +475,133 @@ void Variant::Visit(VariantVisitor & visitor) const
     { visitor.Visit(any_cast<bool>(Value)); }
 
   else if (t == typeid(std::vector<bool>))
-    { visitor.Visit(any_cast<std::vector<bool>>(Value)); }
+    { visitor.Visit(any_cast<const std::vector<bool> &>(Value)); }
 
   else if (t == typeid(int8_t))
     { visitor.Visit(any_cast<int8_t>(Value)); }
 
   else if (t == typeid(std::vector<int8_t>))
-    { visitor.Visit(any_cast<std::vector<int8_t>>(Value)); }
+    { visitor.Visit(any_cast<const std::vector<int8_t> &>(Value)); }
 
   else if (t == typeid(uint8_t))
     { visitor.Visit(any_cast<uint8_t>(Value)); }
 
   else if (t == typeid(std::vector<uint8_t>))
-    { visitor.Visit(any_cast<std::vector<uint8_t>>(Value)); }
+    { visitor.Visit(any_cast<const std::vector<uint8_t> &>(Value)); }
 
   else if (t == typeid(int16_t))
     { visitor.Visit(any_cast<int16_t>(Value)); }
 
   else if (t == typeid(std::vector<int16_t>))
-    { visitor.Visit(any_cast<std::vector<int16_t>>(Value)); }
+    { visitor.Visit(any_cast<const std::vector<int16_t> &>(Value)); }
 
   else if (t == typeid(uint16_t))
     { visitor.Visit(any_cast<uint16_t>(Value)); }
 
   else if (t == typeid(std::vector<uint16_t>))
-    { visitor.Visit(any_cast<std::vector<uint16_t>>(Value)); }
+    { visitor.Visit(any_cast<const std::vector<uint16_t> &>(Value)); }
 
   else if (t == typeid(int32_t))
     { visitor.Visit(any_cast<int32_t>(Value)); }
 
   else if (t == typeid(std::vector<int32_t>))
-    { visitor.Visit(any_cast<std::vector<int32_t>>(Value)); }
+    { visitor.Visit(any_cast<const std::vector<int32_t> &>(Value)); }
 
   else if (t == typeid(uint32_t))
     { visitor.Visit(any_cast<uint32_t>(Value)); }
 
   else if (t == typeid(std::vector<uint32_t>))
-    { visitor.Visit(any_cast<std::vector<uint32_t>>(Value)); }
+    { visitor.Visit(any_cast<const std::vector<uint32_t> &>(Value)); }
 
   else if (t == typeid(int64_t))
     { visitor.Visit(any_cast<int64_t>(Value)); }
 
   else if (t == typeid(std::vector<int64_t>))
-    { visitor.Visit(any_cast<std::vector<int64_t>>(Value)); }
+    { visitor.Visit(any_cast<const std::vector<int64_t> &>(Value)); }
 
   else if (t == typeid(uint64_t))
     { visitor.Visit(any_cast<uint64_t>(Value)); }
 
   else if (t == typeid(std::vector<uint64_t>))
-    { visitor.Visit(any_cast<std::vector<uint64_t>>(Value)); }
+    { visitor.Visit(any_cast<const std::vector<uint64_t> &>(Value)); }
 
   else if (t == typeid(float))
     { visitor.Visit(any_cast<float>(Value)); }
 
   else if (t == typeid(std::vector<float>))
-    { visitor.Visit(any_cast<std::vector<float>>(Value)); }
+    { visitor.Visit(any_cast<const std::vector<float> &>(Value)); }
 
   else if (t == typeid(double))
     { visitor.Visit(any_cast<double>(Value)); }
 
   else if (t == typeid(std::vector<double>))
-    { visitor.Visit(any_cast<std::vector<double>>(Value)); }
+    { visitor.Visit(any_cast<const std::vector<double> &>(Value)); }
 
   else if (t == typeid(std::string))
     { visitor.Visit(any_cast<std::string>(Value)); }
 
   else if (t == typeid(std::vector<std::string>))
-    { visitor.Visit(any_cast<std::vector<std::string>>(Value)); }
+    { visitor.Visit(any_cast<const std::vector<std::string> &>(Value)); }
 
   else if (t == typeid(DateTime))
     { visitor.Visit(any_cast<DateTime>(Value)); }
 
   else if (t == typeid(std::vector<DateTime>))
-    { visitor.Visit(any_cast<std::vector<DateTime>>(Value)); }
+    { visitor.Visit(any_cast<const std::vector<DateTime> &>(Value)); }
 
   else if (t == typeid(Guid))
     { visitor.Visit(any_cast<Guid>(Value)); }
 
   else if (t == typeid(std::vector<Guid>))
-    { visitor.Visit(any_cast<std::vector<Guid>>(Value)); }
+    { visitor.Visit(any_cast<const std::vector<Guid> &>(Value)); }
 
   else if (t == typeid(ByteString))
     { visitor.Visit(any_cast<ByteString>(Value)); }
 
   else if (t == typeid(std::vector<ByteString>))
-    { visitor.Visit(any_cast<std::vector<ByteString>>(Value)); }
+    { visitor.Visit(any_cast<const std::vector<ByteString> &>(Value)); }
 
   else if (t == typeid(NodeId))
     { visitor.Visit(any_cast<NodeId>(Value)); }
 
   else if (t == typeid(std::vector<NodeId>))
-    { visitor.Visit(any_cast<std::vector<NodeId>>(Value)); }
+    { visitor.Visit(any_cast<const std::vector<NodeId> &>(Value)); }
 
   else if (t == typeid(StatusCode))
     { visitor.Visit(any_cast<StatusCode>(Value)); }
 
   else if (t == typeid(std::vector<StatusCode>))
-    { visitor.Visit(any_cast<std::vector<StatusCode>>(Value)); }
+    { visitor.Visit(any_cast<const std::vector<StatusCode> &>(Value)); }
 
   else if (t == typeid(LocalizedText))
     { visitor.Visit(any_cast<LocalizedText>(Value)); }
 
   else if (t == typeid(std::vector<LocalizedText>))
-    { visitor.Visit(any_cast<std::vector<LocalizedText>>(Value)); }
+    { visitor.Visit(any_cast<const std::vector<LocalizedText> &>(Value)); }
 
   else if (t == typeid(QualifiedName))
     { visitor.Visit(any_cast<QualifiedName>(Value)); }
 
   else if (t == typeid(std::vector<QualifiedName>))
-    { visitor.Visit(any_cast<std::vector<QualifiedName>>(Value)); }
+    { visitor.Visit(any_cast<const std::vector<QualifiedName> &>(Value)); }
 
   /*
       else if (t == typeid(DataValue))
         visitor.Visit(any_cast<DataValue>(Value));
       else if (t == typeid(std::vector<DataValue>))
-        visitor.Visit(any_cast<std::vector<DataValue>>(Value));
+        visitor.Visit(any_cast<const std::vector<DataValue> &>(Value));
         //Variant of variant is not allowed but variant of an array of variant is OK
       else if (t == typeid(Variant))
         visitor.Visit(any_cast<Variant>(Value));
   */
   else if (t == typeid(std::vector<Variant>))
-    { visitor.Visit(any_cast<std::vector<Variant>>(Value)); }
+    { visitor.Visit(any_cast<const std::vector<Variant> &>(Value)); }
 
   else if (t == typeid(DiagnosticInfo))
     { visitor.Visit(any_cast<DiagnosticInfo>(Value)); }
 
   else if (t == typeid(std::vector<DiagnosticInfo>))
-    { visitor.Visit(any_cast<std::vector<DiagnosticInfo>>(Value)); }
+    { visitor.Visit(any_cast<const std::vector<DiagnosticInfo> &>(Value)); }
 
   else
     { throw std::runtime_error(std::string("Unknown variant type '") + t.name() + "'."); }
@@ -120,6 +120,26 @@ TranslateBrowsePathsToNodeIdsResponse::TranslateBrowsePathsToNodeIdsResponse()
 {
 }
 
+QueryFirstRequest::QueryFirstRequest()
+  : TypeId(QUERY_FIRST_REQUEST)
+{
+}
+
+QueryFirstResponse::QueryFirstResponse()
+  : TypeId(QUERY_FIRST_RESPONSE)
+{
+}
+
+QueryNextRequest::QueryNextRequest()
+  : TypeId(QUERY_NEXT_REQUEST)
+{
+}
+
+QueryNextResponse::QueryNextResponse()
+  : TypeId(QUERY_NEXT_RESPONSE)
+{
+}
+
 namespace Binary
 {
 
@@ -773,5 +793,341 @@ void DataDeserializer::Deserialize<TranslateBrowsePathsToNodeIdsRequest>(Transla
   *this >> request.Parameters;
 }
 
+////////////////////////////////////////////////////////////////////
+// QueryDataDescription
+////////////////////////////////////////////////////////////////////
+
+template<>
+std::size_t RawSize<QueryDataDescription>(const QueryDataDescription & desc)
+{
+  return RawSize(desc.Path) + RawSize(desc.Attribute) + RawSize(desc.IndexRange);
+}
+
+template<>
+void DataSerializer::Serialize<QueryDataDescription>(const QueryDataDescription & desc)
+{
+  *this << desc.Path;
+  *this << desc.Attribute;
+  *this << desc.IndexRange;
+}
+
+template<>
+void DataDeserializer::Deserialize<QueryDataDescription>(QueryDataDescription & desc)
+{
+  *this >> desc.Path;
+  *this >> desc.Attribute;
+  *this >> desc.IndexRange;
+}
+
+////////////////////////////////////////////////////////////////////
+// NodeTypeDescription
+////////////////////////////////////////////////////////////////////
+
+template<>
+std::size_t RawSize<NodeTypeDescription>(const NodeTypeDescription & desc)
+{
+  return RawSize(desc.TypeDefinitionNode) + RawSize(desc.IncludeSubtypes) + RawSizeContainer(desc.DataToReturn);
+}
+
+template<>
+void DataSerializer::Serialize<NodeTypeDescription>(const NodeTypeDescription & desc)
+{
+  *this << desc.TypeDefinitionNode;
+  *this << desc.IncludeSubtypes;
+  SerializeContainer(*this, desc.DataToReturn);
+}
+
+template<>
+void DataDeserializer::Deserialize<NodeTypeDescription>(NodeTypeDescription & desc)
+{
+  *this >> desc.TypeDefinitionNode;
+  *this >> desc.IncludeSubtypes;
+  DeserializeContainer(*this, desc.DataToReturn);
+}
+
+////////////////////////////////////////////////////////////////////
+// QueryDataSet
+////////////////////////////////////////////////////////////////////
+
+template<>
+std::size_t RawSize<QueryDataSet>(const QueryDataSet & dataSet)
+{
+  return RawSize(dataSet.Node) + RawSize(dataSet.TypeDefinitionNode) + RawSizeContainer(dataSet.Values);
+}
+
+template<>
+void DataSerializer::Serialize<QueryDataSet>(const QueryDataSet & dataSet)
+{
+  *this << dataSet.Node;
+  *this << dataSet.TypeDefinitionNode;
+  SerializeContainer(*this, dataSet.Values);
+}
+
+template<>
+void DataDeserializer::Deserialize<QueryDataSet>(QueryDataSet & dataSet)
+{
+  *this >> dataSet.Node;
+  *this >> dataSet.TypeDefinitionNode;
+  DeserializeContainer(*this, dataSet.Values);
+}
+
+////////////////////////////////////////////////////////////////////
+// ContentFilterElementResult
+////////////////////////////////////////////////////////////////////
+
+template<>
+std::size_t RawSize<ContentFilterElementResult>(const ContentFilterElementResult & result)
+{
+  return RawSize(result.Status) + RawSizeContainer(result.OperandStatusCodes) + RawSizeContainer(result.OperandDiagnosticInfos);
+}
+
+template<>
+void DataSerializer::Serialize<ContentFilterElementResult>(const ContentFilterElementResult & result)
+{
+  *this << result.Status;
+  SerializeContainer(*this, result.OperandStatusCodes);
+  SerializeContainer(*this, result.OperandDiagnosticInfos);
+}
+
+template<>
+void DataDeserializer::Deserialize<ContentFilterElementResult>(ContentFilterElementResult & result)
+{
+  *this >> result.Status;
+  DeserializeContainer(*this, result.OperandStatusCodes);
+  DeserializeContainer(*this, result.OperandDiagnosticInfos);
+}
+
+////////////////////////////////////////////////////////////////////
+// ContentFilterResult
+////////////////////////////////////////////////////////////////////
+
+template<>
+std::size_t RawSize<ContentFilterResult>(const ContentFilterResult & result)
+{
+  return RawSizeContainer(result.ElementResults) + RawSizeContainer(result.ElementDiagnosticInfos);
+}
+
+template<>
+void DataSerializer::Serialize<ContentFilterResult>(const ContentFilterResult & result)
+{
+  SerializeContainer(*this, result.ElementResults);
+  SerializeContainer(*this, result.ElementDiagnosticInfos);
+}
+
+template<>
+void DataDeserializer::Deserialize<ContentFilterResult>(ContentFilterResult & result)
+{
+  DeserializeContainer(*this, result.ElementResults);
+  DeserializeContainer(*this, result.ElementDiagnosticInfos);
+}
+
+////////////////////////////////////////////////////////////////////
+// ParsingResult
+////////////////////////////////////////////////////////////////////
+
+template<>
+std::size_t RawSize<ParsingResult>(const ParsingResult & result)
+{
+  return RawSize(result.Status) + RawSizeContainer(result.DataStatusCodes) + RawSizeContainer(result.DataDiagnosticInfos);
+}
+
+template<>
+void DataSerializer::Serialize<ParsingResult>(const ParsingResult & result)
+{
+  *this << result.Status;
+  SerializeContainer(*this, result.DataStatusCodes);
+  SerializeContainer(*this, result.DataDiagnosticInfos);
+}
+
+template<>
+void DataDeserializer::Deserialize<ParsingResult>(ParsingResult & result)
+{
+  *this >> result.Status;
+  DeserializeContainer(*this, result.DataStatusCodes);
+  DeserializeContainer(*this, result.DataDiagnosticInfos);
+}
+
+////////////////////////////////////////////////////////////////////
+// QueryFirstParameters
+////////////////////////////////////////////////////////////////////
+
+template<>
+std::size_t RawSize<QueryFirstParameters>(const QueryFirstParameters & params)
+{
+  return RawSize(params.View) +
+         RawSizeContainer(params.NodeTypes) +
+         RawSizeContainer(params.Filter) +
+         RawSize(params.MaxDataSetsToReturn) +
+         RawSize(params.MaxReferencesToReturn);
+}
+
+template<>
+void DataSerializer::Serialize<QueryFirstParameters>(const QueryFirstParameters & params)
+{
+  *this << params.View;
+  SerializeContainer(*this, params.NodeTypes);
+  SerializeContainer(*this, params.Filter);
+  *this << params.MaxDataSetsToReturn;
+  *this << params.MaxReferencesToReturn;
+}
+
+template<>
+void DataDeserializer::Deserialize<QueryFirstParameters>(QueryFirstParameters & params)
+{
+  *this >> params.View;
+  DeserializeContainer(*this, params.NodeTypes);
+  DeserializeContainer(*this, params.Filter);
+  *this >> params.MaxDataSetsToReturn;
+  *this >> params.MaxReferencesToReturn;
+}
+
+////////////////////////////////////////////////////////////////////
+// QueryFirstRequest
+////////////////////////////////////////////////////////////////////
+
+template<>
+std::size_t RawSize<QueryFirstRequest>(const QueryFirstRequest & request)
+{
+  return RawSize(request.TypeId) + RawSize(request.Header) + RawSize(request.Parameters);
+}
+
+template<>
+void DataSerializer::Serialize<QueryFirstRequest>(const QueryFirstRequest & request)
+{
+  *this << request.TypeId;
+  *this << request.Header;
+  *this << request.Parameters;
+}
+
+template<>
+void DataDeserializer::Deserialize<QueryFirstRequest>(QueryFirstRequest & request)
+{
+  *this >> request.TypeId;
+  *this >> request.Header;
+  *this >> request.Parameters;
+}
+
+////////////////////////////////////////////////////////////////////
+// QueryFirstResponse
+////////////////////////////////////////////////////////////////////
+
+template<>
+std::size_t RawSize<QueryFirstResponse>(const QueryFirstResponse & response)
+{
+  return RawSize(response.TypeId) + RawSize(response.Header) +
+         RawSizeContainer(response.Result.QueryDataSets) +
+         RawSizeContainer(response.Result.ContinuationPoint) +
+         RawSizeContainer(response.Result.ParsingResults) +
+         RawSizeContainer(response.Result.Diagnostics) +
+         RawSize(response.Result.FilterResult);
+}
+
+template<>
+void DataSerializer::Serialize<QueryFirstResponse>(const QueryFirstResponse & response)
+{
+  *this << response.TypeId;
+  *this << response.Header;
+  SerializeContainer(*this, response.Result.QueryDataSets);
+  SerializeContainer(*this, response.Result.ContinuationPoint);
+  SerializeContainer(*this, response.Result.ParsingResults);
+  SerializeContainer(*this, response.Result.Diagnostics);
+  *this << response.Result.FilterResult;
+}
+
+template<>
+void DataDeserializer::Deserialize<QueryFirstResponse>(QueryFirstResponse & response)
+{
+  *this >> response.TypeId;
+  *this >> response.Header;
+  DeserializeContainer(*this, response.Result.QueryDataSets);
+  DeserializeContainer(*this, response.Result.ContinuationPoint);
+  DeserializeContainer(*this, response.Result.ParsingResults);
+  DeserializeContainer(*this, response.Result.Diagnostics);
+  *this >> response.Result.FilterResult;
+  response.Result.Status = response.Header.ServiceResult;
+}
+
+////////////////////////////////////////////////////////////////////
+// QueryNextParameters
+////////////////////////////////////////////////////////////////////
+
+template<>
+std::size_t RawSize<QueryNextParameters>(const QueryNextParameters & params)
+{
+  return RawSize(params.ReleaseContinuationPoint) + RawSizeContainer(params.ContinuationPoint);
+}
+
+template<>
+void DataSerializer::Serialize<QueryNextParameters>(const QueryNextParameters & params)
+{
+  *this << params.ReleaseContinuationPoint;
+  SerializeContainer(*this, params.ContinuationPoint);
+}
+
+template<>
+void DataDeserializer::Deserialize<QueryNextParameters>(QueryNextParameters & params)
+{
+  *this >> params.ReleaseContinuationPoint;
+  DeserializeContainer(*this, params.ContinuationPoint);
+}
+
+////////////////////////////////////////////////////////////////////
+// QueryNextRequest
+////////////////////////////////////////////////////////////////////
+
+template<>
+std::size_t RawSize<QueryNextRequest>(const QueryNextRequest & request)
+{
+  return RawSize(request.TypeId) + RawSize(request.Header) + RawSize(request.Parameters);
+}
+
+template<>
+void DataSerializer::Serialize<QueryNextRequest>(const QueryNextRequest & request)
+{
+  *this << request.TypeId;
+  *this << request.Header;
+  *this << request.Parameters;
+}
+
+template<>
+void DataDeserializer::Deserialize<QueryNextRequest>(QueryNextRequest & request)
+{
+  *this >> request.TypeId;
+  *this >> request.Header;
+  *this >> request.Parameters;
+}
+
+////////////////////////////////////////////////////////////////////
+// QueryNextResponse
+////////////////////////////////////////////////////////////////////
+
+template<>
+std::size_t RawSize<QueryNextResponse>(const QueryNextResponse & response)
+{
+  return RawSize(response.TypeId) + RawSize(response.Header) +
+         RawSizeContainer(response.Result.QueryDataSets) +
+         RawSizeContainer(response.Result.RevisedContinuationPoint);
+}
+
+template<>
+void DataSerializer::Serialize<QueryNextResponse>(const QueryNextResponse & response)
+{
+  *this << response.TypeId;
+  *this << response.Header;
+  SerializeContainer(*this, response.Result.QueryDataSets);
+  SerializeContainer(*this, response.Result.RevisedContinuationPoint);
+}
+
+template<>
+void DataDeserializer::Deserialize<QueryNextResponse>(QueryNextResponse & response)
+{
+  *this >> response.TypeId;
+  *this >> response.Header;
+  DeserializeContainer(*this, response.Result.QueryDataSets);
+  DeserializeContainer(*this, response.Result.RevisedContinuationPoint);
+  response.Result.Status = response.Header.ServiceResult;
+}
+
 } // namespace Binary
+
 } // namespace OpcUa
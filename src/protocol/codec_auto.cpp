@@ -0,0 +1,1779 @@
+// DO NOT EDIT THIS FILE!
+// It is automatically generated from opcfoundation.org schemas.
+//
+
+/// @brief Opc Ua Binary.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include "fields_auto.h"
+
+namespace OpcUa
+{
+namespace Binary
+{
+
+template<>
+std::size_t RawSize<OpenFileMode>(const OpenFileMode &)
+{
+  return sizeof(uint32_t);
+}
+
+template<>
+void DataSerializer::Serialize<OpenFileMode>(const OpenFileMode & data)
+{
+  *this << static_cast<uint32_t>(data);
+}
+
+template<>
+void DataDeserializer::Deserialize<OpenFileMode>(OpenFileMode & data)
+{
+  uint32_t tmp;
+  *this >> tmp;
+  data = static_cast<OpenFileMode>(tmp);
+}
+
+template<>
+std::size_t RawSize<NodeClass>(const NodeClass &)
+{
+  return sizeof(uint32_t);
+}
+
+template<>
+void DataSerializer::Serialize<NodeClass>(const NodeClass & data)
+{
+  *this << static_cast<uint32_t>(data);
+}
+
+template<>
+void DataDeserializer::Deserialize<NodeClass>(NodeClass & data)
+{
+  uint32_t tmp;
+  *this >> tmp;
+  data = static_cast<NodeClass>(tmp);
+}
+
+template<>
+std::size_t RawSize<ApplicationType>(const ApplicationType &)
+{
+  return sizeof(uint32_t);
+}
+
+template<>
+void DataSerializer::Serialize<ApplicationType>(const ApplicationType & data)
+{
+  *this << static_cast<uint32_t>(data);
+}
+
+template<>
+void DataDeserializer::Deserialize<ApplicationType>(ApplicationType & data)
+{
+  uint32_t tmp;
+  *this >> tmp;
+  data = static_cast<ApplicationType>(tmp);
+}
+
+template<>
+std::size_t RawSize<MessageSecurityMode>(const MessageSecurityMode &)
+{
+  return sizeof(uint32_t);
+}
+
+template<>
+void DataSerializer::Serialize<MessageSecurityMode>(const MessageSecurityMode & data)
+{
+  *this << static_cast<uint32_t>(data);
+}
+
+template<>
+void DataDeserializer::Deserialize<MessageSecurityMode>(MessageSecurityMode & data)
+{
+  uint32_t tmp;
+  *this >> tmp;
+  data = static_cast<MessageSecurityMode>(tmp);
+}
+
+template<>
+std::size_t RawSize<UserTokenType>(const UserTokenType &)
+{
+  return sizeof(uint32_t);
+}
+
+template<>
+void DataSerializer::Serialize<UserTokenType>(const UserTokenType & data)
+{
+  *this << static_cast<uint32_t>(data);
+}
+
+template<>
+void DataDeserializer::Deserialize<UserTokenType>(UserTokenType & data)
+{
+  uint32_t tmp;
+  *this >> tmp;
+  data = static_cast<UserTokenType>(tmp);
+}
+
+template<>
+std::size_t RawSize<SecurityTokenRequestType>(const SecurityTokenRequestType &)
+{
+  return sizeof(uint32_t);
+}
+
+template<>
+void DataSerializer::Serialize<SecurityTokenRequestType>(const SecurityTokenRequestType & data)
+{
+  *this << static_cast<uint32_t>(data);
+}
+
+template<>
+void DataDeserializer::Deserialize<SecurityTokenRequestType>(SecurityTokenRequestType & data)
+{
+  uint32_t tmp;
+  *this >> tmp;
+  data = static_cast<SecurityTokenRequestType>(tmp);
+}
+
+template<>
+std::size_t RawSize<NodeAttributesMask>(const NodeAttributesMask &)
+{
+  return sizeof(uint32_t);
+}
+
+template<>
+void DataSerializer::Serialize<NodeAttributesMask>(const NodeAttributesMask & data)
+{
+  *this << static_cast<uint32_t>(data);
+}
+
+template<>
+void DataDeserializer::Deserialize<NodeAttributesMask>(NodeAttributesMask & data)
+{
+  uint32_t tmp;
+  *this >> tmp;
+  data = static_cast<NodeAttributesMask>(tmp);
+}
+
+template<>
+std::size_t RawSize<AttributeWriteMask>(const AttributeWriteMask &)
+{
+  return sizeof(uint32_t);
+}
+
+template<>
+void DataSerializer::Serialize<AttributeWriteMask>(const AttributeWriteMask & data)
+{
+  *this << static_cast<uint32_t>(data);
+}
+
+template<>
+void DataDeserializer::Deserialize<AttributeWriteMask>(AttributeWriteMask & data)
+{
+  uint32_t tmp;
+  *this >> tmp;
+  data = static_cast<AttributeWriteMask>(tmp);
+}
+
+template<>
+std::size_t RawSize<BrowseDirection>(const BrowseDirection &)
+{
+  return sizeof(uint32_t);
+}
+
+template<>
+void DataSerializer::Serialize<BrowseDirection>(const BrowseDirection & data)
+{
+  *this << static_cast<uint32_t>(data);
+}
+
+template<>
+void DataDeserializer::Deserialize<BrowseDirection>(BrowseDirection & data)
+{
+  uint32_t tmp;
+  *this >> tmp;
+  data = static_cast<BrowseDirection>(tmp);
+}
+
+template<>
+std::size_t RawSize<BrowseResultMask>(const BrowseResultMask &)
+{
+  return sizeof(uint32_t);
+}
+
+template<>
+void DataSerializer::Serialize<BrowseResultMask>(const BrowseResultMask & data)
+{
+  *this << static_cast<uint32_t>(data);
+}
+
+template<>
+void DataDeserializer::Deserialize<BrowseResultMask>(BrowseResultMask & data)
+{
+  uint32_t tmp;
+  *this >> tmp;
+  data = static_cast<BrowseResultMask>(tmp);
+}
+
+template<>
+std::size_t RawSize<ComplianceLevel>(const ComplianceLevel &)
+{
+  return sizeof(uint32_t);
+}
+
+template<>
+void DataSerializer::Serialize<ComplianceLevel>(const ComplianceLevel & data)
+{
+  *this << static_cast<uint32_t>(data);
+}
+
+template<>
+void DataDeserializer::Deserialize<ComplianceLevel>(ComplianceLevel & data)
+{
+  uint32_t tmp;
+  *this >> tmp;
+  data = static_cast<ComplianceLevel>(tmp);
+}
+
+template<>
+std::size_t RawSize<FilterOperator>(const FilterOperator &)
+{
+  return sizeof(uint32_t);
+}
+
+template<>
+void DataSerializer::Serialize<FilterOperator>(const FilterOperator & data)
+{
+  *this << static_cast<uint32_t>(data);
+}
+
+template<>
+void DataDeserializer::Deserialize<FilterOperator>(FilterOperator & data)
+{
+  uint32_t tmp;
+  *this >> tmp;
+  data = static_cast<FilterOperator>(tmp);
+}
+
+template<>
+std::size_t RawSize<TimestampsToReturn>(const TimestampsToReturn &)
+{
+  return sizeof(uint32_t);
+}
+
+template<>
+void DataSerializer::Serialize<TimestampsToReturn>(const TimestampsToReturn & data)
+{
+  *this << static_cast<uint32_t>(data);
+}
+
+template<>
+void DataDeserializer::Deserialize<TimestampsToReturn>(TimestampsToReturn & data)
+{
+  uint32_t tmp;
+  *this >> tmp;
+  data = static_cast<TimestampsToReturn>(tmp);
+}
+
+template<>
+std::size_t RawSize<HistoryUpdateType>(const HistoryUpdateType &)
+{
+  return sizeof(uint32_t);
+}
+
+template<>
+void DataSerializer::Serialize<HistoryUpdateType>(const HistoryUpdateType & data)
+{
+  *this << static_cast<uint32_t>(data);
+}
+
+template<>
+void DataDeserializer::Deserialize<HistoryUpdateType>(HistoryUpdateType & data)
+{
+  uint32_t tmp;
+  *this >> tmp;
+  data = static_cast<HistoryUpdateType>(tmp);
+}
+
+template<>
+std::size_t RawSize<PerformUpdateType>(const PerformUpdateType &)
+{
+  return sizeof(uint32_t);
+}
+
+template<>
+void DataSerializer::Serialize<PerformUpdateType>(const PerformUpdateType & data)
+{
+  *this << static_cast<uint32_t>(data);
+}
+
+template<>
+void DataDeserializer::Deserialize<PerformUpdateType>(PerformUpdateType & data)
+{
+  uint32_t tmp;
+  *this >> tmp;
+  data = static_cast<PerformUpdateType>(tmp);
+}
+
+template<>
+std::size_t RawSize<MonitoringMode>(const MonitoringMode &)
+{
+  return sizeof(uint32_t);
+}
+
+template<>
+void DataSerializer::Serialize<MonitoringMode>(const MonitoringMode & data)
+{
+  *this << static_cast<uint32_t>(data);
+}
+
+template<>
+void DataDeserializer::Deserialize<MonitoringMode>(MonitoringMode & data)
+{
+  uint32_t tmp;
+  *this >> tmp;
+  data = static_cast<MonitoringMode>(tmp);
+}
+
+template<>
+std::size_t RawSize<DataChangeTrigger>(const DataChangeTrigger &)
+{
+  return sizeof(uint32_t);
+}
+
+template<>
+void DataSerializer::Serialize<DataChangeTrigger>(const DataChangeTrigger & data)
+{
+  *this << static_cast<uint32_t>(data);
+}
+
+template<>
+void DataDeserializer::Deserialize<DataChangeTrigger>(DataChangeTrigger & data)
+{
+  uint32_t tmp;
+  *this >> tmp;
+  data = static_cast<DataChangeTrigger>(tmp);
+}
+
+template<>
+std::size_t RawSize<DeadbandType>(const DeadbandType &)
+{
+  return sizeof(uint32_t);
+}
+
+template<>
+void DataSerializer::Serialize<DeadbandType>(const DeadbandType & data)
+{
+  *this << static_cast<uint32_t>(data);
+}
+
+template<>
+void DataDeserializer::Deserialize<DeadbandType>(DeadbandType & data)
+{
+  uint32_t tmp;
+  *this >> tmp;
+  data = static_cast<DeadbandType>(tmp);
+}
+
+template<>
+std::size_t RawSize<EnumeratedTestType>(const EnumeratedTestType &)
+{
+  return sizeof(uint32_t);
+}
+
+template<>
+void DataSerializer::Serialize<EnumeratedTestType>(const EnumeratedTestType & data)
+{
+  *this << static_cast<uint32_t>(data);
+}
+
+template<>
+void DataDeserializer::Deserialize<EnumeratedTestType>(EnumeratedTestType & data)
+{
+  uint32_t tmp;
+  *this >> tmp;
+  data = static_cast<EnumeratedTestType>(tmp);
+}
+
+template<>
+std::size_t RawSize<RedundancySupport>(const RedundancySupport &)
+{
+  return sizeof(uint32_t);
+}
+
+template<>
+void DataSerializer::Serialize<RedundancySupport>(const RedundancySupport & data)
+{
+  *this << static_cast<uint32_t>(data);
+}
+
+template<>
+void DataDeserializer::Deserialize<RedundancySupport>(RedundancySupport & data)
+{
+  uint32_t tmp;
+  *this >> tmp;
+  data = static_cast<RedundancySupport>(tmp);
+}
+
+template<>
+std::size_t RawSize<ServerState>(const ServerState &)
+{
+  return sizeof(uint32_t);
+}
+
+template<>
+void DataSerializer::Serialize<ServerState>(const ServerState & data)
+{
+  *this << static_cast<uint32_t>(data);
+}
+
+template<>
+void DataDeserializer::Deserialize<ServerState>(ServerState & data)
+{
+  uint32_t tmp;
+  *this >> tmp;
+  data = static_cast<ServerState>(tmp);
+}
+
+template<>
+std::size_t RawSize<ModelChangeStructureVerbMask>(const ModelChangeStructureVerbMask &)
+{
+  return sizeof(uint32_t);
+}
+
+template<>
+void DataSerializer::Serialize<ModelChangeStructureVerbMask>(const ModelChangeStructureVerbMask & data)
+{
+  *this << static_cast<uint32_t>(data);
+}
+
+template<>
+void DataDeserializer::Deserialize<ModelChangeStructureVerbMask>(ModelChangeStructureVerbMask & data)
+{
+  uint32_t tmp;
+  *this >> tmp;
+  data = static_cast<ModelChangeStructureVerbMask>(tmp);
+}
+
+template<>
+std::size_t RawSize<AxisScaleEnumeration>(const AxisScaleEnumeration &)
+{
+  return sizeof(uint32_t);
+}
+
+template<>
+void DataSerializer::Serialize<AxisScaleEnumeration>(const AxisScaleEnumeration & data)
+{
+  *this << static_cast<uint32_t>(data);
+}
+
+template<>
+void DataDeserializer::Deserialize<AxisScaleEnumeration>(AxisScaleEnumeration & data)
+{
+  uint32_t tmp;
+  *this >> tmp;
+  data = static_cast<AxisScaleEnumeration>(tmp);
+}
+
+template<>
+std::size_t RawSize<ExceptionDeviationFormat>(const ExceptionDeviationFormat &)
+{
+  return sizeof(uint32_t);
+}
+
+template<>
+void DataSerializer::Serialize<ExceptionDeviationFormat>(const ExceptionDeviationFormat & data)
+{
+  *this << static_cast<uint32_t>(data);
+}
+
+template<>
+void DataDeserializer::Deserialize<ExceptionDeviationFormat>(ExceptionDeviationFormat & data)
+{
+  uint32_t tmp;
+  *this >> tmp;
+  data = static_cast<ExceptionDeviationFormat>(tmp);
+}
+
+template<>
+std::size_t RawSize<XmlElement>(const XmlElement & data)
+{
+  return RawSizeFields(data, StructFields<XmlElement>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<XmlElement>(const XmlElement & data)
+{
+  SerializeFields(*this, data, StructFields<XmlElement>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<XmlElement>(XmlElement & data)
+{
+  DeserializeFields(*this, data, StructFields<XmlElement>::Type());
+}
+
+template<>
+std::size_t RawSize<ExtensionObject>(const ExtensionObject & data)
+{
+  return RawSizeFields(data, StructFields<ExtensionObject>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<ExtensionObject>(const ExtensionObject & data)
+{
+  SerializeFields(*this, data, StructFields<ExtensionObject>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<ExtensionObject>(ExtensionObject & data)
+{
+  DeserializeFields(*this, data, StructFields<ExtensionObject>::Type());
+}
+
+template<>
+std::size_t RawSize<ApplicationDescription>(const ApplicationDescription & data)
+{
+  return RawSizeFields(data, StructFields<ApplicationDescription>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<ApplicationDescription>(const ApplicationDescription & data)
+{
+  SerializeFields(*this, data, StructFields<ApplicationDescription>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<ApplicationDescription>(ApplicationDescription & data)
+{
+  DeserializeFields(*this, data, StructFields<ApplicationDescription>::Type());
+}
+
+template<>
+std::size_t RawSize<UserTokenPolicy>(const UserTokenPolicy & data)
+{
+  return RawSizeFields(data, StructFields<UserTokenPolicy>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<UserTokenPolicy>(const UserTokenPolicy & data)
+{
+  SerializeFields(*this, data, StructFields<UserTokenPolicy>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<UserTokenPolicy>(UserTokenPolicy & data)
+{
+  DeserializeFields(*this, data, StructFields<UserTokenPolicy>::Type());
+}
+
+template<>
+std::size_t RawSize<EndpointDescription>(const EndpointDescription & data)
+{
+  return RawSizeFields(data, StructFields<EndpointDescription>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<EndpointDescription>(const EndpointDescription & data)
+{
+  SerializeFields(*this, data, StructFields<EndpointDescription>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<EndpointDescription>(EndpointDescription & data)
+{
+  DeserializeFields(*this, data, StructFields<EndpointDescription>::Type());
+}
+
+template<>
+std::size_t RawSize<GetEndpointsParameters>(const GetEndpointsParameters & data)
+{
+  return RawSizeFields(data, StructFields<GetEndpointsParameters>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<GetEndpointsParameters>(const GetEndpointsParameters & data)
+{
+  SerializeFields(*this, data, StructFields<GetEndpointsParameters>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<GetEndpointsParameters>(GetEndpointsParameters & data)
+{
+  DeserializeFields(*this, data, StructFields<GetEndpointsParameters>::Type());
+}
+
+template<>
+std::size_t RawSize<GetEndpointsRequest>(const GetEndpointsRequest & data)
+{
+  return RawSizeFields(data, StructFields<GetEndpointsRequest>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<GetEndpointsRequest>(const GetEndpointsRequest & data)
+{
+  SerializeFields(*this, data, StructFields<GetEndpointsRequest>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<GetEndpointsRequest>(GetEndpointsRequest & data)
+{
+  DeserializeFields(*this, data, StructFields<GetEndpointsRequest>::Type());
+}
+
+template<>
+std::size_t RawSize<GetEndpointsResponse>(const GetEndpointsResponse & data)
+{
+  return RawSizeFields(data, StructFields<GetEndpointsResponse>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<GetEndpointsResponse>(const GetEndpointsResponse & data)
+{
+  SerializeFields(*this, data, StructFields<GetEndpointsResponse>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<GetEndpointsResponse>(GetEndpointsResponse & data)
+{
+  DeserializeFields(*this, data, StructFields<GetEndpointsResponse>::Type());
+}
+
+template<>
+std::size_t RawSize<SignedSoftwareCertificate>(const SignedSoftwareCertificate & data)
+{
+  return RawSizeFields(data, StructFields<SignedSoftwareCertificate>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<SignedSoftwareCertificate>(const SignedSoftwareCertificate & data)
+{
+  SerializeFields(*this, data, StructFields<SignedSoftwareCertificate>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<SignedSoftwareCertificate>(SignedSoftwareCertificate & data)
+{
+  DeserializeFields(*this, data, StructFields<SignedSoftwareCertificate>::Type());
+}
+
+template<>
+std::size_t RawSize<SignatureData>(const SignatureData & data)
+{
+  return RawSizeFields(data, StructFields<SignatureData>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<SignatureData>(const SignatureData & data)
+{
+  SerializeFields(*this, data, StructFields<SignatureData>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<SignatureData>(SignatureData & data)
+{
+  DeserializeFields(*this, data, StructFields<SignatureData>::Type());
+}
+
+template<>
+std::size_t RawSize<CreateSessionParameters>(const CreateSessionParameters & data)
+{
+  return RawSizeFields(data, StructFields<CreateSessionParameters>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<CreateSessionParameters>(const CreateSessionParameters & data)
+{
+  SerializeFields(*this, data, StructFields<CreateSessionParameters>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<CreateSessionParameters>(CreateSessionParameters & data)
+{
+  DeserializeFields(*this, data, StructFields<CreateSessionParameters>::Type());
+}
+
+template<>
+std::size_t RawSize<CreateSessionRequest>(const CreateSessionRequest & data)
+{
+  return RawSizeFields(data, StructFields<CreateSessionRequest>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<CreateSessionRequest>(const CreateSessionRequest & data)
+{
+  SerializeFields(*this, data, StructFields<CreateSessionRequest>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<CreateSessionRequest>(CreateSessionRequest & data)
+{
+  DeserializeFields(*this, data, StructFields<CreateSessionRequest>::Type());
+}
+
+template<>
+std::size_t RawSize<CreateSessionResult>(const CreateSessionResult & data)
+{
+  return RawSizeFields(data, StructFields<CreateSessionResult>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<CreateSessionResult>(const CreateSessionResult & data)
+{
+  SerializeFields(*this, data, StructFields<CreateSessionResult>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<CreateSessionResult>(CreateSessionResult & data)
+{
+  DeserializeFields(*this, data, StructFields<CreateSessionResult>::Type());
+}
+
+template<>
+std::size_t RawSize<CreateSessionResponse>(const CreateSessionResponse & data)
+{
+  return RawSizeFields(data, StructFields<CreateSessionResponse>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<CreateSessionResponse>(const CreateSessionResponse & data)
+{
+  SerializeFields(*this, data, StructFields<CreateSessionResponse>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<CreateSessionResponse>(CreateSessionResponse & data)
+{
+  DeserializeFields(*this, data, StructFields<CreateSessionResponse>::Type());
+}
+
+template<>
+std::size_t RawSize<ActivateSessionParameters>(const ActivateSessionParameters & data)
+{
+  return RawSizeFields(data, StructFields<ActivateSessionParameters>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<ActivateSessionParameters>(const ActivateSessionParameters & data)
+{
+  SerializeFields(*this, data, StructFields<ActivateSessionParameters>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<ActivateSessionParameters>(ActivateSessionParameters & data)
+{
+  DeserializeFields(*this, data, StructFields<ActivateSessionParameters>::Type());
+}
+
+template<>
+std::size_t RawSize<ActivateSessionRequest>(const ActivateSessionRequest & data)
+{
+  return RawSizeFields(data, StructFields<ActivateSessionRequest>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<ActivateSessionRequest>(const ActivateSessionRequest & data)
+{
+  SerializeFields(*this, data, StructFields<ActivateSessionRequest>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<ActivateSessionRequest>(ActivateSessionRequest & data)
+{
+  DeserializeFields(*this, data, StructFields<ActivateSessionRequest>::Type());
+}
+
+template<>
+std::size_t RawSize<ActivateSessionResult>(const ActivateSessionResult & data)
+{
+  return RawSizeFields(data, StructFields<ActivateSessionResult>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<ActivateSessionResult>(const ActivateSessionResult & data)
+{
+  SerializeFields(*this, data, StructFields<ActivateSessionResult>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<ActivateSessionResult>(ActivateSessionResult & data)
+{
+  DeserializeFields(*this, data, StructFields<ActivateSessionResult>::Type());
+}
+
+template<>
+std::size_t RawSize<ActivateSessionResponse>(const ActivateSessionResponse & data)
+{
+  return RawSizeFields(data, StructFields<ActivateSessionResponse>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<ActivateSessionResponse>(const ActivateSessionResponse & data)
+{
+  SerializeFields(*this, data, StructFields<ActivateSessionResponse>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<ActivateSessionResponse>(ActivateSessionResponse & data)
+{
+  DeserializeFields(*this, data, StructFields<ActivateSessionResponse>::Type());
+}
+
+template<>
+std::size_t RawSize<DeleteNodesItem>(const DeleteNodesItem & data)
+{
+  return RawSizeFields(data, StructFields<DeleteNodesItem>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<DeleteNodesItem>(const DeleteNodesItem & data)
+{
+  SerializeFields(*this, data, StructFields<DeleteNodesItem>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<DeleteNodesItem>(DeleteNodesItem & data)
+{
+  DeserializeFields(*this, data, StructFields<DeleteNodesItem>::Type());
+}
+
+template<>
+std::size_t RawSize<DeleteNodesRequest>(const DeleteNodesRequest & data)
+{
+  return RawSizeFields(data, StructFields<DeleteNodesRequest>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<DeleteNodesRequest>(const DeleteNodesRequest & data)
+{
+  SerializeFields(*this, data, StructFields<DeleteNodesRequest>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<DeleteNodesRequest>(DeleteNodesRequest & data)
+{
+  DeserializeFields(*this, data, StructFields<DeleteNodesRequest>::Type());
+}
+
+template<>
+std::size_t RawSize<DeleteNodesResponse>(const DeleteNodesResponse & data)
+{
+  return RawSizeFields(data, StructFields<DeleteNodesResponse>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<DeleteNodesResponse>(const DeleteNodesResponse & data)
+{
+  SerializeFields(*this, data, StructFields<DeleteNodesResponse>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<DeleteNodesResponse>(DeleteNodesResponse & data)
+{
+  DeserializeFields(*this, data, StructFields<DeleteNodesResponse>::Type());
+}
+
+template<>
+std::size_t RawSize<ReadValueId>(const ReadValueId & data)
+{
+  return RawSizeFields(data, StructFields<ReadValueId>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<ReadValueId>(const ReadValueId & data)
+{
+  SerializeFields(*this, data, StructFields<ReadValueId>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<ReadValueId>(ReadValueId & data)
+{
+  DeserializeFields(*this, data, StructFields<ReadValueId>::Type());
+}
+
+template<>
+std::size_t RawSize<ReadParameters>(const ReadParameters & data)
+{
+  return RawSizeFields(data, StructFields<ReadParameters>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<ReadParameters>(const ReadParameters & data)
+{
+  SerializeFields(*this, data, StructFields<ReadParameters>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<ReadParameters>(ReadParameters & data)
+{
+  DeserializeFields(*this, data, StructFields<ReadParameters>::Type());
+}
+
+template<>
+std::size_t RawSize<ReadRequest>(const ReadRequest & data)
+{
+  return RawSizeFields(data, StructFields<ReadRequest>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<ReadRequest>(const ReadRequest & data)
+{
+  SerializeFields(*this, data, StructFields<ReadRequest>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<ReadRequest>(ReadRequest & data)
+{
+  DeserializeFields(*this, data, StructFields<ReadRequest>::Type());
+}
+
+template<>
+std::size_t RawSize<ReadResponse>(const ReadResponse & data)
+{
+  return RawSizeFields(data, StructFields<ReadResponse>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<ReadResponse>(const ReadResponse & data)
+{
+  SerializeFields(*this, data, StructFields<ReadResponse>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<ReadResponse>(ReadResponse & data)
+{
+  DeserializeFields(*this, data, StructFields<ReadResponse>::Type());
+}
+
+template<>
+std::size_t RawSize<WriteValue>(const WriteValue & data)
+{
+  return RawSizeFields(data, StructFields<WriteValue>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<WriteValue>(const WriteValue & data)
+{
+  SerializeFields(*this, data, StructFields<WriteValue>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<WriteValue>(WriteValue & data)
+{
+  DeserializeFields(*this, data, StructFields<WriteValue>::Type());
+}
+
+template<>
+std::size_t RawSize<WriteParameters>(const WriteParameters & data)
+{
+  return RawSizeFields(data, StructFields<WriteParameters>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<WriteParameters>(const WriteParameters & data)
+{
+  SerializeFields(*this, data, StructFields<WriteParameters>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<WriteParameters>(WriteParameters & data)
+{
+  DeserializeFields(*this, data, StructFields<WriteParameters>::Type());
+}
+
+template<>
+std::size_t RawSize<WriteRequest>(const WriteRequest & data)
+{
+  return RawSizeFields(data, StructFields<WriteRequest>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<WriteRequest>(const WriteRequest & data)
+{
+  SerializeFields(*this, data, StructFields<WriteRequest>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<WriteRequest>(WriteRequest & data)
+{
+  DeserializeFields(*this, data, StructFields<WriteRequest>::Type());
+}
+
+template<>
+std::size_t RawSize<WriteResponse>(const WriteResponse & data)
+{
+  return RawSizeFields(data, StructFields<WriteResponse>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<WriteResponse>(const WriteResponse & data)
+{
+  SerializeFields(*this, data, StructFields<WriteResponse>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<WriteResponse>(WriteResponse & data)
+{
+  DeserializeFields(*this, data, StructFields<WriteResponse>::Type());
+}
+
+template<>
+std::size_t RawSize<CallMethodRequest>(const CallMethodRequest & data)
+{
+  return RawSizeFields(data, StructFields<CallMethodRequest>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<CallMethodRequest>(const CallMethodRequest & data)
+{
+  SerializeFields(*this, data, StructFields<CallMethodRequest>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<CallMethodRequest>(CallMethodRequest & data)
+{
+  DeserializeFields(*this, data, StructFields<CallMethodRequest>::Type());
+}
+
+template<>
+std::size_t RawSize<CallMethodResult>(const CallMethodResult & data)
+{
+  return RawSizeFields(data, StructFields<CallMethodResult>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<CallMethodResult>(const CallMethodResult & data)
+{
+  SerializeFields(*this, data, StructFields<CallMethodResult>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<CallMethodResult>(CallMethodResult & data)
+{
+  DeserializeFields(*this, data, StructFields<CallMethodResult>::Type());
+}
+
+template<>
+std::size_t RawSize<CallParameters>(const CallParameters & data)
+{
+  return RawSizeFields(data, StructFields<CallParameters>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<CallParameters>(const CallParameters & data)
+{
+  SerializeFields(*this, data, StructFields<CallParameters>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<CallParameters>(CallParameters & data)
+{
+  DeserializeFields(*this, data, StructFields<CallParameters>::Type());
+}
+
+template<>
+std::size_t RawSize<CallRequest>(const CallRequest & data)
+{
+  return RawSizeFields(data, StructFields<CallRequest>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<CallRequest>(const CallRequest & data)
+{
+  SerializeFields(*this, data, StructFields<CallRequest>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<CallRequest>(CallRequest & data)
+{
+  DeserializeFields(*this, data, StructFields<CallRequest>::Type());
+}
+
+template<>
+std::size_t RawSize<CallResponse>(const CallResponse & data)
+{
+  return RawSizeFields(data, StructFields<CallResponse>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<CallResponse>(const CallResponse & data)
+{
+  SerializeFields(*this, data, StructFields<CallResponse>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<CallResponse>(CallResponse & data)
+{
+  DeserializeFields(*this, data, StructFields<CallResponse>::Type());
+}
+
+template<>
+std::size_t RawSize<MonitoringParameters>(const MonitoringParameters & data)
+{
+  return RawSizeFields(data, StructFields<MonitoringParameters>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<MonitoringParameters>(const MonitoringParameters & data)
+{
+  SerializeFields(*this, data, StructFields<MonitoringParameters>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<MonitoringParameters>(MonitoringParameters & data)
+{
+  DeserializeFields(*this, data, StructFields<MonitoringParameters>::Type());
+}
+
+template<>
+std::size_t RawSize<MonitoredItemCreateRequest>(const MonitoredItemCreateRequest & data)
+{
+  return RawSizeFields(data, StructFields<MonitoredItemCreateRequest>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<MonitoredItemCreateRequest>(const MonitoredItemCreateRequest & data)
+{
+  SerializeFields(*this, data, StructFields<MonitoredItemCreateRequest>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<MonitoredItemCreateRequest>(MonitoredItemCreateRequest & data)
+{
+  DeserializeFields(*this, data, StructFields<MonitoredItemCreateRequest>::Type());
+}
+
+template<>
+std::size_t RawSize<MonitoredItemCreateResult>(const MonitoredItemCreateResult & data)
+{
+  return RawSizeFields(data, StructFields<MonitoredItemCreateResult>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<MonitoredItemCreateResult>(const MonitoredItemCreateResult & data)
+{
+  SerializeFields(*this, data, StructFields<MonitoredItemCreateResult>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<MonitoredItemCreateResult>(MonitoredItemCreateResult & data)
+{
+  DeserializeFields(*this, data, StructFields<MonitoredItemCreateResult>::Type());
+}
+
+template<>
+std::size_t RawSize<MonitoredItemsParameters>(const MonitoredItemsParameters & data)
+{
+  return RawSizeFields(data, StructFields<MonitoredItemsParameters>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<MonitoredItemsParameters>(const MonitoredItemsParameters & data)
+{
+  SerializeFields(*this, data, StructFields<MonitoredItemsParameters>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<MonitoredItemsParameters>(MonitoredItemsParameters & data)
+{
+  DeserializeFields(*this, data, StructFields<MonitoredItemsParameters>::Type());
+}
+
+template<>
+std::size_t RawSize<CreateMonitoredItemsRequest>(const CreateMonitoredItemsRequest & data)
+{
+  return RawSizeFields(data, StructFields<CreateMonitoredItemsRequest>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<CreateMonitoredItemsRequest>(const CreateMonitoredItemsRequest & data)
+{
+  SerializeFields(*this, data, StructFields<CreateMonitoredItemsRequest>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<CreateMonitoredItemsRequest>(CreateMonitoredItemsRequest & data)
+{
+  DeserializeFields(*this, data, StructFields<CreateMonitoredItemsRequest>::Type());
+}
+
+template<>
+std::size_t RawSize<CreateMonitoredItemsResponse>(const CreateMonitoredItemsResponse & data)
+{
+  return RawSizeFields(data, StructFields<CreateMonitoredItemsResponse>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<CreateMonitoredItemsResponse>(const CreateMonitoredItemsResponse & data)
+{
+  SerializeFields(*this, data, StructFields<CreateMonitoredItemsResponse>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<CreateMonitoredItemsResponse>(CreateMonitoredItemsResponse & data)
+{
+  DeserializeFields(*this, data, StructFields<CreateMonitoredItemsResponse>::Type());
+}
+
+template<>
+std::size_t RawSize<DeleteMonitoredItemsParameters>(const DeleteMonitoredItemsParameters & data)
+{
+  return RawSizeFields(data, StructFields<DeleteMonitoredItemsParameters>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<DeleteMonitoredItemsParameters>(const DeleteMonitoredItemsParameters & data)
+{
+  SerializeFields(*this, data, StructFields<DeleteMonitoredItemsParameters>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<DeleteMonitoredItemsParameters>(DeleteMonitoredItemsParameters & data)
+{
+  DeserializeFields(*this, data, StructFields<DeleteMonitoredItemsParameters>::Type());
+}
+
+template<>
+std::size_t RawSize<DeleteMonitoredItemsRequest>(const DeleteMonitoredItemsRequest & data)
+{
+  return RawSizeFields(data, StructFields<DeleteMonitoredItemsRequest>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<DeleteMonitoredItemsRequest>(const DeleteMonitoredItemsRequest & data)
+{
+  SerializeFields(*this, data, StructFields<DeleteMonitoredItemsRequest>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<DeleteMonitoredItemsRequest>(DeleteMonitoredItemsRequest & data)
+{
+  DeserializeFields(*this, data, StructFields<DeleteMonitoredItemsRequest>::Type());
+}
+
+template<>
+std::size_t RawSize<DeleteMonitoredItemsResponse>(const DeleteMonitoredItemsResponse & data)
+{
+  return RawSizeFields(data, StructFields<DeleteMonitoredItemsResponse>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<DeleteMonitoredItemsResponse>(const DeleteMonitoredItemsResponse & data)
+{
+  SerializeFields(*this, data, StructFields<DeleteMonitoredItemsResponse>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<DeleteMonitoredItemsResponse>(DeleteMonitoredItemsResponse & data)
+{
+  DeserializeFields(*this, data, StructFields<DeleteMonitoredItemsResponse>::Type());
+}
+
+template<>
+std::size_t RawSize<CreateSubscriptionParameters>(const CreateSubscriptionParameters & data)
+{
+  return RawSizeFields(data, StructFields<CreateSubscriptionParameters>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<CreateSubscriptionParameters>(const CreateSubscriptionParameters & data)
+{
+  SerializeFields(*this, data, StructFields<CreateSubscriptionParameters>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<CreateSubscriptionParameters>(CreateSubscriptionParameters & data)
+{
+  DeserializeFields(*this, data, StructFields<CreateSubscriptionParameters>::Type());
+}
+
+template<>
+std::size_t RawSize<CreateSubscriptionRequest>(const CreateSubscriptionRequest & data)
+{
+  return RawSizeFields(data, StructFields<CreateSubscriptionRequest>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<CreateSubscriptionRequest>(const CreateSubscriptionRequest & data)
+{
+  SerializeFields(*this, data, StructFields<CreateSubscriptionRequest>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<CreateSubscriptionRequest>(CreateSubscriptionRequest & data)
+{
+  DeserializeFields(*this, data, StructFields<CreateSubscriptionRequest>::Type());
+}
+
+template<>
+std::size_t RawSize<SubscriptionData>(const SubscriptionData & data)
+{
+  return RawSizeFields(data, StructFields<SubscriptionData>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<SubscriptionData>(const SubscriptionData & data)
+{
+  SerializeFields(*this, data, StructFields<SubscriptionData>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<SubscriptionData>(SubscriptionData & data)
+{
+  DeserializeFields(*this, data, StructFields<SubscriptionData>::Type());
+}
+
+template<>
+std::size_t RawSize<CreateSubscriptionResponse>(const CreateSubscriptionResponse & data)
+{
+  return RawSizeFields(data, StructFields<CreateSubscriptionResponse>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<CreateSubscriptionResponse>(const CreateSubscriptionResponse & data)
+{
+  SerializeFields(*this, data, StructFields<CreateSubscriptionResponse>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<CreateSubscriptionResponse>(CreateSubscriptionResponse & data)
+{
+  DeserializeFields(*this, data, StructFields<CreateSubscriptionResponse>::Type());
+}
+
+template<>
+std::size_t RawSize<ModifySubscriptionParameters>(const ModifySubscriptionParameters & data)
+{
+  return RawSizeFields(data, StructFields<ModifySubscriptionParameters>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<ModifySubscriptionParameters>(const ModifySubscriptionParameters & data)
+{
+  SerializeFields(*this, data, StructFields<ModifySubscriptionParameters>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<ModifySubscriptionParameters>(ModifySubscriptionParameters & data)
+{
+  DeserializeFields(*this, data, StructFields<ModifySubscriptionParameters>::Type());
+}
+
+template<>
+std::size_t RawSize<ModifySubscriptionRequest>(const ModifySubscriptionRequest & data)
+{
+  return RawSizeFields(data, StructFields<ModifySubscriptionRequest>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<ModifySubscriptionRequest>(const ModifySubscriptionRequest & data)
+{
+  SerializeFields(*this, data, StructFields<ModifySubscriptionRequest>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<ModifySubscriptionRequest>(ModifySubscriptionRequest & data)
+{
+  DeserializeFields(*this, data, StructFields<ModifySubscriptionRequest>::Type());
+}
+
+template<>
+std::size_t RawSize<ModifySubscriptionResult>(const ModifySubscriptionResult & data)
+{
+  return RawSizeFields(data, StructFields<ModifySubscriptionResult>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<ModifySubscriptionResult>(const ModifySubscriptionResult & data)
+{
+  SerializeFields(*this, data, StructFields<ModifySubscriptionResult>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<ModifySubscriptionResult>(ModifySubscriptionResult & data)
+{
+  DeserializeFields(*this, data, StructFields<ModifySubscriptionResult>::Type());
+}
+
+template<>
+std::size_t RawSize<ModifySubscriptionResponse>(const ModifySubscriptionResponse & data)
+{
+  return RawSizeFields(data, StructFields<ModifySubscriptionResponse>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<ModifySubscriptionResponse>(const ModifySubscriptionResponse & data)
+{
+  SerializeFields(*this, data, StructFields<ModifySubscriptionResponse>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<ModifySubscriptionResponse>(ModifySubscriptionResponse & data)
+{
+  DeserializeFields(*this, data, StructFields<ModifySubscriptionResponse>::Type());
+}
+
+template<>
+std::size_t RawSize<PublishingModeParameters>(const PublishingModeParameters & data)
+{
+  return RawSizeFields(data, StructFields<PublishingModeParameters>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<PublishingModeParameters>(const PublishingModeParameters & data)
+{
+  SerializeFields(*this, data, StructFields<PublishingModeParameters>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<PublishingModeParameters>(PublishingModeParameters & data)
+{
+  DeserializeFields(*this, data, StructFields<PublishingModeParameters>::Type());
+}
+
+template<>
+std::size_t RawSize<SetPublishingModeRequest>(const SetPublishingModeRequest & data)
+{
+  return RawSizeFields(data, StructFields<SetPublishingModeRequest>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<SetPublishingModeRequest>(const SetPublishingModeRequest & data)
+{
+  SerializeFields(*this, data, StructFields<SetPublishingModeRequest>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<SetPublishingModeRequest>(SetPublishingModeRequest & data)
+{
+  DeserializeFields(*this, data, StructFields<SetPublishingModeRequest>::Type());
+}
+
+template<>
+std::size_t RawSize<PublishingModeResult>(const PublishingModeResult & data)
+{
+  return RawSizeFields(data, StructFields<PublishingModeResult>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<PublishingModeResult>(const PublishingModeResult & data)
+{
+  SerializeFields(*this, data, StructFields<PublishingModeResult>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<PublishingModeResult>(PublishingModeResult & data)
+{
+  DeserializeFields(*this, data, StructFields<PublishingModeResult>::Type());
+}
+
+template<>
+std::size_t RawSize<SetPublishingModeResponse>(const SetPublishingModeResponse & data)
+{
+  return RawSizeFields(data, StructFields<SetPublishingModeResponse>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<SetPublishingModeResponse>(const SetPublishingModeResponse & data)
+{
+  SerializeFields(*this, data, StructFields<SetPublishingModeResponse>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<SetPublishingModeResponse>(SetPublishingModeResponse & data)
+{
+  DeserializeFields(*this, data, StructFields<SetPublishingModeResponse>::Type());
+}
+
+template<>
+std::size_t RawSize<NotificationMessage>(const NotificationMessage & data)
+{
+  return RawSizeFields(data, StructFields<NotificationMessage>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<NotificationMessage>(const NotificationMessage & data)
+{
+  SerializeFields(*this, data, StructFields<NotificationMessage>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<NotificationMessage>(NotificationMessage & data)
+{
+  DeserializeFields(*this, data, StructFields<NotificationMessage>::Type());
+}
+
+template<>
+std::size_t RawSize<SubscriptionAcknowledgement>(const SubscriptionAcknowledgement & data)
+{
+  return RawSizeFields(data, StructFields<SubscriptionAcknowledgement>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<SubscriptionAcknowledgement>(const SubscriptionAcknowledgement & data)
+{
+  SerializeFields(*this, data, StructFields<SubscriptionAcknowledgement>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<SubscriptionAcknowledgement>(SubscriptionAcknowledgement & data)
+{
+  DeserializeFields(*this, data, StructFields<SubscriptionAcknowledgement>::Type());
+}
+
+template<>
+std::size_t RawSize<PublishRequest>(const PublishRequest & data)
+{
+  return RawSizeFields(data, StructFields<PublishRequest>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<PublishRequest>(const PublishRequest & data)
+{
+  SerializeFields(*this, data, StructFields<PublishRequest>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<PublishRequest>(PublishRequest & data)
+{
+  DeserializeFields(*this, data, StructFields<PublishRequest>::Type());
+}
+
+template<>
+std::size_t RawSize<PublishResult>(const PublishResult & data)
+{
+  return RawSizeFields(data, StructFields<PublishResult>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<PublishResult>(const PublishResult & data)
+{
+  SerializeFields(*this, data, StructFields<PublishResult>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<PublishResult>(PublishResult & data)
+{
+  DeserializeFields(*this, data, StructFields<PublishResult>::Type());
+}
+
+template<>
+std::size_t RawSize<PublishResponse>(const PublishResponse & data)
+{
+  return RawSizeFields(data, StructFields<PublishResponse>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<PublishResponse>(const PublishResponse & data)
+{
+  SerializeFields(*this, data, StructFields<PublishResponse>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<PublishResponse>(PublishResponse & data)
+{
+  DeserializeFields(*this, data, StructFields<PublishResponse>::Type());
+}
+
+template<>
+std::size_t RawSize<RepublishParameters>(const RepublishParameters & data)
+{
+  return RawSizeFields(data, StructFields<RepublishParameters>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<RepublishParameters>(const RepublishParameters & data)
+{
+  SerializeFields(*this, data, StructFields<RepublishParameters>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<RepublishParameters>(RepublishParameters & data)
+{
+  DeserializeFields(*this, data, StructFields<RepublishParameters>::Type());
+}
+
+template<>
+std::size_t RawSize<RepublishRequest>(const RepublishRequest & data)
+{
+  return RawSizeFields(data, StructFields<RepublishRequest>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<RepublishRequest>(const RepublishRequest & data)
+{
+  SerializeFields(*this, data, StructFields<RepublishRequest>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<RepublishRequest>(RepublishRequest & data)
+{
+  DeserializeFields(*this, data, StructFields<RepublishRequest>::Type());
+}
+
+template<>
+std::size_t RawSize<RepublishResponse>(const RepublishResponse & data)
+{
+  return RawSizeFields(data, StructFields<RepublishResponse>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<RepublishResponse>(const RepublishResponse & data)
+{
+  SerializeFields(*this, data, StructFields<RepublishResponse>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<RepublishResponse>(RepublishResponse & data)
+{
+  DeserializeFields(*this, data, StructFields<RepublishResponse>::Type());
+}
+
+template<>
+std::size_t RawSize<TransferResult>(const TransferResult & data)
+{
+  return RawSizeFields(data, StructFields<TransferResult>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<TransferResult>(const TransferResult & data)
+{
+  SerializeFields(*this, data, StructFields<TransferResult>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<TransferResult>(TransferResult & data)
+{
+  DeserializeFields(*this, data, StructFields<TransferResult>::Type());
+}
+
+template<>
+std::size_t RawSize<TransferSubscriptionsParameters>(const TransferSubscriptionsParameters & data)
+{
+  return RawSizeFields(data, StructFields<TransferSubscriptionsParameters>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<TransferSubscriptionsParameters>(const TransferSubscriptionsParameters & data)
+{
+  SerializeFields(*this, data, StructFields<TransferSubscriptionsParameters>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<TransferSubscriptionsParameters>(TransferSubscriptionsParameters & data)
+{
+  DeserializeFields(*this, data, StructFields<TransferSubscriptionsParameters>::Type());
+}
+
+template<>
+std::size_t RawSize<TransferSubscriptionsRequest>(const TransferSubscriptionsRequest & data)
+{
+  return RawSizeFields(data, StructFields<TransferSubscriptionsRequest>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<TransferSubscriptionsRequest>(const TransferSubscriptionsRequest & data)
+{
+  SerializeFields(*this, data, StructFields<TransferSubscriptionsRequest>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<TransferSubscriptionsRequest>(TransferSubscriptionsRequest & data)
+{
+  DeserializeFields(*this, data, StructFields<TransferSubscriptionsRequest>::Type());
+}
+
+template<>
+std::size_t RawSize<TransferSubscriptionsResult>(const TransferSubscriptionsResult & data)
+{
+  return RawSizeFields(data, StructFields<TransferSubscriptionsResult>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<TransferSubscriptionsResult>(const TransferSubscriptionsResult & data)
+{
+  SerializeFields(*this, data, StructFields<TransferSubscriptionsResult>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<TransferSubscriptionsResult>(TransferSubscriptionsResult & data)
+{
+  DeserializeFields(*this, data, StructFields<TransferSubscriptionsResult>::Type());
+}
+
+template<>
+std::size_t RawSize<TransferSubscriptionsResponse>(const TransferSubscriptionsResponse & data)
+{
+  return RawSizeFields(data, StructFields<TransferSubscriptionsResponse>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<TransferSubscriptionsResponse>(const TransferSubscriptionsResponse & data)
+{
+  SerializeFields(*this, data, StructFields<TransferSubscriptionsResponse>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<TransferSubscriptionsResponse>(TransferSubscriptionsResponse & data)
+{
+  DeserializeFields(*this, data, StructFields<TransferSubscriptionsResponse>::Type());
+}
+
+template<>
+std::size_t RawSize<DeleteSubscriptionsRequest>(const DeleteSubscriptionsRequest & data)
+{
+  return RawSizeFields(data, StructFields<DeleteSubscriptionsRequest>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<DeleteSubscriptionsRequest>(const DeleteSubscriptionsRequest & data)
+{
+  SerializeFields(*this, data, StructFields<DeleteSubscriptionsRequest>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<DeleteSubscriptionsRequest>(DeleteSubscriptionsRequest & data)
+{
+  DeserializeFields(*this, data, StructFields<DeleteSubscriptionsRequest>::Type());
+}
+
+template<>
+std::size_t RawSize<DeleteSubscriptionsResponse>(const DeleteSubscriptionsResponse & data)
+{
+  return RawSizeFields(data, StructFields<DeleteSubscriptionsResponse>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<DeleteSubscriptionsResponse>(const DeleteSubscriptionsResponse & data)
+{
+  SerializeFields(*this, data, StructFields<DeleteSubscriptionsResponse>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<DeleteSubscriptionsResponse>(DeleteSubscriptionsResponse & data)
+{
+  DeserializeFields(*this, data, StructFields<DeleteSubscriptionsResponse>::Type());
+}
+
+template<>
+std::size_t RawSize<Annotation>(const Annotation & data)
+{
+  return RawSizeFields(data, StructFields<Annotation>::Type());
+}
+
+template<>
+void DataSerializer::Serialize<Annotation>(const Annotation & data)
+{
+  SerializeFields(*this, data, StructFields<Annotation>::Type());
+}
+
+template<>
+void DataDeserializer::Deserialize<Annotation>(Annotation & data)
+{
+  DeserializeFields(*this, data, StructFields<Annotation>::Type());
+}
+
+} // namespace Binary
+} // namespace OpcUa
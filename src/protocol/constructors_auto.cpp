@@ -523,21 +523,15 @@ RepublishResponse::RepublishResponse()
 {
 }
 
-/*  DISABLED
-
-     TransferSubscriptionsRequest::TransferSubscriptionsRequest()
-        : TypeId(FourByteNodeId((uint16_t)ObjectId::TransferSubscriptionsRequest_Encoding_DefaultBinary))
-    {
-    }
-*/
-
-/*  DISABLED
+TransferSubscriptionsRequest::TransferSubscriptionsRequest()
+  : TypeId(FourByteNodeId((uint16_t)ObjectId::TransferSubscriptionsRequest_Encoding_DefaultBinary))
+{
+}
 
-     TransferSubscriptionsResponse::TransferSubscriptionsResponse()
-        : TypeId(FourByteNodeId((uint16_t)ObjectId::TransferSubscriptionsResponse_Encoding_DefaultBinary))
-    {
-    }
-*/
+TransferSubscriptionsResponse::TransferSubscriptionsResponse()
+  : TypeId(FourByteNodeId((uint16_t)ObjectId::TransferSubscriptionsResponse_Encoding_DefaultBinary))
+{
+}
 
 DeleteSubscriptionsRequest::DeleteSubscriptionsRequest()
   : TypeId(FourByteNodeId((uint16_t)ObjectId::DeleteSubscriptionsRequest_Encoding_DefaultBinary))
@@ -0,0 +1,791 @@
+// DO NOT EDIT THIS FILE!
+// It is automatically generated from opcfoundation.org schemas.
+//
+
+/// @brief Field lists of Opc Ua structures.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#pragma once
+
+#include "binary_fields.h"
+#include <opc/ua/protocol/protocol.h>
+
+namespace OpcUa
+{
+namespace Binary
+{
+
+template<> struct FixedSize<OpenFileMode> : std::integral_constant<std::size_t, sizeof(uint32_t)> {};
+template<> struct FixedSize<NodeClass> : std::integral_constant<std::size_t, sizeof(uint32_t)> {};
+template<> struct FixedSize<ApplicationType> : std::integral_constant<std::size_t, sizeof(uint32_t)> {};
+template<> struct FixedSize<MessageSecurityMode> : std::integral_constant<std::size_t, sizeof(uint32_t)> {};
+template<> struct FixedSize<UserTokenType> : std::integral_constant<std::size_t, sizeof(uint32_t)> {};
+template<> struct FixedSize<SecurityTokenRequestType> : std::integral_constant<std::size_t, sizeof(uint32_t)> {};
+template<> struct FixedSize<NodeAttributesMask> : std::integral_constant<std::size_t, sizeof(uint32_t)> {};
+template<> struct FixedSize<AttributeWriteMask> : std::integral_constant<std::size_t, sizeof(uint32_t)> {};
+template<> struct FixedSize<BrowseDirection> : std::integral_constant<std::size_t, sizeof(uint32_t)> {};
+template<> struct FixedSize<BrowseResultMask> : std::integral_constant<std::size_t, sizeof(uint32_t)> {};
+template<> struct FixedSize<ComplianceLevel> : std::integral_constant<std::size_t, sizeof(uint32_t)> {};
+template<> struct FixedSize<FilterOperator> : std::integral_constant<std::size_t, sizeof(uint32_t)> {};
+template<> struct FixedSize<TimestampsToReturn> : std::integral_constant<std::size_t, sizeof(uint32_t)> {};
+template<> struct FixedSize<HistoryUpdateType> : std::integral_constant<std::size_t, sizeof(uint32_t)> {};
+template<> struct FixedSize<PerformUpdateType> : std::integral_constant<std::size_t, sizeof(uint32_t)> {};
+template<> struct FixedSize<MonitoringMode> : std::integral_constant<std::size_t, sizeof(uint32_t)> {};
+template<> struct FixedSize<DataChangeTrigger> : std::integral_constant<std::size_t, sizeof(uint32_t)> {};
+template<> struct FixedSize<DeadbandType> : std::integral_constant<std::size_t, sizeof(uint32_t)> {};
+template<> struct FixedSize<EnumeratedTestType> : std::integral_constant<std::size_t, sizeof(uint32_t)> {};
+template<> struct FixedSize<RedundancySupport> : std::integral_constant<std::size_t, sizeof(uint32_t)> {};
+template<> struct FixedSize<ServerState> : std::integral_constant<std::size_t, sizeof(uint32_t)> {};
+template<> struct FixedSize<ModelChangeStructureVerbMask> : std::integral_constant<std::size_t, sizeof(uint32_t)> {};
+template<> struct FixedSize<AxisScaleEnumeration> : std::integral_constant<std::size_t, sizeof(uint32_t)> {};
+template<> struct FixedSize<ExceptionDeviationFormat> : std::integral_constant<std::size_t, sizeof(uint32_t)> {};
+
+template<>
+struct StructFields<XmlElement>
+{
+  typedef FieldList<
+    OPCUA_FIELD(XmlElement, Length),
+    OPCUA_ARRAY_FIELD(XmlElement, Value)
+  > Type;
+};
+
+template<>
+struct StructFields<ExtensionObject>
+{
+  typedef FieldList<
+    OPCUA_FIELD(ExtensionObject, TypeId),
+    OPCUA_FIELD(ExtensionObject, Encoding),
+    OPCUA_OPTIONAL_FIELD(ExtensionObject, Body, Encoding, 0)
+  > Type;
+};
+
+template<>
+struct StructFields<ApplicationDescription>
+{
+  typedef FieldList<
+    OPCUA_FIELD(ApplicationDescription, ApplicationUri),
+    OPCUA_FIELD(ApplicationDescription, ProductUri),
+    OPCUA_FIELD(ApplicationDescription, ApplicationName),
+    OPCUA_FIELD(ApplicationDescription, ApplicationType),
+    OPCUA_FIELD(ApplicationDescription, GatewayServerUri),
+    OPCUA_FIELD(ApplicationDescription, DiscoveryProfileUri),
+    OPCUA_ARRAY_FIELD(ApplicationDescription, DiscoveryUrls)
+  > Type;
+};
+
+template<>
+struct StructFields<UserTokenPolicy>
+{
+  typedef FieldList<
+    OPCUA_FIELD(UserTokenPolicy, PolicyId),
+    OPCUA_FIELD(UserTokenPolicy, TokenType),
+    OPCUA_FIELD(UserTokenPolicy, IssuedTokenType),
+    OPCUA_FIELD(UserTokenPolicy, IssuerEndpointUrl),
+    OPCUA_FIELD(UserTokenPolicy, SecurityPolicyUri)
+  > Type;
+};
+
+template<>
+struct StructFields<EndpointDescription>
+{
+  typedef FieldList<
+    OPCUA_FIELD(EndpointDescription, EndpointUrl),
+    OPCUA_FIELD(EndpointDescription, Server),
+    OPCUA_FIELD(EndpointDescription, ServerCertificate),
+    OPCUA_FIELD(EndpointDescription, SecurityMode),
+    OPCUA_FIELD(EndpointDescription, SecurityPolicyUri),
+    OPCUA_ARRAY_FIELD(EndpointDescription, UserIdentityTokens),
+    OPCUA_FIELD(EndpointDescription, TransportProfileUri),
+    OPCUA_FIELD(EndpointDescription, SecurityLevel)
+  > Type;
+};
+
+template<>
+struct StructFields<GetEndpointsParameters>
+{
+  typedef FieldList<
+    OPCUA_FIELD(GetEndpointsParameters, EndpointUrl),
+    OPCUA_ARRAY_FIELD(GetEndpointsParameters, LocaleIds),
+    OPCUA_ARRAY_FIELD(GetEndpointsParameters, ProfileUris)
+  > Type;
+};
+
+template<>
+struct StructFields<GetEndpointsRequest>
+{
+  typedef FieldList<
+    OPCUA_FIELD(GetEndpointsRequest, TypeId),
+    OPCUA_FIELD(GetEndpointsRequest, Header),
+    OPCUA_FIELD(GetEndpointsRequest, Parameters)
+  > Type;
+};
+
+template<>
+struct StructFields<GetEndpointsResponse>
+{
+  typedef FieldList<
+    OPCUA_FIELD(GetEndpointsResponse, TypeId),
+    OPCUA_FIELD(GetEndpointsResponse, Header),
+    OPCUA_ARRAY_FIELD(GetEndpointsResponse, Endpoints)
+  > Type;
+};
+
+template<>
+struct StructFields<SignedSoftwareCertificate>
+{
+  typedef FieldList<
+    OPCUA_FIELD(SignedSoftwareCertificate, CertificateData),
+    OPCUA_FIELD(SignedSoftwareCertificate, Signature)
+  > Type;
+};
+
+template<>
+struct StructFields<SignatureData>
+{
+  typedef FieldList<
+    OPCUA_FIELD(SignatureData, Algorithm),
+    OPCUA_FIELD(SignatureData, Signature)
+  > Type;
+};
+
+template<>
+struct StructFields<CreateSessionParameters>
+{
+  typedef FieldList<
+    OPCUA_FIELD(CreateSessionParameters, ClientDescription),
+    OPCUA_FIELD(CreateSessionParameters, ServerUri),
+    OPCUA_FIELD(CreateSessionParameters, EndpointUrl),
+    OPCUA_FIELD(CreateSessionParameters, SessionName),
+    OPCUA_FIELD(CreateSessionParameters, ClientNonce),
+    OPCUA_FIELD(CreateSessionParameters, ClientCertificate),
+    OPCUA_FIELD(CreateSessionParameters, RequestedSessionTimeout),
+    OPCUA_FIELD(CreateSessionParameters, MaxResponseMessageSize)
+  > Type;
+};
+
+template<>
+struct StructFields<CreateSessionRequest>
+{
+  typedef FieldList<
+    OPCUA_FIELD(CreateSessionRequest, TypeId),
+    OPCUA_FIELD(CreateSessionRequest, Header),
+    OPCUA_FIELD(CreateSessionRequest, Parameters)
+  > Type;
+};
+
+template<>
+struct StructFields<CreateSessionResult>
+{
+  typedef FieldList<
+    OPCUA_FIELD(CreateSessionResult, SessionId),
+    OPCUA_FIELD(CreateSessionResult, AuthenticationToken),
+    OPCUA_FIELD(CreateSessionResult, RevisedSessionTimeout),
+    OPCUA_FIELD(CreateSessionResult, ServerNonce),
+    OPCUA_FIELD(CreateSessionResult, ServerCertificate),
+    OPCUA_ARRAY_FIELD(CreateSessionResult, ServerEndpoints),
+    OPCUA_ARRAY_FIELD(CreateSessionResult, ServerSoftwareCertificates),
+    OPCUA_FIELD(CreateSessionResult, ServerSignature),
+    OPCUA_FIELD(CreateSessionResult, MaxRequestMessageSize)
+  > Type;
+};
+
+template<>
+struct StructFields<CreateSessionResponse>
+{
+  typedef FieldList<
+    OPCUA_FIELD(CreateSessionResponse, TypeId),
+    OPCUA_FIELD(CreateSessionResponse, Header),
+    OPCUA_FIELD(CreateSessionResponse, Parameters)
+  > Type;
+};
+
+template<>
+struct StructFields<ActivateSessionParameters>
+{
+  typedef FieldList<
+    OPCUA_FIELD(ActivateSessionParameters, ClientSignature),
+    OPCUA_ARRAY_FIELD(ActivateSessionParameters, ClientSoftwareCertificates),
+    OPCUA_ARRAY_FIELD(ActivateSessionParameters, LocaleIds),
+    OPCUA_FIELD(ActivateSessionParameters, UserIdentityToken),
+    OPCUA_FIELD(ActivateSessionParameters, UserTokenSignature)
+  > Type;
+};
+
+template<>
+struct StructFields<ActivateSessionRequest>
+{
+  typedef FieldList<
+    OPCUA_FIELD(ActivateSessionRequest, TypeId),
+    OPCUA_FIELD(ActivateSessionRequest, Header),
+    OPCUA_FIELD(ActivateSessionRequest, Parameters)
+  > Type;
+};
+
+template<>
+struct StructFields<ActivateSessionResult>
+{
+  typedef FieldList<
+    OPCUA_FIELD(ActivateSessionResult, ServerNonce),
+    OPCUA_ARRAY_FIELD(ActivateSessionResult, Results),
+    OPCUA_ARRAY_FIELD(ActivateSessionResult, DiagnosticInfos)
+  > Type;
+};
+
+template<>
+struct StructFields<ActivateSessionResponse>
+{
+  typedef FieldList<
+    OPCUA_FIELD(ActivateSessionResponse, TypeId),
+    OPCUA_FIELD(ActivateSessionResponse, Header),
+    OPCUA_FIELD(ActivateSessionResponse, Parameters)
+  > Type;
+};
+
+template<>
+struct StructFields<DeleteNodesItem>
+{
+  typedef FieldList<
+    OPCUA_FIELD(DeleteNodesItem, NodeId),
+    OPCUA_FIELD(DeleteNodesItem, DeleteTargetReferences)
+  > Type;
+};
+
+template<>
+struct StructFields<DeleteNodesRequest>
+{
+  typedef FieldList<
+    OPCUA_FIELD(DeleteNodesRequest, TypeId),
+    OPCUA_FIELD(DeleteNodesRequest, Header),
+    OPCUA_ARRAY_FIELD(DeleteNodesRequest, NodesToDelete)
+  > Type;
+};
+
+template<>
+struct StructFields<DeleteNodesResponse>
+{
+  typedef FieldList<
+    OPCUA_FIELD(DeleteNodesResponse, TypeId),
+    OPCUA_FIELD(DeleteNodesResponse, Header),
+    OPCUA_ARRAY_FIELD(DeleteNodesResponse, Results),
+    OPCUA_ARRAY_FIELD(DeleteNodesResponse, DiagnosticInfos)
+  > Type;
+};
+
+template<>
+struct StructFields<ReadValueId>
+{
+  typedef FieldList<
+    OPCUA_FIELD(ReadValueId, NodeId),
+    OPCUA_FIELD(ReadValueId, AttributeId),
+    OPCUA_FIELD(ReadValueId, IndexRange),
+    OPCUA_FIELD(ReadValueId, DataEncoding)
+  > Type;
+};
+
+template<>
+struct StructFields<ReadParameters>
+{
+  typedef FieldList<
+    OPCUA_FIELD(ReadParameters, MaxAge),
+    OPCUA_FIELD(ReadParameters, TimestampsToReturn),
+    OPCUA_ARRAY_FIELD(ReadParameters, AttributesToRead)
+  > Type;
+};
+
+template<>
+struct StructFields<ReadRequest>
+{
+  typedef FieldList<
+    OPCUA_FIELD(ReadRequest, TypeId),
+    OPCUA_FIELD(ReadRequest, Header),
+    OPCUA_FIELD(ReadRequest, Parameters)
+  > Type;
+};
+
+template<>
+struct StructFields<ReadResponse>
+{
+  typedef FieldList<
+    OPCUA_FIELD(ReadResponse, TypeId),
+    OPCUA_FIELD(ReadResponse, Header),
+    OPCUA_ARRAY_FIELD(ReadResponse, Results),
+    OPCUA_ARRAY_FIELD(ReadResponse, DiagnosticInfos)
+  > Type;
+};
+
+template<>
+struct StructFields<WriteValue>
+{
+  typedef FieldList<
+    OPCUA_FIELD(WriteValue, NodeId),
+    OPCUA_FIELD(WriteValue, AttributeId),
+    OPCUA_FIELD(WriteValue, IndexRange),
+    OPCUA_FIELD(WriteValue, Value)
+  > Type;
+};
+
+template<>
+struct StructFields<WriteParameters>
+{
+  typedef FieldList<
+    OPCUA_ARRAY_FIELD(WriteParameters, NodesToWrite)
+  > Type;
+};
+
+template<>
+struct StructFields<WriteRequest>
+{
+  typedef FieldList<
+    OPCUA_FIELD(WriteRequest, TypeId),
+    OPCUA_FIELD(WriteRequest, Header),
+    OPCUA_FIELD(WriteRequest, Parameters)
+  > Type;
+};
+
+template<>
+struct StructFields<WriteResponse>
+{
+  typedef FieldList<
+    OPCUA_FIELD(WriteResponse, TypeId),
+    OPCUA_FIELD(WriteResponse, Header),
+    OPCUA_ARRAY_FIELD(WriteResponse, Results),
+    OPCUA_ARRAY_FIELD(WriteResponse, DiagnosticInfos)
+  > Type;
+};
+
+template<>
+struct StructFields<CallMethodRequest>
+{
+  typedef FieldList<
+    OPCUA_FIELD(CallMethodRequest, ObjectId),
+    OPCUA_FIELD(CallMethodRequest, MethodId),
+    OPCUA_ARRAY_FIELD(CallMethodRequest, InputArguments)
+  > Type;
+};
+
+template<>
+struct StructFields<CallMethodResult>
+{
+  typedef FieldList<
+    OPCUA_FIELD(CallMethodResult, Status),
+    OPCUA_ARRAY_FIELD(CallMethodResult, InputArgumentResults),
+    OPCUA_ARRAY_FIELD(CallMethodResult, InputArgumentDiagnosticInfos),
+    OPCUA_ARRAY_FIELD(CallMethodResult, OutputArguments)
+  > Type;
+};
+
+template<>
+struct StructFields<CallParameters>
+{
+  typedef FieldList<
+    OPCUA_ARRAY_FIELD(CallParameters, MethodsToCall)
+  > Type;
+};
+
+template<>
+struct StructFields<CallRequest>
+{
+  typedef FieldList<
+    OPCUA_FIELD(CallRequest, TypeId),
+    OPCUA_FIELD(CallRequest, Header),
+    OPCUA_FIELD(CallRequest, Parameters)
+  > Type;
+};
+
+template<>
+struct StructFields<CallResponse>
+{
+  typedef FieldList<
+    OPCUA_FIELD(CallResponse, TypeId),
+    OPCUA_FIELD(CallResponse, Header),
+    OPCUA_ARRAY_FIELD(CallResponse, Results),
+    OPCUA_ARRAY_FIELD(CallResponse, DiagnosticInfos)
+  > Type;
+};
+
+template<>
+struct StructFields<MonitoringParameters>
+{
+  typedef FieldList<
+    OPCUA_FIELD(MonitoringParameters, ClientHandle),
+    OPCUA_FIELD(MonitoringParameters, SamplingInterval),
+    OPCUA_FIELD(MonitoringParameters, Filter),
+    OPCUA_FIELD(MonitoringParameters, QueueSize),
+    OPCUA_FIELD(MonitoringParameters, DiscardOldest)
+  > Type;
+};
+
+template<>
+struct StructFields<MonitoredItemCreateRequest>
+{
+  typedef FieldList<
+    OPCUA_FIELD(MonitoredItemCreateRequest, ItemToMonitor),
+    OPCUA_FIELD(MonitoredItemCreateRequest, MonitoringMode),
+    OPCUA_FIELD(MonitoredItemCreateRequest, RequestedParameters)
+  > Type;
+};
+
+template<>
+struct StructFields<MonitoredItemCreateResult>
+{
+  typedef FieldList<
+    OPCUA_FIELD(MonitoredItemCreateResult, Status),
+    OPCUA_FIELD(MonitoredItemCreateResult, MonitoredItemId),
+    OPCUA_FIELD(MonitoredItemCreateResult, RevisedSamplingInterval),
+    OPCUA_FIELD(MonitoredItemCreateResult, RevisedQueueSize),
+    OPCUA_FIELD(MonitoredItemCreateResult, FilterResult)
+  > Type;
+};
+
+template<>
+struct StructFields<MonitoredItemsParameters>
+{
+  typedef FieldList<
+    OPCUA_FIELD(MonitoredItemsParameters, SubscriptionId),
+    OPCUA_FIELD(MonitoredItemsParameters, TimestampsToReturn),
+    OPCUA_ARRAY_FIELD(MonitoredItemsParameters, ItemsToCreate)
+  > Type;
+};
+
+template<>
+struct StructFields<CreateMonitoredItemsRequest>
+{
+  typedef FieldList<
+    OPCUA_FIELD(CreateMonitoredItemsRequest, TypeId),
+    OPCUA_FIELD(CreateMonitoredItemsRequest, Header),
+    OPCUA_FIELD(CreateMonitoredItemsRequest, Parameters)
+  > Type;
+};
+
+template<>
+struct StructFields<CreateMonitoredItemsResponse>
+{
+  typedef FieldList<
+    OPCUA_FIELD(CreateMonitoredItemsResponse, TypeId),
+    OPCUA_FIELD(CreateMonitoredItemsResponse, Header),
+    OPCUA_ARRAY_FIELD(CreateMonitoredItemsResponse, Results),
+    OPCUA_ARRAY_FIELD(CreateMonitoredItemsResponse, DiagnosticInfos)
+  > Type;
+};
+
+template<>
+struct StructFields<DeleteMonitoredItemsParameters>
+{
+  typedef FieldList<
+    OPCUA_FIELD(DeleteMonitoredItemsParameters, SubscriptionId),
+    OPCUA_ARRAY_FIELD(DeleteMonitoredItemsParameters, MonitoredItemIds)
+  > Type;
+};
+
+template<>
+struct StructFields<DeleteMonitoredItemsRequest>
+{
+  typedef FieldList<
+    OPCUA_FIELD(DeleteMonitoredItemsRequest, TypeId),
+    OPCUA_FIELD(DeleteMonitoredItemsRequest, Header),
+    OPCUA_FIELD(DeleteMonitoredItemsRequest, Parameters)
+  > Type;
+};
+
+template<>
+struct StructFields<DeleteMonitoredItemsResponse>
+{
+  typedef FieldList<
+    OPCUA_FIELD(DeleteMonitoredItemsResponse, TypeId),
+    OPCUA_FIELD(DeleteMonitoredItemsResponse, Header),
+    OPCUA_ARRAY_FIELD(DeleteMonitoredItemsResponse, Results),
+    OPCUA_ARRAY_FIELD(DeleteMonitoredItemsResponse, DiagnosticInfos)
+  > Type;
+};
+
+template<>
+struct StructFields<CreateSubscriptionParameters>
+{
+  typedef FieldList<
+    OPCUA_FIELD(CreateSubscriptionParameters, RequestedPublishingInterval),
+    OPCUA_FIELD(CreateSubscriptionParameters, RequestedLifetimeCount),
+    OPCUA_FIELD(CreateSubscriptionParameters, RequestedMaxKeepAliveCount),
+    OPCUA_FIELD(CreateSubscriptionParameters, MaxNotificationsPerPublish),
+    OPCUA_FIELD(CreateSubscriptionParameters, PublishingEnabled),
+    OPCUA_FIELD(CreateSubscriptionParameters, Priority)
+  > Type;
+};
+
+template<>
+struct StructFields<CreateSubscriptionRequest>
+{
+  typedef FieldList<
+    OPCUA_FIELD(CreateSubscriptionRequest, TypeId),
+    OPCUA_FIELD(CreateSubscriptionRequest, Header),
+    OPCUA_FIELD(CreateSubscriptionRequest, Parameters)
+  > Type;
+};
+
+template<>
+struct StructFields<SubscriptionData>
+{
+  typedef FieldList<
+    OPCUA_FIELD(SubscriptionData, SubscriptionId),
+    OPCUA_FIELD(SubscriptionData, RevisedPublishingInterval),
+    OPCUA_FIELD(SubscriptionData, RevisedLifetimeCount),
+    OPCUA_FIELD(SubscriptionData, RevisedMaxKeepAliveCount)
+  > Type;
+};
+
+template<>
+struct StructFields<CreateSubscriptionResponse>
+{
+  typedef FieldList<
+    OPCUA_FIELD(CreateSubscriptionResponse, TypeId),
+    OPCUA_FIELD(CreateSubscriptionResponse, Header),
+    OPCUA_FIELD(CreateSubscriptionResponse, Data)
+  > Type;
+};
+
+template<>
+struct StructFields<ModifySubscriptionParameters>
+{
+  typedef FieldList<
+    OPCUA_FIELD(ModifySubscriptionParameters, SubscriptionId),
+    OPCUA_FIELD(ModifySubscriptionParameters, RequestedPublishingInterval),
+    OPCUA_FIELD(ModifySubscriptionParameters, RequestedLifetimeCount),
+    OPCUA_FIELD(ModifySubscriptionParameters, RequestedMaxKeepAliveCount),
+    OPCUA_FIELD(ModifySubscriptionParameters, MaxNotificationsPerPublish),
+    OPCUA_FIELD(ModifySubscriptionParameters, Priority)
+  > Type;
+};
+
+template<>
+struct StructFields<ModifySubscriptionRequest>
+{
+  typedef FieldList<
+    OPCUA_FIELD(ModifySubscriptionRequest, TypeId),
+    OPCUA_FIELD(ModifySubscriptionRequest, Header),
+    OPCUA_FIELD(ModifySubscriptionRequest, Parameters)
+  > Type;
+};
+
+template<>
+struct StructFields<ModifySubscriptionResult>
+{
+  typedef FieldList<
+    OPCUA_FIELD(ModifySubscriptionResult, RevisedPublishingInterval),
+    OPCUA_FIELD(ModifySubscriptionResult, RevisedLifetimeCount),
+    OPCUA_FIELD(ModifySubscriptionResult, RevisedMaxKeepAliveCount)
+  > Type;
+};
+
+template<>
+struct StructFields<ModifySubscriptionResponse>
+{
+  typedef FieldList<
+    OPCUA_FIELD(ModifySubscriptionResponse, TypeId),
+    OPCUA_FIELD(ModifySubscriptionResponse, Header),
+    OPCUA_FIELD(ModifySubscriptionResponse, Parameters)
+  > Type;
+};
+
+template<>
+struct StructFields<PublishingModeParameters>
+{
+  typedef FieldList<
+    OPCUA_FIELD(PublishingModeParameters, PublishingEnabled),
+    OPCUA_ARRAY_FIELD(PublishingModeParameters, SubscriptionIds)
+  > Type;
+};
+
+template<>
+struct StructFields<SetPublishingModeRequest>
+{
+  typedef FieldList<
+    OPCUA_FIELD(SetPublishingModeRequest, TypeId),
+    OPCUA_FIELD(SetPublishingModeRequest, Header),
+    OPCUA_FIELD(SetPublishingModeRequest, Parameters)
+  > Type;
+};
+
+template<>
+struct StructFields<PublishingModeResult>
+{
+  typedef FieldList<
+    OPCUA_ARRAY_FIELD(PublishingModeResult, Results),
+    OPCUA_ARRAY_FIELD(PublishingModeResult, DiagnosticInfos)
+  > Type;
+};
+
+template<>
+struct StructFields<SetPublishingModeResponse>
+{
+  typedef FieldList<
+    OPCUA_FIELD(SetPublishingModeResponse, TypeId),
+    OPCUA_FIELD(SetPublishingModeResponse, Header),
+    OPCUA_FIELD(SetPublishingModeResponse, Result)
+  > Type;
+};
+
+template<>
+struct StructFields<NotificationMessage>
+{
+  typedef FieldList<
+    OPCUA_FIELD(NotificationMessage, SequenceNumber),
+    OPCUA_FIELD(NotificationMessage, PublishTime),
+    OPCUA_ARRAY_FIELD(NotificationMessage, NotificationData)
+  > Type;
+};
+
+template<>
+struct StructFields<SubscriptionAcknowledgement>
+{
+  typedef FieldList<
+    OPCUA_FIELD(SubscriptionAcknowledgement, SubscriptionId),
+    OPCUA_FIELD(SubscriptionAcknowledgement, SequenceNumber)
+  > Type;
+};
+
+template<>
+struct StructFields<PublishRequest>
+{
+  typedef FieldList<
+    OPCUA_FIELD(PublishRequest, TypeId),
+    OPCUA_FIELD(PublishRequest, Header),
+    OPCUA_ARRAY_FIELD(PublishRequest, SubscriptionAcknowledgements)
+  > Type;
+};
+
+template<>
+struct StructFields<PublishResult>
+{
+  typedef FieldList<
+    OPCUA_FIELD(PublishResult, SubscriptionId),
+    OPCUA_ARRAY_FIELD(PublishResult, AvailableSequenceNumbers),
+    OPCUA_FIELD(PublishResult, MoreNotifications),
+    OPCUA_FIELD(PublishResult, NotificationMessage),
+    OPCUA_ARRAY_FIELD(PublishResult, Results),
+    OPCUA_ARRAY_FIELD(PublishResult, DiagnosticInfos)
+  > Type;
+};
+
+template<>
+struct StructFields<PublishResponse>
+{
+  typedef FieldList<
+    OPCUA_FIELD(PublishResponse, TypeId),
+    OPCUA_FIELD(PublishResponse, Header),
+    OPCUA_FIELD(PublishResponse, Parameters)
+  > Type;
+};
+
+template<>
+struct StructFields<RepublishParameters>
+{
+  typedef FieldList<
+    OPCUA_FIELD(RepublishParameters, SubscriptionId),
+    OPCUA_FIELD(RepublishParameters, RetransmitSequenceNumber)
+  > Type;
+};
+
+template<>
+struct StructFields<RepublishRequest>
+{
+  typedef FieldList<
+    OPCUA_FIELD(RepublishRequest, TypeId),
+    OPCUA_FIELD(RepublishRequest, Header),
+    OPCUA_FIELD(RepublishRequest, Parameters)
+  > Type;
+};
+
+template<>
+struct StructFields<RepublishResponse>
+{
+  typedef FieldList<
+    OPCUA_FIELD(RepublishResponse, TypeId),
+    OPCUA_FIELD(RepublishResponse, Header),
+    OPCUA_FIELD(RepublishResponse, NotificationMessage)
+  > Type;
+};
+
+template<>
+struct StructFields<TransferResult>
+{
+  typedef FieldList<
+    OPCUA_FIELD(TransferResult, Status),
+    OPCUA_ARRAY_FIELD(TransferResult, AvailableSequenceNumbers)
+  > Type;
+};
+
+template<>
+struct StructFields<TransferSubscriptionsParameters>
+{
+  typedef FieldList<
+    OPCUA_ARRAY_FIELD(TransferSubscriptionsParameters, SubscriptionIds),
+    OPCUA_FIELD(TransferSubscriptionsParameters, SendInitialValues)
+  > Type;
+};
+
+template<>
+struct StructFields<TransferSubscriptionsRequest>
+{
+  typedef FieldList<
+    OPCUA_FIELD(TransferSubscriptionsRequest, TypeId),
+    OPCUA_FIELD(TransferSubscriptionsRequest, Header),
+    OPCUA_FIELD(TransferSubscriptionsRequest, Parameters)
+  > Type;
+};
+
+template<>
+struct StructFields<TransferSubscriptionsResult>
+{
+  typedef FieldList<
+    OPCUA_ARRAY_FIELD(TransferSubscriptionsResult, Results),
+    OPCUA_ARRAY_FIELD(TransferSubscriptionsResult, DiagnosticInfos)
+  > Type;
+};
+
+template<>
+struct StructFields<TransferSubscriptionsResponse>
+{
+  typedef FieldList<
+    OPCUA_FIELD(TransferSubscriptionsResponse, TypeId),
+    OPCUA_FIELD(TransferSubscriptionsResponse, Header),
+    OPCUA_FIELD(TransferSubscriptionsResponse, Parameters)
+  > Type;
+};
+
+template<>
+struct StructFields<DeleteSubscriptionsRequest>
+{
+  typedef FieldList<
+    OPCUA_FIELD(DeleteSubscriptionsRequest, TypeId),
+    OPCUA_FIELD(DeleteSubscriptionsRequest, Header),
+    OPCUA_ARRAY_FIELD(DeleteSubscriptionsRequest, SubscriptionIds)
+  > Type;
+};
+
+template<>
+struct StructFields<DeleteSubscriptionsResponse>
+{
+  typedef FieldList<
+    OPCUA_FIELD(DeleteSubscriptionsResponse, TypeId),
+    OPCUA_FIELD(DeleteSubscriptionsResponse, Header),
+    OPCUA_ARRAY_FIELD(DeleteSubscriptionsResponse, Results),
+    OPCUA_ARRAY_FIELD(DeleteSubscriptionsResponse, DiagnosticInfos)
+  > Type;
+};
+
+template<>
+struct StructFields<Annotation>
+{
+  typedef FieldList<
+    OPCUA_FIELD(Annotation, Message),
+    OPCUA_FIELD(Annotation, UserName),
+    OPCUA_FIELD(Annotation, AnnotationTime)
+  > Type;
+};
+
+} // namespace Binary
+} // namespace OpcUa
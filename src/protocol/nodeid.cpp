@@ -245,6 +245,60 @@ NodeId::NodeId(const NodeId & node)
   CopyNodeId(node);
 }
 
+// moves the identifier strings, so containers of node ids grow without copies
+void NodeId::MoveNodeId(NodeId && node) noexcept
+{
+  Encoding = node.Encoding;
+
+  switch (node.GetEncodingValue())
+    {
+    case EV_TWO_BYTE:
+      TwoByteData.Identifier = node.TwoByteData.Identifier;
+      break;
+
+    case EV_FOUR_BYTE:
+      FourByteData = node.FourByteData;
+      break;
+
+    case EV_NUMERIC:
+      NumericData = node.NumericData;
+      break;
+
+    case EV_STRING:
+      StringData.NamespaceIndex = node.StringData.NamespaceIndex;
+      StringData.Identifier = std::move(node.StringData.Identifier);
+      break;
+
+    case EV_GUId:
+      GuidData.NamespaceIndex = node.GuidData.NamespaceIndex;
+      GuidData.Identifier = node.GuidData.Identifier;
+      break;
+
+    case EV_BYTE_STRING:
+      BinaryData.NamespaceIndex = node.BinaryData.NamespaceIndex;
+      BinaryData.Identifier = std::move(node.BinaryData.Identifier);
+      break;
+
+    default:
+      break;
+    }
+
+  if (node.HasServerIndex())
+    {
+      ServerIndex = node.ServerIndex;
+    }
+
+  if (node.HasNamespaceURI())
+    {
+      NamespaceURI = std::move(node.NamespaceURI);
+    }
+}
+
+NodeId::NodeId(NodeId && node) noexcept
+{
+  MoveNodeId(std::move(node));
+}
+
 NodeId::NodeId(const ExpandedNodeId & node)
 {
   CopyNodeId(node);
@@ -264,6 +318,12 @@ NodeId & NodeId::operator=(const NodeId & node)
   return *this;
 }
 
+NodeId & NodeId::operator=(NodeId && node) noexcept
+{
+  MoveNodeId(std::move(node));
+  return *this;
+}
+
 NodeId & NodeId::operator=(const ExpandedNodeId & node)
 {
   CopyNodeId(node);
@@ -318,12 +378,12 @@ bool NodeId::operator== (const NodeId & node) const
 
   if (IsString() && node.IsString())
     {
-      return GetStringIdentifier() == node.GetStringIdentifier();
+      return StringData.Identifier == node.StringData.Identifier;
     }
 
   if (IsBinary() && node.IsBinary())
     {
-      return GetBinaryIdentifier() == node.GetBinaryIdentifier();
+      return BinaryData.Identifier == node.BinaryData.Identifier;
     }
 
   if (IsGuid() && node.IsGuid())
@@ -346,16 +406,15 @@ bool NodeId::operator < (const NodeId & node) const
       return GetIntegerIdentifier() < node.GetIntegerIdentifier();
     }
 
+  // identifiers are compared in place, the getters return copies
   if (IsString() && node.IsString())
     {
-      return GetStringIdentifier() < node.GetStringIdentifier();
+      return StringData.Identifier < node.StringData.Identifier;
     }
 
   if (IsBinary() && node.IsBinary())
     {
-      const std::vector<uint8_t> & l = GetBinaryIdentifier();
-      const std::vector<uint8_t> & r = node.GetBinaryIdentifier();
-      return std::lexicographical_compare(l.cbegin(), l.cend(), r.cbegin(), r.cend());
+      return BinaryData.Identifier < node.BinaryData.Identifier;
     }
 
   if (IsGuid() && node.IsGuid())
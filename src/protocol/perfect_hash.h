@@ -0,0 +1,98 @@
+/// @brief Lookup in perfect hash tables generated by schemas/codegen.py.
+/// A key (or the hash of a name) is first mixed with seed 0 to pick a bucket;
+/// the seed stored for the bucket then mixes it to a slot which no other key
+/// of the table uses. The slot holds the index of the entry, which must still
+/// be compared with the key because unknown keys land on arbitrary slots.
+/// The hash functions must stay in sync with codegen.py.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#ifndef __OPC_UA_PERFECT_HASH_H__
+#define __OPC_UA_PERFECT_HASH_H__
+
+#include <boost/utility/string_view.hpp>
+
+#include <cstddef>
+#include <stdint.h>
+
+namespace OpcUa
+{
+namespace PerfectHash
+{
+
+/// @brief Hash of a name, eight bytes at a time.
+inline uint32_t HashName(boost::string_view name)
+{
+  uint64_t hash = 0xcbf29ce484222325ull ^ name.size();
+
+  for (std::size_t pos = 0; pos < name.size(); pos += 8)
+    {
+      // explicit little endian load, the tables do not depend on the host
+      uint64_t word = 0;
+      const std::size_t end = pos + 8 < name.size() ? pos + 8 : name.size();
+
+      for (std::size_t idx = end; idx > pos; --idx)
+        {
+          word = word << 8 | static_cast<uint8_t>(name[idx - 1]);
+        }
+
+      hash = (hash ^ word) * 0x9e3779b97f4a7c15ull;
+      hash ^= hash >> 32;
+    }
+
+  return static_cast<uint32_t>(hash);
+}
+
+/// @brief Finalizer of MurmurHash3.
+inline uint32_t HashValue(uint32_t value, uint32_t seed)
+{
+  uint32_t hash = value + seed * 0x9e3779b9u;
+  hash ^= hash >> 16;
+  hash *= 0x85ebca6bu;
+  hash ^= hash >> 13;
+  hash *= 0xc2b2ae35u;
+  hash ^= hash >> 16;
+  return hash;
+}
+
+/// @brief Index of the only entry which can have the name.
+template <std::size_t SeedCount, std::size_t SlotCount>
+inline uint16_t FindName(const uint16_t (&seeds)[SeedCount], const uint16_t (&slots)[SlotCount], boost::string_view name)
+{
+  const uint32_t hash = HashName(name);
+  const uint16_t seed = seeds[HashValue(hash, 0) % SeedCount];
+  return slots[HashValue(hash, seed) % SlotCount];
+}
+
+/// @brief Index of the only entry which can have the value.
+template <std::size_t SeedCount, std::size_t SlotCount>
+inline uint16_t FindValue(const uint16_t (&seeds)[SeedCount], const uint16_t (&slots)[SlotCount], uint32_t value)
+{
+  const uint16_t seed = seeds[HashValue(value, 0) % SeedCount];
+  return slots[HashValue(value, seed) % SlotCount];
+}
+
+/// @brief Compare with a zero terminated name of a table without strlen.
+inline bool IsName(boost::string_view name, const char * tableName)
+{
+  for (const char c : name)
+    {
+      if (c != *tableName || c == '\0')
+        {
+          return false;
+        }
+
+      ++tableName;
+    }
+
+  return *tableName == '\0';
+}
+
+} // namespace PerfectHash
+} // namespace OpcUa
+
+#endif // __OPC_UA_PERFECT_HASH_H__
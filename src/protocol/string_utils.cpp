@@ -26,6 +26,7 @@
 #include <iomanip>
 #include <iostream>
 #include <limits>
+#include <algorithm>
 
 
 std::string OpcUa::ToString(const OpcUa::BrowseDirection & direction)
@@ -209,9 +210,27 @@ std::string OpcUa::ToString(const OpcUa::MonitoringMode & value)
 
 std::string OpcUa::ToString(const NodeId & id, bool addObjectIdName)
 {
-  std::stringstream result;
-  ToStream(result, id, addObjectIdName);
-  return result.str();
+  char buffer[64];
+  std::size_t length = ToChars(id, buffer, sizeof(buffer));
+  std::string result;
+
+  if (length <= sizeof(buffer))
+    {
+      result.assign(buffer, length);
+    }
+
+  else
+    {
+      result.resize(length);
+      ToChars(id, &result[0], length);
+    }
+
+  if (addObjectIdName && id.IsInteger())
+    {
+      result += " (" + ToString(ObjectId(id.GetIntegerIdentifier())) + ")";
+    }
+
+  return result;
 }
 
 std::string OpcUa::ToString(const OpcUa::TimestampsToReturn & value)
@@ -610,42 +629,7 @@ std::ostream & OpcUa::ToStream(std::ostream & os, const OpcUa::MonitoringFilter
 
 std::ostream & OpcUa::ToStream(std::ostream & os, const OpcUa::NodeId & value, bool addObjectIdName)
 {
-  if (value.HasServerIndex())
-    {
-      os << "srv=" << value.ServerIndex << ";";
-    }
-
-  if (value.HasNamespaceURI())
-    {
-      os << "nsu=" << value.NamespaceURI << ";";
-    }
-
-  os << "ns=" << value.GetNamespaceIndex() << ";";
-
-  if (value.IsInteger())
-    {
-      int id = value.GetIntegerIdentifier();
-      os << "i=" << id << ";";
-      if (addObjectIdName)
-        {
-          os << " (" << ToString(ObjectId(id)) << ")";
-        }
-    }
-
-#ifndef __ENABLE_EMBEDDED_PROFILE__
-
-  else if (value.IsString())
-    {
-      os << "s=" << value.GetStringIdentifier() << ";";
-    }
-
-  else if (value.IsGuid())
-    {
-      os << "g=" << ToString(value.GetGuidIdentifier()) << ";";
-    }
-
-#endif
-  return os;
+  return os << ToString(value, addObjectIdName);
 }
 
 std::ostream & OpcUa::ToStream(std::ostream & os, const std::vector<OpcUa::QualifiedName> & value)
@@ -717,181 +701,350 @@ std::ostream & OpcUa::ToStream(std::ostream & os, const OpcUa::SimpleAttributeOp
   return os;
 }
 
-OpcUa::Guid OpcUa::ToGuid(const std::string & str)
+namespace
 {
-  if (str.size() != 36)
-    {
-      return OpcUa::Guid();
-    }
-
-  Guid guid;
-
-  unsigned data1 = 0;
-  unsigned data2 = 0;
-  unsigned data3 = 0;
-  unsigned data4 = 0;
-  unsigned data5 = 0;
-  unsigned data6 = 0;
-  unsigned data7 = 0;
-  unsigned data8 = 0;
-  unsigned data9 = 0;
-  unsigned data10 = 0;
-  unsigned data11 = 0;
-  const int parts = sscanf(str.c_str(), "%08X-%04X-%04X-%02X%02X-%02X%02X%02X%02X%02X%02X",
-                           &data1, &data2, &data3, &data4, &data5, &data6, &data7, &data8, &data9, &data10, &data11);
-
-  guid.Data1    = static_cast<uint32_t>(data1);
-  guid.Data2    = static_cast<uint16_t>(data2);
-  guid.Data3    = static_cast<uint16_t>(data3);
-  guid.Data4[0] = static_cast<uint8_t>(data4);
-  guid.Data4[1] = static_cast<uint8_t>(data5);
-  guid.Data4[2] = static_cast<uint8_t>(data6);
-  guid.Data4[3] = static_cast<uint8_t>(data7);
-  guid.Data4[4] = static_cast<uint8_t>(data8);
-  guid.Data4[5] = static_cast<uint8_t>(data9);
-  guid.Data4[6] = static_cast<uint8_t>(data10);
-  guid.Data4[7] = static_cast<uint8_t>(data11);
-
-  if (parts != 11)
-    {
-      return OpcUa::Guid();
-    }
-
-  return guid;
-}
-
+const char HexDigits[] = "0123456789ABCDEF";
 
-namespace
+/// @brief Text writer into a caller buffer which counts what did not fit.
+class CharWriter
 {
-std::string GetNodeField(const std::string & data, const char * field)
+public:
+  CharWriter(char * buffer, std::size_t size)
+    : Buffer(buffer)
+    , Size(size)
+    , Length(0)
+  {
+  }
+
+  void Append(boost::string_view text)
+  {
+    if (Length < Size)
+      {
+        std::memcpy(Buffer + Length, text.data(), std::min(text.size(), Size - Length));
+      }
+
+    Length += text.size();
+  }
+
+  void AppendDecimal(uint32_t value)
+  {
+    char digits[10];
+    char * begin = digits + sizeof(digits);
+
+    do
+      {
+        *--begin = static_cast<char>('0' + value % 10);
+        value /= 10;
+      }
+    while (value);
+
+    Append(boost::string_view(begin, digits + sizeof(digits) - begin));
+  }
+
+  void AppendHex(uint32_t value, unsigned width)
+  {
+    char digits[8];
+
+    for (unsigned idx = width; idx > 0; --idx)
+      {
+        digits[idx - 1] = HexDigits[value & 0xF];
+        value >>= 4;
+      }
+
+    Append(boost::string_view(digits, width));
+  }
+
+  void AppendGuid(const OpcUa::Guid & guid)
+  {
+    AppendHex(guid.Data1, 8);
+    Append("-");
+    AppendHex(guid.Data2, 4);
+    Append("-");
+    AppendHex(guid.Data3, 4);
+    Append("-");
+    AppendHex(guid.Data4[0], 2);
+    AppendHex(guid.Data4[1], 2);
+    Append("-");
+
+    for (unsigned idx = 2; idx < 8; ++idx)
+      {
+        AppendHex(guid.Data4[idx], 2);
+      }
+  }
+
+  std::size_t GetLength() const
+  {
+    return Length;
+  }
+
+private:
+  char * Buffer;
+  std::size_t Size;
+  std::size_t Length;
+};
+
+bool ParseHex(boost::string_view text, uint32_t & value)
 {
-  std::size_t colon = 0;
+  value = 0;
 
-  do
+  for (const char c : text)
     {
-      // if something found at previous cycle
-      if (colon)
+      uint32_t digit = 0;
+
+      if (c >= '0' && c <= '9')
         {
-          ++colon;
+          digit = c - '0';
         }
 
-      // find field string
-      colon = data.find(field, colon);
+      else if (c >= 'A' && c <= 'F')
+        {
+          digit = c - 'A' + 10;
+        }
 
-      // if found nothing
-      if (colon == std::string::npos)
+      else if (c >= 'a' && c <= 'f')
         {
-          return std::string();
+          digit = c - 'a' + 10;
         }
 
-      // if found at the begin
-      if (colon == 0)
+      else
         {
-          break;
+          return false;
         }
+
+      value = value << 4 | digit;
     }
 
-  // if finding 's=' in the 'ns=1;i-3;' will be found field 'ns=1;'
-  // check that previous character is the ';' if not then search next.
-  while (data[colon - 1] != ';');
+  return true;
+}
+
+/// @brief Decimal number without sign or spaces which is not greater than max.
+uint32_t ParseInteger(boost::string_view value, uint32_t max, boost::string_view data)
+{
+  uint64_t result = 0;
 
-  colon += std::strlen(field);
-  const std::size_t semicolon = data.find(";", colon);
+  if (value.empty())
+    {
+      throw std::runtime_error("Empty number in string: " + data.to_string());
+    }
 
-  if (semicolon == std::string::npos)
+  for (const char c : value)
     {
-      data.substr(colon);
+      if (c < '0' || c > '9' || (result = result * 10 + (c - '0')) > max)
+        {
+          throw std::runtime_error("Invalid number '" + value.to_string() + "' in string: " + data.to_string());
+        }
     }
 
-  return data.substr(colon, semicolon - colon);
+  return static_cast<uint32_t>(result);
 }
 
-uint32_t GetInteger(const std::string & value)
+/// @brief StringNodeId without the extra copy of the identifier.
+OpcUa::NodeId MakeStringNodeId(boost::string_view identifier, uint16_t ns)
 {
-  if (value.empty())
+  OpcUa::NodeId result;
+  result.Encoding = OpcUa::EV_STRING;
+  result.StringData.Identifier.assign(identifier.data(), identifier.size());
+  result.StringData.NamespaceIndex = ns;
+  return result;
+}
+
+/// @brief Keep the value of the first field with the key.
+void GetNodeField(boost::string_view field, boost::string_view key, boost::string_view & value)
+{
+  if (value.empty() && field.starts_with(key))
     {
-      return 0;
+      value = field.substr(key.size());
     }
+}
 
-  return std::stoul(value);
 }
 
+OpcUa::Guid OpcUa::ToGuid(boost::string_view str)
+{
+  // 01020304-0506-0708-090A-0B0C0D0E0F10
+  if (str.size() != 36 || str[8] != '-' || str[13] != '-' || str[18] != '-' || str[23] != '-')
+    {
+      return OpcUa::Guid();
+    }
+
+  Guid guid;
+  uint32_t data2 = 0;
+  uint32_t data3 = 0;
+  uint32_t data4[8] = {0};
+
+  bool valid = ParseHex(str.substr(0, 8), guid.Data1)
+               && ParseHex(str.substr(9, 4), data2)
+               && ParseHex(str.substr(14, 4), data3)
+               && ParseHex(str.substr(19, 2), data4[0])
+               && ParseHex(str.substr(21, 2), data4[1]);
+
+  for (unsigned idx = 2; idx < 8 && valid; ++idx)
+    {
+      valid = ParseHex(str.substr(24 + (idx - 2) * 2, 2), data4[idx]);
+    }
+
+  if (!valid)
+    {
+      return OpcUa::Guid();
+    }
+
+  guid.Data2 = static_cast<uint16_t>(data2);
+  guid.Data3 = static_cast<uint16_t>(data3);
+
+  for (unsigned idx = 0; idx < 8; ++idx)
+    {
+      guid.Data4[idx] = static_cast<uint8_t>(data4[idx]);
+    }
+
+  return guid;
 }
 
-OpcUa::NodeId OpcUa::ToNodeId(const std::string & data, uint32_t defaultNamespace)
+OpcUa::NodeId OpcUa::ToNodeId(boost::string_view data, uint32_t defaultNamespace)
 {
-  OpcUa::NodeId result;
-  uint32_t ns = defaultNamespace;
+  boost::string_view srv;
+  boost::string_view nsu;
+  boost::string_view nsString;
+  boost::string_view integer;
+  boost::string_view str;
+  boost::string_view g;
+
+  // fields are separated by ';' and may come in any order
+  for (std::size_t begin = 0; begin < data.size();)
+    {
+      const std::size_t end = std::min(data.find(';', begin), data.size());
+      const boost::string_view field = data.substr(begin, end - begin);
+      begin = end + 1;
+
+      GetNodeField(field, "srv=", srv);
+      GetNodeField(field, "nsu=", nsu);
+      GetNodeField(field, "ns=", nsString);
+      GetNodeField(field, "i=", integer);
+      GetNodeField(field, "s=", str);
+      GetNodeField(field, "g=", g);
+    }
 
-  const std::string nsString = GetNodeField(data, "ns=");
+  uint32_t ns = defaultNamespace;
 
   if (nsString.empty())
     {
       if (ns == std::numeric_limits<uint32_t>::max())
         {
-          throw (std::runtime_error("Namespace index coult not be parsed from string and not default index specified in string: " + data));
+          throw (std::runtime_error("Namespace index coult not be parsed from string and not default index specified in string: " + data.to_string()));
         }
     }
 
   else
     {
-      ns = GetInteger(nsString);
+      ns = ParseInteger(nsString, std::numeric_limits<uint16_t>::max(), data);
     }
 
-  const std::string srv = GetNodeField(data, "srv=");
+  OpcUa::NodeId result;
 
-  if (!srv.empty())
+  if (!integer.empty())
     {
-      result.SetServerIndex(GetInteger(srv));
+      result = OpcUa::NumericNodeId(ParseInteger(integer, std::numeric_limits<uint32_t>::max(), data), ns);
     }
 
-  const std::string nsu = GetNodeField(data, "nsu=");
-
-  if (!nsu.empty())
+  else if (!str.empty())
     {
-      result.SetNamespaceURI(nsu);
+      result = MakeStringNodeId(str, ns);
     }
 
-  const std::string integer = GetNodeField(data, "i=");
+  else if (!g.empty())
+    {
+      result = OpcUa::GuidNodeId(ToGuid(g), ns);
+    }
 
-  if (!integer.empty())
+  else
     {
-      return OpcUa::NumericNodeId(GetInteger(integer), ns);
+      throw (std::runtime_error("No identifier found in string: '" + data.to_string() + "'"));
     }
 
-  const std::string str = GetNodeField(data, "s=");
+  if (!srv.empty())
+    {
+      result.SetServerIndex(ParseInteger(srv, std::numeric_limits<uint32_t>::max(), data));
+    }
 
-  if (!str.empty())
+  if (!nsu.empty())
     {
-      return OpcUa::StringNodeId(str, ns);
+      result.SetNamespaceURI(nsu.to_string());
     }
 
-  const std::string g = GetNodeField(data, "g=");
+  return result;
+}
+
+OpcUa::QualifiedName OpcUa::ToQualifiedName(boost::string_view str, uint32_t default_ns)
+{
+  std::size_t found = str.find(':');
+
+  if (found != boost::string_view::npos)
+    {
+      const uint16_t ns = ParseInteger(str.substr(0, found), std::numeric_limits<uint16_t>::max(), str);
+      return QualifiedName(ns, str.substr(found + 1).to_string());
+    }
 
-  if (!g.empty())
+  if (default_ns == std::numeric_limits<uint32_t>::max())
     {
-      return OpcUa::GuidNodeId(ToGuid(g), ns);
+      throw (std::runtime_error("Namespace index coult not be parsed from string and not default index specified in string: " + str.to_string()));
     }
 
-  throw (std::runtime_error("No identifier found in string: '" + data + "'"));
+  return QualifiedName(default_ns, str.to_string());
 }
 
-OpcUa::QualifiedName OpcUa::ToQualifiedName(const std::string & str, uint32_t default_ns)
+std::size_t OpcUa::ToChars(const NodeId & id, char * buffer, std::size_t size)
 {
-  std::size_t found = str.find(":");
+  CharWriter writer(buffer, size);
 
-  if (found != std::string::npos)
+  if (id.HasServerIndex())
     {
-      uint16_t ns = std::stoi(str.substr(0, found));
-      std::string name = str.substr(found + 1, str.length() - found);
-      return QualifiedName(ns, name);
+      writer.Append("srv=");
+      writer.AppendDecimal(id.ServerIndex);
+      writer.Append(";");
     }
 
-  if (default_ns == std::numeric_limits<uint32_t>::max())
+  if (id.HasNamespaceURI())
+    {
+      writer.Append("nsu=");
+      writer.Append(id.NamespaceURI);
+      writer.Append(";");
+    }
+
+  writer.Append("ns=");
+  writer.AppendDecimal(id.GetNamespaceIndex());
+  writer.Append(";");
+
+  if (id.IsInteger())
+    {
+      writer.Append("i=");
+      writer.AppendDecimal(id.GetIntegerIdentifier());
+      writer.Append(";");
+    }
+
+#ifndef __ENABLE_EMBEDDED_PROFILE__
+
+  else if (id.IsString())
+    {
+      writer.Append("s=");
+      writer.Append(id.StringData.Identifier);
+      writer.Append(";");
+    }
+
+  else if (id.IsGuid())
     {
-      throw (std::runtime_error("Namespace index coult not be parsed from string and not default index specified in string: " + str));
+      writer.Append("g=");
+      writer.AppendGuid(id.GuidData.Identifier);
+      writer.Append(";");
     }
 
-  return QualifiedName(default_ns, str);
+#endif
+  return writer.GetLength();
 }
 
+std::size_t OpcUa::ToChars(const QualifiedName & name, char * buffer, std::size_t size)
+{
+  CharWriter writer(buffer, size);
+  writer.AppendDecimal(name.NamespaceIndex);
+  writer.Append(":");
+  writer.Append(name.Name);
+  return writer.GetLength();
+}
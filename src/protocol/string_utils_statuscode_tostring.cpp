@@ -3,895 +3,776 @@
 // It is automatically generated from opcfoundation.org schemas.
 //
 
-#include <string>
-#include <sstream>
+#include "perfect_hash.h"
+
 #include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <string>
 
 #include "opc/ua/protocol/status_codes.h"
+#include "opc/ua/protocol/string_utils.h"
 
-namespace OpcUa
+namespace
 {
 
-std::string ToString(const StatusCode & code)
+struct StatusCodeEntry
 {
-  if (code == StatusCode::Good)
-    {
-      return std::string();
-    }
-
-  std::stringstream stream;
-
-  switch (code)
-    {
-    case StatusCode::BadUnexpectedError:
-      stream << "An unexpected error occurred.";
-      break;
-
-    case StatusCode::BadInternalError:
-      stream << "An internal error occurred as a result of a programming or configuration error.";
-      break;
-
-    case StatusCode::BadOutOfMemory:
-      stream << "Not enough memory to complete the operation.";
-      break;
-
-    case StatusCode::BadResourceUnavailable:
-      stream << "An operating system resource is not available.";
-      break;
-
-    case StatusCode::BadCommunicationError:
-      stream << "A low level communication error occurred.";
-      break;
-
-    case StatusCode::BadEncodingError:
-      stream << "Encoding halted because of invalid data in the objects being serialized.";
-      break;
-
-    case StatusCode::BadDecodingError:
-      stream << "Decoding halted because of invalid data in the stream.";
-      break;
-
-    case StatusCode::BadEncodingLimitsExceeded:
-      stream << "The message encoding/decoding limits imposed by the stack have been exceeded.";
-      break;
-
-    case StatusCode::BadRequestTooLarge:
-      stream << "The request message size exceeds limits set by the server.";
-      break;
-
-    case StatusCode::BadResponseTooLarge:
-      stream << "The response message size exceeds limits set by the client.";
-      break;
-
-    case StatusCode::BadUnknownResponse:
-      stream << "An unrecognized response was received from the server.";
-      break;
-
-    case StatusCode::BadTimeout:
-      stream << "The operation timed out.";
-      break;
-
-    case StatusCode::BadServiceUnsupported:
-      stream << "The server does not support the requested service.";
-      break;
-
-    case StatusCode::BadShutdown:
-      stream << "The operation was cancelled because the application is shutting down.";
-      break;
-
-    case StatusCode::BadServerNotConnected:
-      stream << "The operation could not complete because the client is not connected to the server.";
-      break;
-
-    case StatusCode::BadServerHalted:
-      stream << "The server has stopped and cannot process any requests.";
-      break;
-
-    case StatusCode::BadNothingToDo:
-      stream << "There was nothing to do because the client passed a list of operations with no elements.";
-      break;
-
-    case StatusCode::BadTooManyOperations:
-      stream << "The request could not be processed because it specified too many operations.";
-      break;
-
-    case StatusCode::BadTooManyMonitoredItems:
-      stream << "The request could not be processed because there are too many monitored items in the subscription.";
-      break;
-
-    case StatusCode::BadDataTypeIdUnknown:
-      stream << "The extension object cannot be (de)serialized because the data type id is not recognized.";
-      break;
-
-    case StatusCode::BadCertificateInvalid:
-      stream << "The certificate provided as a parameter is not valid.";
-      break;
-
-    case StatusCode::BadSecurityChecksFailed:
-      stream << "An error occurred verifying security.";
-      break;
-
-    case StatusCode::BadCertificateTimeInvalid:
-      stream << "The Certificate has expired or is not yet valid.";
-      break;
-
-    case StatusCode::BadCertificateIssuerTimeInvalid:
-      stream << "An Issuer Certificate has expired or is not yet valid.";
-      break;
-
-    case StatusCode::BadCertificateHostNameInvalid:
-      stream << "The HostName used to connect to a Server does not match a HostName in the Certificate.";
-      break;
-
-    case StatusCode::BadCertificateUriInvalid:
-      stream << "The URI specified in the ApplicationDescription does not match the URI in the Certificate.";
-      break;
-
-    case StatusCode::BadCertificateUseNotAllowed:
-      stream << "The Certificate may not be used for the requested operation.";
-      break;
-
-    case StatusCode::BadCertificateIssuerUseNotAllowed:
-      stream << "The Issuer Certificate may not be used for the requested operation.";
-      break;
-
-    case StatusCode::BadCertificateUntrusted:
-      stream << "The Certificate is not trusted.";
-      break;
-
-    case StatusCode::BadCertificateRevocationUnknown:
-      stream << "It was not possible to determine if the Certificate has been revoked.";
-      break;
-
-    case StatusCode::BadCertificateIssuerRevocationUnknown:
-      stream << "It was not possible to determine if the Issuer Certificate has been revoked.";
-      break;
-
-    case StatusCode::BadCertificateRevoked:
-      stream << "The Certificate has been revoked.";
-      break;
-
-    case StatusCode::BadCertificateIssuerRevoked:
-      stream << "The Issuer Certificate has been revoked.";
-      break;
-
-    case StatusCode::BadUserAccessDenied:
-      stream << "User does not have permission to perform the requested operation.";
-      break;
-
-    case StatusCode::BadIdentityTokenInvalid:
-      stream << "The user identity token is not valid.";
-      break;
-
-    case StatusCode::BadIdentityTokenRejected:
-      stream << "The user identity token is valid but the server has rejected it.";
-      break;
-
-    case StatusCode::BadSecureChannelIdInvalid:
-      stream << "The specified secure channel is no longer valid.";
-      break;
-
-    case StatusCode::BadInvalidTimestamp:
-      stream << "The timestamp is outside the range allowed by the server.";
-      break;
-
-    case StatusCode::BadNonceInvalid:
-      stream << "The nonce does appear to be not a random value or it is not the correct length.";
-      break;
-
-    case StatusCode::BadSessionIdInvalid:
-      stream << "The session id is not valid.";
-      break;
-
-    case StatusCode::BadSessionClosed:
-      stream << "The session was closed by the client.";
-      break;
-
-    case StatusCode::BadSessionNotActivated:
-      stream << "The session cannot be used because ActivateSession has not been called.";
-      break;
-
-    case StatusCode::BadSubscriptionIdInvalid:
-      stream << "The subscription id is not valid.";
-      break;
-
-    case StatusCode::BadRequestHeaderInvalid:
-      stream << "The header for the request is missing or invalid.";
-      break;
-
-    case StatusCode::BadTimestampsToReturnInvalid:
-      stream << "The timestamps to return parameter is invalid.";
-      break;
-
-    case StatusCode::BadRequestCancelledByClient:
-      stream << "The request was cancelled by the client.";
-      break;
-
-    case StatusCode::GoodSubscriptionTransferred:
-      stream << "The subscription was transferred to another session.";
-      break;
-
-    case StatusCode::GoodCompletesAsynchronously:
-      stream << "The processing will complete asynchronously.";
-      break;
-
-    case StatusCode::GoodOverload:
-      stream << "Sampling has slowed down due to resource limitations.";
-      break;
-
-    case StatusCode::GoodClamped:
-      stream << "The value written was accepted but was clamped.";
-      break;
-
-    case StatusCode::BadNoCommunication:
-      stream << "Communication with the data source is defined";
-      break;
-
-    case StatusCode::BadWaitingForInitialData:
-      stream << "Waiting for the server to obtain values from the underlying data source.";
-      break;
-
-    case StatusCode::BadNodeIdInvalid:
-      stream << "The syntax of the node id is not valid.";
-      break;
-
-    case StatusCode::BadNodeIdUnknown:
-      stream << "The node id refers to a node that does not exist in the server address space.";
-      break;
-
-    case StatusCode::BadAttributeIdInvalid:
-      stream << "The attribute is not supported for the specified Node.";
-      break;
-
-    case StatusCode::BadIndexRangeInvalid:
-      stream << "The syntax of the index range parameter is invalid.";
-      break;
-
-    case StatusCode::BadIndexRangeNoData:
-      stream << "No data exists within the range of indexes specified.";
-      break;
-
-    case StatusCode::BadDataEncodingInvalid:
-      stream << "The data encoding is invalid.";
-      break;
-
-    case StatusCode::BadDataEncodingUnsupported:
-      stream << "The server does not support the requested data encoding for the node.";
-      break;
-
-    case StatusCode::BadNotReadable:
-      stream << "The access level does not allow reading or subscribing to the Node.";
-      break;
-
-    case StatusCode::BadNotWritable:
-      stream << "The access level does not allow writing to the Node.";
-      break;
-
-    case StatusCode::BadOutOfRange:
-      stream << "The value was out of range.";
-      break;
-
-    case StatusCode::BadNotSupported:
-      stream << "The requested operation is not supported.";
-      break;
-
-    case StatusCode::BadNotFound:
-      stream << "A requested item was not found or a search operation ended without success.";
-      break;
-
-    case StatusCode::BadObjectDeleted:
-      stream << "The object cannot be used because it has been deleted.";
-      break;
-
-    case StatusCode::BadNotImplemented:
-      stream << "Requested operation is not implemented.";
-      break;
-
-    case StatusCode::BadMonitoringModeInvalid:
-      stream << "The monitoring mode is invalid.";
-      break;
-
-    case StatusCode::BadMonitoredItemIdInvalid:
-      stream << "The monitoring item id does not refer to a valid monitored item.";
-      break;
-
-    case StatusCode::BadMonitoredItemFilterInvalid:
-      stream << "The monitored item filter parameter is not valid.";
-      break;
-
-    case StatusCode::BadMonitoredItemFilterUnsupported:
-      stream << "The server does not support the requested monitored item filter.";
-      break;
-
-    case StatusCode::BadFilterNotAllowed:
-      stream << "A monitoring filter cannot be used in combination with the attribute specified.";
-      break;
-
-    case StatusCode::BadStructureMissing:
-      stream << "A mandatory structured parameter was missing or null.";
-      break;
-
-    case StatusCode::BadEventFilterInvalid:
-      stream << "The event filter is not valid.";
-      break;
-
-    case StatusCode::BadContentFilterInvalid:
-      stream << "The content filter is not valid.";
-      break;
-
-    case StatusCode::BadFilterOperatorInvalid:
-      stream << "An unregognized operator was provided in a filter.";
-      break;
-
-    case StatusCode::BadFilterOperatorUnsupported:
-      stream << "A valid operator was provided";
-      break;
-
-    case StatusCode::BadFilterOperandCountMismatch:
-      stream << "The number of operands provided for the filter operator was less then expected for the operand provided.";
-      break;
-
-    case StatusCode::BadFilterOperandInvalid:
-      stream << "The operand used in a content filter is not valid.";
-      break;
-
-    case StatusCode::BadFilterElementInvalid:
-      stream << "The referenced element is not a valid element in the content filter.";
-      break;
-
-    case StatusCode::BadFilterLiteralInvalid:
-      stream << "The referenced literal is not a valid value.";
-      break;
-
-    case StatusCode::BadContinuationPointInvalid:
-      stream << "The continuation point provide is longer valid.";
-      break;
-
-    case StatusCode::BadNoContinuationPoints:
-      stream << "The operation could not be processed because all continuation points have been allocated.";
-      break;
-
-    case StatusCode::BadReferenceTypeIdInvalid:
-      stream << "The operation could not be processed because all continuation points have been allocated.";
-      break;
-
-    case StatusCode::BadBrowseDirectionInvalid:
-      stream << "The browse direction is not valid.";
-      break;
-
-    case StatusCode::BadNodeNotInView:
-      stream << "The node is not part of the view.";
-      break;
-
-    case StatusCode::BadServerUriInvalid:
-      stream << "The ServerUri is not a valid URI.";
-      break;
-
-    case StatusCode::BadServerNameMissing:
-      stream << "No ServerName was specified.";
-      break;
-
-    case StatusCode::BadDiscoveryUrlMissing:
-      stream << "No DiscoveryUrl was specified.";
-      break;
-
-    case StatusCode::BadSempahoreFileMissing:
-      stream << "The semaphore file specified by the client is not valid.";
-      break;
-
-    case StatusCode::BadRequestTypeInvalid:
-      stream << "The security token request type is not valid.";
-      break;
-
-    case StatusCode::BadSecurityModeRejected:
-      stream << "The security mode does not meet the requirements set by the Server.";
-      break;
-
-    case StatusCode::BadSecurityPolicyRejected:
-      stream << "The security policy does not meet the requirements set by the Server.";
-      break;
-
-    case StatusCode::BadTooManySessions:
-      stream << "The server has reached its maximum number of sessions.";
-      break;
-
-    case StatusCode::BadUserSignatureInvalid:
-      stream << "The user token signature is missing or invalid.";
-      break;
-
-    case StatusCode::BadApplicationSignatureInvalid:
-      stream << "The signature generated with the client certificate is missing or invalid.";
-      break;
-
-    case StatusCode::BadNoValidCertificates:
-      stream << "The client did not provide at least one software certificate that is valid and meets the profile requirements for the server.";
-      break;
-
-    case StatusCode::BadIdentityChangeNotSupported:
-      stream << "The Server does not support changing the user identity assigned to the session.";
-      break;
-
-    case StatusCode::BadRequestCancelledByRequest:
-      stream << "The request was cancelled by the client with the Cancel service.";
-      break;
-
-    case StatusCode::BadParentNodeIdInvalid:
-      stream << "The parent node id does not to refer to a valid node.";
-      break;
-
-    case StatusCode::BadReferenceNotAllowed:
-      stream << "The reference could not be created because it violates constraints imposed by the data model.";
-      break;
-
-    case StatusCode::BadNodeIdRejected:
-      stream << "The requested node id was reject because it was either invalid or server does not allow node ids to be specified by the client.";
-      break;
-
-    case StatusCode::BadNodeIdExists:
-      stream << "The requested node id is already used by another node.";
-      break;
-
-    case StatusCode::BadNodeClassInvalid:
-      stream << "The node class is not valid.";
-      break;
-
-    case StatusCode::BadBrowseNameInvalid:
-      stream << "The browse name is invalid.";
-      break;
-
-    case StatusCode::BadBrowseNameDuplicated:
-      stream << "The browse name is not unique among nodes that share the same relationship with the parent.";
-      break;
-
-    case StatusCode::BadNodeAttributesInvalid:
-      stream << "The node attributes are not valid for the node class.";
-      break;
-
-    case StatusCode::BadTypeDefinitionInvalid:
-      stream << "The type definition node id does not reference an appropriate type node.";
-      break;
-
-    case StatusCode::BadSourceNodeIdInvalid:
-      stream << "The source node id does not reference a valid node.";
-      break;
-
-    case StatusCode::BadTargetNodeIdInvalid:
-      stream << "The target node id does not reference a valid node.";
-      break;
-
-    case StatusCode::BadDuplicateReferenceNotAllowed:
-      stream << "The reference type between the nodes is already defined.";
-      break;
-
-    case StatusCode::BadInvalidSelfReference:
-      stream << "The server does not allow this type of self reference on this node.";
-      break;
-
-    case StatusCode::BadReferenceLocalOnly:
-      stream << "The reference type is not valid for a reference to a remote server.";
-      break;
-
-    case StatusCode::BadNoDeleteRights:
-      stream << "The server will not allow the node to be deleted.";
-      break;
-
-    case StatusCode::UncertainReferenceNotDeleted:
-      stream << "The server was not able to delete all target references.";
-      break;
-
-    case StatusCode::BadServerIndexInvalid:
-      stream << "The server index is not valid.";
-      break;
-
-    case StatusCode::BadViewIdUnknown:
-      stream << "The view id does not refer to a valid view node.";
-      break;
-
-    case StatusCode::BadViewTimestampInvalid:
-      stream << "The view timestamp is not available or not supported.";
-      break;
-
-    case StatusCode::BadViewParameterMismatch:
-      stream << "The view parameters are not consistent with each other.";
-      break;
-
-    case StatusCode::BadViewVersionInvalid:
-      stream << "The view version is not available or not supported.";
-      break;
-
-    case StatusCode::UncertainNotAllNodesAvailable:
-      stream << "The list of references may not be complete because the underlying system is not available.";
-      break;
-
-    case StatusCode::GoodResultsMayBeIncomplete:
-      stream << "The server should have followed a reference to a node in a remote server but did not. The result set may be incomplete.";
-      break;
-
-    case StatusCode::BadNotTypeDefinition:
-      stream << "The provided Nodeid was not a type definition nodeid.";
-      break;
-
-    case StatusCode::UncertainReferenceOutOfServer:
-      stream << "One of the references to follow in the relative path references to a node in the address space in another server.";
-      break;
-
-    case StatusCode::BadTooManyMatches:
-      stream << "The requested operation has too many matches to return.";
-      break;
-
-    case StatusCode::BadQueryTooComplex:
-      stream << "The requested operation requires too many resources in the server.";
-      break;
-
-    case StatusCode::BadNoMatch:
-      stream << "The requested operation has no match to return.";
-      break;
-
-    case StatusCode::BadMaxAgeInvalid:
-      stream << "The max age parameter is invalid.";
-      break;
-
-    case StatusCode::BadHistoryOperationInvalid:
-      stream << "The history details parameter is not valid.";
-      break;
-
-    case StatusCode::BadHistoryOperationUnsupported:
-      stream << "The server does not support the requested operation.";
-      break;
-
-    case StatusCode::BadInvalidTimestampArgument:
-      stream << "The defined timestamp to return was invalid.";
-      break;
-
-    case StatusCode::BadWriteNotSupported:
-      stream << "The server not does support writing the combination of value";
-      break;
-
-    case StatusCode::BadTypeMismatch:
-      stream << "The value supplied for the attribute is not of the same type as the attribute's value.";
-      break;
-
-    case StatusCode::BadMethodInvalid:
-      stream << "The method id does not refer to a method for the specified object.";
-      break;
-
-    case StatusCode::BadArgumentsMissing:
-      stream << "The client did not specify all of the input arguments for the method.";
-      break;
-
-    case StatusCode::BadTooManySubscriptions:
-      stream << "The server has reached its  maximum number of subscriptions.";
-      break;
-
-    case StatusCode::BadTooManyPublishRequests:
-      stream << "The server has reached the maximum number of queued publish requests.";
-      break;
-
-    case StatusCode::BadNoSubscription:
-      stream << "There is no subscription available for this session.";
-      break;
-
-    case StatusCode::BadSequenceNumberUnknown:
-      stream << "The sequence number is unknown to the server.";
-      break;
-
-    case StatusCode::BadMessageNotAvailable:
-      stream << "The requested notification message is no longer available.";
-      break;
-
-    case StatusCode::BadInsufficientClientProfile:
-      stream << "The Client of the current Session does not support one or more Profiles that are necessary for the Subscription.";
-      break;
-
-    case StatusCode::BadStateNotActive:
-      stream << "The sub-state machine is not currently active.";
-      break;
-
-    case StatusCode::BadTcpServerTooBusy:
-      stream << "The server cannot process the request because it is too busy.";
-      break;
-
-    case StatusCode::BadTcpMessageTypeInvalid:
-      stream << "The type of the message specified in the header invalid.";
-      break;
-
-    case StatusCode::BadTcpSecureChannelUnknown:
-      stream << "The SecureChannelId and/or TokenId are not currently in use.";
-      break;
-
-    case StatusCode::BadTcpMessageTooLarge:
-      stream << "The size of the message specified in the header is too large.";
-      break;
-
-    case StatusCode::BadTcpNotEnoughResources:
-      stream << "There are not enough resources to process the request.";
-      break;
-
-    case StatusCode::BadTcpInternalError:
-      stream << "An internal error occurred.";
-      break;
-
-    case StatusCode::BadTcpEndpointUrlInvalid:
-      stream << "The Server does not recognize the QueryString specified.";
-      break;
-
-    case StatusCode::BadRequestInterrupted:
-      stream << "The request could not be sent because of a network interruption.";
-      break;
-
-    case StatusCode::BadRequestTimeout:
-      stream << "Timeout occurred while processing the request.";
-      break;
-
-    case StatusCode::BadSecureChannelClosed:
-      stream << "The secure channel has been closed.";
-      break;
-
-    case StatusCode::BadSecureChannelTokenUnknown:
-      stream << "The token has expired or is not recognized.";
-      break;
-
-    case StatusCode::BadSequenceNumberInvalid:
-      stream << "The sequence number is not valid.";
-      break;
-
-    case StatusCode::BadProtocolVersionUnsupported:
-      stream << "The applications do not have compatible protocol versions.";
-      break;
-
-    case StatusCode::BadConfigurationError:
-      stream << "There is a problem with the configuration that affects the usefulness of the value.";
-      break;
-
-    case StatusCode::BadNotConnected:
-      stream << "The variable should receive its value from another variable";
-      break;
-
-    case StatusCode::BadDeviceFailure:
-      stream << "There has been a failure in the device/data source that generates the value that has affected the value.";
-      break;
-
-    case StatusCode::BadSensorFailure:
-      stream << "There has been a failure in the sensor from which the value is derived by the device/data source.";
-      break;
-
-    case StatusCode::BadOutOfService:
-      stream << "The source of the data is not operational.";
-      break;
-
-    case StatusCode::BadDeadbandFilterInvalid:
-      stream << "The deadband filter is not valid.";
-      break;
-
-    case StatusCode::UncertainNoCommunicationLastUsableValue:
-      stream << "Communication to the data source has failed. The variable value is the last value that had a good quality.";
-      break;
-
-    case StatusCode::UncertainLastUsableValue:
-      stream << "Whatever was updating this value has stopped doing so.";
-      break;
-
-    case StatusCode::UncertainSubstituteValue:
-      stream << "The value is an operational value that was manually overwritten.";
-      break;
-
-    case StatusCode::UncertainInitialValue:
-      stream << "The value is an initial value for a variable that normally receives its value from another variable.";
-      break;
-
-    case StatusCode::UncertainSensorNotAccurate:
-      stream << "The value is at one of the sensor limits.";
-      break;
-
-    case StatusCode::UncertainEngineeringUnitsExceeded:
-      stream << "The value is outside of the range of values defined for this parameter.";
-      break;
-
-    case StatusCode::UncertainSubNormal:
-      stream << "The value is derived from multiple sources and has less than the required number of Good sources.";
-      break;
-
-    case StatusCode::GoodLocalOverride:
-      stream << "The value has been overridden.";
-      break;
-
-    case StatusCode::BadRefreshInProgress:
-      stream << "This Condition refresh failed";
-      break;
-
-    case StatusCode::BadConditionAlreadyDisabled:
-      stream << "This condition has already been disabled.";
-      break;
-
-    case StatusCode::BadConditionAlreadyEnabled:
-      stream << "This condition has already been enabled.";
-      break;
-
-    case StatusCode::BadConditionDisabled:
-      stream << "Property not available";
-      break;
-
-    case StatusCode::BadEventIdUnknown:
-      stream << "The specified event id is not recognized.";
-      break;
-
-    case StatusCode::BadEventNotAcknowledgeable:
-      stream << "The event cannot be acknowledged.";
-      break;
-
-    case StatusCode::BadDialogNotActive:
-      stream << "The dialog condition is not active.";
-      break;
-
-    case StatusCode::BadDialogResponseInvalid:
-      stream << "The response is not valid for the dialog.";
-      break;
-
-    case StatusCode::BadConditionBranchAlreadyAcked:
-      stream << "The condition branch has already been acknowledged.";
-      break;
-
-    case StatusCode::BadConditionBranchAlreadyConfirmed:
-      stream << "The condition branch has already been confirmed.";
-      break;
-
-    case StatusCode::BadConditionAlreadyShelved:
-      stream << "The condition has already been shelved.";
-      break;
-
-    case StatusCode::BadConditionNotShelved:
-      stream << "The condition is not currently shelved.";
-      break;
-
-    case StatusCode::BadShelvingTimeOutOfRange:
-      stream << "The shelving time not within an acceptable range.";
-      break;
-
-    case StatusCode::BadNoData:
-      stream << "No data exists for the requested time range or event filter.";
-      break;
-
-    case StatusCode::BadBoundNotFound:
-      stream << "No data found to provide upper or lower bound value.";
-      break;
-
-    case StatusCode::BadBoundNotSupported:
-      stream << "The server cannot retrieve a bound for the variable.";
-      break;
-
-    case StatusCode::BadDataLost:
-      stream << "Data is missing due to collection started/stopped/lost.";
-      break;
-
-    case StatusCode::BadDataUnavailable:
-      stream << "Expected data is unavailable for the requested time range due to an un-mounted volume";
-      break;
-
-    case StatusCode::BadEntryExists:
-      stream << "The data or event was not successfully inserted because a matching entry exists.";
-      break;
-
-    case StatusCode::BadNoEntryExists:
-      stream << "The data or event was not successfully updated because no matching entry exists.";
-      break;
-
-    case StatusCode::BadTimestampNotSupported:
-      stream << "The client requested history using a timestamp format the server does not support (i.e requested ServerTimestamp when server only supports SourceTimestamp).";
-      break;
-
-    case StatusCode::GoodEntryInserted:
-      stream << "The data or event was successfully inserted into the historical database.";
-      break;
-
-    case StatusCode::GoodEntryReplaced:
-      stream << "The data or event field was successfully replaced in the historical database.";
-      break;
-
-    case StatusCode::UncertainDataSubNormal:
-      stream << "The value is derived from multiple values and has less than the required number of Good values.";
-      break;
-
-    case StatusCode::GoodNoData:
-      stream << "No data exists for the requested time range or event filter.";
-      break;
-
-    case StatusCode::GoodMoreData:
-      stream << "The data or event field was successfully replaced in the historical database.";
-      break;
-
-    case StatusCode::BadAggregateListMismatch:
-      stream << "The requested number of Aggregates does not match the requested number of NodeIds.";
-      break;
-
-    case StatusCode::BadAggregateNotSupported:
-      stream << "The requested Aggregate is not support by the server.";
-      break;
-
-    case StatusCode::BadAggregateInvalidInputs:
-      stream << "The aggregate value could not be derived due to invalid data inputs.";
-      break;
-
-    case StatusCode::BadAggregateConfigurationRejected:
-      stream << "The aggregate configuration is not valid for specified node.";
-      break;
-
-    case StatusCode::GoodDataIgnored:
-      stream << "The request pecifies fields which are not valid for the EventType or cannot be saved by the historian.";
-      break;
-
-    case StatusCode::GoodCommunicationEvent:
-      stream << "The communication layer has raised an event.";
-      break;
-
-    case StatusCode::GoodShutdownEvent:
-      stream << "The system is shutting down.";
-      break;
-
-    case StatusCode::GoodCallAgain:
-      stream << "The operation is not finished and needs to be called again.";
-      break;
-
-    case StatusCode::GoodNonCriticalTimeout:
-      stream << "A non-critical timeout occurred.";
-      break;
-
-    case StatusCode::BadInvalidArgument:
-      stream << "One or more arguments are invalid.";
-      break;
-
-    case StatusCode::BadConnectionRejected:
-      stream << "Could not establish a network connection to remote server.";
-      break;
-
-    case StatusCode::BadDisconnect:
-      stream << "The server has disconnected from the client.";
-      break;
-
-    case StatusCode::BadConnectionClosed:
-      stream << "The network connection has been closed.";
-      break;
-
-    case StatusCode::BadInvalidState:
-      stream << "The operation cannot be completed because the object is closed";
-      break;
+  uint32_t Value;
+  uint32_t Name;        // offset in StatusCodeStrings
+  uint32_t Description; // offset in StatusCodeStrings
+};
+
+const char StatusCodeStrings[] =
+  "Good\0"
+  "\0"
+  "BadUnexpectedError\0"
+  "An unexpected error occurred.\0"
+  "BadInternalError\0"
+  "An internal error occurred as a result of a programming or configuration error.\0"
+  "BadOutOfMemory\0"
+  "Not enough memory to complete the operation.\0"
+  "BadResourceUnavailable\0"
+  "An operating system resource is not available.\0"
+  "BadCommunicationError\0"
+  "A low level communication error occurred.\0"
+  "BadEncodingError\0"
+  "Encoding halted because of invalid data in the objects being serialized.\0"
+  "BadDecodingError\0"
+  "Decoding halted because of invalid data in the stream.\0"
+  "BadEncodingLimitsExceeded\0"
+  "The message encoding/decoding limits imposed by the stack have been exceeded.\0"
+  "BadRequestTooLarge\0"
+  "The request message size exceeds limits set by the server.\0"
+  "BadResponseTooLarge\0"
+  "The response message size exceeds limits set by the client.\0"
+  "BadUnknownResponse\0"
+  "An unrecognized response was received from the server.\0"
+  "BadTimeout\0"
+  "The operation timed out.\0"
+  "BadServiceUnsupported\0"
+  "The server does not support the requested service.\0"
+  "BadShutdown\0"
+  "The operation was cancelled because the application is shutting down.\0"
+  "BadServerNotConnected\0"
+  "The operation could not complete because the client is not connected to the server.\0"
+  "BadServerHalted\0"
+  "The server has stopped and cannot process any requests.\0"
+  "BadNothingToDo\0"
+  "There was nothing to do because the client passed a list of operations with no elements.\0"
+  "BadTooManyOperations\0"
+  "The request could not be processed because it specified too many operations.\0"
+  "BadTooManyMonitoredItems\0"
+  "The request could not be processed because there are too many monitored items in the subscription.\0"
+  "BadDataTypeIdUnknown\0"
+  "The extension object cannot be (de)serialized because the data type id is not recognized.\0"
+  "BadCertificateInvalid\0"
+  "The certificate provided as a parameter is not valid.\0"
+  "BadSecurityChecksFailed\0"
+  "An error occurred verifying security.\0"
+  "BadCertificateTimeInvalid\0"
+  "The Certificate has expired or is not yet valid.\0"
+  "BadCertificateIssuerTimeInvalid\0"
+  "An Issuer Certificate has expired or is not yet valid.\0"
+  "BadCertificateHostNameInvalid\0"
+  "The HostName used to connect to a Server does not match a HostName in the Certificate.\0"
+  "BadCertificateUriInvalid\0"
+  "The URI specified in the ApplicationDescription does not match the URI in the Certificate.\0"
+  "BadCertificateUseNotAllowed\0"
+  "The Certificate may not be used for the requested operation.\0"
+  "BadCertificateIssuerUseNotAllowed\0"
+  "The Issuer Certificate may not be used for the requested operation.\0"
+  "BadCertificateUntrusted\0"
+  "The Certificate is not trusted.\0"
+  "BadCertificateRevocationUnknown\0"
+  "It was not possible to determine if the Certificate has been revoked.\0"
+  "BadCertificateIssuerRevocationUnknown\0"
+  "It was not possible to determine if the Issuer Certificate has been revoked.\0"
+  "BadCertificateRevoked\0"
+  "The Certificate has been revoked.\0"
+  "BadCertificateIssuerRevoked\0"
+  "The Issuer Certificate has been revoked.\0"
+  "BadUserAccessDenied\0"
+  "User does not have permission to perform the requested operation.\0"
+  "BadIdentityTokenInvalid\0"
+  "The user identity token is not valid.\0"
+  "BadIdentityTokenRejected\0"
+  "The user identity token is valid but the server has rejected it.\0"
+  "BadSecureChannelIdInvalid\0"
+  "The specified secure channel is no longer valid.\0"
+  "BadInvalidTimestamp\0"
+  "The timestamp is outside the range allowed by the server.\0"
+  "BadNonceInvalid\0"
+  "The nonce does appear to be not a random value or it is not the correct length.\0"
+  "BadSessionIdInvalid\0"
+  "The session id is not valid.\0"
+  "BadSessionClosed\0"
+  "The session was closed by the client.\0"
+  "BadSessionNotActivated\0"
+  "The session cannot be used because ActivateSession has not been called.\0"
+  "BadSubscriptionIdInvalid\0"
+  "The subscription id is not valid.\0"
+  "BadRequestHeaderInvalid\0"
+  "The header for the request is missing or invalid.\0"
+  "BadTimestampsToReturnInvalid\0"
+  "The timestamps to return parameter is invalid.\0"
+  "BadRequestCancelledByClient\0"
+  "The request was cancelled by the client.\0"
+  "GoodSubscriptionTransferred\0"
+  "The subscription was transferred to another session.\0"
+  "GoodCompletesAsynchronously\0"
+  "The processing will complete asynchronously.\0"
+  "GoodOverload\0"
+  "Sampling has slowed down due to resource limitations.\0"
+  "GoodClamped\0"
+  "The value written was accepted but was clamped.\0"
+  "BadNoCommunication\0"
+  "Communication with the data source is defined\0"
+  "BadWaitingForInitialData\0"
+  "Waiting for the server to obtain values from the underlying data source.\0"
+  "BadNodeIdInvalid\0"
+  "The syntax of the node id is not valid.\0"
+  "BadNodeIdUnknown\0"
+  "The node id refers to a node that does not exist in the server address space.\0"
+  "BadAttributeIdInvalid\0"
+  "The attribute is not supported for the specified Node.\0"
+  "BadIndexRangeInvalid\0"
+  "The syntax of the index range parameter is invalid.\0"
+  "BadIndexRangeNoData\0"
+  "No data exists within the range of indexes specified.\0"
+  "BadDataEncodingInvalid\0"
+  "The data encoding is invalid.\0"
+  "BadDataEncodingUnsupported\0"
+  "The server does not support the requested data encoding for the node.\0"
+  "BadNotReadable\0"
+  "The access level does not allow reading or subscribing to the Node.\0"
+  "BadNotWritable\0"
+  "The access level does not allow writing to the Node.\0"
+  "BadOutOfRange\0"
+  "The value was out of range.\0"
+  "BadNotSupported\0"
+  "The requested operation is not supported.\0"
+  "BadNotFound\0"
+  "A requested item was not found or a search operation ended without success.\0"
+  "BadObjectDeleted\0"
+  "The object cannot be used because it has been deleted.\0"
+  "BadNotImplemented\0"
+  "Requested operation is not implemented.\0"
+  "BadMonitoringModeInvalid\0"
+  "The monitoring mode is invalid.\0"
+  "BadMonitoredItemIdInvalid\0"
+  "The monitoring item id does not refer to a valid monitored item.\0"
+  "BadMonitoredItemFilterInvalid\0"
+  "The monitored item filter parameter is not valid.\0"
+  "BadMonitoredItemFilterUnsupported\0"
+  "The server does not support the requested monitored item filter.\0"
+  "BadFilterNotAllowed\0"
+  "A monitoring filter cannot be used in combination with the attribute specified.\0"
+  "BadStructureMissing\0"
+  "A mandatory structured parameter was missing or null.\0"
+  "BadEventFilterInvalid\0"
+  "The event filter is not valid.\0"
+  "BadContentFilterInvalid\0"
+  "The content filter is not valid.\0"
+  "BadFilterOperatorInvalid\0"
+  "An unregognized operator was provided in a filter.\0"
+  "BadFilterOperatorUnsupported\0"
+  "A valid operator was provided\0"
+  "BadFilterOperandCountMismatch\0"
+  "The number of operands provided for the filter operator was less then expected for the operand provided.\0"
+  "BadFilterOperandInvalid\0"
+  "The operand used in a content filter is not valid.\0"
+  "BadFilterElementInvalid\0"
+  "The referenced element is not a valid element in the content filter.\0"
+  "BadFilterLiteralInvalid\0"
+  "The referenced literal is not a valid value.\0"
+  "BadContinuationPointInvalid\0"
+  "The continuation point provide is longer valid.\0"
+  "BadNoContinuationPoints\0"
+  "The operation could not be processed because all continuation points have been allocated.\0"
+  "BadReferenceTypeIdInvalid\0"
+  "The operation could not be processed because all continuation points have been allocated.\0"
+  "BadBrowseDirectionInvalid\0"
+  "The browse direction is not valid.\0"
+  "BadNodeNotInView\0"
+  "The node is not part of the view.\0"
+  "BadServerUriInvalid\0"
+  "The ServerUri is not a valid URI.\0"
+  "BadServerNameMissing\0"
+  "No ServerName was specified.\0"
+  "BadDiscoveryUrlMissing\0"
+  "No DiscoveryUrl was specified.\0"
+  "BadSempahoreFileMissing\0"
+  "The semaphore file specified by the client is not valid.\0"
+  "BadRequestTypeInvalid\0"
+  "The security token request type is not valid.\0"
+  "BadSecurityModeRejected\0"
+  "The security mode does not meet the requirements set by the Server.\0"
+  "BadSecurityPolicyRejected\0"
+  "The security policy does not meet the requirements set by the Server.\0"
+  "BadTooManySessions\0"
+  "The server has reached its maximum number of sessions.\0"
+  "BadUserSignatureInvalid\0"
+  "The user token signature is missing or invalid.\0"
+  "BadApplicationSignatureInvalid\0"
+  "The signature generated with the client certificate is missing or invalid.\0"
+  "BadNoValidCertificates\0"
+  "The client did not provide at least one software certificate that is valid and meets the profile requirements for the server.\0"
+  "BadIdentityChangeNotSupported\0"
+  "The Server does not support changing the user identity assigned to the session.\0"
+  "BadRequestCancelledByRequest\0"
+  "The request was cancelled by the client with the Cancel service.\0"
+  "BadParentNodeIdInvalid\0"
+  "The parent node id does not to refer to a valid node.\0"
+  "BadReferenceNotAllowed\0"
+  "The reference could not be created because it violates constraints imposed by the data model.\0"
+  "BadNodeIdRejected\0"
+  "The requested node id was reject because it was either invalid or server does not allow node ids to be specified by the client.\0"
+  "BadNodeIdExists\0"
+  "The requested node id is already used by another node.\0"
+  "BadNodeClassInvalid\0"
+  "The node class is not valid.\0"
+  "BadBrowseNameInvalid\0"
+  "The browse name is invalid.\0"
+  "BadBrowseNameDuplicated\0"
+  "The browse name is not unique among nodes that share the same relationship with the parent.\0"
+  "BadNodeAttributesInvalid\0"
+  "The node attributes are not valid for the node class.\0"
+  "BadTypeDefinitionInvalid\0"
+  "The type definition node id does not reference an appropriate type node.\0"
+  "BadSourceNodeIdInvalid\0"
+  "The source node id does not reference a valid node.\0"
+  "BadTargetNodeIdInvalid\0"
+  "The target node id does not reference a valid node.\0"
+  "BadDuplicateReferenceNotAllowed\0"
+  "The reference type between the nodes is already defined.\0"
+  "BadInvalidSelfReference\0"
+  "The server does not allow this type of self reference on this node.\0"
+  "BadReferenceLocalOnly\0"
+  "The reference type is not valid for a reference to a remote server.\0"
+  "BadNoDeleteRights\0"
+  "The server will not allow the node to be deleted.\0"
+  "UncertainReferenceNotDeleted\0"
+  "The server was not able to delete all target references.\0"
+  "BadServerIndexInvalid\0"
+  "The server index is not valid.\0"
+  "BadViewIdUnknown\0"
+  "The view id does not refer to a valid view node.\0"
+  "BadViewTimestampInvalid\0"
+  "The view timestamp is not available or not supported.\0"
+  "BadViewParameterMismatch\0"
+  "The view parameters are not consistent with each other.\0"
+  "BadViewVersionInvalid\0"
+  "The view version is not available or not supported.\0"
+  "UncertainNotAllNodesAvailable\0"
+  "The list of references may not be complete because the underlying system is not available.\0"
+  "GoodResultsMayBeIncomplete\0"
+  "The server should have followed a reference to a node in a remote server but did not. The result set may be incomplete.\0"
+  "BadNotTypeDefinition\0"
+  "The provided Nodeid was not a type definition nodeid.\0"
+  "UncertainReferenceOutOfServer\0"
+  "One of the references to follow in the relative path references to a node in the address space in another server.\0"
+  "BadTooManyMatches\0"
+  "The requested operation has too many matches to return.\0"
+  "BadQueryTooComplex\0"
+  "The requested operation requires too many resources in the server.\0"
+  "BadNoMatch\0"
+  "The requested operation has no match to return.\0"
+  "BadMaxAgeInvalid\0"
+  "The max age parameter is invalid.\0"
+  "BadHistoryOperationInvalid\0"
+  "The history details parameter is not valid.\0"
+  "BadHistoryOperationUnsupported\0"
+  "The server does not support the requested operation.\0"
+  "BadInvalidTimestampArgument\0"
+  "The defined timestamp to return was invalid.\0"
+  "BadWriteNotSupported\0"
+  "The server not does support writing the combination of value\0"
+  "BadTypeMismatch\0"
+  "The value supplied for the attribute is not of the same type as the attribute's value.\0"
+  "BadMethodInvalid\0"
+  "The method id does not refer to a method for the specified object.\0"
+  "BadArgumentsMissing\0"
+  "The client did not specify all of the input arguments for the method.\0"
+  "BadTooManySubscriptions\0"
+  "The server has reached its  maximum number of subscriptions.\0"
+  "BadTooManyPublishRequests\0"
+  "The server has reached the maximum number of queued publish requests.\0"
+  "BadNoSubscription\0"
+  "There is no subscription available for this session.\0"
+  "BadSequenceNumberUnknown\0"
+  "The sequence number is unknown to the server.\0"
+  "BadMessageNotAvailable\0"
+  "The requested notification message is no longer available.\0"
+  "BadInsufficientClientProfile\0"
+  "The Client of the current Session does not support one or more Profiles that are necessary for the Subscription.\0"
+  "BadStateNotActive\0"
+  "The sub-state machine is not currently active.\0"
+  "BadTcpServerTooBusy\0"
+  "The server cannot process the request because it is too busy.\0"
+  "BadTcpMessageTypeInvalid\0"
+  "The type of the message specified in the header invalid.\0"
+  "BadTcpSecureChannelUnknown\0"
+  "The SecureChannelId and/or TokenId are not currently in use.\0"
+  "BadTcpMessageTooLarge\0"
+  "The size of the message specified in the header is too large.\0"
+  "BadTcpNotEnoughResources\0"
+  "There are not enough resources to process the request.\0"
+  "BadTcpInternalError\0"
+  "An internal error occurred.\0"
+  "BadTcpEndpointUrlInvalid\0"
+  "The Server does not recognize the QueryString specified.\0"
+  "BadRequestInterrupted\0"
+  "The request could not be sent because of a network interruption.\0"
+  "BadRequestTimeout\0"
+  "Timeout occurred while processing the request.\0"
+  "BadSecureChannelClosed\0"
+  "The secure channel has been closed.\0"
+  "BadSecureChannelTokenUnknown\0"
+  "The token has expired or is not recognized.\0"
+  "BadSequenceNumberInvalid\0"
+  "The sequence number is not valid.\0"
+  "BadProtocolVersionUnsupported\0"
+  "The applications do not have compatible protocol versions.\0"
+  "BadConfigurationError\0"
+  "There is a problem with the configuration that affects the usefulness of the value.\0"
+  "BadNotConnected\0"
+  "The variable should receive its value from another variable\0"
+  "BadDeviceFailure\0"
+  "There has been a failure in the device/data source that generates the value that has affected the value.\0"
+  "BadSensorFailure\0"
+  "There has been a failure in the sensor from which the value is derived by the device/data source.\0"
+  "BadOutOfService\0"
+  "The source of the data is not operational.\0"
+  "BadDeadbandFilterInvalid\0"
+  "The deadband filter is not valid.\0"
+  "UncertainNoCommunicationLastUsableValue\0"
+  "Communication to the data source has failed. The variable value is the last value that had a good quality.\0"
+  "UncertainLastUsableValue\0"
+  "Whatever was updating this value has stopped doing so.\0"
+  "UncertainSubstituteValue\0"
+  "The value is an operational value that was manually overwritten.\0"
+  "UncertainInitialValue\0"
+  "The value is an initial value for a variable that normally receives its value from another variable.\0"
+  "UncertainSensorNotAccurate\0"
+  "The value is at one of the sensor limits.\0"
+  "UncertainEngineeringUnitsExceeded\0"
+  "The value is outside of the range of values defined for this parameter.\0"
+  "UncertainSubNormal\0"
+  "The value is derived from multiple sources and has less than the required number of Good sources.\0"
+  "GoodLocalOverride\0"
+  "The value has been overridden.\0"
+  "BadRefreshInProgress\0"
+  "This Condition refresh failed\0"
+  "BadConditionAlreadyDisabled\0"
+  "This condition has already been disabled.\0"
+  "BadConditionAlreadyEnabled\0"
+  "This condition has already been enabled.\0"
+  "BadConditionDisabled\0"
+  "Property not available\0"
+  "BadEventIdUnknown\0"
+  "The specified event id is not recognized.\0"
+  "BadEventNotAcknowledgeable\0"
+  "The event cannot be acknowledged.\0"
+  "BadDialogNotActive\0"
+  "The dialog condition is not active.\0"
+  "BadDialogResponseInvalid\0"
+  "The response is not valid for the dialog.\0"
+  "BadConditionBranchAlreadyAcked\0"
+  "The condition branch has already been acknowledged.\0"
+  "BadConditionBranchAlreadyConfirmed\0"
+  "The condition branch has already been confirmed.\0"
+  "BadConditionAlreadyShelved\0"
+  "The condition has already been shelved.\0"
+  "BadConditionNotShelved\0"
+  "The condition is not currently shelved.\0"
+  "BadShelvingTimeOutOfRange\0"
+  "The shelving time not within an acceptable range.\0"
+  "BadNoData\0"
+  "No data exists for the requested time range or event filter.\0"
+  "BadBoundNotFound\0"
+  "No data found to provide upper or lower bound value.\0"
+  "BadBoundNotSupported\0"
+  "The server cannot retrieve a bound for the variable.\0"
+  "BadDataLost\0"
+  "Data is missing due to collection started/stopped/lost.\0"
+  "BadDataUnavailable\0"
+  "Expected data is unavailable for the requested time range due to an un-mounted volume\0"
+  "BadEntryExists\0"
+  "The data or event was not successfully inserted because a matching entry exists.\0"
+  "BadNoEntryExists\0"
+  "The data or event was not successfully updated because no matching entry exists.\0"
+  "BadTimestampNotSupported\0"
+  "The client requested history using a timestamp format the server does not support (i.e requested ServerTimestamp when server only supports SourceTimestamp).\0"
+  "GoodEntryInserted\0"
+  "The data or event was successfully inserted into the historical database.\0"
+  "GoodEntryReplaced\0"
+  "The data or event field was successfully replaced in the historical database.\0"
+  "UncertainDataSubNormal\0"
+  "The value is derived from multiple values and has less than the required number of Good values.\0"
+  "GoodNoData\0"
+  "No data exists for the requested time range or event filter.\0"
+  "GoodMoreData\0"
+  "The data or event field was successfully replaced in the historical database.\0"
+  "BadAggregateListMismatch\0"
+  "The requested number of Aggregates does not match the requested number of NodeIds.\0"
+  "BadAggregateNotSupported\0"
+  "The requested Aggregate is not support by the server.\0"
+  "BadAggregateInvalidInputs\0"
+  "The aggregate value could not be derived due to invalid data inputs.\0"
+  "BadAggregateConfigurationRejected\0"
+  "The aggregate configuration is not valid for specified node.\0"
+  "GoodDataIgnored\0"
+  "The request pecifies fields which are not valid for the EventType or cannot be saved by the historian.\0"
+  "GoodCommunicationEvent\0"
+  "The communication layer has raised an event.\0"
+  "GoodShutdownEvent\0"
+  "The system is shutting down.\0"
+  "GoodCallAgain\0"
+  "The operation is not finished and needs to be called again.\0"
+  "GoodNonCriticalTimeout\0"
+  "A non-critical timeout occurred.\0"
+  "BadInvalidArgument\0"
+  "One or more arguments are invalid.\0"
+  "BadConnectionRejected\0"
+  "Could not establish a network connection to remote server.\0"
+  "BadDisconnect\0"
+  "The server has disconnected from the client.\0"
+  "BadConnectionClosed\0"
+  "The network connection has been closed.\0"
+  "BadInvalidState\0"
+  "The operation cannot be completed because the object is closed\0"
+  "BadEndOfStream\0"
+  "Cannot move beyond end of the stream.\0"
+  "BadNoDataAvailable\0"
+  "No data is currently available for reading from a non-blocking stream.\0"
+  "BadWaitingForResponse\0"
+  "The asynchronous operation is waiting for a response.\0"
+  "BadOperationAbandoned\0"
+  "The asynchronous operation was abandoned by the caller.\0"
+  "BadExpectedStreamToBlock\0"
+  "The stream did not return all data requested (possibly because it is a non-blocking stream).\0"
+  "BadWouldBlock\0"
+  "Non blocking behaviour is required and the operation would block.\0"
+  "BadSyntaxError\0"
+  "A value had an invalid syntax.\0"
+  "BadMaxConnectionsReached\0"
+  "The operation could not be finished because all available connections are in use.\0"
+  ;
+
+const StatusCodeEntry StatusCodeEntries[] =
+{
+  {0x00000000, 0, 5},
+  {0x80010000, 6, 25},
+  {0x80020000, 55, 72},
+  {0x80030000, 152, 167},
+  {0x80040000, 212, 235},
+  {0x80050000, 282, 304},
+  {0x80060000, 346, 363},
+  {0x80070000, 436, 453},
+  {0x80080000, 508, 534},
+  {0x80b80000, 612, 631},
+  {0x80b90000, 690, 710},
+  {0x80090000, 770, 789},
+  {0x800a0000, 844, 855},
+  {0x800b0000, 880, 902},
+  {0x800c0000, 953, 965},
+  {0x800d0000, 1035, 1057},
+  {0x800e0000, 1141, 1157},
+  {0x800f0000, 1213, 1228},
+  {0x80100000, 1317, 1338},
+  {0x80db0000, 1415, 1440},
+  {0x80110000, 1539, 1560},
+  {0x80120000, 1650, 1672},
+  {0x80130000, 1726, 1750},
+  {0x80140000, 1788, 1814},
+  {0x80150000, 1863, 1895},
+  {0x80160000, 1950, 1980},
+  {0x80170000, 2067, 2092},
+  {0x80180000, 2183, 2211},
+  {0x80190000, 2272, 2306},
+  {0x801a0000, 2374, 2398},
+  {0x801b0000, 2430, 2462},
+  {0x801c0000, 2532, 2570},
+  {0x801d0000, 2647, 2669},
+  {0x801e0000, 2703, 2731},
+  {0x801f0000, 2772, 2792},
+  {0x80200000, 2858, 2882},
+  {0x80210000, 2920, 2945},
+  {0x80220000, 3010, 3036},
+  {0x80230000, 3085, 3105},
+  {0x80240000, 3163, 3179},
+  {0x80250000, 3259, 3279},
+  {0x80260000, 3308, 3325},
+  {0x80270000, 3363, 3386},
+  {0x80280000, 3458, 3483},
+  {0x802a0000, 3517, 3541},
+  {0x802b0000, 3591, 3620},
+  {0x802c0000, 3667, 3695},
+  {0x002d0000, 3736, 3764},
+  {0x002e0000, 3817, 3845},
+  {0x002f0000, 3890, 3903},
+  {0x00300000, 3957, 3969},
+  {0x80310000, 4017, 4036},
+  {0x80320000, 4082, 4107},
+  {0x80330000, 4180, 4197},
+  {0x80340000, 4237, 4254},
+  {0x80350000, 4332, 4354},
+  {0x80360000, 4409, 4430},
+  {0x80370000, 4482, 4502},
+  {0x80380000, 4556, 4579},
+  {0x80390000, 4609, 4636},
+  {0x803a0000, 4706, 4721},
+  {0x803b0000, 4789, 4804},
+  {0x803c0000, 4857, 4871},
+  {0x803d0000, 4899, 4915},
+  {0x803e0000, 4957, 4969},
+  {0x803f0000, 5045, 5062},
+  {0x80400000, 5117, 5135},
+  {0x80410000, 5175, 5200},
+  {0x80420000, 5232, 5258},
+  {0x80430000, 5323, 5353},
+  {0x80440000, 5403, 5437},
+  {0x80450000, 5502, 5522},
+  {0x80460000, 5602, 5622},
+  {0x80470000, 5676, 5698},
+  {0x80480000, 5729, 5753},
+  {0x80c10000, 5786, 5811},
+  {0x80c20000, 5862, 5891},
+  {0x80c30000, 5921, 5951},
+  {0x80490000, 6056, 6080},
+  {0x80c40000, 6131, 6155},
+  {0x80c50000, 6224, 6248},
+  {0x804a0000, 6293, 6321},
+  {0x804b0000, 6369, 6393},
+  {0x804c0000, 6483, 6509},
+  {0x804d0000, 6599, 6625},
+  {0x804e0000, 6660, 6677},
+  {0x804f0000, 6711, 6731},
+  {0x80500000, 6765, 6786},
+  {0x80510000, 6815, 6838},
+  {0x80520000, 6869, 6893},
+  {0x80530000, 6950, 6972},
+  {0x80540000, 7018, 7042},
+  {0x80550000, 7110, 7136},
+  {0x80560000, 7206, 7225},
+  {0x80570000, 7280, 7304},
+  {0x80580000, 7352, 7383},
+  {0x80590000, 7458, 7481},
+  {0x80c60000, 7607, 7637},
+  {0x805a0000, 7717, 7746},
+  {0x805b0000, 7811, 7834},
+  {0x805c0000, 7888, 7911},
+  {0x805d0000, 8005, 8023},
+  {0x805e0000, 8151, 8167},
+  {0x805f0000, 8222, 8242},
+  {0x80600000, 8271, 8292},
+  {0x80610000, 8320, 8344},
+  {0x80620000, 8436, 8461},
+  {0x80630000, 8515, 8540},
+  {0x80640000, 8613, 8636},
+  {0x80650000, 8688, 8711},
+  {0x80660000, 8763, 8795},
+  {0x80670000, 8852, 8876},
+  {0x80680000, 8944, 8966},
+  {0x80690000, 9034, 9052},
+  {0x40bc0000, 9102, 9131},
+  {0x806a0000, 9188, 9210},
+  {0x806b0000, 9241, 9258},
+  {0x80c90000, 9307, 9331},
+  {0x80ca0000, 9385, 9410},
+  {0x80cb0000, 9466, 9488},
+  {0x40c00000, 9540, 9570},
+  {0x00ba0000, 9661, 9688},
+  {0x80c80000, 9808, 9829},
+  {0x406c0000, 9883, 9913},
+  {0x806d0000, 10027, 10045},
+  {0x806e0000, 10101, 10120},
+  {0x806f0000, 10187, 10198},
+  {0x80700000, 10246, 10263},
+  {0x80710000, 10297, 10324},
+  {0x80720000, 10368, 10399},
+  {0x80bd0000, 10452, 10480},
+  {0x80730000, 10525, 10546},
+  {0x80740000, 10607, 10623},
+  {0x80750000, 10710, 10727},
+  {0x80760000, 10794, 10814},
+  {0x80770000, 10884, 10908},
+  {0x80780000, 10969, 10995},
+  {0x80790000, 11065, 11083},
+  {0x807a0000, 11136, 11161},
+  {0x807b0000, 11207, 11230},
+  {0x807c0000, 11289, 11318},
+  {0x80bf0000, 11431, 11449},
+  {0x807d0000, 11496, 11516},
+  {0x807e0000, 11578, 11603},
+  {0x807f0000, 11660, 11687},
+  {0x80800000, 11748, 11770},
+  {0x80810000, 11832, 11857},
+  {0x80820000, 11912, 11932},
+  {0x80830000, 11960, 11985},
+  {0x80840000, 12042, 12064},
+  {0x80850000, 12129, 12147},
+  {0x80860000, 12194, 12217},
+  {0x80870000, 12253, 12282},
+  {0x80880000, 12326, 12351},
+  {0x80be0000, 12385, 12415},
+  {0x80890000, 12474, 12496},
+  {0x808a0000, 12580, 12596},
+  {0x808b0000, 12656, 12673},
+  {0x808c0000, 12778, 12795},
+  {0x808d0000, 12893, 12909},
+  {0x808e0000, 12952, 12977},
+  {0x408f0000, 13011, 13051},
+  {0x40900000, 13158, 13183},
+  {0x40910000, 13238, 13263},
+  {0x40920000, 13328, 13350},
+  {0x40930000, 13451, 13478},
+  {0x40940000, 13520, 13554},
+  {0x40950000, 13626, 13645},
+  {0x00960000, 13743, 13761},
+  {0x80970000, 13792, 13813},
+  {0x80980000, 13843, 13871},
+  {0x80cc0000, 13913, 13940},
+  {0x80990000, 13981, 14002},
+  {0x809a0000, 14025, 14043},
+  {0x80bb0000, 14085, 14112},
+  {0x80cd0000, 14146, 14165},
+  {0x80ce0000, 14201, 14226},
+  {0x80cf0000, 14268, 14299},
+  {0x80d00000, 14351, 14386},
+  {0x80d10000, 14435, 14462},
+  {0x80d20000, 14502, 14525},
+  {0x80d30000, 14565, 14591},
+  {0x809b0000, 14641, 14651},
+  {0x80d70000, 14712, 14729},
+  {0x80d80000, 14782, 14803},
+  {0x809d0000, 14856, 14868},
+  {0x809e0000, 14924, 14943},
+  {0x809f0000, 15029, 15044},
+  {0x80a00000, 15125, 15142},
+  {0x80a10000, 15223, 15248},
+  {0x00a20000, 15405, 15423},
+  {0x00a30000, 15497, 15515},
+  {0x40a40000, 15593, 15616},
+  {0x00a50000, 15712, 15723},
+  {0x00a60000, 15784, 15797},
+  {0x80d40000, 15875, 15900},
+  {0x80d50000, 15983, 16008},
+  {0x80d60000, 16062, 16088},
+  {0x80da0000, 16157, 16191},
+  {0x00d90000, 16252, 16268},
+  {0x00a70000, 16371, 16394},
+  {0x00a80000, 16439, 16457},
+  {0x00a90000, 16486, 16500},
+  {0x00aa0000, 16560, 16583},
+  {0x80ab0000, 16616, 16635},
+  {0x80ac0000, 16670, 16692},
+  {0x80ad0000, 16751, 16765},
+  {0x80ae0000, 16810, 16830},
+  {0x80af0000, 16870, 16886},
+  {0x80b00000, 16949, 16964},
+  {0x80b10000, 17002, 17021},
+  {0x80b20000, 17092, 17114},
+  {0x80b30000, 17168, 17190},
+  {0x80b40000, 17246, 17271},
+  {0x80b50000, 17364, 17378},
+  {0x80b60000, 17444, 17459},
+  {0x80b70000, 17490, 17515},
+};
+
+const uint16_t StatusCodeValueSeeds[] =
+{
+  19, 207, 14, 45, 4, 115, 3, 33, 3, 10, 11, 120, 2, 466, 6, 50,
+  14, 4, 1, 2, 73, 7, 13, 215, 39, 117, 43, 2, 46, 124, 96, 10,
+  429, 1, 277, 16, 206, 1, 141, 1, 183, 409, 257, 600, 141, 37, 327, 284,
+  31, 13, 6, 1123, 0, 300, 139,
+};
 
-    case StatusCode::BadEndOfStream:
-      stream << "Cannot move beyond end of the stream.";
-      break;
+const uint16_t StatusCodeValueSlots[] =
+{
+  97, 120, 158, 0, 9, 5, 65, 169, 91, 191, 190, 98, 95, 80, 16, 139,
+  11, 82, 44, 28, 152, 42, 150, 12, 73, 47, 200, 25, 119, 117, 132, 58,
+  124, 214, 107, 175, 160, 17, 51, 116, 201, 55, 209, 194, 67, 102, 77, 203,
+  193, 33, 13, 71, 100, 83, 186, 78, 7, 208, 202, 76, 159, 157, 6, 147,
+  129, 108, 144, 22, 45, 133, 206, 153, 148, 164, 155, 63, 43, 27, 165, 23,
+  136, 52, 93, 26, 110, 85, 122, 81, 143, 36, 31, 197, 205, 162, 140, 103,
+  92, 109, 125, 176, 123, 14, 213, 40, 182, 161, 131, 104, 4, 68, 75, 57,
+  137, 106, 192, 90, 185, 207, 53, 166, 8, 149, 174, 54, 86, 99, 94, 128,
+  56, 61, 37, 141, 70, 138, 111, 1, 89, 62, 24, 142, 211, 178, 179, 88,
+  3, 184, 154, 29, 130, 204, 167, 112, 32, 145, 126, 46, 48, 181, 19, 35,
+  163, 187, 87, 216, 196, 189, 212, 64, 195, 177, 180, 2, 15, 199, 101, 183,
+  215, 74, 59, 66, 79, 69, 146, 115, 118, 84, 168, 170, 188, 72, 30, 34,
+  20, 49, 210, 38, 173, 134, 198, 41, 96, 39, 151, 113, 121, 105, 172, 156,
+  21, 50, 127, 135, 171, 114, 60, 18, 10,
+};
+
+const uint16_t StatusCodeNameSeeds[] =
+{
+  2, 19, 2, 4, 23, 50, 37, 31, 7, 262, 9, 4, 55, 132, 10, 121,
+  1, 5, 1, 145, 5, 1, 4, 10, 14, 2, 97, 127, 119, 2, 40, 8,
+  55, 65, 2073, 307, 3, 156, 86, 6, 3, 9, 1026, 19, 189, 233, 1472, 73,
+  194, 59, 651, 11, 5499, 43, 7,
+};
 
-    case StatusCode::BadNoDataAvailable:
-      stream << "No data is currently available for reading from a non-blocking stream.";
-      break;
+const uint16_t StatusCodeNameSlots[] =
+{
+  138, 207, 186, 173, 64, 116, 104, 87, 200, 164, 115, 202, 156, 142, 113, 1,
+  194, 193, 58, 157, 216, 175, 50, 154, 204, 55, 127, 6, 141, 170, 74, 20,
+  133, 172, 63, 77, 197, 182, 128, 150, 26, 91, 68, 66, 191, 177, 121, 201,
+  78, 90, 180, 162, 54, 117, 126, 100, 190, 30, 57, 72, 187, 152, 65, 184,
+  83, 158, 195, 149, 134, 95, 211, 53, 110, 43, 2, 163, 29, 82, 86, 22,
+  5, 111, 102, 165, 137, 61, 9, 132, 37, 93, 112, 32, 40, 73, 171, 75,
+  70, 44, 181, 130, 14, 168, 106, 45, 203, 196, 3, 51, 10, 179, 213, 17,
+  145, 35, 96, 99, 108, 0, 8, 62, 140, 159, 16, 34, 94, 79, 15, 155,
+  28, 107, 4, 119, 166, 169, 189, 174, 109, 114, 38, 209, 80, 208, 101, 23,
+  212, 11, 97, 85, 214, 21, 185, 33, 69, 167, 59, 160, 205, 24, 84, 147,
+  118, 123, 49, 215, 120, 129, 124, 36, 46, 52, 56, 198, 176, 139, 19, 42,
+  48, 136, 92, 143, 25, 105, 7, 161, 81, 210, 89, 192, 76, 146, 153, 13,
+  71, 41, 27, 148, 18, 199, 183, 125, 188, 151, 103, 60, 122, 178, 131, 206,
+  67, 98, 144, 12, 88, 135, 39, 47, 31,
+};
+
+const StatusCodeEntry * FindStatusCode(OpcUa::StatusCode code)
+{
+  const uint32_t value = static_cast<uint32_t>(code);
+  const StatusCodeEntry & entry = StatusCodeEntries[OpcUa::PerfectHash::FindValue(StatusCodeValueSeeds, StatusCodeValueSlots, value)];
+  return entry.Value == value ? &entry : nullptr;
+}
 
-    case StatusCode::BadWaitingForResponse:
-      stream << "The asynchronous operation is waiting for a response.";
-      break;
+} // namespace
 
-    case StatusCode::BadOperationAbandoned:
-      stream << "The asynchronous operation was abandoned by the caller.";
-      break;
+namespace OpcUa
+{
 
-    case StatusCode::BadExpectedStreamToBlock:
-      stream << "The stream did not return all data requested (possibly because it is a non-blocking stream).";
-      break;
+const char * GetStatusCodeName(StatusCode code)
+{
+  const StatusCodeEntry * entry = FindStatusCode(code);
+  return entry ? StatusCodeStrings + entry->Name : nullptr;
+}
 
-    case StatusCode::BadWouldBlock:
-      stream << "Non blocking behaviour is required and the operation would block.";
-      break;
+StatusCode ToStatusCode(boost::string_view name)
+{
+  const StatusCodeEntry & entry = StatusCodeEntries[PerfectHash::FindName(StatusCodeNameSeeds, StatusCodeNameSlots, name)];
 
-    case StatusCode::BadSyntaxError:
-      stream << "A value had an invalid syntax.";
-      break;
+  if (!PerfectHash::IsName(name, StatusCodeStrings + entry.Name))
+    {
+      throw std::runtime_error("Unknown StatusCode name: '" + name.to_string() + "'");
+    }
 
-    case StatusCode::BadMaxConnectionsReached:
-      stream << "The operation could not be finished because all available connections are in use.";
-      break;
+  return static_cast<StatusCode>(entry.Value);
+}
 
-    default:
-      stream << "Unknown StatusCode?";
-      break;
+std::string ToString(const StatusCode & code)
+{
+  if (code == StatusCode::Good)
+    {
+      return std::string();
     }
 
+  const StatusCodeEntry * entry = FindStatusCode(code);
+  std::stringstream stream;
+  stream << (entry ? StatusCodeStrings + entry->Description : "Unknown StatusCode?");
   stream << " (0x" << std::setfill('0') << std::setw(8) << std::hex << (unsigned)code << ")";
 
   return stream.str();
@@ -84,6 +84,16 @@ void AddressSpaceAddon::UnregisterNodes(const std::vector<NodeId> & params) cons
   return Registry->UnregisterNodes(params);
 }
 
+QueryFirstResult AddressSpaceAddon::QueryFirst(const QueryFirstParameters & params) const
+{
+  return Registry->QueryFirst(params);
+}
+
+QueryNextResult AddressSpaceAddon::QueryNext(const QueryNextParameters & params) const
+{
+  return Registry->QueryNext(params);
+}
+
 std::vector<DataValue> AddressSpaceAddon::Read(const OpcUa::ReadParameters & filter) const
 {
   return Registry->Read(filter);
@@ -115,11 +125,56 @@ void AddressSpaceAddon::SetMethod(const NodeId & node, std::function<std::vector
   return;
 }
 
+void AddressSpaceAddon::SetAsyncMethod(const NodeId & node, std::function<Server::AsyncMethod> callback)
+{
+  Registry->SetAsyncMethod(node, callback);
+}
+
+void AddressSpaceAddon::EnableMethodPool(const Server::MethodPoolParameters & params)
+{
+  Registry->EnableMethodPool(params);
+}
+
+std::vector<StatusCode> AddressSpaceAddon::UpdateValues(const std::vector<Server::ValueUpdate> & updates)
+{
+  return Registry->UpdateValues(updates);
+}
+
+std::vector<StatusCode> AddressSpaceAddon::UpdateValues(const std::vector<Server::HandleValueUpdate> & updates)
+{
+  return Registry->UpdateValues(updates);
+}
+
+uint32_t AddressSpaceAddon::GetValueHandle(const NodeId & node) const
+{
+  return Registry->GetValueHandle(node);
+}
+
+StatusCode AddressSpaceAddon::EnableEncodedValueCache(const NodeId & node, bool enable)
+{
+  return Registry->EnableEncodedValueCache(node, enable);
+}
+
+std::vector<Server::EncodedDataValue> AddressSpaceAddon::ReadEncoded(const ReadParameters & params) const
+{
+  return Registry->ReadEncoded(params);
+}
+
+std::vector<Server::EncodedBrowseResult> AddressSpaceAddon::BrowseEncoded(const NodesQuery & query) const
+{
+  return Registry->BrowseEncoded(query);
+}
+
 std::vector<CallMethodResult> AddressSpaceAddon::Call(const std::vector<CallMethodRequest> & methodsToCall)
 {
   return Registry->Call(methodsToCall);
 }
 
+void AddressSpaceAddon::CallAsync(const std::vector<CallMethodRequest> & methodsToCall, std::function<CallCompletion> done)
+{
+  Registry->CallAsync(methodsToCall, done);
+}
+
 
 } // namespace Internal
 } // namespace OpcUa
@@ -47,6 +47,8 @@ public: // ViewServices
   virtual std::vector<BrowsePathResult> TranslateBrowsePathsToNodeIds(const TranslateBrowsePathsParameters & params) const;
   virtual std::vector<NodeId> RegisterNodes(const std::vector<NodeId> & params) const;
   virtual void UnregisterNodes(const std::vector<NodeId> & params) const;
+  virtual QueryFirstResult QueryFirst(const QueryFirstParameters & params) const;
+  virtual QueryNextResult QueryNext(const QueryNextParameters & params) const;
 
 public: // AttribueServices
   virtual std::vector<DataValue> Read(const OpcUa::ReadParameters & filter) const;
@@ -54,12 +56,21 @@ public: // AttribueServices
 
 public: // MethodServices
   virtual std::vector<CallMethodResult> Call(const std::vector<CallMethodRequest> & methodsToCall);
+  virtual void CallAsync(const std::vector<CallMethodRequest> & methodsToCall, std::function<CallCompletion> done);
 
 public: // Server internal methods
   virtual uint32_t AddDataChangeCallback(const NodeId & node, AttributeId attribute, std::function<Server::DataChangeCallback> callback);
   virtual void DeleteDataChangeCallback(uint32_t clienthandle);
   virtual StatusCode SetValueCallback(const NodeId & node, AttributeId attribute, std::function<DataValue(void)> callback);
   virtual void SetMethod(const NodeId & node, std::function<std::vector<OpcUa::Variant> (NodeId context, std::vector<OpcUa::Variant> arguments)> callback);
+  virtual void SetAsyncMethod(const NodeId & node, std::function<Server::AsyncMethod> callback);
+  virtual void EnableMethodPool(const Server::MethodPoolParameters & params);
+  virtual std::vector<StatusCode> UpdateValues(const std::vector<Server::ValueUpdate> & updates);
+  virtual std::vector<StatusCode> UpdateValues(const std::vector<Server::HandleValueUpdate> & updates);
+  virtual uint32_t GetValueHandle(const NodeId & node) const;
+  virtual StatusCode EnableEncodedValueCache(const NodeId & node, bool enable);
+  virtual std::vector<Server::EncodedDataValue> ReadEncoded(const ReadParameters & params) const;
+  virtual std::vector<Server::EncodedBrowseResult> BrowseEncoded(const NodesQuery & query) const;
 
 private:
   Common::Logger::SharedPtr Logger;
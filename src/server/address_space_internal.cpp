@@ -9,7 +9,11 @@
 ///
 
 #include "address_space_internal.h"
+#include "encoded_responses.h"
 
+#include <algorithm>
+#include <iterator>
+#include <random>
 
 namespace OpcUa
 {
@@ -25,10 +29,85 @@ struct AttSubscription
   MonitoringParameters Parameters;
 };
 
+namespace
+{
+// the value of a name attribute is the pooled name of the node
+bool IsPooledName(const AttributeValue & attribute)
+{
+  return !attribute.GetValueCallback && attribute.Value.Status == StatusCode::Good && attribute.Value.Value.IsNul();
+}
+
+// data sets returned at once when the client does not limit them
+const uint32_t MaxQueryDataSets = 1000;
+// queries continued at once by all sessions, the oldest is released first.
+// The session layer limits the queries of one session.
+const std::size_t MaxQueryContinuationPoints = 4096;
+// random bytes of a continuation point, other sessions can not guess it
+const std::size_t QueryContinuationPointSize = 16;
+// cached Browse results, the least recently used is evicted first
+const std::size_t MaxBrowseCacheSize = 65536;
+// cached shapes of BrowseDescription of one node, the least recently used is replaced first
+const std::size_t MaxBrowseShapesPerNode = 4;
+
+std::vector<uint8_t> GenerateContinuationPoint()
+{
+  std::random_device random;
+  std::vector<uint8_t> point(QueryContinuationPointSize);
+
+  for (uint8_t & byte : point)
+    {
+      byte = static_cast<uint8_t>(random());
+    }
+
+  return point;
+}
+
+// Browse results are cached only for nodes of the standard address space and
+// for types, which rarely change. Results of instances created by the
+// application are invalidated too often to be worth the encoding.
+bool IsStaticNode(const NodesMap::value_type & node)
+{
+  if (node.first.GetNamespaceIndex() == 0)
+    {
+      return true;
+    }
+
+  const auto class_it = node.second.Attributes.find(AttributeId::NodeClass);
+
+  if (class_it == node.second.Attributes.end())
+    {
+      return false;
+    }
+
+  const Variant & nodeClass = class_it->second.Value.Value;
+  return nodeClass == static_cast<int32_t>(NodeClass::ObjectType) || nodeClass == static_cast<int32_t>(NodeClass::VariableType)
+         || nodeClass == static_cast<int32_t>(NodeClass::ReferenceType) || nodeClass == static_cast<int32_t>(NodeClass::DataType);
+}
+
+// result of a cached Browse, only its encoding when the caller just serializes it
+Server::EncodedBrowseResult CopyBrowseResult(const Server::EncodedBrowseResult & cached, bool encodedOnly)
+{
+  Server::EncodedBrowseResult result;
+
+  if (!encodedOnly)
+    {
+      result.Result = cached.Result;
+      return result;
+    }
+
+  result.Result.Status = cached.Result.Status;
+  result.Result.ContinuationPoint = cached.Result.ContinuationPoint;
+  result.EncodedReferences = cached.EncodedReferences;
+  return result;
+}
+}
+
 AddressSpaceInMemory::AddressSpaceInMemory(const Common::Logger::SharedPtr & logger)
   : Logger(logger)
   , DataChangeCallbackHandle(0)
 {
+  // index 0 is looked up to find type definitions of targets
+  GetReferenceTypeIndex(ObjectId::HasTypeDefinition);
   /*
   ObjectAttributes attrs;
   attrs.Description = LocalizedText(OpcUa::Names::Root);
@@ -92,14 +171,35 @@ std::vector<BrowsePathResult> AddressSpaceInMemory::TranslateBrowsePathsToNodeId
 }
 
 std::vector<BrowseResult> AddressSpaceInMemory::Browse(const OpcUa::NodesQuery & query) const
+{
+  std::vector<Server::EncodedBrowseResult> encoded = BrowseNodes(query, false);
+
+  std::vector<BrowseResult> results;
+  results.reserve(encoded.size());
+
+  for (Server::EncodedBrowseResult & result : encoded)
+    {
+      results.push_back(std::move(result.Result));
+    }
+
+  return results;
+}
+
+std::vector<Server::EncodedBrowseResult> AddressSpaceInMemory::BrowseEncoded(const NodesQuery & query) const
+{
+  return BrowseNodes(query, true);
+}
+
+std::vector<Server::EncodedBrowseResult> AddressSpaceInMemory::BrowseNodes(const NodesQuery & query, bool encodedOnly) const
 {
   boost::shared_lock<boost::shared_mutex> lock(DbMutex);
 
   LOG_TRACE(Logger, "address_space_internal| browse");
 
-  std::vector<BrowseResult> results;
+  std::vector<Server::EncodedBrowseResult> results;
+  results.reserve(query.NodesToBrowse.size());
 
-  for (BrowseDescription browseDescription : query.NodesToBrowse)
+  for (const BrowseDescription & browseDescription : query.NodesToBrowse)
     {
       BrowseResult result;
 
@@ -122,15 +222,153 @@ std::vector<BrowseResult> AddressSpaceInMemory::Browse(const OpcUa::NodesQuery &
           continue;
         }
 
-      std::copy_if(node_it->second.References.begin(), node_it->second.References.end(), std::back_inserter(result.Referencies),
-                   std::bind(&AddressSpaceInMemory::IsSuitableReference, this, std::cref(browseDescription), std::placeholders::_1)
-                  );
-      results.push_back(result);
+      results.push_back(BrowseNode(*node_it, browseDescription, encodedOnly));
     }
 
   return results;
 }
 
+Server::EncodedBrowseResult AddressSpaceInMemory::BrowseNode(const NodesMap::value_type & node, const BrowseDescription & desc, bool encodedOnly) const
+{
+  const uint32_t handle = node.second.Handle;
+  const bool cacheable = IsStaticNode(node);
+
+  if (cacheable)
+    {
+      const std::shared_ptr<const Server::EncodedBrowseResult> cached = FindBrowseResult(handle, desc);
+
+      if (cached)
+        {
+          return CopyBrowseResult(*cached, encodedOnly);
+        }
+    }
+
+  Server::EncodedBrowseResult result;
+  const std::vector<bool> referenceTypes = SelectReferenceTypes(desc.ReferenceTypeId, desc.IncludeSubtypes);
+
+  for (const CompactReference & reference : node.second.References)
+    {
+      if (IsSuitableReference(desc, referenceTypes, reference))
+        {
+          result.Result.Referencies.push_back(MakeReferenceDescription(reference, desc.ResultMask));
+        }
+    }
+
+  if (!cacheable)
+    {
+      return result;
+    }
+
+  // the encoding replaces the one of the serializer and is reused by later hits
+  result.EncodedReferences = Server::EncodeReferences(result.Result.Referencies);
+  const std::shared_ptr<const Server::EncodedBrowseResult> stored = StoreBrowseResult(handle, desc, std::make_shared<const Server::EncodedBrowseResult>(std::move(result)));
+  return CopyBrowseResult(*stored, encodedOnly);
+}
+
+std::shared_ptr<const Server::EncodedBrowseResult> AddressSpaceInMemory::FindBrowseResult(uint32_t node, const BrowseDescription & desc) const
+{
+  std::lock_guard<std::mutex> lock(BrowseCacheMutex);
+
+  const auto cache_it = BrowseCache.find(node);
+
+  if (cache_it == BrowseCache.end())
+    {
+      return std::shared_ptr<const Server::EncodedBrowseResult>();
+    }
+
+  std::vector<BrowseCacheList::iterator> & shapes = cache_it->second;
+
+  for (auto shape_it = shapes.begin(); shape_it != shapes.end(); ++shape_it)
+    {
+      const BrowseCacheList::iterator entry = *shape_it;
+
+      if (entry->Matches(desc))
+        {
+          BrowseCacheOrder.splice(BrowseCacheOrder.begin(), BrowseCacheOrder, entry);
+          shapes.erase(shape_it);
+          shapes.push_back(entry);
+          return entry->Result;
+        }
+    }
+
+  return std::shared_ptr<const Server::EncodedBrowseResult>();
+}
+
+std::shared_ptr<const Server::EncodedBrowseResult> AddressSpaceInMemory::StoreBrowseResult(uint32_t node, const BrowseDescription & desc, std::shared_ptr<const Server::EncodedBrowseResult> result) const
+{
+  std::lock_guard<std::mutex> lock(BrowseCacheMutex);
+
+  std::vector<BrowseCacheList::iterator> & shapes = BrowseCache[node];
+
+  // another reader may have stored the same result meanwhile
+  for (const BrowseCacheList::iterator & entry : shapes)
+    {
+      if (entry->Matches(desc))
+        {
+          return entry->Result;
+        }
+    }
+
+  if (shapes.size() >= MaxBrowseShapesPerNode)
+    {
+      BrowseCacheOrder.erase(shapes.front());
+      shapes.erase(shapes.begin());
+    }
+
+  CachedBrowse cached;
+  cached.Node = node;
+  cached.ReferenceTypeId = desc.ReferenceTypeId;
+  cached.Direction = desc.Direction;
+  cached.IncludeSubtypes = desc.IncludeSubtypes;
+  cached.NodeClasses = desc.NodeClasses;
+  cached.ResultMask = desc.ResultMask;
+  cached.Result = std::move(result);
+  BrowseCacheOrder.push_front(std::move(cached));
+  shapes.push_back(BrowseCacheOrder.begin());
+
+  // evict the least recently used result of any node
+  if (BrowseCacheOrder.size() > MaxBrowseCacheSize)
+    {
+      const BrowseCacheList::iterator oldest = std::prev(BrowseCacheOrder.end());
+      std::vector<BrowseCacheList::iterator> & oldestShapes = BrowseCache[oldest->Node];
+      oldestShapes.erase(std::find(oldestShapes.begin(), oldestShapes.end(), oldest));
+
+      if (oldestShapes.empty())
+        {
+          BrowseCache.erase(oldest->Node);
+        }
+
+      BrowseCacheOrder.erase(oldest);
+    }
+
+  return BrowseCacheOrder.front().Result;
+}
+
+void AddressSpaceInMemory::InvalidateBrowseCache(uint32_t node)
+{
+  std::lock_guard<std::mutex> lock(BrowseCacheMutex);
+
+  const auto cache_it = BrowseCache.find(node);
+
+  if (cache_it != BrowseCache.end())
+    {
+      for (const BrowseCacheList::iterator & entry : cache_it->second)
+        {
+          BrowseCacheOrder.erase(entry);
+        }
+
+      BrowseCache.erase(cache_it);
+    }
+}
+
+void AddressSpaceInMemory::ClearBrowseCache()
+{
+  std::lock_guard<std::mutex> lock(BrowseCacheMutex);
+
+  BrowseCache.clear();
+  BrowseCacheOrder.clear();
+}
+
 std::vector<BrowseResult> AddressSpaceInMemory::BrowseNext() const
 {
   boost::shared_lock<boost::shared_mutex> lock(DbMutex);
@@ -152,11 +390,133 @@ void AddressSpaceInMemory::UnregisterNodes(const std::vector<NodeId> & params) c
   return;
 }
 
+QueryFirstResult AddressSpaceInMemory::QueryFirst(const QueryFirstParameters & params) const
+{
+  QueryFirstResult result;
+
+  if (params.NodeTypes.empty())
+    {
+      result.Status = StatusCode::BadNothingToDo;
+      return result;
+    }
+
+  if (CheckContentFilter(params.Filter, result.FilterResult) != StatusCode::Good)
+    {
+      result.Status = StatusCode::BadContentFilterInvalid;
+      return result;
+    }
+
+  // element results are only returned for an invalid filter
+  result.FilterResult.ElementResults.clear();
+
+  boost::shared_lock<boost::shared_mutex> lock(DbMutex);
+
+  QueryState state;
+  state.Params = params;
+  std::set<uint32_t> selected;
+  bool parsingFailed = false;
+
+  for (std::size_t index = 0; index < params.NodeTypes.size(); ++index)
+    {
+      ParsingResult parsing;
+      NodesMap::const_iterator type_it = Nodes.find(params.NodeTypes[index].TypeDefinitionNode);
+
+      if (type_it == Nodes.end())
+        {
+          parsing.Status = StatusCode::BadNodeIdUnknown;
+          parsingFailed = true;
+          result.ParsingResults.push_back(parsing);
+          continue;
+        }
+
+      std::vector<uint32_t> types(1, type_it->second.Handle);
+
+      if (params.NodeTypes[index].IncludeSubtypes)
+        {
+          SelectSubtypes(types);
+        }
+
+      for (uint32_t type : types)
+        {
+          const auto instances_it = TypeInstances.find(type);
+
+          if (instances_it == TypeInstances.end())
+            {
+              continue;
+            }
+
+          for (uint32_t node : instances_it->second)
+            {
+              // a node selected by several node types is returned once
+              if (selected.insert(node).second)
+                {
+                  state.Candidates.push_back(QueryCandidate{node, type, index});
+                }
+            }
+        }
+
+      result.ParsingResults.push_back(parsing);
+    }
+
+  if (!parsingFailed)
+    {
+      result.ParsingResults.clear();
+    }
+
+  result.QueryDataSets = RunQuery(state);
+
+  if (state.Next < state.Candidates.size())
+    {
+      result.ContinuationPoint = StoreQuery(std::move(state));
+    }
+
+  return result;
+}
+
+QueryNextResult AddressSpaceInMemory::QueryNext(const QueryNextParameters & params) const
+{
+  QueryNextResult result;
+  QueryState state;
+
+  {
+    std::lock_guard<std::mutex> lock(QueryMutex);
+    auto query_it = Queries.find(params.ContinuationPoint);
+
+    if (query_it == Queries.end())
+      {
+        result.Status = StatusCode::BadContinuationPointInvalid;
+        return result;
+      }
+
+    state = std::move(query_it->second);
+    QueryOrder.erase(state.Order);
+    Queries.erase(query_it);
+  }
+
+  if (params.ReleaseContinuationPoint)
+    {
+      return result;
+    }
+
+  {
+    boost::shared_lock<boost::shared_mutex> lock(DbMutex);
+    result.QueryDataSets = RunQuery(state);
+  }
+
+  if (state.Next < state.Candidates.size())
+    {
+      result.RevisedContinuationPoint = StoreQuery(std::move(state));
+    }
+
+  return result;
+}
+
 std::vector<DataValue> AddressSpaceInMemory::Read(const ReadParameters & params) const
 {
   boost::shared_lock<boost::shared_mutex> lock(DbMutex);
 
   std::vector<DataValue> values;
+  values.reserve(params.AttributesToRead.size());
 
   for (const ReadValueId & attribute : params.AttributesToRead)
     {
@@ -166,13 +526,29 @@ std::vector<DataValue> AddressSpaceInMemory::Read(const ReadParameters & params)
   return values;
 }
 
+std::vector<Server::EncodedDataValue> AddressSpaceInMemory::ReadEncoded(const ReadParameters & params) const
+{
+  boost::shared_lock<boost::shared_mutex> lock(DbMutex);
+
+  std::vector<Server::EncodedDataValue> values(params.AttributesToRead.size());
+
+  for (std::size_t i = 0; i < values.size(); ++i)
+    {
+      const ReadValueId & attribute = params.AttributesToRead[i];
+      values[i].Value = GetValue(attribute.NodeId, attribute.AttributeId, &values[i].EncodedVariant);
+    }
+
+  return values;
+}
+
 std::vector<StatusCode> AddressSpaceInMemory::Write(const std::vector<OpcUa::WriteValue> & values)
 {
   boost::unique_lock<boost::shared_mutex> lock(DbMutex);
 
   std::vector<StatusCode> statuses;
+  statuses.reserve(values.size());
 
-  for (WriteValue value : values)
+  for (const WriteValue & value : values)
     {
       if (value.Value.Encoding & DATA_VALUE)
         {
@@ -186,18 +562,29 @@ std::vector<StatusCode> AddressSpaceInMemory::Write(const std::vector<OpcUa::Wri
   return statuses;
 }
 
-std::tuple<bool, NodeId> AddressSpaceInMemory::FindElementInNode(const NodeId & nodeid, const RelativePathElement & element) const
+std::tuple<bool, NodeId> AddressSpaceInMemory::FindElementInNode(const NodeId & nodeid, const QualifiedName & name, const InternedName * pooledName) const
 {
   NodesMap::const_iterator nodeit = Nodes.find(nodeid);
 
   if (nodeit != Nodes.end())
     {
-      for (auto reference : nodeit->second.References)
+      for (const CompactReference & reference : nodeit->second.References)
         {
-          //if (reference.first == current) { std::cout <<   reference.second.BrowseName.NamespaceIndex << reference.second.BrowseName.Name << " to " << element.TargetName.NamespaceIndex << element.TargetName.Name <<std::endl; }
-          if (reference.BrowseName == element.TargetName)
+          const NodesMap::value_type & target = *NodeHandles[reference.Target];
+          const auto attr_it = target.second.Attributes.find(AttributeId::BrowseName);
+
+          if (attr_it != target.second.Attributes.end() && IsPooledName(attr_it->second))
+            {
+              // a name which is not in the pool is the name of no pooled node
+              if (pooledName && target.second.BrowseName == *pooledName)
+                {
+                  return std::make_tuple(true, target.first);
+                }
+            }
+
+          else if (GetBrowseName(target) == name)
             {
-              return std::make_tuple(true, reference.TargetNodeId);
+              return std::make_tuple(true, target.first);
             }
         }
     }
@@ -210,9 +597,11 @@ BrowsePathResult AddressSpaceInMemory::TranslateBrowsePath(const BrowsePath & br
   NodeId current = browsepath.StartingNode;
   BrowsePathResult result;
 
-  for (RelativePathElement element : browsepath.Path.Elements)
+  for (const RelativePathElement & element : browsepath.Path.Elements)
     {
-      auto res = FindElementInNode(current, element);
+      InternedName name;
+      const bool pooled = Names.Find(element.TargetName, name);
+      auto res = FindElementInNode(current, element.TargetName, pooled ? &name : nullptr);
 
       if (std::get<0>(res) == false)
         {
@@ -233,7 +622,7 @@ BrowsePathResult AddressSpaceInMemory::TranslateBrowsePath(const BrowsePath & br
   return result;
 }
 
-DataValue AddressSpaceInMemory::GetValue(const NodeId & node, AttributeId attribute) const
+DataValue AddressSpaceInMemory::GetValue(const NodeId & node, AttributeId attribute, Server::EncodedData * encoded) const
 {
   NodesMap::const_iterator nodeit = Nodes.find(node);
 
@@ -262,6 +651,25 @@ DataValue AddressSpaceInMemory::GetValue(const NodeId & node, AttributeId attrib
 
 //          LOG_TRACE(Logger, "address_space_internal| no callback registered, returning stored value");
 
+          if (attribute == AttributeId::BrowseName && IsPooledName(attrit->second))
+            {
+              DataValue value = attrit->second.Value;
+              value.Value = nodeit->second.BrowseName.ToQualifiedName();
+              return value;
+            }
+
+          if (attribute == AttributeId::DisplayName && IsPooledName(attrit->second))
+            {
+              DataValue value = attrit->second.Value;
+              value.Value = nodeit->second.DisplayName.ToLocalizedText();
+              return value;
+            }
+
+          if (encoded)
+            {
+              *encoded = attrit->second.EncodedValue;
+            }
+
           return attrit->second.Value;
         }
     }
@@ -272,59 +680,173 @@ DataValue AddressSpaceInMemory::GetValue(const NodeId & node, AttributeId attrib
   return value;
 }
 
-uint32_t AddressSpaceInMemory::AddDataChangeCallback(const NodeId & node, AttributeId attribute, std::function<Server::DataChangeCallback> callback)
+void AddressSpaceInMemory::SelectSubtypes(std::vector<uint32_t> & types) const
 {
-  boost::unique_lock<boost::shared_mutex> lock(DbMutex);
-
-  LOG_DEBUG(Logger, "address_space_internal| set data changes callback for node {} and attribute {}", node, (unsigned)attribute);
+  const auto index_it = ReferenceTypeIndexes.find(ObjectId::HasSubtype);
 
-  NodesMap::iterator it = Nodes.find(node);
+  if (index_it == ReferenceTypeIndexes.end())
+    {
+      return;
+    }
 
-  if (it == Nodes.end())
+  // types grows while the hierarchy is walked
+  for (std::size_t i = 0; i < types.size(); ++i)
     {
-      LOG_ERROR(Logger, "address_space_internal| Node: '{}' not found", node);
-      throw std::runtime_error("address_space_internal| NodeId not found");
+      for (const CompactReference & reference : NodeHandles[types[i]]->second.References)
+        {
+          if (reference.IsForward && reference.ReferenceType == index_it->second && std::find(types.begin(), types.end(), reference.Target) == types.end())
+            {
+              types.push_back(reference.Target);
+            }
+        }
     }
+}
 
-  AttributesMap::iterator ait = it->second.Attributes.find(attribute);
+std::vector<QueryDataSet> AddressSpaceInMemory::RunQuery(QueryState & state) const
+{
+  const uint32_t maxDataSets = state.Params.MaxDataSetsToReturn && state.Params.MaxDataSetsToReturn < MaxQueryDataSets ? state.Params.MaxDataSetsToReturn : MaxQueryDataSets;
+  std::vector<QueryDataSet> dataSets;
 
-  if (ait == it->second.Attributes.end())
+  while (state.Next < state.Candidates.size() && dataSets.size() < maxDataSets)
     {
-      LOG_ERROR(Logger, "address_space_internal| Attribute: {} of node: ‘{}‘ not found", (unsigned)attribute, node);
-      throw std::runtime_error("Attribute not found");
+      const QueryCandidate & candidate = state.Candidates[state.Next++];
+      const NodeId & node = NodeHandles[candidate.Node]->first;
+      const FilterOperandReader read = [this, &node](const FilterOperand & operand)
+      {
+        return ReadOperand(node, operand);
+      };
+
+      if (!EvaluateContentFilter(state.Params.Filter, read))
+        {
+          continue;
+        }
+
+      QueryDataSet dataSet;
+      dataSet.Node = node;
+      dataSet.TypeDefinitionNode = NodeHandles[candidate.Type]->first;
+
+      for (const QueryDataDescription & data : state.Params.NodeTypes[candidate.NodeType].DataToReturn)
+        {
+          dataSet.Values.push_back(ReadPath(node, data.Path, data.Attribute));
+        }
+
+      dataSets.push_back(std::move(dataSet));
     }
 
-  uint32_t handle = ++DataChangeCallbackHandle;
-  DataChangeCallbackData data;
-  data.Callback = callback;
-  ait->second.DataChangeCallbacks[handle] = data;
-  ClientIdToAttributeMap[handle] = NodeAttribute(node, attribute);
-  return handle;
+  return dataSets;
 }
 
-void AddressSpaceInMemory::DeleteDataChangeCallback(uint32_t serverhandle)
+Variant AddressSpaceInMemory::ReadPath(const NodeId & node, const RelativePath & path, AttributeId attribute) const
 {
-  boost::unique_lock<boost::shared_mutex> lock(DbMutex);
-
-  LOG_DEBUG(Logger, "address_space_internal| deleting callback with client id: {}", serverhandle);
+  BrowsePath browsePath;
+  browsePath.StartingNode = node;
+  browsePath.Path = path;
+  const BrowsePathResult target = TranslateBrowsePath(browsePath);
 
-  ClientIdToAttributeMapType::iterator it = ClientIdToAttributeMap.find(serverhandle);
-
-  if (it == ClientIdToAttributeMap.end())
+  if (target.Status != StatusCode::Good)
     {
-      LOG_WARN(Logger, "address_space_internal| request to delete a callback using unknown handle: {1}", serverhandle);
-      return;
+      return Variant();
     }
 
-  NodesMap::iterator nodeit = Nodes.find(it->second.Node);
+  const DataValue value = GetValue(target.Targets[0].Node, attribute);
+  return value.Status == StatusCode::Good ? value.Value : Variant();
+}
 
-  if (nodeit != Nodes.end())
+Variant AddressSpaceInMemory::ReadOperand(const NodeId & node, const FilterOperand & operand) const
+{
+  if (operand.Header.TypeId == ExpandedObjectId::SimpleAttributeOperand)
     {
-      AttributesMap::iterator ait = nodeit->second.Attributes.find(it->second.Attribute);
+      RelativePath path;
 
-      if (ait != nodeit->second.Attributes.end())
+      for (const QualifiedName & name : operand.SimpleAttribute.BrowsePath)
         {
-          size_t nb = ait->second.DataChangeCallbacks.erase(serverhandle);
+          RelativePathElement element;
+          element.TargetName = name;
+          path.Elements.push_back(element);
+        }
+
+      return ReadPath(node, path, operand.SimpleAttribute.Attribute);
+    }
+
+  return ReadPath(node, operand.Attribute.Path, static_cast<AttributeId>(static_cast<uint32_t>(operand.Attribute.AttributeId)));
+}
+
+std::vector<uint8_t> AddressSpaceInMemory::StoreQuery(QueryState state) const
+{
+  std::vector<uint8_t> point = GenerateContinuationPoint();
+  std::lock_guard<std::mutex> lock(QueryMutex);
+
+  while (Queries.count(point))
+    {
+      point = GenerateContinuationPoint();
+    }
+
+  state.Order = ++LastQuery;
+  QueryOrder[state.Order] = point;
+  Queries[point] = std::move(state);
+
+  while (Queries.size() > MaxQueryContinuationPoints)
+    {
+      Queries.erase(QueryOrder.begin()->second);
+      QueryOrder.erase(QueryOrder.begin());
+    }
+
+  return point;
+}
+
+uint32_t AddressSpaceInMemory::AddDataChangeCallback(const NodeId & node, AttributeId attribute, std::function<Server::DataChangeCallback> callback)
+{
+  boost::unique_lock<boost::shared_mutex> lock(DbMutex);
+
+  LOG_DEBUG(Logger, "address_space_internal| set data changes callback for node {} and attribute {}", node, (unsigned)attribute);
+
+  NodesMap::iterator it = Nodes.find(node);
+
+  if (it == Nodes.end())
+    {
+      LOG_ERROR(Logger, "address_space_internal| Node: '{}' not found", node);
+      throw std::runtime_error("address_space_internal| NodeId not found");
+    }
+
+  AttributesMap::iterator ait = it->second.Attributes.find(attribute);
+
+  if (ait == it->second.Attributes.end())
+    {
+      LOG_ERROR(Logger, "address_space_internal| Attribute: {} of node: ‘{}‘ not found", (unsigned)attribute, node);
+      throw std::runtime_error("Attribute not found");
+    }
+
+  uint32_t handle = ++DataChangeCallbackHandle;
+  DataChangeCallbackData data;
+  data.Callback = callback;
+  ait->second.DataChangeCallbacks[handle] = data;
+  ClientIdToAttributeMap[handle] = NodeAttribute(node, attribute);
+  return handle;
+}
+
+void AddressSpaceInMemory::DeleteDataChangeCallback(uint32_t serverhandle)
+{
+  boost::unique_lock<boost::shared_mutex> lock(DbMutex);
+
+  LOG_DEBUG(Logger, "address_space_internal| deleting callback with client id: {}", serverhandle);
+
+  ClientIdToAttributeMapType::iterator it = ClientIdToAttributeMap.find(serverhandle);
+
+  if (it == ClientIdToAttributeMap.end())
+    {
+      LOG_WARN(Logger, "address_space_internal| request to delete a callback using unknown handle: {1}", serverhandle);
+      return;
+    }
+
+  NodesMap::iterator nodeit = Nodes.find(it->second.Node);
+
+  if (nodeit != Nodes.end())
+    {
+      AttributesMap::iterator ait = nodeit->second.Attributes.find(it->second.Attribute);
+
+      if (ait != nodeit->second.Attributes.end())
+        {
+          size_t nb = ait->second.DataChangeCallbacks.erase(serverhandle);
 
           LOG_DEBUG(Logger, "address_space_internal| deleted {} callbacks", nb);
 
@@ -349,6 +871,12 @@ StatusCode AddressSpaceInMemory::SetValueCallback(const NodeId & node, Attribute
       if (ait != it->second.Attributes.end())
         {
           ait->second.GetValueCallback = callback;
+
+          if (attribute == AttributeId::BrowseName || attribute == AttributeId::DisplayName)
+            {
+              ClearBrowseCache();
+            }
+
           return StatusCode::Good;
         }
     }
@@ -357,6 +885,21 @@ StatusCode AddressSpaceInMemory::SetValueCallback(const NodeId & node, Attribute
 }
 
 void AddressSpaceInMemory::SetMethod(const NodeId & node, std::function<std::vector<OpcUa::Variant> (NodeId context, std::vector<OpcUa::Variant> arguments)> callback)
+{
+  std::function<Server::AsyncMethod> method;
+
+  if (callback)
+    {
+      method = [callback](NodeId context, std::vector<OpcUa::Variant> arguments, Server::MethodCompletion::SharedPtr completion)
+      {
+        completion->Complete(callback(context, arguments));
+      };
+    }
+
+  SetAsyncMethod(node, method);
+}
+
+void AddressSpaceInMemory::SetAsyncMethod(const NodeId & node, std::function<Server::AsyncMethod> callback)
 {
   boost::unique_lock<boost::shared_mutex> lock(DbMutex);
 
@@ -373,65 +916,116 @@ void AddressSpaceInMemory::SetMethod(const NodeId & node, std::function<std::vec
     }
 }
 
-std::vector<OpcUa::CallMethodResult> AddressSpaceInMemory::Call(const std::vector<OpcUa::CallMethodRequest> & methodsToCall)
+void AddressSpaceInMemory::EnableMethodPool(const Server::MethodPoolParameters & params)
 {
-  boost::shared_lock<boost::shared_mutex> lock(DbMutex);
+  std::shared_ptr<MethodPool> pool = std::make_shared<MethodPool>(params, Logger);
 
-  std::vector<OpcUa::CallMethodResult>  results;
+  {
+    boost::unique_lock<boost::shared_mutex> lock(DbMutex);
+    Pool.swap(pool);
+  }
 
-  for (auto method : methodsToCall)
-    {
-      results.push_back(CallMethod(method));
-    }
-
-  return results;
+  // the replaced pool is stopped here unless a Call still uses it
 }
 
-CallMethodResult AddressSpaceInMemory::CallMethod(CallMethodRequest request)
+std::vector<OpcUa::CallMethodResult> AddressSpaceInMemory::Call(const std::vector<OpcUa::CallMethodRequest> & methodsToCall)
 {
-  CallMethodResult result;
-  NodesMap::iterator node_it = Nodes.find(request.ObjectId);
+  std::shared_ptr<std::promise<std::vector<CallMethodResult>>> promise = std::make_shared<std::promise<std::vector<CallMethodResult>>>();
+  std::future<std::vector<CallMethodResult>> results = promise->get_future();
+  CallAsync(methodsToCall, [promise](std::vector<CallMethodResult> results)
+  {
+    promise->set_value(std::move(results));
+  });
+  return results.get();
+}
 
-  if (node_it == Nodes.end())
+void AddressSpaceInMemory::CallAsync(const std::vector<OpcUa::CallMethodRequest> & methodsToCall, std::function<CallCompletion> done)
+{
+  if (methodsToCall.empty())
     {
-      result.Status = StatusCode::BadNodeIdUnknown;
-      return result;
+      done(std::vector<CallMethodResult>());
+      return;
     }
 
-  NodesMap::iterator method_it = Nodes.find(request.MethodId);
+  // methods are copied, so they run without a lock of the address space
+  std::vector<std::function<Server::AsyncMethod>> methods(methodsToCall.size());
+  std::vector<StatusCode> statuses(methodsToCall.size());
+  std::shared_ptr<MethodPool> pool;
 
-  if (method_it == Nodes.end())
-    {
-      result.Status = StatusCode::BadNodeIdUnknown;
-      return result;
-    }
+  {
+    boost::shared_lock<boost::shared_mutex> lock(DbMutex);
 
-  if (! method_it->second.Method)
+    for (std::size_t i = 0; i < methodsToCall.size(); ++i)
+      {
+        statuses[i] = FindMethod(methodsToCall[i], methods[i]);
+      }
+
+    pool = Pool;
+  }
+
+  std::shared_ptr<MethodCallResults> results = std::make_shared<MethodCallResults>(methodsToCall.size(), std::move(done));
+
+  for (std::size_t i = 0; i < methodsToCall.size(); ++i)
     {
-      result.Status = StatusCode::BadNothingToDo;
-      return result;
+      const CallMethodRequest & request = methodsToCall[i];
+      std::shared_ptr<MethodCallCompletion> completion = std::make_shared<MethodCallCompletion>(results, i, request.InputArguments.size());
+
+      if (statuses[i] != StatusCode::Good)
+        {
+          completion->Fail(statuses[i]);
+          continue;
+        }
+
+      Common::Logger::SharedPtr logger = Logger;
+      std::function<Server::AsyncMethod> method = std::move(methods[i]);
+      MethodPool::Runner run = [logger, method, request](const std::shared_ptr<MethodCallCompletion> & completion)
+      {
+        //FIXME: find a way to return more information about failure to client
+        try
+          {
+            method(request.ObjectId, request.InputArguments, completion);
+          }
+
+        catch (std::exception & ex)
+          {
+            LOG_ERROR(logger, "address_space_internal| exception while calling method: {}: {}", request.MethodId, ex.what());
+            completion->Fail(StatusCode::BadUnexpectedError);
+          }
+      };
+
+      if (pool)
+        {
+          pool->Submit(request.MethodId, std::move(run), completion);
+        }
+
+      else
+        {
+          run(completion);
+        }
     }
+}
 
-  //FIXME: find a way to return more information about failure to client
-  try
+StatusCode AddressSpaceInMemory::FindMethod(const CallMethodRequest & request, std::function<Server::AsyncMethod> & method) const
+{
+  if (Nodes.find(request.ObjectId) == Nodes.end())
     {
-      result.OutputArguments = method_it->second.Method(node_it->first, request.InputArguments);
+      return StatusCode::BadNodeIdUnknown;
     }
 
-  catch (std::exception & ex)
+  NodesMap::const_iterator method_it = Nodes.find(request.MethodId);
+
+  if (method_it == Nodes.end())
     {
-      LOG_ERROR(Logger, "address_space_internal| exception while calling method: {}: {}", request.MethodId, ex.what());
-      result.Status = StatusCode::BadUnexpectedError;
-      return result;
+      return StatusCode::BadNodeIdUnknown;
     }
 
-  for (auto var : request.InputArguments)
+  if (! method_it->second.Method)
     {
-      result.InputArgumentResults.push_back(StatusCode::Good);
+      return StatusCode::BadNothingToDo;
     }
 
-  result.Status = StatusCode::Good;
-  return result;
+  method = method_it->second.Method;
+  return StatusCode::Good;
 }
 
 StatusCode AddressSpaceInMemory::SetValue(const NodeId & node, AttributeId attribute, const DataValue & data)
@@ -444,14 +1038,21 @@ StatusCode AddressSpaceInMemory::SetValue(const NodeId & node, AttributeId attri
 
       if (ait != it->second.Attributes.end())
         {
-          DataValue value(data);
-          value.SetServerTimestamp(DateTime::Current());
-          ait->second.Value = value;
+          StoreValue(ait->second, data, DateTime::Current());
+          // callbacks get the name which StoreName moves into the pool
+          const DataValue value = ait->second.Value;
+
+          if (attribute == AttributeId::BrowseName || attribute == AttributeId::DisplayName)
+            {
+              StoreName(it->second, attribute, ait->second.Value);
+              // the names are part of Browse results of other nodes
+              ClearBrowseCache();
+            }
 
           //call registered callback
           for (auto pair : ait->second.DataChangeCallbacks)
             {
-              pair.second.Callback(it->first, ait->first, ait->second.Value);
+              pair.second.Callback(it->first, ait->first, value);
             }
 
           return StatusCode::Good;
@@ -461,73 +1062,391 @@ StatusCode AddressSpaceInMemory::SetValue(const NodeId & node, AttributeId attri
   return StatusCode::BadAttributeIdInvalid;
 }
 
-bool AddressSpaceInMemory::IsSuitableReference(const BrowseDescription & desc, const ReferenceDescription & reference) const
+std::vector<StatusCode> AddressSpaceInMemory::UpdateValues(const std::vector<Server::ValueUpdate> & updates)
 {
-//  LOG_TRACE(Logger, "address_space_internal| checking reference: '{}' to node: '{}' ({}) which must fit ref: '{}' with IncludeSubtypes: '{}'", reference.ReferenceTypeId, reference.TargetNodeId, reference.BrowseName, desc.ReferenceTypeId, desc.IncludeSubtypes);
+  std::vector<StatusCode> statuses;
+  statuses.reserve(updates.size());
+  std::vector<DataValue> values;
+  std::vector<PendingDataChange> changes;
+  boost::unique_lock<boost::shared_mutex> lock(DbMutex);
+  const DateTime timestamp = DateTime::Current();
+
+  for (const Server::ValueUpdate & update : updates)
+    {
+      NodesMap::iterator it = Nodes.find(update.Node);
 
+      if (it == Nodes.end())
+        {
+          statuses.push_back(StatusCode::BadNodeIdUnknown);
+          continue;
+        }
+
+      statuses.push_back(UpdateValue(*it, update.Value, timestamp, values, changes));
+    }
+
+  // callbacks can not be deleted while the shared lock is held
+  boost::shared_lock<boost::shared_mutex> sharedLock(std::move(lock));
+  NotifyDataChanges(values, changes);
+  return statuses;
+}
+
+std::vector<StatusCode> AddressSpaceInMemory::UpdateValues(const std::vector<Server::HandleValueUpdate> & updates)
+{
+  std::vector<StatusCode> statuses;
+  statuses.reserve(updates.size());
+  std::vector<DataValue> values;
+  std::vector<PendingDataChange> changes;
+  boost::unique_lock<boost::shared_mutex> lock(DbMutex);
+  const DateTime timestamp = DateTime::Current();
+
+  for (const Server::HandleValueUpdate & update : updates)
+    {
+      if (update.Handle >= NodeHandles.size())
+        {
+          statuses.push_back(StatusCode::BadNodeIdUnknown);
+          continue;
+        }
+
+      statuses.push_back(UpdateValue(*NodeHandles[update.Handle], update.Value, timestamp, values, changes));
+    }
+
+  // callbacks can not be deleted while the shared lock is held
+  boost::shared_lock<boost::shared_mutex> sharedLock(std::move(lock));
+  NotifyDataChanges(values, changes);
+  return statuses;
+}
+
+uint32_t AddressSpaceInMemory::GetValueHandle(const NodeId & node) const
+{
+  boost::shared_lock<boost::shared_mutex> lock(DbMutex);
+
+  NodesMap::const_iterator it = Nodes.find(node);
+
+  if (it == Nodes.end())
+    {
+      throw std::runtime_error("address_space_internal| NodeId not found");
+    }
+
+  return it->second.Handle;
+}
+
+StatusCode AddressSpaceInMemory::EnableEncodedValueCache(const NodeId & node, bool enable)
+{
+  boost::unique_lock<boost::shared_mutex> lock(DbMutex);
+
+  NodesMap::iterator it = Nodes.find(node);
+
+  if (it == Nodes.end())
+    {
+      return StatusCode::BadNodeIdUnknown;
+    }
+
+  AttributesMap::iterator ait = it->second.Attributes.find(AttributeId::Value);
+
+  if (ait == it->second.Attributes.end())
+    {
+      return StatusCode::BadAttributeIdInvalid;
+    }
+
+  ait->second.CacheEncoding = enable;
+
+  if (enable)
+    {
+      ait->second.EncodedValue = Server::EncodeVariant(ait->second.Value.Value);
+    }
+
+  else
+    {
+      ait->second.EncodedValue.reset();
+    }
+
+  return StatusCode::Good;
+}
+
+void AddressSpaceInMemory::StoreValue(AttributeValue & attribute, const DataValue & data, const DateTime & timestamp)
+{
+  attribute.Value = data;
+  attribute.Value.SetServerTimestamp(timestamp);
+
+  if (attribute.CacheEncoding)
+    {
+      attribute.EncodedValue = Server::EncodeVariant(attribute.Value.Value);
+    }
+}
+
+StatusCode AddressSpaceInMemory::UpdateValue(NodesMap::value_type & node, const DataValue & data, const DateTime & timestamp, std::vector<DataValue> & values, std::vector<PendingDataChange> & changes)
+{
+  AttributesMap::iterator ait = node.second.Attributes.find(AttributeId::Value);
+
+  if (ait == node.second.Attributes.end())
+    {
+      return StatusCode::BadAttributeIdInvalid;
+    }
+
+  StoreValue(ait->second, data, timestamp);
+
+  if (ait->second.DataChangeCallbacks.empty())
+    {
+      return StatusCode::Good;
+    }
+
+  // the stored value may change again before the callbacks are called
+  values.push_back(ait->second.Value);
+
+  for (const auto & pair : ait->second.DataChangeCallbacks)
+    {
+      PendingDataChange change;
+      change.Callback = &pair.second.Callback;
+      change.Node = &node.first;
+      change.Value = values.size() - 1;
+      changes.push_back(change);
+    }
+
+  return StatusCode::Good;
+}
+
+void AddressSpaceInMemory::NotifyDataChanges(const std::vector<DataValue> & values, const std::vector<PendingDataChange> & changes) const
+{
+  for (const PendingDataChange & change : changes)
+    {
+      (*change.Callback)(*change.Node, AttributeId::Value, values[change.Value]);
+    }
+}
+
+void AddressSpaceInMemory::StoreName(NodeStruct & node, AttributeId attribute, DataValue & value)
+{
+  if (value.Value.IsArray())
+    {
+      return;
+    }
+
+  if (attribute == AttributeId::BrowseName && value.Value.Type() == VariantType::QUALIFIED_NAME)
+    {
+      node.BrowseName = Names.Intern(value.Value.As<QualifiedName>());
+      value.Value = Variant();
+    }
+
+  else if (attribute == AttributeId::DisplayName && value.Value.Type() == VariantType::LOCALIZED_TEXT)
+    {
+      node.DisplayName = Names.Intern(value.Value.As<LocalizedText>());
+      value.Value = Variant();
+    }
+}
+
+bool AddressSpaceInMemory::IsSuitableReference(const BrowseDescription & desc, const std::vector<bool> & referenceTypes, const CompactReference & reference) const
+{
   if ((desc.Direction == BrowseDirection::Forward && !reference.IsForward) || (desc.Direction == BrowseDirection::Inverse && reference.IsForward))
     {
-//      LOG_TRACE(Logger, "address_space_internal| reference in wrong direction");
       return false;
     }
 
-  if (desc.ReferenceTypeId != ObjectId::Null && !IsSuitableReferenceType(reference, desc.ReferenceTypeId, desc.IncludeSubtypes))
+  if (!referenceTypes.empty() && !referenceTypes[reference.ReferenceType])
     {
-//      LOG_TRACE(Logger, "address_space_internal| reference has wrong type");
       return false;
     }
 
-  if (desc.NodeClasses != NodeClass::Unspecified && (desc.NodeClasses & reference.TargetNodeClass) == NodeClass::Unspecified)
+  if (desc.NodeClasses != NodeClass::Unspecified && (desc.NodeClasses & static_cast<NodeClass>(reference.TargetNodeClass)) == NodeClass::Unspecified)
     {
-//      LOG_TRACE(Logger, "address_space_internal| reference has wrong class");
       return false;
     }
 
-//  LOG_TRACE(Logger, "address_space_internal| reference suitable");
   return true;
 }
 
-bool AddressSpaceInMemory::IsSuitableReferenceType(const ReferenceDescription & reference, const NodeId & typeId, bool includeSubtypes) const
+std::vector<bool> AddressSpaceInMemory::SelectReferenceTypes(const NodeId & typeId, bool includeSubtypes) const
 {
-  if (!includeSubtypes)
+  // empty selects every type
+  std::vector<bool> result;
+
+  if (typeId == ObjectId::Null)
     {
-      return reference.ReferenceTypeId == typeId;
+      return result;
     }
 
-  const std::vector<NodeId> suitableTypes = SelectNodesHierarchy(std::vector<NodeId>(1, typeId));
-  const auto resultIt = std::find(suitableTypes.begin(), suitableTypes.end(), reference.ReferenceTypeId);
-  \
-  return resultIt != suitableTypes.end();
-}
+  result.resize(ReferenceTypes.size(), false);
+  const auto type_it = ReferenceTypeIndexes.find(typeId);
 
-std::vector<NodeId> AddressSpaceInMemory::SelectNodesHierarchy(std::vector<NodeId> sourceNodes) const
-{
-  std::vector<NodeId> subNodes;
+  if (type_it != ReferenceTypeIndexes.end())
+    {
+      result[type_it->second] = true;
+    }
+
+  NodesMap::const_iterator node_it = Nodes.find(typeId);
 
-  for (NodeId nodeid : sourceNodes)
+  if (!includeSubtypes || node_it == Nodes.end())
     {
-      NodesMap::const_iterator node_it = Nodes.find(nodeid);
+      return result;
+    }
 
-      if (node_it != Nodes.end())
+  // subtypes are all nodes reachable through forward references
+  std::set<uint32_t> visited;
+  std::vector<uint32_t> pending(1, node_it->second.Handle);
+  visited.insert(node_it->second.Handle);
+
+  while (!pending.empty())
+    {
+      const NodesMap::value_type & node = *NodeHandles[pending.back()];
+      pending.pop_back();
+
+      const auto index_it = ReferenceTypeIndexes.find(node.first);
+
+      if (index_it != ReferenceTypeIndexes.end())
         {
-          for (auto & ref : node_it->second.References)
+          result[index_it->second] = true;
+        }
+
+      for (const CompactReference & ref : node.second.References)
+        {
+          if (ref.IsForward && visited.insert(ref.Target).second)
             {
-              if (ref.IsForward)
-                {
-                  subNodes.push_back(ref.TargetNodeId);
-                }
+              pending.push_back(ref.Target);
             }
         }
     }
 
-  if (subNodes.empty())
+  return result;
+}
+
+ReferenceDescription AddressSpaceInMemory::MakeReferenceDescription(const CompactReference & reference, BrowseResultMask mask) const
+{
+  const NodesMap::value_type & target = *NodeHandles[reference.Target];
+
+  ReferenceDescription result;
+  result.TargetNodeId = target.first;
+
+  if ((mask & BrowseResultMask::ReferenceTypeId) != BrowseResultMask::None)
+    {
+      result.ReferenceTypeId = ReferenceTypes[reference.ReferenceType];
+    }
+
+  if ((mask & BrowseResultMask::IsForward) != BrowseResultMask::None)
+    {
+      result.IsForward = reference.IsForward != 0;
+    }
+
+  if ((mask & BrowseResultMask::NodeClass) != BrowseResultMask::None)
     {
-      return sourceNodes;
+      result.TargetNodeClass = static_cast<NodeClass>(reference.TargetNodeClass);
     }
 
-  const std::vector<NodeId> allChilds = SelectNodesHierarchy(subNodes);
-  sourceNodes.insert(sourceNodes.end(), allChilds.begin(), allChilds.end());
-  return sourceNodes;
+  if ((mask & BrowseResultMask::BrowseName) != BrowseResultMask::None)
+    {
+      result.BrowseName = GetBrowseName(target);
+    }
+
+  if ((mask & BrowseResultMask::DisplayName) != BrowseResultMask::None)
+    {
+      result.DisplayName = GetDisplayName(target);
+    }
+
+  if ((mask & BrowseResultMask::TypeDefinition) != BrowseResultMask::None)
+    {
+      result.TargetNodeTypeDefinition = GetTypeDefinition(target.second);
+    }
+
+  return result;
+}
+
+QualifiedName AddressSpaceInMemory::GetBrowseName(const NodesMap::value_type & node) const
+{
+  const auto attr_it = node.second.Attributes.find(AttributeId::BrowseName);
+
+  if (attr_it != node.second.Attributes.end() && IsPooledName(attr_it->second))
+    {
+      return node.second.BrowseName.ToQualifiedName();
+    }
+
+  DataValue dv = GetValue(node.first, AttributeId::BrowseName);
+  return dv.Status == StatusCode::Good ? dv.Value.As<QualifiedName>() : QualifiedName("NONAME", 0);
+}
+
+LocalizedText AddressSpaceInMemory::GetDisplayName(const NodesMap::value_type & node) const
+{
+  const auto attr_it = node.second.Attributes.find(AttributeId::DisplayName);
+
+  if (attr_it != node.second.Attributes.end() && IsPooledName(attr_it->second))
+    {
+      return node.second.DisplayName.ToLocalizedText();
+    }
+
+  DataValue dv = GetValue(node.first, AttributeId::DisplayName);
+
+  if (dv.Status == StatusCode::Good)
+    {
+      return dv.Value.As<LocalizedText>();
+    }
+
+  return LocalizedText(GetBrowseName(node).Name);
+}
+
+NodeId AddressSpaceInMemory::GetTypeDefinition(const NodeStruct & node) const
+{
+  for (const CompactReference & ref : node.References)
+    {
+      // HasTypeDefinition has index 0
+      if (ref.ReferenceType == 0 && ref.IsForward)
+        {
+          return NodeHandles[ref.Target]->first;
+        }
+    }
+
+  return NodeId();
+}
+
+uint16_t AddressSpaceInMemory::GetReferenceTypeIndex(const NodeId & typeId)
+{
+  const auto it = ReferenceTypeIndexes.find(typeId);
+
+  if (it != ReferenceTypeIndexes.end())
+    {
+      return it->second;
+    }
+
+  if (ReferenceTypes.size() > std::numeric_limits<uint16_t>::max())
+    {
+      throw std::runtime_error("address_space_internal| too many reference types");
+    }
+
+  const uint16_t index = static_cast<uint16_t>(ReferenceTypes.size());
+  ReferenceTypes.push_back(typeId);
+  ReferenceTypeIndexes.emplace(typeId, index);
+  return index;
+}
+
+void AddressSpaceInMemory::AddCompactReference(NodeStruct & source, const NodeStruct & target, const NodeId & typeId, NodeClass targetClass, bool isForward)
+{
+  CompactReference ref;
+  ref.Target = target.Handle;
+  ref.ReferenceType = GetReferenceTypeIndex(typeId);
+  ref.TargetNodeClass = static_cast<uint8_t>(targetClass);
+  ref.IsForward = isForward ? 1 : 0;
+  source.References.push_back(ref);
+
+  const auto class_it = target.Attributes.find(AttributeId::NodeClass);
+  const bool toReferenceType = class_it != target.Attributes.end() && class_it->second.Value.Value == static_cast<int32_t>(NodeClass::ReferenceType);
+
+  // Browse results of every node follow subtypes of reference types
+  if (isForward && toReferenceType)
+    {
+      ClearBrowseCache();
+      return;
+    }
+
+  InvalidateBrowseCache(source.Handle);
+
+  // Browse results show the type definition of their targets, so the nodes
+  // linked with the source drop theirs, e.g. the parent of a new instance.
+  // The type itself does not show its instances.
+  if (isForward && typeId == ObjectId::HasTypeDefinition)
+    {
+      for (const CompactReference & reference : source.References)
+        {
+          if (!reference.IsForward || reference.ReferenceType != ref.ReferenceType)
+            {
+              InvalidateBrowseCache(reference.Target);
+            }
+        }
+    }
 }
 
 AddNodesResult AddressSpaceInMemory::AddNode(const AddNodesItem & item)
@@ -574,23 +1493,30 @@ AddNodesResult AddressSpaceInMemory::AddNode(const AddNodesItem & item)
       nodestruct.Attributes.insert(std::make_pair(attr.first, attval));
     }
 
-  Nodes.insert(std::make_pair(resultId, nodestruct));
+  for (auto & attr : nodestruct.Attributes)
+    {
+      StoreName(nodestruct, attr.first, attr.second.Value);
+    }
 
-  if (parent_node_it != Nodes.end())
+  const auto inserted = Nodes.insert(std::make_pair(resultId, std::move(nodestruct)));
+  NodeStruct & node = inserted.first->second;
+
+  if (inserted.second)
     {
-      // Link from parent to child
-      NodeStruct& parent = parent_node_it->second;
+      if (NodeHandles.size() > std::numeric_limits<uint32_t>::max())
+        {
+          throw std::runtime_error("address_space_internal| too many nodes");
+        }
 
-      ReferenceDescription desc;
-      desc.ReferenceTypeId = item.ReferenceTypeId;
-      desc.TargetNodeId = resultId;
-      desc.TargetNodeClass = item.Class;
-      desc.BrowseName = item.BrowseName;
-      desc.DisplayName = LocalizedText(item.BrowseName.Name);
-      desc.TargetNodeTypeDefinition = item.TypeDefinition;
-      desc.IsForward = true; // should this be in constructor?
+      node.Handle = static_cast<uint32_t>(NodeHandles.size());
+      NodeHandles.push_back(&*inserted.first);
+    }
 
-      parent.References.push_back(desc);
+  if (parent_node_it != Nodes.end())
+    {
+      // Link from parent to child
+      NodeStruct & parent = parent_node_it->second;
+      AddCompactReference(parent, node, item.ReferenceTypeId, item.Class, true);
 
       // Link to parent
       AddReferencesItem typeRef;
@@ -638,36 +1564,13 @@ StatusCode AddressSpaceInMemory::AddReference(const AddReferencesItem & item)
       return StatusCode::BadTargetNodeIdInvalid;
     }
 
-  ReferenceDescription desc;
-  desc.ReferenceTypeId = item.ReferenceTypeId;
-  desc.IsForward = item.IsForward;
-  desc.TargetNodeId = item.TargetNodeId;
-  desc.TargetNodeClass = item.TargetNodeClass;
-  DataValue dv = GetValue(item.TargetNodeId, AttributeId::BrowseName);
-
-  if (dv.Status == StatusCode::Good)
-    {
-      desc.BrowseName = dv.Value.As<QualifiedName>();
-    }
+  AddCompactReference(node_it->second, targetnode_it->second, item.ReferenceTypeId, item.TargetNodeClass, item.IsForward);
 
-  else
-    {
-      desc.BrowseName = QualifiedName("NONAME", 0);
-    }
-
-  dv = GetValue(item.TargetNodeId, AttributeId::DisplayName);
-
-  if (dv.Status == StatusCode::Good)
-    {
-      desc.DisplayName = dv.Value.As<LocalizedText>();
-    }
-
-  else
+  if (item.IsForward && item.ReferenceTypeId == ObjectId::HasTypeDefinition)
     {
-      desc.DisplayName = LocalizedText(desc.BrowseName.Name);
+      TypeInstances[targetnode_it->second.Handle].push_back(node_it->second.Handle);
     }
 
-  node_it->second.References.push_back(desc);
   return StatusCode::Good;
 }
 
@@ -11,6 +11,9 @@
 #pragma once
 
 #include "address_space_addon.h"
+#include "content_filter.h"
+#include "method_pool.h"
+#include "string_pool.h"
 
 #include <opc/ua/protocol/strings.h>
 #include <opc/ua/protocol/string_utils.h>
@@ -24,8 +27,11 @@
 #include <limits>
 #include <list>
 #include <map>
+#include <memory>
 #include <queue>
 #include <deque>
+#include <future>
+#include <mutex>
 #include <set>
 #include <thread>
 
@@ -56,26 +62,90 @@ struct DataChangeCallbackData
 
 typedef std::map<uint32_t, DataChangeCallbackData> DataChangeCallbackMap;
 
+//Data change collected under the exclusive lock and delivered under the shared one
+struct PendingDataChange
+{
+  const std::function<Server::DataChangeCallback> * Callback;
+  const NodeId * Node;
+  std::size_t Value; // index in the list of new values
+};
+
 //Store an attribute value together with a link to all its suscriptions
 struct AttributeValue
 {
   DataValue Value;
   DataChangeCallbackMap DataChangeCallbacks;
   std::function<DataValue(void)> GetValueCallback;
+  bool CacheEncoding = false; // see AddressSpace::EnableEncodedValueCache
+  Server::EncodedData EncodedValue; // encoding of Value.Value, follows it in StoreValue
 };
 
 typedef std::map<AttributeId, AttributeValue> AttributesMap;
 
+//Reference of a node packed into 8 bytes. Target id, names and type
+//definition are read from the target node when a Browse needs them.
+struct CompactReference
+{
+  uint32_t Target;          // handle of the target node
+  uint16_t ReferenceType;   // index in the table of reference types
+  uint8_t TargetNodeClass;  // NodeClass values fit into a byte
+  uint8_t IsForward;
+};
+
+static_assert(sizeof(CompactReference) == 8, "CompactReference must stay packed");
+
 //Store all data related to a Node
+//The values of the BrowseName and DisplayName attributes are kept only in
+//the string pool, their DataValues hold an empty Variant.
 struct NodeStruct
 {
   AttributesMap Attributes;
-  std::vector<ReferenceDescription> References;
-  std::function<std::vector<OpcUa::Variant> (NodeId, std::vector<OpcUa::Variant>)> Method;
+  InternedName BrowseName;
+  InternedText DisplayName;
+  std::vector<CompactReference> References;
+  std::function<Server::AsyncMethod> Method; // synchronous methods are wrapped
+  uint32_t Handle = 0; // dense index of the node, see AddressSpaceInMemory::NodeHandles
 };
 
 typedef std::map<NodeId, NodeStruct> NodesMap;
 
+//Instance selected by the node types of a query, by handles
+struct QueryCandidate
+{
+  uint32_t Node;
+  uint32_t Type;
+  std::size_t NodeType; // index in QueryFirstParameters::NodeTypes
+};
+
+//Browse result of a node for one shape of BrowseDescription
+struct CachedBrowse
+{
+  uint32_t Node; // handle of the browsed node
+  NodeId ReferenceTypeId;
+  BrowseDirection Direction;
+  bool IncludeSubtypes;
+  NodeClass NodeClasses;
+  BrowseResultMask ResultMask;
+  std::shared_ptr<const Server::EncodedBrowseResult> Result; // with its references and their encoding, shared by the readers
+
+  bool Matches(const BrowseDescription & desc) const
+  {
+    return Direction == desc.Direction && IncludeSubtypes == desc.IncludeSubtypes && NodeClasses == desc.NodeClasses
+           && ResultMask == desc.ResultMask && ReferenceTypeId == desc.ReferenceTypeId;
+  }
+};
+
+typedef std::list<CachedBrowse> BrowseCacheList;
+
+//Query continued by QueryNext
+struct QueryState
+{
+  QueryFirstParameters Params;
+  std::vector<QueryCandidate> Candidates;
+  std::size_t Next = 0; // first candidate not evaluated yet
+  uint64_t Order = 0; // position in QueryOrder
+};
+
 //In memory storage of server opc-ua data model
 class AddressSpaceInMemory : public Server::AddressSpace
 {
@@ -92,9 +162,12 @@ public:
   virtual std::vector<BrowseResult> BrowseNext() const;
   virtual std::vector<NodeId> RegisterNodes(const std::vector<NodeId> & params) const;
   virtual void UnregisterNodes(const std::vector<NodeId> & params) const;
+  virtual QueryFirstResult QueryFirst(const QueryFirstParameters & params) const;
+  virtual QueryNextResult QueryNext(const QueryNextParameters & params) const;
   virtual std::vector<DataValue> Read(const ReadParameters & params) const;
   virtual std::vector<StatusCode> Write(const std::vector<OpcUa::WriteValue> & values);
   virtual std::vector<OpcUa::CallMethodResult> Call(const std::vector<OpcUa::CallMethodRequest> & methodsToCall);
+  virtual void CallAsync(const std::vector<OpcUa::CallMethodRequest> & methodsToCall, std::function<CallCompletion> done);
 
   //Server side methods
 
@@ -110,28 +183,76 @@ public:
 
   /// @brief Set method function for a method node.
   void SetMethod(const NodeId & node, std::function<std::vector<OpcUa::Variant> (NodeId context, std::vector<OpcUa::Variant> arguments)> callback);
+  void SetAsyncMethod(const NodeId & node, std::function<Server::AsyncMethod> callback);
+
+  /// @brief Run methods on a pool, without one they run on the calling thread.
+  void EnableMethodPool(const Server::MethodPoolParameters & params);
+
+  /// @brief Set Value attributes of many nodes under one lock.
+  std::vector<StatusCode> UpdateValues(const std::vector<Server::ValueUpdate> & updates);
+  std::vector<StatusCode> UpdateValues(const std::vector<Server::HandleValueUpdate> & updates);
+
+  /// @brief Handle of a node for UpdateValues.
+  uint32_t GetValueHandle(const NodeId & node) const;
+
+  StatusCode EnableEncodedValueCache(const NodeId & node, bool enable);
+  std::vector<Server::EncodedDataValue> ReadEncoded(const ReadParameters & params) const;
+  std::vector<Server::EncodedBrowseResult> BrowseEncoded(const NodesQuery & query) const;
 
 private:
-  std::tuple<bool, NodeId> FindElementInNode(const NodeId & nodeid, const RelativePathElement & element) const;
+  std::tuple<bool, NodeId> FindElementInNode(const NodeId & nodeid, const QualifiedName & name, const InternedName * pooledName) const;
   BrowsePathResult TranslateBrowsePath(const BrowsePath & browsepath) const;
-  DataValue GetValue(const NodeId & node, AttributeId attribute) const;
+  DataValue GetValue(const NodeId & node, AttributeId attribute, Server::EncodedData * encoded = nullptr) const;
   StatusCode SetValue(const NodeId & node, AttributeId attribute, const DataValue & data);
-  bool IsSuitableReference(const BrowseDescription & desc, const ReferenceDescription & reference) const;
-  bool IsSuitableReferenceType(const ReferenceDescription & reference, const NodeId & typeId, bool includeSubtypes) const;
-  std::vector<NodeId> SelectNodesHierarchy(std::vector<NodeId> sourceNodes) const;
+  StatusCode UpdateValue(NodesMap::value_type & node, const DataValue & data, const DateTime & timestamp, std::vector<DataValue> & values, std::vector<PendingDataChange> & changes);
+  static void StoreValue(AttributeValue & attribute, const DataValue & data, const DateTime & timestamp);
+  void NotifyDataChanges(const std::vector<DataValue> & values, const std::vector<PendingDataChange> & changes) const;
+  void StoreName(NodeStruct & node, AttributeId attribute, DataValue & value);
+  bool IsSuitableReference(const BrowseDescription & desc, const std::vector<bool> & referenceTypes, const CompactReference & reference) const;
+  std::vector<bool> SelectReferenceTypes(const NodeId & typeId, bool includeSubtypes) const;
+  ReferenceDescription MakeReferenceDescription(const CompactReference & reference, BrowseResultMask mask) const;
+  QualifiedName GetBrowseName(const NodesMap::value_type & node) const;
+  LocalizedText GetDisplayName(const NodesMap::value_type & node) const;
+  NodeId GetTypeDefinition(const NodeStruct & node) const;
+  uint16_t GetReferenceTypeIndex(const NodeId & typeId);
+  void AddCompactReference(NodeStruct & source, const NodeStruct & target, const NodeId & typeId, NodeClass targetClass, bool isForward);
   AddNodesResult AddNode(const AddNodesItem & item);
   StatusCode AddReference(const AddReferencesItem & item);
   NodeId GetNewNodeId(const NodeId & id);
-  CallMethodResult CallMethod(CallMethodRequest method);
+  StatusCode FindMethod(const CallMethodRequest & request, std::function<Server::AsyncMethod> & method) const;
+  void SelectSubtypes(std::vector<uint32_t> & types) const;
+  std::vector<QueryDataSet> RunQuery(QueryState & state) const;
+  Variant ReadPath(const NodeId & node, const RelativePath & path, AttributeId attribute) const;
+  Variant ReadOperand(const NodeId & node, const FilterOperand & operand) const;
+  std::vector<uint8_t> StoreQuery(QueryState state) const;
+  std::vector<Server::EncodedBrowseResult> BrowseNodes(const NodesQuery & query, bool encodedOnly) const;
+  Server::EncodedBrowseResult BrowseNode(const NodesMap::value_type & node, const BrowseDescription & desc, bool encodedOnly) const;
+  std::shared_ptr<const Server::EncodedBrowseResult> FindBrowseResult(uint32_t node, const BrowseDescription & desc) const;
+  std::shared_ptr<const Server::EncodedBrowseResult> StoreBrowseResult(uint32_t node, const BrowseDescription & desc, std::shared_ptr<const Server::EncodedBrowseResult> result) const;
+  void InvalidateBrowseCache(uint32_t node);
+  void ClearBrowseCache();
 
 private:
   Common::Logger::SharedPtr Logger;
   mutable boost::shared_mutex DbMutex;
+  StringPool Names; // must outlive Nodes
   NodesMap Nodes;
+  std::vector<NodesMap::value_type *> NodeHandles; // node of every handle
+  std::vector<NodeId> ReferenceTypes; // reference type of every index
+  std::map<NodeId, uint16_t> ReferenceTypeIndexes;
+  std::map<uint32_t, std::vector<uint32_t>> TypeInstances; // instances of every type definition, by handles
+  mutable std::mutex QueryMutex; // taken after DbMutex
+  mutable std::map<std::vector<uint8_t>, QueryState> Queries; // by continuation point
+  mutable std::map<uint64_t, std::vector<uint8_t>> QueryOrder; // continuation points, oldest first
+  mutable uint64_t LastQuery = 0;
+  mutable std::mutex BrowseCacheMutex; // taken after DbMutex
+  mutable BrowseCacheList BrowseCacheOrder; // cached results, most recently used first
+  mutable std::map<uint32_t, std::vector<BrowseCacheList::iterator>> BrowseCache; // by node handle, most recently used last
   ClientIdToAttributeMapType ClientIdToAttributeMap; //Use to find callback using callback subcsriptionid
   uint32_t MaxNodeIdNum = 2000;
   uint32_t DefaultIdx = 2;
   std::atomic<uint32_t> DataChangeCallbackHandle;
+  std::shared_ptr<MethodPool> Pool; // destroyed first, its running methods may use the address space
 };
 }
 
@@ -27,6 +27,7 @@
 #include <opc/ua/server/addons/endpoints_services.h>
 #include <opc/ua/server/addons/opcua_protocol.h>
 #include <opc/ua/server/addons/opc_tcp_async.h>
+#include <opc/ua/server/addons/service_metrics.h>
 #include <opc/ua/server/addons/services_registry.h>
 #include <opc/ua/server/addons/standard_address_space.h>
 #include <opc/ua/server/addons/subscription_service.h>
@@ -51,6 +52,7 @@ void CreateCommonAddonsConfiguration(const Common::AddonParameters & params, std
   Common::AddonInformation asioAddon = Server::CreateAsioAddon();
   Common::AddonInformation subscriptionService = Server::CreateSubscriptionServiceAddon();
   Common::AddonInformation serverObject = Server::CreateServerObjectAddon();
+  Common::AddonInformation serviceMetrics = Server::CreateServiceMetricsAddon();
 
   for (const Common::ParametersGroup & group : params.Groups)
     {
@@ -93,6 +95,11 @@ void CreateCommonAddonsConfiguration(const Common::AddonParameters & params, std
         {
           AddParameters(serverObject, group);
         }
+
+      else if (group.Name == OpcUa::Server::ServiceMetricsAddonId)
+        {
+          AddParameters(serviceMetrics, group);
+        }
     }
 
   addons.push_back(endpointsRegistry);
@@ -102,6 +109,7 @@ void CreateCommonAddonsConfiguration(const Common::AddonParameters & params, std
   addons.push_back(Server::CreateServicesRegistryAddon());
   addons.push_back(Server::CreateStandardNamespaceAddon());
   addons.push_back(serverObject);
+  addons.push_back(serviceMetrics);
 }
 
 inline void RegisterAddons(std::vector<Common::AddonInformation> addons, Common::AddonsManager & manager)
@@ -137,12 +145,23 @@ Common::AddonParameters CreateAddonsParameters(const OpcUa::Server::Parameters &
 
   Common::ParametersGroup opc_tcp(OpcUa::Server::AsyncOpcTcpAddonId);
   opc_tcp.Parameters.push_back(debugMode);
+  opc_tcp.Parameters.push_back(Common::Parameter("max_send_queue_bytes", std::to_string(serverParams.MaxSendQueueBytes)));
+  opc_tcp.Parameters.push_back(Common::Parameter("send_stall_timeout", std::to_string(serverParams.SendStallTimeout)));
   OpcUa::Server::ApplicationData applicationData;
   applicationData.Application = serverParams.Endpoint.Server;
   applicationData.Endpoints.push_back(serverParams.Endpoint);
   opc_tcp.Groups = OpcUa::CreateCommonParameters({applicationData}, logger);
   addons.Groups.push_back(opc_tcp);
 
+  Common::ParametersGroup serviceMetrics(OpcUa::Server::ServiceMetricsAddonId);
+
+  if (!serverParams.MetricsDumpFile.empty())
+    {
+      serviceMetrics.Parameters.push_back(Common::Parameter("dump_file", serverParams.MetricsDumpFile));
+    }
+
+  addons.Groups.push_back(serviceMetrics);
+
   return addons;
 }
 
@@ -203,6 +222,7 @@ Common::AddonInformation Server::CreateOpcTcpAsyncAddon()
   opcTcp.Dependencies.push_back(OpcUa::Server::AsioAddonId);
   opcTcp.Dependencies.push_back(OpcUa::Server::EndpointsRegistryAddonId);
   opcTcp.Dependencies.push_back(OpcUa::Server::SubscriptionServiceAddonId);
+  opcTcp.Dependencies.push_back(OpcUa::Server::ServiceMetricsAddonId);
   return opcTcp;
 }
 
@@ -217,6 +237,19 @@ Common::AddonInformation Server::CreateServerObjectAddon()
   return serverObjectAddon;
 }
 
+Common::AddonInformation Server::CreateServiceMetricsAddon()
+{
+  Common::AddonInformation metricsAddon;
+  metricsAddon.Factory = std::make_shared<OpcUa::Server::ServiceMetricsAddonFactory>();
+  metricsAddon.Id = OpcUa::Server::ServiceMetricsAddonId;
+  metricsAddon.Dependencies.push_back(OpcUa::Server::StandardNamespaceAddonId);
+  metricsAddon.Dependencies.push_back(OpcUa::Server::ServicesRegistryAddonId);
+  metricsAddon.Dependencies.push_back(OpcUa::Server::AsioAddonId);
+  metricsAddon.Dependencies.push_back(OpcUa::Server::AddressSpaceRegistryAddonId);
+  metricsAddon.Dependencies.push_back(OpcUa::Server::SubscriptionServiceAddonId);
+  return metricsAddon;
+}
+
 Common::AddonInformation Server::CreateAsioAddon()
 {
   Common::AddonInformation asioAddon;
@@ -0,0 +1,384 @@
+/// @brief Evaluation of content filters of the Query services.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include "content_filter.h"
+
+#include <opc/ua/protocol/expanded_object_ids.h>
+
+namespace OpcUa
+{
+namespace Internal
+{
+
+namespace
+{
+
+// elements of one filter, larger filters are rejected
+const std::size_t MaxContentFilterElements = 256;
+
+enum class OperandKind
+{
+  Invalid,
+  Element,
+  Literal,
+  Attribute
+};
+
+OperandKind GetOperandKind(const FilterOperand & operand)
+{
+  if (operand.Header.TypeId == ExpandedObjectId::ElementOperand)
+    {
+      return OperandKind::Element;
+    }
+
+  if (operand.Header.TypeId == ExpandedObjectId::LiteralOperand)
+    {
+      return OperandKind::Literal;
+    }
+
+  if (operand.Header.TypeId == ExpandedObjectId::AttributeOperand || operand.Header.TypeId == ExpandedObjectId::SimpleAttributeOperand)
+    {
+      return OperandKind::Attribute;
+    }
+
+  return OperandKind::Invalid;
+}
+
+// InList takes any number of operands above one
+bool IsOperandCountValid(FilterOperator op, std::size_t count)
+{
+  switch (op)
+    {
+    case FilterOperator::IsNull:
+    case FilterOperator::Not:
+      return count == 1;
+
+    case FilterOperator::Equals:
+    case FilterOperator::GreaterThan:
+    case FilterOperator::LessThan:
+    case FilterOperator::GreaterThanOrEqual:
+    case FilterOperator::LessThanOrEqual:
+    case FilterOperator::And:
+    case FilterOperator::Or:
+      return count == 2;
+
+    case FilterOperator::Between:
+      return count == 3;
+
+    case FilterOperator::InList:
+      return count >= 2;
+
+    default:
+      return false;
+    }
+}
+
+bool IsOperatorSupported(FilterOperator op)
+{
+  switch (op)
+    {
+    case FilterOperator::Equals:
+    case FilterOperator::IsNull:
+    case FilterOperator::GreaterThan:
+    case FilterOperator::LessThan:
+    case FilterOperator::GreaterThanOrEqual:
+    case FilterOperator::LessThanOrEqual:
+    case FilterOperator::Not:
+    case FilterOperator::Between:
+    case FilterOperator::InList:
+    case FilterOperator::And:
+    case FilterOperator::Or:
+      return true;
+
+    default:
+      return false;
+    }
+}
+
+bool ToDouble(const Variant & value, double & result)
+{
+  switch (value.Type())
+    {
+    case VariantType::BOOLEAN:
+      result = value.As<bool>() ? 1 : 0;
+      return true;
+
+    case VariantType::SBYTE:
+      result = value.As<int8_t>();
+      return true;
+
+    case VariantType::BYTE:
+      result = value.As<uint8_t>();
+      return true;
+
+    case VariantType::INT16:
+      result = value.As<int16_t>();
+      return true;
+
+    case VariantType::UINT16:
+      result = value.As<uint16_t>();
+      return true;
+
+    case VariantType::INT32:
+      result = value.As<int32_t>();
+      return true;
+
+    case VariantType::UINT32:
+      result = value.As<uint32_t>();
+      return true;
+
+    case VariantType::INT64:
+      result = static_cast<double>(value.As<int64_t>());
+      return true;
+
+    case VariantType::UINT64:
+      result = static_cast<double>(value.As<uint64_t>());
+      return true;
+
+    case VariantType::FLOAT:
+      result = value.As<float>();
+      return true;
+
+    case VariantType::DOUBLE:
+      result = value.As<double>();
+      return true;
+
+    default:
+      return false;
+    }
+}
+
+// numbers of different types compare by value, other types only with the same type
+bool Compare(const Variant & left, const Variant & right, int & order)
+{
+  if (left.IsNul() || right.IsNul() || left.IsArray() || right.IsArray())
+    {
+      return false;
+    }
+
+  double l = 0;
+  double r = 0;
+
+  if (ToDouble(left, l) && ToDouble(right, r))
+    {
+      order = l < r ? -1 : (l > r ? 1 : 0);
+      return true;
+    }
+
+  if (left.Type() != right.Type())
+    {
+      return false;
+    }
+
+  if (left.Type() == VariantType::STRING)
+    {
+      order = left.As<std::string>().compare(right.As<std::string>());
+      return true;
+    }
+
+  if (left.Type() == VariantType::DATE_TIME)
+    {
+      const int64_t lt = left.As<DateTime>().Value;
+      const int64_t rt = right.As<DateTime>().Value;
+      order = lt < rt ? -1 : (lt > rt ? 1 : 0);
+      return true;
+    }
+
+  if (left == right)
+    {
+      order = 0;
+      return true;
+    }
+
+  return false;
+}
+
+bool IsEqual(const Variant & left, const Variant & right)
+{
+  int order = 0;
+  return Compare(left, right, order) && order == 0;
+}
+
+// Elements are evaluated once per node from the last to the first: operands
+// refer to later elements only, so their values are known already and shared
+// subexpressions are not evaluated again.
+class FilterEvaluator
+{
+public:
+  FilterEvaluator(const std::vector<ContentFilterElement> & filter, const FilterOperandReader & read)
+    : Filter(filter)
+    , Read(read)
+    , Results(filter.size())
+  {
+  }
+
+  bool Evaluate()
+  {
+    for (std::size_t index = Filter.size(); index-- > 0;)
+      {
+        Results[index] = Variant(EvaluateElement(Filter[index]));
+      }
+
+    return Results[0].As<bool>();
+  }
+
+private:
+  bool EvaluateElement(const ContentFilterElement & element) const
+  {
+    const std::vector<FilterOperand> & operands = element.FilterOperands;
+    int order = 0;
+
+    switch (element.Operator)
+      {
+      case FilterOperator::Equals:
+        return IsEqual(Value(operands[0]), Value(operands[1]));
+
+      case FilterOperator::IsNull:
+        return Value(operands[0]).IsNul();
+
+      case FilterOperator::GreaterThan:
+        return Compare(Value(operands[0]), Value(operands[1]), order) && order > 0;
+
+      case FilterOperator::LessThan:
+        return Compare(Value(operands[0]), Value(operands[1]), order) && order < 0;
+
+      case FilterOperator::GreaterThanOrEqual:
+        return Compare(Value(operands[0]), Value(operands[1]), order) && order >= 0;
+
+      case FilterOperator::LessThanOrEqual:
+        return Compare(Value(operands[0]), Value(operands[1]), order) && order <= 0;
+
+      case FilterOperator::Not:
+        return !IsTrue(operands[0]);
+
+      case FilterOperator::And:
+        return IsTrue(operands[0]) && IsTrue(operands[1]);
+
+      case FilterOperator::Or:
+        return IsTrue(operands[0]) || IsTrue(operands[1]);
+
+      case FilterOperator::Between:
+      {
+        const Variant value = Value(operands[0]);
+        int upper = 0;
+        return Compare(value, Value(operands[1]), order) && order >= 0 && Compare(value, Value(operands[2]), upper) && upper <= 0;
+      }
+
+      case FilterOperator::InList:
+      {
+        const Variant value = Value(operands[0]);
+
+        for (std::size_t i = 1; i < operands.size(); ++i)
+          {
+            if (IsEqual(value, Value(operands[i])))
+              {
+                return true;
+              }
+          }
+
+        return false;
+      }
+
+      default:
+        return false;
+      }
+  }
+
+  Variant Value(const FilterOperand & operand) const
+  {
+    switch (GetOperandKind(operand))
+      {
+      case OperandKind::Element:
+        return Results[operand.Element.Index];
+
+      case OperandKind::Literal:
+        return operand.Literal.Value;
+
+      case OperandKind::Attribute:
+        return Read(operand);
+
+      default:
+        return Variant();
+      }
+  }
+
+  bool IsTrue(const FilterOperand & operand) const
+  {
+    const Variant value = Value(operand);
+    return value.Type() == VariantType::BOOLEAN && !value.IsArray() && value.As<bool>();
+  }
+
+private:
+  const std::vector<ContentFilterElement> & Filter;
+  const FilterOperandReader & Read;
+  std::vector<Variant> Results; // value of every element evaluated so far
+};
+
+} // namespace
+
+StatusCode CheckContentFilter(const std::vector<ContentFilterElement> & filter, ContentFilterResult & result)
+{
+  if (filter.size() > MaxContentFilterElements)
+    {
+      result.ElementResults.clear();
+      return StatusCode::BadContentFilterInvalid;
+    }
+
+  StatusCode status = StatusCode::Good;
+  result.ElementResults.resize(filter.size());
+
+  for (std::size_t index = 0; index < filter.size(); ++index)
+    {
+      const ContentFilterElement & element = filter[index];
+      ContentFilterElementResult & elementResult = result.ElementResults[index];
+
+      if (!IsOperatorSupported(element.Operator))
+        {
+          elementResult.Status = StatusCode::BadFilterOperatorUnsupported;
+        }
+
+      else if (!IsOperandCountValid(element.Operator, element.FilterOperands.size()))
+        {
+          elementResult.Status = StatusCode::BadFilterOperandCountMismatch;
+        }
+
+      for (const FilterOperand & operand : element.FilterOperands)
+        {
+          const OperandKind kind = GetOperandKind(operand);
+          // referring to later elements only excludes cycles
+          const bool valid = kind != OperandKind::Invalid && (kind != OperandKind::Element || (operand.Element.Index > index && operand.Element.Index < filter.size()));
+
+          elementResult.OperandStatusCodes.push_back(valid ? StatusCode::Good : StatusCode::BadFilterOperandInvalid);
+
+          if (!valid && elementResult.Status == StatusCode::Good)
+            {
+              elementResult.Status = StatusCode::BadFilterOperandInvalid;
+            }
+        }
+
+      if (elementResult.Status != StatusCode::Good)
+        {
+          status = StatusCode::BadContentFilterInvalid;
+        }
+    }
+
+  return status;
+}
+
+bool EvaluateContentFilter(const std::vector<ContentFilterElement> & filter, const FilterOperandReader & read)
+{
+  if (filter.empty())
+    {
+      return true;
+    }
+
+  return FilterEvaluator(filter, read).Evaluate();
+}
+
+}
+}
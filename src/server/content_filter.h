@@ -0,0 +1,37 @@
+/// @brief Evaluation of content filters of the Query services.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#pragma once
+
+#include <opc/ua/protocol/view.h>
+
+#include <functional>
+#include <vector>
+
+namespace OpcUa
+{
+namespace Internal
+{
+
+/// @brief Value of an AttributeOperand or SimpleAttributeOperand for the node being filtered.
+typedef std::function<Variant(const FilterOperand & operand)> FilterOperandReader;
+
+/// @brief Check operators and operands of a filter before it is evaluated.
+/// Supported are Equals, IsNull, GreaterThan, LessThan, GreaterThanOrEqual,
+/// LessThanOrEqual, Not, Between, InList, And and Or. Element operands must
+/// refer to a later element. Filters of more than 256 elements are rejected
+/// without element results.
+/// @return Good or BadContentFilterInvalid, result holds a status for every element then.
+StatusCode CheckContentFilter(const std::vector<ContentFilterElement> & filter, ContentFilterResult & result);
+
+/// @brief Whether the first element of a checked filter is true for a node, an empty filter selects every node.
+/// Every element is evaluated once.
+bool EvaluateContentFilter(const std::vector<ContentFilterElement> & filter, const FilterOperandReader & read);
+
+}
+}
@@ -0,0 +1,230 @@
+/// @brief Responses of the binary protocol which copy encodings kept by the address space.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include "encoded_responses.h"
+
+#include <opc/ua/protocol/binary/stream.h>
+
+namespace OpcUa
+{
+namespace Server
+{
+
+namespace
+{
+
+struct EncodedDataAcceptor
+{
+  std::vector<char> & Data;
+
+  void Send(const char * data, std::size_t size)
+  {
+    Data.assign(data, data + size);
+  }
+};
+
+template<class Container>
+std::size_t RawSizeArray(const Container & c)
+{
+  std::size_t size = 4;
+
+  for (const typename Container::value_type & value : c)
+    {
+      size += Binary::RawSize(value);
+    }
+
+  return size;
+}
+
+template<class Container>
+void SerializeArray(Binary::DataSerializer & out, const Container & c, uint32_t emptySizeValue = ~uint32_t())
+{
+  out.Serialize(c.empty() ? emptySizeValue : static_cast<uint32_t>(c.size()));
+
+  for (const typename Container::value_type & value : c)
+    {
+      out.Serialize(value);
+    }
+}
+
+}
+
+EncodedData EncodeVariant(const Variant & value)
+{
+  Binary::DataSerializer serializer(Binary::RawSize(value));
+  serializer << value;
+
+  std::shared_ptr<std::vector<char>> encoded = std::make_shared<std::vector<char>>();
+  EncodedDataAcceptor acceptor = {*encoded};
+  serializer.Flush(acceptor);
+  return encoded;
+}
+
+EncodedData EncodeReferences(const std::vector<ReferenceDescription> & references)
+{
+  Binary::DataSerializer serializer(RawSizeArray(references));
+  SerializeArray(serializer, references);
+
+  std::shared_ptr<std::vector<char>> encoded = std::make_shared<std::vector<char>>();
+  EncodedDataAcceptor acceptor = {*encoded};
+  serializer.Flush(acceptor);
+  return encoded;
+}
+
+EncodedReadResponse::EncodedReadResponse()
+  : TypeId(ReadResponse().TypeId)
+{
+}
+
+EncodedBrowseResponse::EncodedBrowseResponse()
+  : TypeId(BrowseResponse().TypeId)
+{
+}
+
+}
+
+namespace Binary
+{
+
+template<>
+std::size_t RawSize<Server::EncodedDataValue>(const Server::EncodedDataValue & value)
+{
+  const DataValue & data = value.Value;
+
+  if (!(data.Encoding & DATA_VALUE) || !value.EncodedVariant)
+    {
+      return RawSize(data);
+    }
+
+  std::size_t size = RawSize(data.Encoding) + value.EncodedVariant->size();
+
+  if (data.Encoding & DATA_VALUE_STATUS_CODE)
+    {
+      size += RawSize(data.Status);
+    }
+
+  if (data.Encoding & DATA_VALUE_SOURCE_TIMESTAMP)
+    {
+      size += RawSize(data.SourceTimestamp);
+    }
+
+  if (data.Encoding & DATA_VALUE_SOURCE_PICOSECONDS)
+    {
+      size += RawSize(data.SourcePicoseconds);
+    }
+
+  if (data.Encoding & DATA_VALUE_Server_TIMESTAMP)
+    {
+      size += RawSize(data.ServerTimestamp);
+    }
+
+  if (data.Encoding & DATA_VALUE_Server_PICOSECONDS)
+    {
+      size += RawSize(data.ServerPicoseconds);
+    }
+
+  return size;
+}
+
+template<>
+void DataSerializer::Serialize<Server::EncodedDataValue>(const Server::EncodedDataValue & value)
+{
+  const DataValue & data = value.Value;
+
+  if (!(data.Encoding & DATA_VALUE) || !value.EncodedVariant)
+    {
+      *this << data;
+      return;
+    }
+
+  *this << data.Encoding;
+  *this << RawMessage(value.EncodedVariant->data(), value.EncodedVariant->size());
+
+  if (data.Encoding & DATA_VALUE_STATUS_CODE)
+    {
+      *this << data.Status;
+    }
+
+  if (data.Encoding & DATA_VALUE_SOURCE_TIMESTAMP)
+    {
+      *this << data.SourceTimestamp;
+    }
+
+  if (data.Encoding & DATA_VALUE_SOURCE_PICOSECONDS)
+    {
+      *this << data.SourcePicoseconds;
+    }
+
+  if (data.Encoding & DATA_VALUE_Server_TIMESTAMP)
+    {
+      *this << data.ServerTimestamp;
+    }
+
+  if (data.Encoding & DATA_VALUE_Server_PICOSECONDS)
+    {
+      *this << data.ServerPicoseconds;
+    }
+}
+
+template<>
+std::size_t RawSize<Server::EncodedReadResponse>(const Server::EncodedReadResponse & response)
+{
+  return RawSize(response.TypeId) + RawSize(response.Header) + Server::RawSizeArray(response.Results) + Server::RawSizeArray(response.DiagnosticInfos);
+}
+
+template<>
+void DataSerializer::Serialize<Server::EncodedReadResponse>(const Server::EncodedReadResponse & response)
+{
+  *this << response.TypeId;
+  *this << response.Header;
+  Server::SerializeArray(*this, response.Results);
+  Server::SerializeArray(*this, response.DiagnosticInfos);
+}
+
+template<>
+std::size_t RawSize<Server::EncodedBrowseResult>(const Server::EncodedBrowseResult & result)
+{
+  if (!result.EncodedReferences)
+    {
+      return RawSize(result.Result);
+    }
+
+  return RawSize(result.Result.Status) + Server::RawSizeArray(result.Result.ContinuationPoint) + result.EncodedReferences->size();
+}
+
+template<>
+void DataSerializer::Serialize<Server::EncodedBrowseResult>(const Server::EncodedBrowseResult & result)
+{
+  if (!result.EncodedReferences)
+    {
+      *this << result.Result;
+      return;
+    }
+
+  *this << result.Result.Status;
+  Server::SerializeArray(*this, result.Result.ContinuationPoint);
+  *this << RawMessage(result.EncodedReferences->data(), result.EncodedReferences->size());
+}
+
+template<>
+std::size_t RawSize<Server::EncodedBrowseResponse>(const Server::EncodedBrowseResponse & response)
+{
+  return RawSize(response.TypeId) + RawSize(response.Header) + Server::RawSizeArray(response.Results) + Server::RawSizeArray(response.Diagnostics);
+}
+
+template<>
+void DataSerializer::Serialize<Server::EncodedBrowseResponse>(const Server::EncodedBrowseResponse & response)
+{
+  *this << response.TypeId;
+  *this << response.Header;
+  Server::SerializeArray(*this, response.Results, 0);
+  Server::SerializeArray(*this, response.Diagnostics, 0);
+}
+
+}
+}
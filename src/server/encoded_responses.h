@@ -0,0 +1,52 @@
+/// @brief Responses of the binary protocol which copy encodings kept by the address space.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#pragma once
+
+#include <opc/ua/protocol/protocol.h>
+#include <opc/ua/server/address_space.h>
+
+#include <vector>
+
+namespace OpcUa
+{
+namespace Server
+{
+
+/// @brief Binary encoding of a value for EncodedDataValue::EncodedVariant.
+EncodedData EncodeVariant(const Variant & value);
+
+/// @brief Binary encoding of references for EncodedBrowseResult::EncodedReferences.
+EncodedData EncodeReferences(const std::vector<ReferenceDescription> & references);
+
+/// @brief ReadResponse whose values are serialized from the encodings kept with them.
+/// It is encoded like ReadResponse, a value without an encoding is encoded again.
+struct EncodedReadResponse
+{
+  NodeId TypeId;
+  ResponseHeader Header;
+  std::vector<EncodedDataValue> Results;
+  std::vector<DiagnosticInfo> DiagnosticInfos;
+
+  EncodedReadResponse();
+};
+
+/// @brief BrowseResponse whose results are serialized from the encodings kept with them.
+/// It is encoded like BrowseResponse, a result without an encoding is encoded again.
+struct EncodedBrowseResponse
+{
+  NodeId TypeId;
+  ResponseHeader Header;
+  std::vector<EncodedBrowseResult> Results;
+  DiagnosticInfoList Diagnostics;
+
+  EncodedBrowseResponse();
+};
+
+}
+}
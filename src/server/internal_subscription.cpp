@@ -1,5 +1,8 @@
 #include "internal_subscription.h"
 
+#include <opc/ua/protocol/binary/stream.h>
+#include <opc/ua/server/trace_ring.h>
+
 #include <boost/thread/locks.hpp>
 
 namespace OpcUa
@@ -7,7 +10,62 @@ namespace OpcUa
 namespace Internal
 {
 
-InternalSubscription::InternalSubscription(SubscriptionServiceInternal & service, const SubscriptionData & data, const NodeId & SessionAuthenticationToken, std::function<void (PublishResult)> callback, const Common::Logger::SharedPtr & logger)
+SubscriptionStatistics::SubscriptionStatistics(const SubscriptionData & data, const NodeId & session)
+  : SessionId(session)
+  , SubscriptionId(data.SubscriptionId)
+  , PublishingInterval(data.RevisedPublishingInterval)
+  , MaxKeepAliveCount(data.RevisedMaxKeepAliveCount)
+  , MaxLifetimeCount(data.RevisedLifetimeCount)
+  , PublishRequestCount(0)
+  , RepublishRequestCount(0)
+  , DataChangeNotificationsCount(0)
+  , EventNotificationsCount(0)
+  , NotificationsCount(0)
+  , KeepAliveCount(0)
+  , LatePublishRequestCount(0)
+  , CurrentKeepAliveCount(0)
+  , UnacknowledgedMessageCount(0)
+  , QueuedNotificationsCount(0)
+  , DiscardedNotificationsCount(0)
+  , MonitoredItemCount(0)
+  , MonitoringQueueOverflowCount(0)
+{
+}
+
+Server::SubscriptionDiagnostics SubscriptionStatistics::Snapshot() const
+{
+  Server::SubscriptionDiagnostics result;
+  {
+    std::lock_guard<std::mutex> lock(SessionMutex);
+    result.SessionId = SessionId;
+  }
+  result.SubscriptionId = SubscriptionId;
+  result.PublishingInterval = PublishingInterval.load(std::memory_order_relaxed);
+  result.MaxKeepAliveCount = MaxKeepAliveCount.load(std::memory_order_relaxed);
+  result.MaxLifetimeCount = MaxLifetimeCount.load(std::memory_order_relaxed);
+  result.PublishRequestCount = PublishRequestCount.load(std::memory_order_relaxed);
+  result.RepublishRequestCount = RepublishRequestCount.load(std::memory_order_relaxed);
+  result.DataChangeNotificationsCount = DataChangeNotificationsCount.load(std::memory_order_relaxed);
+  result.EventNotificationsCount = EventNotificationsCount.load(std::memory_order_relaxed);
+  result.NotificationsCount = NotificationsCount.load(std::memory_order_relaxed);
+  result.KeepAliveCount = KeepAliveCount.load(std::memory_order_relaxed);
+  result.LatePublishRequestCount = LatePublishRequestCount.load(std::memory_order_relaxed);
+  result.CurrentKeepAliveCount = CurrentKeepAliveCount.load(std::memory_order_relaxed);
+  result.UnacknowledgedMessageCount = UnacknowledgedMessageCount.load(std::memory_order_relaxed);
+  result.QueuedNotificationsCount = QueuedNotificationsCount.load(std::memory_order_relaxed);
+  result.DiscardedNotificationsCount = DiscardedNotificationsCount.load(std::memory_order_relaxed);
+  result.MonitoredItemCount = MonitoredItemCount.load(std::memory_order_relaxed);
+  result.MonitoringQueueOverflowCount = MonitoringQueueOverflowCount.load(std::memory_order_relaxed);
+  return result;
+}
+
+void SubscriptionStatistics::SetSession(const NodeId & session)
+{
+  std::lock_guard<std::mutex> lock(SessionMutex);
+  SessionId = session;
+}
+
+InternalSubscription::InternalSubscription(SubscriptionServiceInternal & service, const SubscriptionData & data, const NodeId & SessionAuthenticationToken, std::function<void (PublishResult)> callback, const Server::PublishParameters & publishParams, const Common::Logger::SharedPtr & logger)
   : Service(service)
   , AddressSpace(Service.GetAddressSpace())
   , Data(data)
@@ -16,7 +74,10 @@ InternalSubscription::InternalSubscription(SubscriptionServiceInternal & service
   , io(service.GetIOService())
   , Timer(io, boost::posix_time::microseconds(static_cast<unsigned long>(1000 * data.RevisedPublishingInterval)))
   , LifeTimeCount(data.RevisedLifetimeCount)
+  , PublishParams(publishParams)
+  , EarlyTimer(io)
   , Logger(logger)
+  , Statistics(std::make_shared<SubscriptionStatistics>(data, service.GetSessionId(SessionAuthenticationToken)))
 {
   LOG_DEBUG(Logger, "internal_subscription | id: {}, create", Data.SubscriptionId);
 }
@@ -34,11 +95,20 @@ InternalSubscription::~InternalSubscription()
   LOG_DEBUG(Logger, "internal_subscription | id: {}, destroy", Data.SubscriptionId);
 }
 
+std::shared_ptr<const SubscriptionStatistics> InternalSubscription::GetStatistics() const
+{
+  return Statistics;
+}
+
 void InternalSubscription::Stop()
 {
   LOG_DEBUG(Logger, "internal_subscription | id: {}, stop", Data.SubscriptionId);
   DeleteAllMonitoredItems();
   Timer.cancel();
+
+  boost::unique_lock<boost::shared_mutex> lock(DbMutex);
+  Stopped = true;
+  EarlyTimer.cancel();
 }
 
 void InternalSubscription::DeleteAllMonitoredItems()
@@ -77,45 +147,141 @@ void InternalSubscription::PublishResults(const boost::system::error_code & erro
       return;
     }
 
-  if (HasExpired())
+  {
+    std::lock_guard<std::mutex> publishLock(PublishMutex);
+
+    if (HasExpired())
+      {
+        return;
+      }
+
+    const bool hasPublishResult = HasPublishResult();
+
+    if (hasPublishResult && !Service.PopPublishRequest(GetSession()))   //Check we received a publishrequest before sending response
+      {
+        Statistics->LatePublishRequestCount.fetch_add(1, std::memory_order_relaxed);
+        OPCUA_TRACE(0, Data.SubscriptionId, PUBLISH_REQUEST, PublishLate);
+      }
+
+    else if (hasPublishResult)
+      {
+        Statistics->PublishRequestCount.fetch_add(1, std::memory_order_relaxed);
+        OPCUA_TRACE(0, Data.SubscriptionId, PUBLISH_REQUEST, PublishCycle);
+        SendPublishResult();
+      }
+  }
+
+  TimerStopped = false;
+  Timer.expires_at(Timer.expires_at() + boost::posix_time::microseconds(static_cast<unsigned long>(1000 * Data.RevisedPublishingInterval)));
+  std::shared_ptr<InternalSubscription> self = shared_from_this();
+  Timer.async_wait([self](const boost::system::error_code & error) { self->PublishResults(error); });
+}
+
+
+void InternalSubscription::PublishEarly(const boost::system::error_code & error)
+{
+  if (error)
     {
       return;
     }
 
-  if (HasPublishResult() && Service.PopPublishRequest(CurrentSession))   //Check we received a publishrequest before sending response
+  std::lock_guard<std::mutex> publishLock(PublishMutex);
+
+  NodeId session;
+  {
+    boost::unique_lock<boost::shared_mutex> lock(DbMutex);
+
+    EarlyPublishScheduled = false;
+
+    // the publishing cycle may have sent them meanwhile
+    if (Stopped || !HasQueuedNotifications())
+      {
+        return;
+      }
+
+    session = CurrentSession;
+  }
+
+  // without a publish request the notifications are sent once one arrives
+  if (HasExpired() || !Service.HasPublishRequest(session) || !Service.PopPublishRequest(session))
     {
+      return;
+    }
 
-      std::vector<PublishResult> results = PopPublishResult();
+  LOG_DEBUG(Logger, "internal_subscription | id: {}, publishing before end of cycle", Data.SubscriptionId);
 
-      if (results.size() > 0)
-        {
-          LOG_DEBUG(Logger, "internal_subscription | id: {}, have {} results", Data.SubscriptionId, results.size());
+  Statistics->PublishRequestCount.fetch_add(1, std::memory_order_relaxed);
+  OPCUA_TRACE(0, Data.SubscriptionId, PUBLISH_REQUEST, PublishCycle);
+  SendPublishResult();
+}
 
-          if (Callback)
-            {
-              LOG_DEBUG(Logger, "internal_subscription | id: {}, calling callback", Data.SubscriptionId);
-              Callback(results[0]);
-            }
+NodeId InternalSubscription::GetSession() const
+{
+  boost::shared_lock<boost::shared_mutex> lock(DbMutex);
+  return CurrentSession;
+}
 
-          else
-            {
-              LOG_DEBUG(Logger, "internal_subscription | id: {}, no callback defined for this subscription", Data.SubscriptionId);
-            }
+void InternalSubscription::SendPublishResult()
+{
+  std::function<void (PublishResult)> callback;
+  {
+    boost::shared_lock<boost::shared_mutex> lock(DbMutex);
+    callback = Callback;
+  }
+
+  std::vector<PublishResult> results = PopPublishResult();
+
+  if (results.size() > 0)
+    {
+      LOG_DEBUG(Logger, "internal_subscription | id: {}, have {} results", Data.SubscriptionId, results.size());
+
+      if (callback)
+        {
+          LOG_DEBUG(Logger, "internal_subscription | id: {}, calling callback", Data.SubscriptionId);
+          callback(results[0]);
+        }
+
+      else
+        {
+          LOG_DEBUG(Logger, "internal_subscription | id: {}, no callback defined for this subscription", Data.SubscriptionId);
         }
     }
+}
 
-  TimerStopped = false;
-  Timer.expires_at(Timer.expires_at() + boost::posix_time::microseconds(static_cast<unsigned long>(1000 * Data.RevisedPublishingInterval)));
+void InternalSubscription::ScheduleEarlyPublish()
+{
+  // called with DbMutex held
+  if (!PublishParams.LowLatency || Stopped || EarlyPublishScheduled)
+    {
+      return;
+    }
+
+  EarlyPublishScheduled = true;
+  EarlyTimer.expires_at(LastPublish + PublishParams.MinPublishSpacing);
   std::shared_ptr<InternalSubscription> self = shared_from_this();
-  Timer.async_wait([self](const boost::system::error_code & error) { self->PublishResults(error); });
+  EarlyTimer.async_wait([self](const boost::system::error_code & error) { self->PublishEarly(error); });
 }
 
+void InternalSubscription::PublishRequestReceived(const NodeId & session)
+{
+  boost::unique_lock<boost::shared_mutex> lock(DbMutex);
+
+  if (session != CurrentSession)
+    {
+      return;
+    }
+
+  if (HasQueuedNotifications())
+    {
+      ScheduleEarlyPublish();
+    }
+}
 
 bool InternalSubscription::HasPublishResult()
 {
   boost::unique_lock<boost::shared_mutex> lock(DbMutex);
 
-  if (Startup || !TriggeredDataChangeEvents.empty() || !TriggeredEvents.empty())
+  if (Startup || HasQueuedNotifications())
     {
       LOG_TRACE(Logger, "internal_subscription | id: {}, HasPublishResult: all queues empty, should send publish event", Data.SubscriptionId);
       return true;
@@ -129,6 +295,7 @@ bool InternalSubscription::HasPublishResult()
 
   LOG_TRACE(Logger, "internal_subscription | id: {}, HasPublishResult: KeepAliveCount: {}, MaxKeepAliveCount: {}", Data.SubscriptionId, KeepAliveCount, Data.RevisedMaxKeepAliveCount);
   ++KeepAliveCount;
+  Statistics->CurrentKeepAliveCount.store(KeepAliveCount, std::memory_order_relaxed);
   return false;
 
 }
@@ -142,8 +309,13 @@ std::vector<PublishResult> InternalSubscription::PopPublishResult()
   result.SubscriptionId = Data.SubscriptionId;
   result.NotificationMessage.PublishTime = DateTime::Current();
 
+  uint32_t sentNotifications = 0;
+
   if (!TriggeredDataChangeEvents.empty())
     {
+      const uint32_t count = TriggeredDataChangeEvents.size();
+      Statistics->DataChangeNotificationsCount.fetch_add(count, std::memory_order_relaxed);
+      sentNotifications += count;
       NotificationData data = GetNotificationData();
       result.NotificationMessage.NotificationData.push_back(data);
       result.Results.push_back(StatusCode::Good);
@@ -153,6 +325,9 @@ std::vector<PublishResult> InternalSubscription::PopPublishResult()
     {
       LOG_DEBUG(Logger, "internal_subscription | id: {}, PopPublishResult: {} events to send", Data.SubscriptionId, TriggeredEvents.size());
 
+      const uint32_t count = TriggeredEvents.size();
+      Statistics->EventNotificationsCount.fetch_add(count, std::memory_order_relaxed);
+      sentNotifications += count;
       EventNotificationList notif;
 
       for (TriggeredEvent ev : TriggeredEvents)
@@ -166,6 +341,17 @@ std::vector<PublishResult> InternalSubscription::PopPublishResult()
       result.Results.push_back(StatusCode::Good);
     }
 
+  QueuedBytes = 0;
+
+  if (Terminated && !TerminationSent)
+    {
+      StatusChangeNotification status;
+      status.Status = StatusCode::BadResourceUnavailable;
+      result.NotificationMessage.NotificationData.push_back(NotificationData(status));
+      result.Results.push_back(StatusCode::Good);
+      TerminationSent = true;
+    }
+
   // clear TriggerCount to enable new events for next
   // publishing cycle
   for (auto & mdc : MonitoredDataChanges)
@@ -177,6 +363,19 @@ std::vector<PublishResult> InternalSubscription::PopPublishResult()
 
   KeepAliveCount = 0;
   Startup = false;
+  LastPublish = std::chrono::steady_clock::now();
+  Statistics->QueuedNotificationsCount.fetch_sub(sentNotifications, std::memory_order_relaxed);
+  Statistics->CurrentKeepAliveCount.store(0, std::memory_order_relaxed);
+
+  if (sentNotifications)
+    {
+      Statistics->NotificationsCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+  else
+    {
+      Statistics->KeepAliveCount.fetch_add(1, std::memory_order_relaxed);
+    }
 
   result.NotificationMessage.SequenceNumber = NotificationSequence;
   ++NotificationSequence;
@@ -189,6 +388,14 @@ std::vector<PublishResult> InternalSubscription::PopPublishResult()
 
   NotAcknowledgedResults.push_back(result);
 
+  // keep for republishing as many messages as the session may have requests for
+  while (PublishParams.MaxPublishRequests > 0 && NotAcknowledgedResults.size() > PublishParams.MaxPublishRequests)
+    {
+      NotAcknowledgedResults.pop_front();
+    }
+
+  Statistics->UnacknowledgedMessageCount.store(NotAcknowledgedResults.size(), std::memory_order_relaxed);
+
   LOG_DEBUG(Logger, "internal_subscription | id: {}, sending PublishResult with: {} notifications", Data.SubscriptionId, result.NotificationMessage.NotificationData.size());
 
   std::vector<PublishResult> resultlist;
@@ -203,6 +410,7 @@ RepublishResponse InternalSubscription::Republish(const RepublishParameters & pa
 
   boost::unique_lock<boost::shared_mutex> lock(DbMutex);
 
+  Statistics->RepublishRequestCount.fetch_add(1, std::memory_order_relaxed);
   RepublishResponse response;
 
   for (const PublishResult & res : NotAcknowledgedResults)
@@ -218,6 +426,48 @@ RepublishResponse InternalSubscription::Republish(const RepublishParameters & pa
   return response;
 }
 
+TransferResult InternalSubscription::Transfer(const NodeId & session, std::function<void (PublishResult)> callback, bool sendInitialValues)
+{
+  LOG_DEBUG(Logger, "internal_subscription | id: {}, transfer to session: {}", Data.SubscriptionId, session);
+
+  TransferResult result;
+  std::vector<MonitoredDataChange> items;
+  {
+    // not PublishMutex: results are forwarded with it held, the transport calls this while sending
+    boost::unique_lock<boost::shared_mutex> lock(DbMutex);
+
+    CurrentSession = session;
+    Callback = callback;
+    Statistics->SetSession(Service.GetSessionId(session));
+
+    result.Status = StatusCode::Good;
+
+    for (const PublishResult & res : NotAcknowledgedResults)
+      {
+        result.AvailableSequenceNumbers.push_back(res.NotificationMessage.SequenceNumber);
+      }
+
+    if (sendInitialValues)
+      {
+        for (const auto & pair : MonitoredDataChanges)
+          {
+            if (pair.second.ItemToMonitor.AttributeId != AttributeId::EventNotifier)
+              {
+                items.push_back(pair.second);
+              }
+          }
+      }
+  }
+
+  // reads the address space, see CreateMonitoredItem
+  for (const MonitoredDataChange & item : items)
+    {
+      TriggerDataChangeEvent(item, item.ItemToMonitor);
+    }
+
+  return result;
+}
+
 ModifySubscriptionResult InternalSubscription::ModifySubscription(const ModifySubscriptionParameters & data)
 {
   LOG_DEBUG(Logger, "internal_subscription | id: {}, ModifySubscription", Data.SubscriptionId);
@@ -230,6 +480,7 @@ ModifySubscriptionResult InternalSubscription::ModifySubscription(const ModifySu
     }
 
   LifeTimeCount = result.RevisedLifetimeCount = Data.RevisedLifetimeCount;
+  Statistics->MaxLifetimeCount.store(LifeTimeCount, std::memory_order_relaxed);
 
   if (data.RequestedPublishingInterval)
     {
@@ -237,6 +488,7 @@ ModifySubscriptionResult InternalSubscription::ModifySubscription(const ModifySu
     }
 
   result.RevisedPublishingInterval = Data.RevisedPublishingInterval;
+  Statistics->PublishingInterval.store(Data.RevisedPublishingInterval, std::memory_order_relaxed);
 
   if (data.RequestedMaxKeepAliveCount)
     {
@@ -244,6 +496,7 @@ ModifySubscriptionResult InternalSubscription::ModifySubscription(const ModifySu
     }
 
   result.RevisedMaxKeepAliveCount = Data.RevisedMaxKeepAliveCount;
+  Statistics->MaxKeepAliveCount.store(Data.RevisedMaxKeepAliveCount, std::memory_order_relaxed);
 
   return result;
 }
@@ -267,6 +520,7 @@ void InternalSubscription::NewAcknowlegment(const SubscriptionAcknowledgement &
   boost::unique_lock<boost::shared_mutex> lock(DbMutex);
 
   NotAcknowledgedResults.remove_if([&](PublishResult res) { return ack.SequenceNumber == res.NotificationMessage.SequenceNumber; });
+  Statistics->UnacknowledgedMessageCount.store(NotAcknowledgedResults.size(), std::memory_order_relaxed);
 }
 
 
@@ -320,8 +574,10 @@ MonitoredItemCreateResult InternalSubscription::CreateMonitoredItem(const Monito
     mdata.TriggerCount = 0;
     mdata.ClientHandle = request.RequestedParameters.ClientHandle;
     mdata.CallbackHandle = callbackHandle;
+    mdata.ItemToMonitor = request.ItemToMonitor;
     mdata.MonitoredItemId = result.MonitoredItemId;
     MonitoredDataChanges[result.MonitoredItemId] = mdata;
+    Statistics->MonitoredItemCount.fetch_add(1, std::memory_order_relaxed);
   }
 
   // Do not lock this part as it (indirectly) calls a locked AddressSpaceInMemory
@@ -352,7 +608,14 @@ void InternalSubscription::TriggerDataChangeEvent(MonitoredDataChange monitoredi
   {
     boost::unique_lock<boost::shared_mutex> lock(DbMutex);
 
-    TriggeredDataChangeEvents.push_back(event);
+    if (Terminated)
+      {
+        return;
+      }
+
+    QueueDataChange(std::move(event));
+    LimitQueuedNotifications();
+    ScheduleEarlyPublish();
   }
 }
 
@@ -367,12 +630,14 @@ std::vector<StatusCode> InternalSubscription::DeleteMonitoredItemsIds(const std:
       if (DeleteMonitoredEvent(handle))
         {
           results.push_back(StatusCode::Good);
+          Statistics->MonitoredItemCount.fetch_sub(1, std::memory_order_relaxed);
           continue;
         }
 
       if (DeleteMonitoredDataChange(handle))
         {
           results.push_back(StatusCode::Good);
+          Statistics->MonitoredItemCount.fetch_sub(1, std::memory_order_relaxed);
           continue;
         }
 
@@ -413,7 +678,9 @@ bool InternalSubscription::DeleteMonitoredDataChange(uint32_t handle)
             {
               LOG_DEBUG(Logger, "internal_subscription | id: {}, remove TriggeredDataChangeEvents of MonitoredItemId: {}", Data.SubscriptionId, handle);
 
+              QueuedBytes -= ev->Size;
               ev = TriggeredDataChangeEvents.erase(ev);
+              DiscardQueuedNotification();
             }
 
           else
@@ -426,6 +693,132 @@ bool InternalSubscription::DeleteMonitoredDataChange(uint32_t handle)
     }
 }
 
+void InternalSubscription::DiscardQueuedNotification()
+{
+  Statistics->QueuedNotificationsCount.fetch_sub(1, std::memory_order_relaxed);
+  Statistics->DiscardedNotificationsCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::list<TriggeredDataChange>::iterator InternalSubscription::QueueDataChange(TriggeredDataChange event)
+{
+  event.Order = ++QueuedOrder;
+  event.Size = PublishParams.MaxQueuedNotificationBytes ? Binary::RawSize(event.Data) : 0;
+  QueuedBytes += event.Size;
+  Statistics->QueuedNotificationsCount.fetch_add(1, std::memory_order_relaxed);
+  return TriggeredDataChangeEvents.insert(TriggeredDataChangeEvents.end(), std::move(event));
+}
+
+void InternalSubscription::QueueEvent(TriggeredEvent event)
+{
+  event.Order = ++QueuedOrder;
+  event.Size = PublishParams.MaxQueuedNotificationBytes ? Binary::RawSize(event.Data) : 0;
+  QueuedBytes += event.Size;
+  Statistics->QueuedNotificationsCount.fetch_add(1, std::memory_order_relaxed);
+  TriggeredEvents.push_back(std::move(event));
+}
+
+bool InternalSubscription::HasQueuedNotifications() const
+{
+  return !TriggeredDataChangeEvents.empty() || !TriggeredEvents.empty() || (Terminated && !TerminationSent);
+}
+
+void InternalSubscription::LimitQueuedNotifications()
+{
+  // called with DbMutex held
+  const std::size_t limit = PublishParams.MaxQueuedNotificationBytes;
+
+  if (limit == 0 || QueuedBytes <= limit)
+    {
+      return;
+    }
+
+  if (PublishParams.Policy == Server::SlowConsumerPolicy::CloseSession)
+    {
+      LOG_WARN(Logger, "internal_subscription | id: {}, {} bytes of notifications queued, closing session", Data.SubscriptionId, QueuedBytes);
+      Terminated = true;
+      DropQueuedNotifications();
+      std::shared_ptr<InternalSubscription> self = shared_from_this();
+      io.post([self]() { self->Terminate(); });
+      return;
+    }
+
+  while (QueuedBytes > limit && (!TriggeredDataChangeEvents.empty() || !TriggeredEvents.empty()))
+    {
+      // coalesced data changes only hold the latest values, events go first
+      const bool dropEvent = !TriggeredEvents.empty() && (TriggeredDataChangeEvents.empty()
+                             || PublishParams.Policy == Server::SlowConsumerPolicy::CoalesceLatest
+                             || TriggeredEvents.front().Order < TriggeredDataChangeEvents.front().Order);
+
+      if (dropEvent)
+        {
+          QueuedBytes -= TriggeredEvents.front().Size;
+          TriggeredEvents.pop_front();
+        }
+
+      else
+        {
+          // a later change of the item can be queued again
+          MonitoredDataChangeMap::iterator it = MonitoredDataChanges.find(TriggeredDataChangeEvents.front().MonitoredItemId);
+
+          if (it != MonitoredDataChanges.end() && it->second.TriggerCount > 0 && it->second.Queued == TriggeredDataChangeEvents.begin())
+            {
+              it->second.TriggerCount = 0;
+            }
+
+          QueuedBytes -= TriggeredDataChangeEvents.front().Size;
+          TriggeredDataChangeEvents.pop_front();
+        }
+
+      DiscardQueuedNotification();
+    }
+}
+
+void InternalSubscription::Terminate()
+{
+  NodeId session;
+  {
+    std::lock_guard<std::mutex> publishLock(PublishMutex);
+    bool sent = false;
+    {
+      boost::shared_lock<boost::shared_mutex> lock(DbMutex);
+
+      // deleted meanwhile
+      if (Stopped)
+        {
+          return;
+        }
+
+      sent = TerminationSent;
+      session = CurrentSession;
+    }
+
+    // a client which has no publish request queued does not read anymore and gets no status change
+    if (!sent && Service.PopPublishRequest(session))
+      {
+        SendPublishResult();
+      }
+  }
+
+  Service.TerminateSession(session);
+}
+
+void InternalSubscription::DropQueuedNotifications()
+{
+  for (std::size_t i = TriggeredDataChangeEvents.size() + TriggeredEvents.size(); i > 0; --i)
+    {
+      DiscardQueuedNotification();
+    }
+
+  TriggeredDataChangeEvents.clear();
+  TriggeredEvents.clear();
+  QueuedBytes = 0;
+
+  for (auto & mdc : MonitoredDataChanges)
+    {
+      mdc.second.TriggerCount = 0;
+    }
+}
+
 bool InternalSubscription::DeleteMonitoredEvent(uint32_t handle)
 {
   boost::unique_lock<boost::shared_mutex> lock(DbMutex);
@@ -443,7 +836,9 @@ bool InternalSubscription::DeleteMonitoredEvent(uint32_t handle)
                 {
                   LOG_DEBUG(Logger, "internal_subscription | id: {}, remove TriggeredEvents of MonitoredItemId: {}", Data.SubscriptionId, handle);
 
+                  QueuedBytes -= ev->Size;
                   ev = TriggeredEvents.erase(ev);
+                  DiscardQueuedNotification();
                 }
 
               else
@@ -463,6 +858,11 @@ void InternalSubscription::DataChangeCallback(const uint32_t & m_id, const DataV
 {
   boost::unique_lock<boost::shared_mutex> lock(DbMutex);
 
+  if (Terminated)
+    {
+      return;
+    }
+
   TriggeredDataChange event;
   MonitoredDataChangeMap::iterator it_monitoreditem = MonitoredDataChanges.find(m_id);
 
@@ -478,6 +878,19 @@ void InternalSubscription::DataChangeCallback(const uint32_t & m_id, const DataV
   // triggered before
   if (monitoredDataChange.TriggerCount > 0)
     {
+      Statistics->MonitoringQueueOverflowCount.fetch_add(1, std::memory_order_relaxed);
+
+      // keep the latest value of the cycle instead of the first one
+      if (PublishParams.Policy == Server::SlowConsumerPolicy::CoalesceLatest)
+        {
+          TriggeredDataChange & queued = *monitoredDataChange.Queued;
+          queued.Data.Value = value;
+          QueuedBytes -= queued.Size;
+          queued.Size = PublishParams.MaxQueuedNotificationBytes ? Binary::RawSize(queued.Data) : 0;
+          QueuedBytes += queued.Size;
+          LimitQueuedNotifications();
+        }
+
       return;
     }
   event.MonitoredItemId = it_monitoreditem->first;
@@ -487,7 +900,9 @@ void InternalSubscription::DataChangeCallback(const uint32_t & m_id, const DataV
   LOG_DEBUG(Logger, "internal_subscription | id: {}, enqueue TriggeredDataChange event: ClientHandle: {}", Data.SubscriptionId, event.Data.ClientHandle);
 
   ++monitoredDataChange.TriggerCount;
-  TriggeredDataChangeEvents.push_back(event);
+  monitoredDataChange.Queued = QueueDataChange(std::move(event));
+  LimitQueuedNotifications();
+  ScheduleEarlyPublish();
 }
 
 void InternalSubscription::TriggerEvent(NodeId node, Event event)
@@ -513,6 +928,11 @@ bool InternalSubscription::EnqueueEvent(uint32_t monitoredItemId, const Event &
 
   boost::unique_lock<boost::shared_mutex> lock(DbMutex);
 
+  if (Terminated)
+    {
+      return false;
+    }
+
   //Find monitoredItem
   std::map<uint32_t, MonitoredDataChange>::iterator mii_it =  MonitoredDataChanges.find(monitoredItemId);
 
@@ -531,7 +951,9 @@ bool InternalSubscription::EnqueueEvent(uint32_t monitoredItemId, const Event &
   TriggeredEvent ev;
   ev.Data = fieldlist;
   ev.MonitoredItemId = monitoredItemId;
-  TriggeredEvents.push_back(ev);
+  QueueEvent(std::move(ev));
+  LimitQueuedNotifications();
+  ScheduleEarlyPublish();
   return true;
 }
 
@@ -6,16 +6,20 @@
 
 #include <opc/ua/event.h>
 #include <opc/ua/server/address_space.h>
+#include <opc/ua/server/subscription_service.h>
 #include <opc/ua/protocol/monitored_items.h>
 #include <opc/ua/protocol/strings.h>
 #include <opc/ua/protocol/string_utils.h>
 #include <opc/ua/services/attributes.h>
 
 #include <boost/asio.hpp>
+#include <boost/asio/steady_timer.hpp>
 #include <boost/thread/shared_mutex.hpp>
+#include <atomic>
 #include <chrono>
 #include <iostream>
 #include <list>
+#include <mutex>
 #include <vector>
 
 
@@ -26,28 +30,34 @@ namespace Internal
 
 class SubscriptionServiceInternal;
 
-//Structure to store description of a MonitoredItems
-struct MonitoredDataChange
-{
-  uint32_t MonitoredItemId;
-  MonitoringMode Mode;
-  time_t LastTrigger;
-  uint32_t TriggerCount;
-  MonitoredItemCreateResult Parameters;
-  uint32_t ClientHandle;
-  uint32_t CallbackHandle;
-};
-
 struct TriggeredDataChange
 {
   uint32_t MonitoredItemId;
   MonitoredItems Data;
+  uint64_t Order = 0;     // position among all queued notifications
+  std::size_t Size = 0;   // encoded size of Data
 };
 
 struct TriggeredEvent
 {
   uint32_t MonitoredItemId;
   EventFieldList Data;
+  uint64_t Order = 0;
+  std::size_t Size = 0;
+};
+
+//Structure to store description of a MonitoredItems
+struct MonitoredDataChange
+{
+  uint32_t MonitoredItemId;
+  MonitoringMode Mode;
+  time_t LastTrigger;
+  uint32_t TriggerCount;
+  MonitoredItemCreateResult Parameters;
+  uint32_t ClientHandle;
+  uint32_t CallbackHandle;
+  ReadValueId ItemToMonitor;
+  std::list<TriggeredDataChange>::iterator Queued; // queued change, valid while TriggerCount > 0
 };
 
 //typedef std::pair<NodeId, AttributeId> MonitoredItemsIndex;
@@ -56,11 +66,41 @@ typedef std::map<NodeId, uint32_t> MonitoredEventsMap;
 
 class AddressSpaceInMemory; //pre-declaration
 
+// Counters of a subscription. They are updated on the publishing path without
+// locking and read concurrently by GetSubscriptionDiagnostics().
+struct SubscriptionStatistics
+{
+  SubscriptionStatistics(const SubscriptionData & data, const NodeId & session);
+
+  Server::SubscriptionDiagnostics Snapshot() const;
+  void SetSession(const NodeId & session);
+
+  mutable std::mutex SessionMutex; // the session changes when the subscription is transferred
+  NodeId SessionId;
+  const uint32_t SubscriptionId;
+  std::atomic<double> PublishingInterval;
+  std::atomic<uint32_t> MaxKeepAliveCount;
+  std::atomic<uint32_t> MaxLifetimeCount;
+  std::atomic<uint32_t> PublishRequestCount;
+  std::atomic<uint32_t> RepublishRequestCount;
+  std::atomic<uint32_t> DataChangeNotificationsCount;
+  std::atomic<uint32_t> EventNotificationsCount;
+  std::atomic<uint32_t> NotificationsCount;
+  std::atomic<uint32_t> KeepAliveCount;
+  std::atomic<uint32_t> LatePublishRequestCount;
+  std::atomic<uint32_t> CurrentKeepAliveCount;
+  std::atomic<uint32_t> UnacknowledgedMessageCount;
+  std::atomic<uint32_t> QueuedNotificationsCount;
+  std::atomic<uint32_t> DiscardedNotificationsCount;
+  std::atomic<uint32_t> MonitoredItemCount;
+  std::atomic<uint32_t> MonitoringQueueOverflowCount;
+};
+
 
 class InternalSubscription : public std::enable_shared_from_this<InternalSubscription>
 {
 public:
-  InternalSubscription(SubscriptionServiceInternal & service, const SubscriptionData & data, const NodeId & SessionAuthenticationToken, std::function<void (PublishResult)> Callback, const Common::Logger::SharedPtr & logger);
+  InternalSubscription(SubscriptionServiceInternal & service, const SubscriptionData & data, const NodeId & SessionAuthenticationToken, std::function<void (PublishResult)> Callback, const Server::PublishParameters & publishParams, const Common::Logger::SharedPtr & logger);
   ~InternalSubscription();
   void Start();
   void Stop();
@@ -75,15 +115,32 @@ public:
   void TriggerEvent(NodeId node, Event event);
   RepublishResponse Republish(const RepublishParameters & params);
   ModifySubscriptionResult ModifySubscription(const ModifySubscriptionParameters & data);
+  std::shared_ptr<const SubscriptionStatistics> GetStatistics() const;
+  /// @brief Called for every publish request, in low latency mode queued notifications are sent at once.
+  void PublishRequestReceived(const NodeId & session);
+  /// @brief Moves the subscription to another session, results go to the given callback afterwards.
+  /// Queued notifications and the retransmission queue are kept.
+  TransferResult Transfer(const NodeId & session, std::function<void (PublishResult)> callback, bool sendInitialValues);
 
 private:
   void DeleteAllMonitoredItems();
   bool DeleteMonitoredEvent(uint32_t handle);
   bool DeleteMonitoredDataChange(uint32_t handle);
+  void DiscardQueuedNotification();
+  std::list<TriggeredDataChange>::iterator QueueDataChange(TriggeredDataChange event);
+  void QueueEvent(TriggeredEvent event);
+  void LimitQueuedNotifications();
+  void DropQueuedNotifications();
+  bool HasQueuedNotifications() const;
+  void Terminate();
   std::vector<PublishResult> PopPublishResult();
   bool HasPublishResult();
+  NodeId GetSession() const;
   NotificationData GetNotificationData();
   void PublishResults(const boost::system::error_code & error);
+  void PublishEarly(const boost::system::error_code & error);
+  void SendPublishResult();
+  void ScheduleEarlyPublish();
   std::vector<Variant> GetEventFields(const EventFilter & filter, const Event & event);
   void TriggerDataChangeEvent(MonitoredDataChange monitoreditems, ReadValueId attrval);
 
@@ -92,7 +149,7 @@ private:
   Server::AddressSpace & AddressSpace;
   mutable boost::shared_mutex DbMutex;
   SubscriptionData Data;
-  const NodeId CurrentSession;
+  NodeId CurrentSession; // changed by Transfer, guarded by DbMutex with Callback
   std::function<void (PublishResult)> Callback;
 
   uint32_t NotificationSequence = 1; //NotificationSequence start at 1! not 0
@@ -108,7 +165,20 @@ private:
   boost::asio::deadline_timer Timer;
   bool TimerStopped = false;
   uint32_t LifeTimeCount;
+  // low latency mode: notifications are sent by EarlyTimer between the publishing cycles
+  const Server::PublishParameters PublishParams;
+  boost::asio::steady_timer EarlyTimer;
+  bool EarlyPublishScheduled = false;
+  bool Stopped = false;
+  // slow consumer protection
+  std::size_t QueuedBytes = 0;
+  uint64_t QueuedOrder = 0;
+  bool Terminated = false;       // closed by SlowConsumerPolicy::CloseSession
+  bool TerminationSent = false;
+  std::chrono::steady_clock::time_point LastPublish;
+  std::mutex PublishMutex; // serializes the publishing cycle and early publishes
   Common::Logger::SharedPtr Logger;
+  std::shared_ptr<SubscriptionStatistics> Statistics;
 
 };
 
@@ -0,0 +1,421 @@
+/// @brief Bounded thread pool for the methods of the Call service.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include "method_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+
+namespace OpcUa
+{
+namespace Internal
+{
+
+MethodCallResults::MethodCallResults(std::size_t count, std::function<CallCompletion> done)
+  : Results(count)
+  , Remaining(count)
+  , Done(std::move(done))
+{
+}
+
+void MethodCallResults::Set(std::size_t index, CallMethodResult result)
+{
+  std::vector<CallMethodResult> results;
+
+  {
+    std::lock_guard<std::mutex> lock(Mutex);
+    Results[index] = std::move(result);
+
+    if (--Remaining != 0)
+      {
+        return;
+      }
+
+    results.swap(Results);
+  }
+
+  Done(std::move(results));
+}
+
+MethodCallCompletion::MethodCallCompletion(const std::shared_ptr<MethodCallResults> & results, std::size_t index, std::size_t inputsCount)
+  : Results(results)
+  , Index(index)
+  , InputsCount(inputsCount)
+{
+}
+
+MethodCallCompletion::~MethodCallCompletion()
+{
+  CallMethodResult result;
+  result.Status = StatusCode::BadInternalError;
+  Finish(std::move(result));
+}
+
+void MethodCallCompletion::Complete(const std::vector<Variant> & outputArguments)
+{
+  CallMethodResult result;
+  result.Status = StatusCode::Good;
+  result.InputArgumentResults.assign(InputsCount, StatusCode::Good);
+  result.OutputArguments = outputArguments;
+  Finish(std::move(result));
+}
+
+void MethodCallCompletion::Fail(StatusCode status)
+{
+  CallMethodResult result;
+  result.Status = status;
+  Finish(std::move(result));
+}
+
+bool MethodCallCompletion::IsFinished() const
+{
+  std::lock_guard<std::mutex> lock(Mutex);
+  return Finished;
+}
+
+void MethodCallCompletion::OnFinished(std::function<void()> finished)
+{
+  {
+    std::lock_guard<std::mutex> lock(Mutex);
+
+    if (!Finished)
+      {
+        FinishedCallback = std::move(finished);
+        return;
+      }
+  }
+
+  finished();
+}
+
+void MethodCallCompletion::Finish(CallMethodResult result)
+{
+  std::function<void()> finished;
+
+  {
+    std::lock_guard<std::mutex> lock(Mutex);
+
+    if (Finished)
+      {
+        return;
+      }
+
+    Finished = true;
+    finished.swap(FinishedCallback);
+  }
+
+  if (finished)
+    {
+      finished();
+    }
+
+  Results->Set(Index, std::move(result));
+}
+
+namespace
+{
+
+typedef std::chrono::steady_clock Clock;
+
+struct QueuedCall
+{
+  NodeId Method;
+  MethodPool::Runner Run;
+  std::shared_ptr<MethodCallCompletion> Completion;
+  Clock::time_point Deadline = Clock::time_point::max();
+};
+
+// pool whose worker is the current thread, if any
+thread_local const void * CurrentPool = nullptr;
+
+} // namespace
+
+// state shared by the threads and the calls running on them
+struct MethodPool::State
+{
+  State(const Server::MethodPoolParameters & params, const Common::Logger::SharedPtr & logger)
+    : Params(params)
+    , Logger(logger)
+  {
+  }
+
+  uint32_t GetLimit(const NodeId & method) const
+  {
+    const auto it = Params.MethodConcurrencyLimits.find(method);
+    return it != Params.MethodConcurrencyLimits.end() ? it->second : Params.MethodConcurrency;
+  }
+
+  /// @brief Take the first queued call whose method has a free slot, called under Mutex.
+  // Calls which timed out while queued are dropped, the ones the watchdog
+  // did not fail yet are added to expired.
+  bool TakeCall(QueuedCall & call, std::vector<std::shared_ptr<MethodCallCompletion>> & expired)
+  {
+    const Clock::time_point now = Clock::now();
+
+    for (auto it = Queue.begin(); it != Queue.end();)
+      {
+        if (it->Completion->IsFinished())
+          {
+            it = Queue.erase(it);
+            continue;
+          }
+
+        if (it->Deadline <= now)
+          {
+            expired.push_back(it->Completion);
+            it = Queue.erase(it);
+            continue;
+          }
+
+        const uint32_t limit = GetLimit(it->Method);
+
+        if (limit == 0 || Running[it->Method] < limit)
+          {
+            call = std::move(*it);
+            Queue.erase(it);
+            ++Running[call.Method];
+            return true;
+          }
+
+        ++it;
+      }
+
+    return false;
+  }
+
+  void Release(const NodeId & method)
+  {
+    {
+      std::lock_guard<std::mutex> lock(Mutex);
+      auto it = Running.find(method);
+
+      if (--it->second == 0)
+        {
+          Running.erase(it);
+        }
+    }
+
+    CallsChanged.notify_one();
+  }
+
+  const Server::MethodPoolParameters Params;
+  const Common::Logger::SharedPtr Logger;
+
+  std::mutex Mutex;
+  std::condition_variable CallsChanged;
+  std::condition_variable DeadlinesChanged;
+  std::deque<QueuedCall> Queue;
+  std::map<NodeId, uint32_t> Running; // calls holding a slot of a method
+  std::multimap<Clock::time_point, std::weak_ptr<MethodCallCompletion>> Deadlines;
+  bool Stopping = false;
+};
+
+void MethodPool::Work(const std::shared_ptr<State> & state)
+{
+  CurrentPool = state.get();
+  std::unique_lock<std::mutex> lock(state->Mutex);
+
+  while (!state->Stopping)
+    {
+      QueuedCall call;
+      std::vector<std::shared_ptr<MethodCallCompletion>> expired;
+      const bool taken = state->TakeCall(call, expired);
+
+      if (!taken && expired.empty())
+        {
+          state->CallsChanged.wait(lock);
+          continue;
+        }
+
+      lock.unlock();
+
+      for (const std::shared_ptr<MethodCallCompletion> & completion : expired)
+        {
+          completion->Fail(StatusCode::BadTimeout);
+        }
+
+      expired.clear();
+
+      if (taken)
+        {
+          // the slot is free once the method returned and its call is completed,
+          // so methods which time out still count until they return
+          std::shared_ptr<std::atomic<int>> holds = std::make_shared<std::atomic<int>>(2);
+          const NodeId method = call.Method;
+          std::function<void()> release = [state, method, holds]()
+          {
+            if (--*holds == 0)
+              {
+                state->Release(method);
+              }
+          };
+
+          call.Completion->OnFinished(release);
+          call.Run(call.Completion);
+          release();
+          // a released completion may finish the call, which needs the lock
+          call = QueuedCall();
+        }
+
+      lock.lock();
+    }
+}
+
+void MethodPool::Watch(const std::shared_ptr<State> & state)
+{
+  std::unique_lock<std::mutex> lock(state->Mutex);
+
+  while (!state->Stopping)
+    {
+      if (state->Deadlines.empty())
+        {
+          state->DeadlinesChanged.wait(lock);
+          continue;
+        }
+
+      const Clock::time_point now = Clock::now();
+
+      if (now < state->Deadlines.begin()->first)
+        {
+          state->DeadlinesChanged.wait_until(lock, state->Deadlines.begin()->first);
+          continue;
+        }
+
+      std::vector<std::shared_ptr<MethodCallCompletion>> expired;
+      const auto end = state->Deadlines.upper_bound(now);
+
+      for (auto it = state->Deadlines.begin(); it != end; ++it)
+        {
+          if (std::shared_ptr<MethodCallCompletion> completion = it->second.lock())
+            {
+              expired.push_back(completion);
+            }
+        }
+
+      state->Deadlines.erase(state->Deadlines.begin(), end);
+      lock.unlock();
+
+      for (const std::shared_ptr<MethodCallCompletion> & completion : expired)
+        {
+          completion->Fail(StatusCode::BadTimeout);
+        }
+
+      expired.clear();
+      lock.lock();
+    }
+}
+
+MethodPool::MethodPool(const Server::MethodPoolParameters & params, const Common::Logger::SharedPtr & logger)
+  : Shared(std::make_shared<State>(params, logger))
+{
+  const uint32_t threadsCount = std::max<uint32_t>(params.ThreadsCount, 1);
+
+  for (uint32_t i = 0; i < threadsCount; ++i)
+    {
+      Workers.emplace_back(Work, Shared);
+    }
+
+  if (params.Timeout.count() > 0)
+    {
+      Watchdog = std::thread(Watch, Shared);
+    }
+}
+
+MethodPool::~MethodPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(Shared->Mutex);
+    Shared->Stopping = true;
+  }
+
+  Shared->CallsChanged.notify_all();
+  Shared->DeadlinesChanged.notify_all();
+
+  for (std::thread & worker : Workers)
+    {
+      worker.join();
+    }
+
+  if (Watchdog.joinable())
+    {
+      Watchdog.join();
+    }
+
+  std::deque<QueuedCall> queued;
+
+  {
+    std::lock_guard<std::mutex> lock(Shared->Mutex);
+    queued.swap(Shared->Queue);
+  }
+
+  for (const QueuedCall & call : queued)
+    {
+      call.Completion->Fail(StatusCode::BadShutdown);
+    }
+}
+
+void MethodPool::Submit(const NodeId & method, Runner run, const std::shared_ptr<MethodCallCompletion> & completion)
+{
+  // a method calling methods would wait for threads of the pool it may hold all of
+  if (CurrentPool == Shared.get())
+    {
+      run(completion);
+      return;
+    }
+
+  bool accepted = false;
+  bool earliest = false;
+
+  {
+    std::lock_guard<std::mutex> lock(Shared->Mutex);
+
+    if (Shared->Stopping || Shared->Queue.size() >= Shared->Params.QueueSize)
+      {
+        LOG_WARN(Shared->Logger, "method_pool           | queue is full, rejecting call of method {}", method);
+      }
+
+    else
+      {
+        QueuedCall call;
+        call.Method = method;
+        call.Run = std::move(run);
+        call.Completion = completion;
+
+        if (Shared->Params.Timeout.count() > 0)
+          {
+            call.Deadline = Clock::now() + Shared->Params.Timeout;
+            const auto it = Shared->Deadlines.emplace(call.Deadline, completion);
+            earliest = it == Shared->Deadlines.begin();
+          }
+
+        Shared->Queue.push_back(std::move(call));
+
+        accepted = true;
+      }
+  }
+
+  if (!accepted)
+    {
+      completion->Fail(StatusCode::BadTooManyOperations);
+      return;
+    }
+
+  Shared->CallsChanged.notify_one();
+
+  if (earliest)
+    {
+      Shared->DeadlinesChanged.notify_one();
+    }
+}
+
+} // namespace Internal
+} // namespace OpcUa
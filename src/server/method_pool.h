@@ -0,0 +1,100 @@
+/// @brief Bounded thread pool for the methods of the Call service.
+/// Every method of a Call request gets a MethodCallCompletion, the request
+/// is answered once all of them finished. The pool limits the calls waiting
+/// for a thread, the calls of a method node running at once and the time
+/// of a call. A slot of a method is held until its call is completed, so
+/// asynchronous methods count until they finish as well.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#pragma once
+
+#include <opc/common/logger.h>
+#include <opc/ua/server/address_space.h>
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace OpcUa
+{
+namespace Internal
+{
+
+/// @brief Results of the methods of one Call request.
+class MethodCallResults
+{
+public:
+  MethodCallResults(std::size_t count, std::function<CallCompletion> done);
+
+  /// @brief Store the result of a method, the last one calls done.
+  void Set(std::size_t index, CallMethodResult result);
+
+private:
+  std::mutex Mutex;
+  std::vector<CallMethodResult> Results;
+  std::size_t Remaining;
+  std::function<CallCompletion> Done;
+};
+
+/// @brief Completion of one method of a Call request.
+class MethodCallCompletion : public Server::MethodCompletion
+{
+public:
+  MethodCallCompletion(const std::shared_ptr<MethodCallResults> & results, std::size_t index, std::size_t inputsCount);
+  ~MethodCallCompletion() override;
+
+  void Complete(const std::vector<Variant> & outputArguments) override;
+  void Fail(StatusCode status) override;
+
+  bool IsFinished() const;
+  /// @brief Call finished when the call is completed or at once if it already is.
+  void OnFinished(std::function<void()> finished);
+
+private:
+  void Finish(CallMethodResult result);
+
+private:
+  const std::shared_ptr<MethodCallResults> Results;
+  const std::size_t Index;
+  const std::size_t InputsCount;
+  mutable std::mutex Mutex;
+  bool Finished = false;
+  std::function<void()> FinishedCallback;
+};
+
+class MethodPool
+{
+public:
+  typedef std::function<void (const std::shared_ptr<MethodCallCompletion> & completion)> Runner;
+
+  MethodPool(const Server::MethodPoolParameters & params, const Common::Logger::SharedPtr & logger);
+  /// @brief Stop the threads and fail the queued calls with BadShutdown.
+  // Running calls are waited for, asynchronous calls may complete later.
+  ~MethodPool();
+
+  /// @brief Queue a call of a method node, fails it with BadTooManyOperations if the queue is full.
+  // A call submitted by a method running on the pool runs at once on the same
+  // thread, without the limits of the pool.
+  void Submit(const NodeId & method, Runner run, const std::shared_ptr<MethodCallCompletion> & completion);
+
+private:
+  struct State;
+
+  static void Work(const std::shared_ptr<State> & state);
+  static void Watch(const std::shared_ptr<State> & state);
+
+private:
+  const std::shared_ptr<State> Shared;
+  std::vector<std::thread> Workers;
+  std::thread Watchdog;
+};
+
+} // namespace Internal
+} // namespace OpcUa
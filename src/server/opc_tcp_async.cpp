@@ -30,8 +30,11 @@
 
 #include <array>
 #include <boost/asio.hpp>
+#include <chrono>
+#include <deque>
 #include <future>
 #include <iostream>
+#include <mutex>
 #include <set>
 
 
@@ -55,7 +58,7 @@ public:
   DEFINE_CLASS_POINTERS(OpcTcpServer)
 
 public:
-  OpcTcpServer(const AsyncOpcTcp::Parameters & params, Services::SharedPtr server, boost::asio::io_service & ioService, const Common::Logger::SharedPtr & logger);
+  OpcTcpServer(const AsyncOpcTcp::Parameters & params, Services::SharedPtr server, boost::asio::io_service & ioService, const Common::Logger::SharedPtr & logger, OpcUa::Server::ServiceMetrics::SharedPtr metrics);
 
   virtual void Listen() override;
   virtual void Shutdown() override;
@@ -71,6 +74,8 @@ private:
   Parameters Params;
   Services::SharedPtr Server;
   Common::Logger::SharedPtr Logger;
+  OpcUa::Server::ServiceMetrics::SharedPtr Metrics;
+  OpcUa::Server::SessionManager::SharedPtr Sessions; // sessions outlive their connections
   std::mutex Mutex;
   std::set<std::shared_ptr<OpcTcpConnection>> Clients;
 
@@ -125,6 +130,15 @@ private:
 
 private:
   virtual void Send(const char * message, std::size_t size);
+  void WriteNext();
+  void WriteCompleted(const boost::system::error_code & err);
+  bool IsSendStalled() const;
+  void CloseStalled();
+  void CloseWhenSent();
+  void CloseSocket();
+  void StartStallTimer();
+  std::shared_ptr<std::vector<char>> TakeSendBuffer();
+  void ReturnSendBuffer(const std::shared_ptr<std::vector<char>> & data);
   void FillResponseHeader(const RequestHeader & requestHeader, ResponseHeader & responseHeader) const;
 
 private:
@@ -134,6 +148,20 @@ private:
   OStreamBinary OStream;
   Common::Logger::SharedPtr Logger;
   std::vector<char> Buffer;
+  // buffers of sent responses, reused to avoid an allocation per response
+  std::mutex SendBuffersMutex;
+  std::vector<std::shared_ptr<std::vector<char>>> SendBuffers;
+  // responses waiting for the write in flight, only one async_write is pending at a time
+  std::mutex SendQueueMutex;
+  std::deque<std::shared_ptr<std::vector<char>>> SendQueue;
+  std::size_t SendQueueBytes = 0;
+  bool Writing = false;
+  bool Closing = false;
+  bool CloseAfterSend = false; // the session was terminated, close once the queued responses are written
+  std::chrono::steady_clock::time_point WriteStarted;
+  uint64_t WriteCount = 0;
+  // detects a write which does not complete even if nothing else is sent
+  boost::asio::steady_timer StallTimer;
 };
 
 OpcTcpConnection::OpcTcpConnection(tcp::socket socket, OpcTcpServer & tcpServer, const Common::Logger::SharedPtr & logger)
@@ -142,6 +170,11 @@ OpcTcpConnection::OpcTcpConnection(tcp::socket socket, OpcTcpServer & tcpServer,
   , OStream(*this)
   , Logger(logger)
   , Buffer(8192)
+#if BOOST_VERSION < 107000
+  , StallTimer(Socket.get_io_service())
+#else
+  , StallTimer(Socket.get_executor())
+#endif
 {
 }
 
@@ -152,7 +185,17 @@ OpcTcpConnection::SharedPtr OpcTcpConnection::create(tcp::socket socket, OpcTcpS
   // you must not take a shared_ptr in a constructor
   // to give OpcTcpConnection as a shared_ptr to MessageProcessor
   // we have to add this helper function
-  result->MessageProcessor = std::make_shared<Server::OpcTcpMessages>(uaServer, result, logger);
+  result->MessageProcessor = std::make_shared<Server::OpcTcpMessages>(uaServer, result, logger, tcpServer.Metrics, tcpServer.Sessions);
+  std::weak_ptr<OpcTcpConnection> weakResult = result;
+  result->MessageProcessor->SetCloseHandler([weakResult]()
+  {
+    SharedPtr self = weakResult.lock();
+
+    if (self)
+      {
+        self->CloseWhenSent();
+      }
+  });
   return result;
 }
 
@@ -242,7 +285,7 @@ void OpcTcpConnection::ProcessMessage(OpcUa::Binary::MessageType type, const boo
 
   try
     {
-      cont = MessageProcessor->ProcessMessage(type, messageStream);
+      cont = MessageProcessor->ProcessMessage(type, messageStream, GetHeaderSize() + bytesTransferred);
     }
 
   catch (const std::exception & exc)
@@ -277,33 +320,231 @@ void OpcTcpConnection::GoodBye()
 
 void OpcTcpConnection::Send(const char * message, std::size_t size)
 {
-  std::shared_ptr<std::vector<char>> data = std::make_shared<std::vector<char>>(message, message + size);
+  std::shared_ptr<std::vector<char>> data = TakeSendBuffer();
+  data->assign(message, message + size);
 
   LOG_TRACE(Logger, "opc_tcp_async         | send message: {}", ToHexDump(*data));
 
+  std::lock_guard<std::mutex> lock(SendQueueMutex);
+
+  if (Closing)
+    {
+      return;
+    }
+
+  SendQueue.push_back(data);
+  SendQueueBytes += size;
+
+  if (IsSendStalled())
+    {
+      CloseStalled();
+      return;
+    }
+
+  if (!Writing)
+    {
+      WriteNext();
+    }
+}
+
+void OpcTcpConnection::WriteNext()
+{
+  // called with SendQueueMutex held
+  Writing = true;
+  WriteStarted = std::chrono::steady_clock::now();
+  ++WriteCount;
+  StartStallTimer();
+
   // do not lose reference to shared instance even if another
   // async operation decides to call GoodBye()
   OpcTcpConnection::SharedPtr self = shared_from_this();
-  async_write(Socket, buffer(&(*data)[0], data->size()), [self, data](const boost::system::error_code & err, size_t bytes)
+  const std::shared_ptr<std::vector<char>> & data = SendQueue.front();
+  async_write(Socket, buffer(&(*data)[0], data->size()), [self](const boost::system::error_code & err, size_t bytes)
+  {
+    self->WriteCompleted(err);
+  });
+}
+
+void OpcTcpConnection::WriteCompleted(const boost::system::error_code & err)
+{
+  std::shared_ptr<std::vector<char>> data;
+  {
+    std::lock_guard<std::mutex> lock(SendQueueMutex);
+
+    data = std::move(SendQueue.front());
+    SendQueue.pop_front();
+    SendQueueBytes -= data->size();
+    Writing = false;
+
+    if (err || Closing)
+      {
+        SendQueue.clear();
+        SendQueueBytes = 0;
+      }
+
+    else if (!SendQueue.empty())
+      {
+        WriteNext();
+      }
+
+    else if (CloseAfterSend)
+      {
+        Closing = true;
+        CloseSocket();
+      }
+  }
+
+  ReturnSendBuffer(data);
+
+  if (err)
+    {
+      LOG_ERROR(Logger, "opc_tcp_async         | failed to send data: {}", err.message());
+      GoodBye();
+      return;
+    }
+
+  LOG_DEBUG(Logger, "opc_tcp_async         | response sent");
+}
+
+bool OpcTcpConnection::IsSendStalled() const
+{
+  // called with SendQueueMutex held
+  const OpcUa::Server::AsyncOpcTcp::Parameters & params = TcpServer.Params;
+
+  if (params.MaxSendQueueBytes && SendQueueBytes > params.MaxSendQueueBytes)
+    {
+      return true;
+    }
+
+  return params.SendStallTimeout && Writing && std::chrono::steady_clock::now() - WriteStarted > std::chrono::seconds(params.SendStallTimeout);
+}
+
+void OpcTcpConnection::CloseStalled()
+{
+  // called with SendQueueMutex held
+  LOG_WARN(Logger, "opc_tcp_async         | client does not read responses, {} bytes queued, closing connection", SendQueueBytes);
+
+  Closing = true;
+
+  if (!Writing)
+    {
+      SendQueue.clear();
+      SendQueueBytes = 0;
+    }
+
+  CloseSocket();
+}
+
+void OpcTcpConnection::CloseWhenSent()
+{
+  std::lock_guard<std::mutex> lock(SendQueueMutex);
+
+  if (Closing)
+    {
+      return;
+    }
+
+  CloseAfterSend = true;
+
+  if (!Writing)
+    {
+      Closing = true;
+      CloseSocket();
+    }
+}
+
+void OpcTcpConnection::StartStallTimer()
+{
+  // called with SendQueueMutex held
+  const unsigned timeout = TcpServer.Params.SendStallTimeout;
+
+  if (!timeout)
+    {
+      return;
+    }
+
+  const uint64_t write = WriteCount;
+  std::weak_ptr<OpcTcpConnection> weakSelf = shared_from_this();
+  StallTimer.expires_from_now(std::chrono::seconds(timeout));
+  StallTimer.async_wait([weakSelf, write](const boost::system::error_code & error)
   {
-    if (err)
+    OpcTcpConnection::SharedPtr self = weakSelf.lock();
+
+    if (error || !self)
       {
-        LOG_ERROR(self->Logger, "opc_tcp_async         | failed to send data: {}", err.message());
-        self->GoodBye();
         return;
       }
 
-    LOG_DEBUG(self->Logger, "opc_tcp_async         | response sent");
+    std::lock_guard<std::mutex> lock(self->SendQueueMutex);
+
+    if (self->Writing && self->WriteCount == write && !self->Closing)
+      {
+        self->CloseStalled();
+      }
   });
 }
 
-OpcTcpServer::OpcTcpServer(const AsyncOpcTcp::Parameters & params, Services::SharedPtr server, boost::asio::io_service & ioService, const Common::Logger::SharedPtr & logger)
+void OpcTcpConnection::CloseSocket()
+{
+  // called with SendQueueMutex held
+  // the pending read and write fail and end the connection
+  OpcTcpConnection::SharedPtr self = shared_from_this();
+  auto close = [self]()
+  {
+    boost::system::error_code ec;
+    self->Socket.close(ec);
+  };
+#if BOOST_VERSION < 107000
+  Socket.get_io_service().post(close);
+#else
+  post(Socket.get_executor(), close);
+#endif
+}
+
+std::shared_ptr<std::vector<char>> OpcTcpConnection::TakeSendBuffer()
+{
+  std::lock_guard<std::mutex> lock(SendBuffersMutex);
+
+  if (SendBuffers.empty())
+    {
+      return std::make_shared<std::vector<char>>();
+    }
+
+  std::shared_ptr<std::vector<char>> data = std::move(SendBuffers.back());
+  SendBuffers.pop_back();
+  return data;
+}
+
+void OpcTcpConnection::ReturnSendBuffer(const std::shared_ptr<std::vector<char>> & data)
+{
+  // keep a few buffers, large ones are released to not hold the memory of a single big response
+  const std::size_t maxBuffers = 4;
+  const std::size_t maxBufferSize = 1024 * 1024;
+
+  if (data->capacity() > maxBufferSize)
+    {
+      return;
+    }
+
+  std::lock_guard<std::mutex> lock(SendBuffersMutex);
+
+  if (SendBuffers.size() < maxBuffers)
+    {
+      SendBuffers.push_back(data);
+    }
+}
+
+OpcTcpServer::OpcTcpServer(const AsyncOpcTcp::Parameters & params, Services::SharedPtr server, boost::asio::io_service & ioService, const Common::Logger::SharedPtr & logger, OpcUa::Server::ServiceMetrics::SharedPtr metrics)
   : Params(params)
   , Server(server)
   , Logger(logger)
+  , Metrics(metrics)
+  , Sessions(std::make_shared<OpcUa::Server::SessionManager>(server, &ioService, logger, metrics))
   , socket(ioService)
   , acceptor(ioService)
 {
+  Sessions->Start();
+
   tcp::endpoint ep;
 
   if (params.Host.empty())
@@ -370,6 +611,8 @@ void OpcTcpServer::Shutdown()
     Clients.clear();
   }
 
+  Sessions->Shutdown();
+
   /* queue a dummy operation to io_service to make sure we do not return
    * until all existing async io requests of this instance are actually
    * processed
@@ -398,6 +641,10 @@ void OpcTcpServer::Accept()
         if (!errorCode)
           {
             LOG_DEBUG(Logger, "opc_tcp_async         | accepted new client connection");
+            // responses are small and often sent back to back, e.g. Publish
+            // responses, do not hold them back waiting for acknowledgments
+            boost::system::error_code optionError;
+            socket.set_option(tcp::no_delay(true), optionError);
             OpcTcpConnection::SharedPtr connection = OpcTcpConnection::create(std::move(socket), *this, Server, Logger);
             {
               std::unique_lock<std::mutex> lock(Mutex);
@@ -429,7 +676,7 @@ void OpcTcpServer::RemoveClient(OpcTcpConnection::SharedPtr client)
 
 } // namespace
 
-OpcUa::Server::AsyncOpcTcp::UniquePtr OpcUa::Server::CreateAsyncOpcTcp(const OpcUa::Server::AsyncOpcTcp::Parameters & params, Services::SharedPtr server, boost::asio::io_service & io, const Common::Logger::SharedPtr & logger)
+OpcUa::Server::AsyncOpcTcp::UniquePtr OpcUa::Server::CreateAsyncOpcTcp(const OpcUa::Server::AsyncOpcTcp::Parameters & params, Services::SharedPtr server, boost::asio::io_service & io, const Common::Logger::SharedPtr & logger, ServiceMetrics::SharedPtr metrics)
 {
-  return AsyncOpcTcp::UniquePtr(new OpcTcpServer(params, server, io, logger));
+  return AsyncOpcTcp::UniquePtr(new OpcTcpServer(params, server, io, logger, metrics));
 }
@@ -25,6 +25,7 @@
 #include <opc/ua/server/addons/asio_addon.h>
 #include <opc/ua/server/addons/endpoints_services.h>
 #include <opc/ua/server/addons/opc_tcp_async.h>
+#include <opc/ua/server/addons/service_metrics.h>
 #include <opc/ua/server/addons/services_registry.h>
 #include <opc/ua/server/opc_tcp_async.h>
 
@@ -95,9 +96,10 @@ void AsyncOpcTcpAddon::Initialize(Common::AddonsManager & addons, const Common::
   PublishApplicationsInformation(applicationDescriptions, endpointDescriptions, addons);
   OpcUa::Server::ServicesRegistry::SharedPtr internalServer = addons.GetAddon<OpcUa::Server::ServicesRegistry>(OpcUa::Server::ServicesRegistryAddonId);
   OpcUa::Server::AsioAddon::SharedPtr asio = addons.GetAddon<OpcUa::Server::AsioAddon>(OpcUa::Server::AsioAddonId);
+  OpcUa::Server::ServiceMetricsAddon::SharedPtr metrics = addons.GetAddon<OpcUa::Server::ServiceMetricsAddon>(OpcUa::Server::ServiceMetricsAddonId);
 
   params.Port = Common::Uri(endpointDescriptions[0].EndpointUrl).Port();
-  Endpoint = CreateAsyncOpcTcp(params, internalServer->GetServer(), asio->GetIoService(), Logger);
+  Endpoint = CreateAsyncOpcTcp(params, internalServer->GetServer(), asio->GetIoService(), Logger, metrics->GetMetrics());
   Endpoint->Listen();
 }
 
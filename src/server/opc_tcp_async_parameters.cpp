@@ -33,6 +33,12 @@ AsyncOpcTcp::Parameters GetOpcTcpParameters(const Common::AddonParameters & addo
     {
       if (param.Name == "debug")
         { result.DebugMode = param.Value == "false" || param.Value == "0" ? false : true; }
+
+      else if (param.Name == "max_send_queue_bytes")
+        { result.MaxSendQueueBytes = std::stoul(param.Value); }
+
+      else if (param.Name == "send_stall_timeout")
+        { result.SendStallTimeout = std::stoul(param.Value); }
     }
 
   return result;
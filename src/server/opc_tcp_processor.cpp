@@ -10,6 +10,7 @@
 
 #include "opc_tcp_processor.h"
 
+#include "encoded_responses.h"
 #include "opcua_protocol.h"
 
 #include <opc/common/uri_facade.h>
@@ -27,7 +28,11 @@
 #include <opc/ua/server/addons/endpoints_services.h>
 #include <opc/ua/server/addons/opcua_protocol.h>
 #include <opc/ua/server/addons/services_registry.h>
+#include <opc/ua/server/subscription_service.h>
+#include <opc/ua/server/trace_ring.h>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <iostream>
 #include <list>
@@ -36,6 +41,16 @@
 #include <sstream>
 #include <queue>
 
+namespace
+{
+
+uint32_t GenerateConnectionId()
+{
+  static std::atomic<uint32_t> connectionId(0);
+  return ++connectionId;
+}
+
+}
 
 namespace OpcUa
 {
@@ -44,7 +59,7 @@ namespace Server
 
 using namespace OpcUa::Binary;
 
-OpcTcpMessages::OpcTcpMessages(OpcUa::Services::SharedPtr server, OpcUa::OutputChannel::SharedPtr outputChannel, const Common::Logger::SharedPtr & logger)
+OpcTcpMessages::OpcTcpMessages(OpcUa::Services::SharedPtr server, OpcUa::OutputChannel::SharedPtr outputChannel, const Common::Logger::SharedPtr & logger, ServiceMetrics::SharedPtr metrics, SessionManager::SharedPtr sessions)
   : Server(server)
   , OutputChannel(outputChannel)
   // do not create a reference loop - if OutputStream is called with a
@@ -52,22 +67,26 @@ OpcTcpMessages::OpcTcpMessages(OpcUa::Services::SharedPtr server, OpcUa::OutputC
   // pointer
   , OutputStream(*outputChannel)
   , Logger(logger)
+  , Metrics(metrics)
+  , Sessions(sessions ? sessions : std::make_shared<SessionManager>(server, nullptr, logger, metrics))
+  , ConnectionId(GenerateConnectionId())
   , ChannelId(1)
   , TokenId(2)
-  , SessionId(GenerateSessionId())
   , SequenceNb(0)
 {
   //LOG_INFO(Logger, "opc_tcp_processor     | log level: {}", Logger->level());
-  LOG_INFO(Logger, "opc_tcp_processor     | SessionId; {}", SessionId);
+  OPCUA_TRACE(ConnectionId, 0, INVALID, ConnectionOpened);
 }
 
 
 OpcTcpMessages::~OpcTcpMessages()
 {
-  // This is a hack, we cannot leave subscriptions running since they have a callback to us
+  OPCUA_TRACE(ConnectionId, 0, INVALID, ConnectionClosed);
+
+  // the session keeps its subscriptions until it times out or is activated on another connection
   try
     {
-      DeleteAllSubscriptions();
+      Sessions->DetachSession(CurrentSession, this);
     }
 
   catch (const std::exception & exc)
@@ -76,9 +95,15 @@ OpcTcpMessages::~OpcTcpMessages()
     }
 }
 
-bool OpcTcpMessages::ProcessMessage(MessageType msgType, IStreamBinary & iStream)
+bool OpcTcpMessages::ProcessMessage(MessageType msgType, IStreamBinary & iStream, std::size_t messageSize)
 {
-  std::lock_guard<std::mutex> lock(ProcessMutex);
+  std::lock_guard<std::recursive_mutex> lock(ProcessMutex);
+
+  if (Closing)
+    {
+      LOG_WARN(Logger, "opc_tcp_processor     | ignoring message for a terminated session");
+      return false;
+    }
 
   switch (msgType)
     {
@@ -111,7 +136,7 @@ bool OpcTcpMessages::ProcessMessage(MessageType msgType, IStreamBinary & iStream
     {
       LOG_DEBUG(Logger, "opc_tcp_processor     | processing secure message");
 
-      ProcessRequest(iStream, OutputStream);
+      ProcessRequest(iStream, OutputStream, messageSize);
       break;
     }
 
@@ -140,9 +165,9 @@ bool OpcTcpMessages::ProcessMessage(MessageType msgType, IStreamBinary & iStream
   return true;
 }
 
-void OpcTcpMessages::ForwardPublishResponse(const PublishResult result)
+void OpcTcpMessages::ForwardPublishResponse(PublishResult result)
 {
-  std::lock_guard<std::mutex> lock(ProcessMutex);
+  std::lock_guard<std::recursive_mutex> lock(ProcessMutex);
 
   LOG_DEBUG(Logger, "opc_tcp_processor     | sending PublishResult to client");
 
@@ -167,7 +192,7 @@ void OpcTcpMessages::ForwardPublishResponse(const PublishResult result)
   PublishResponse response;
 
   FillResponseHeader(requestData.requestHeader, response.Header);
-  response.Parameters = result;
+  response.Parameters = std::move(result);
 
   requestData.sequence.SequenceNumber = ++SequenceNb;
 
@@ -178,7 +203,77 @@ void OpcTcpMessages::ForwardPublishResponse(const PublishResult result)
 
   LOG_DEBUG(Logger, "opc_tcp_processor     | sending PublishResponse with: {} PublishResults", response.Parameters.NotificationMessage.NotificationData.size());
 
+  const RequestMetrics::Clock::time_point start = RequestMetrics::Clock::now();
   OutputStream << secureHeader << requestData.algorithmHeader << requestData.sequence << response << flush;
+  OPCUA_TRACE(ConnectionId, requestData.requestHeader.RequestHandle, PUBLISH_REQUEST, PublishSent);
+
+  if (Metrics)
+    {
+      ServiceCounters & counters = Metrics->GetCounters(PUBLISH_REQUEST);
+      counters.EncodeTime.Record(std::chrono::duration_cast<std::chrono::nanoseconds>(RequestMetrics::Clock::now() - start).count());
+      counters.BytesOut.fetch_add(secureHeader.Size, std::memory_order_relaxed);
+    }
+}
+
+void OpcTcpMessages::Close()
+{
+  std::function<void ()> handler;
+  {
+    std::lock_guard<std::recursive_mutex> lock(ProcessMutex);
+
+    LOG_WARN(Logger, "opc_tcp_processor     | closing connection of a terminated session");
+
+    Closing = true;
+    std::queue<PublishRequestElement>().swap(PublishRequestQueue);
+    handler = CloseHandler;
+  }
+
+  if (handler)
+    {
+      handler();
+    }
+}
+
+void OpcTcpMessages::SetCloseHandler(std::function<void ()> handler)
+{
+  std::lock_guard<std::recursive_mutex> lock(ProcessMutex);
+  CloseHandler = handler;
+}
+
+void OpcTcpMessages::ForwardCallResponse(Binary::SequenceHeader sequence, const Binary::SymmetricAlgorithmHeader & algorithmHeader, const RequestHeader & requestHeader, std::vector<CallMethodResult> results)
+{
+  // the methods may complete synchronously while the request is processed
+  std::lock_guard<std::recursive_mutex> lock(ProcessMutex);
+
+  OpcUa::OutputChannel::SharedPtr outputChannel = OutputChannel.lock();
+
+  if (!outputChannel)
+    {
+      LOG_WARN(Logger, "opc_tcp_processor     | connection closed before methods completed");
+      return;
+    }
+
+  CallResponse response;
+  FillResponseHeader(requestHeader, response.Header);
+  response.Results = std::move(results);
+
+  sequence.SequenceNumber = ++SequenceNb;
+
+  SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
+  secureHeader.AddSize(RawSize(algorithmHeader));
+  secureHeader.AddSize(RawSize(sequence));
+  secureHeader.AddSize(RawSize(response));
+
+  const RequestMetrics::Clock::time_point start = RequestMetrics::Clock::now();
+  OutputStream << secureHeader << algorithmHeader << sequence << response << flush;
+  OPCUA_TRACE(ConnectionId, requestHeader.RequestHandle, CALL_REQUEST, RequestEnd);
+
+  if (Metrics)
+    {
+      ServiceCounters & counters = Metrics->GetCounters(CALL_REQUEST);
+      counters.EncodeTime.Record(std::chrono::duration_cast<std::chrono::nanoseconds>(RequestMetrics::Clock::now() - start).count());
+      counters.BytesOut.fetch_add(secureHeader.Size, std::memory_order_relaxed);
+    }
 }
 
 void OpcTcpMessages::HelloClient(IStreamBinary & istream, OStreamBinary & ostream)
@@ -264,8 +359,10 @@ void OpcTcpMessages::CloseChannel(IStreamBinary & istream)
   istream >> request;
 }
 
-void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ostream)
+void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ostream, std::size_t messageSize)
 {
+  RequestMetrics metrics(Metrics.get(), messageSize);
+
   uint32_t channelId = 0;
   istream >> channelId;
 
@@ -291,6 +388,7 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
           RawSize(requestHeader);
   */
   const OpcUa::MessageId message = GetMessageId(typeId);
+  metrics.SetService(message, ConnectionId, requestHeader.RequestHandle);
 
   switch (message)
     {
@@ -300,16 +398,20 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
 
       GetEndpointsParameters filter;
       istream >> filter;
+      metrics.Decoded();
 
       GetEndpointsResponse response;
       FillResponseHeader(requestHeader, response.Header);
       response.Endpoints = Server->Endpoints()->GetEndpoints(filter);
 
+      metrics.Serviced(response.Header.ServiceResult);
+
       SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
       secureHeader.AddSize(RawSize(algorithmHeader));
       secureHeader.AddSize(RawSize(sequence));
       secureHeader.AddSize(RawSize(response));
       ostream << secureHeader << algorithmHeader << sequence << response << flush;
+      metrics.Sent(secureHeader.Size);
       return;
     }
 
@@ -319,16 +421,20 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
 
       FindServersParameters params;
       istream >> params;
+      metrics.Decoded();
 
       FindServersResponse response;
       FillResponseHeader(requestHeader, response.Header);
       response.Data.Descriptions = Server->Endpoints()->FindServers(params);
 
+      metrics.Serviced(response.Header.ServiceResult);
+
       SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
       secureHeader.AddSize(RawSize(algorithmHeader));
       secureHeader.AddSize(RawSize(sequence));
       secureHeader.AddSize(RawSize(response));
       ostream << secureHeader << algorithmHeader << sequence << response << flush;
+      metrics.Sent(secureHeader.Size);
       return;
     }
 
@@ -338,17 +444,36 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
 
       NodesQuery query;
       istream >> query;
+      metrics.Decoded();
+
+      EncodedBrowseResponse response;
 
-      BrowseResponse response;
-      response.Results =  Server->Views()->Browse(query);
+      if (AddressSpace::SharedPtr addressSpace = std::dynamic_pointer_cast<AddressSpace>(Server->Views()))
+        {
+          // cached results come with the encodings of their references
+          response.Results = addressSpace->BrowseEncoded(query);
+        }
+
+      else
+        {
+          for (BrowseResult & result : Server->Views()->Browse(query))
+            {
+              EncodedBrowseResult encoded;
+              encoded.Result = std::move(result);
+              response.Results.push_back(std::move(encoded));
+            }
+        }
 
       FillResponseHeader(requestHeader, response.Header);
 
+      metrics.Serviced(response.Header.ServiceResult);
+
       SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
       secureHeader.AddSize(RawSize(algorithmHeader));
       secureHeader.AddSize(RawSize(sequence));
       secureHeader.AddSize(RawSize(response));
       ostream << secureHeader << algorithmHeader << sequence << response << flush;
+      metrics.Sent(secureHeader.Size);
       return;
     }
 
@@ -356,6 +481,7 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
     {
       ReadParameters params;
       istream >> params;
+      metrics.Decoded();
 
       if (Logger && Logger->should_log(spdlog::level::debug))
         {
@@ -372,11 +498,17 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
             }
         }
 
-      ReadResponse response;
+      EncodedReadResponse response;
       FillResponseHeader(requestHeader, response.Header);
       std::vector<DataValue> values;
 
-      if (std::shared_ptr<OpcUa::AttributeServices> service = Server->Attributes())
+      if (AddressSpace::SharedPtr addressSpace = std::dynamic_pointer_cast<AddressSpace>(Server->Attributes()))
+        {
+          // values come with the encodings the address space keeps for them
+          response.Results = addressSpace->ReadEncoded(params);
+        }
+
+      else if (std::shared_ptr<OpcUa::AttributeServices> service = Server->Attributes())
         {
           values = service->Read(params);
         }
@@ -392,13 +524,21 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
             }
         }
 
-      response.Results = values;
+      for (DataValue & value : values)
+        {
+          EncodedDataValue result;
+          result.Value = std::move(value);
+          response.Results.push_back(std::move(result));
+        }
+
+      metrics.Serviced(response.Header.ServiceResult);
 
       SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
       secureHeader.AddSize(RawSize(algorithmHeader));
       secureHeader.AddSize(RawSize(sequence));
       secureHeader.AddSize(RawSize(response));
       ostream << secureHeader << algorithmHeader << sequence << response << flush;
+      metrics.Sent(secureHeader.Size);
 
       return;
     }
@@ -409,6 +549,7 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
 
       WriteParameters params;
       istream >> params;
+      metrics.Decoded();
 
       WriteResponse response;
       FillResponseHeader(requestHeader, response.Header);
@@ -424,11 +565,14 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
           response.Results = std::vector<StatusCode>(params.NodesToWrite.size(), OpcUa::StatusCode::BadNotImplemented);
         }
 
+      metrics.Serviced(response.Header.ServiceResult);
+
       SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
       secureHeader.AddSize(RawSize(algorithmHeader));
       secureHeader.AddSize(RawSize(sequence));
       secureHeader.AddSize(RawSize(response));
       ostream << secureHeader << algorithmHeader << sequence << response << flush;
+      metrics.Sent(secureHeader.Size);
 
       return;
     }
@@ -439,6 +583,7 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
 
       TranslateBrowsePathsParameters params;
       istream >> params;
+      metrics.Decoded();
 
       if (Logger && Logger->should_log(spdlog::level::debug))
         {
@@ -472,7 +617,9 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
 
       TranslateBrowsePathsToNodeIdsResponse response;
       FillResponseHeader(requestHeader, response.Header);
-      response.Result.Paths = result;
+      response.Result.Paths = std::move(result);
+      metrics.Serviced(response.Header.ServiceResult);
+
       SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
       secureHeader.AddSize(RawSize(algorithmHeader));
       secureHeader.AddSize(RawSize(sequence));
@@ -481,6 +628,7 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
       LOG_DEBUG(Logger, "opc_tcp_processor     | sending response to 'Translate Browse Paths To Node Ids' request");
 
       ostream << secureHeader << algorithmHeader << sequence << response << flush;
+      metrics.Sent(secureHeader.Size);
       return;
     }
 
@@ -491,23 +639,28 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
 
       CreateSessionParameters params;
       istream >> params;
+      metrics.Decoded();
 
       CreateSessionResponse response;
       FillResponseHeader(requestHeader, response.Header);
 
-      response.Parameters.SessionId = SessionId;
-      response.Parameters.AuthenticationToken = SessionId;
-      response.Parameters.RevisedSessionTimeout = params.RequestedSessionTimeout;
+      SetSession(Sessions->CreateSession(params.RequestedSessionTimeout, shared_from_this()));
+
+      response.Parameters.SessionId = CurrentSession->SessionId;
+      response.Parameters.AuthenticationToken = CurrentSession->AuthenticationToken;
+      response.Parameters.RevisedSessionTimeout = CurrentSession->Timeout;
       response.Parameters.MaxRequestMessageSize = 65536;
       GetEndpointsParameters epf;
       response.Parameters.ServerEndpoints = Server->Endpoints()->GetEndpoints(epf);
 
+      metrics.Serviced(response.Header.ServiceResult);
 
       SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
       secureHeader.AddSize(RawSize(algorithmHeader));
       secureHeader.AddSize(RawSize(sequence));
       secureHeader.AddSize(RawSize(response));
       ostream << secureHeader << algorithmHeader << sequence << response << flush;
+      metrics.Sent(secureHeader.Size);
 
       return;
     }
@@ -518,15 +671,34 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
 
       ActivateSessionParameters params;
       istream >> params;
+      metrics.Decoded();
 
       ActivateSessionResponse response;
       FillResponseHeader(requestHeader, response.Header);
 
+      // also binds a session of a lost connection to this one
+      const std::string user = params.UserIdentityToken.type() == UserTokenType::UserName ? params.UserIdentityToken.UserName.UserName : std::string();
+      Session::SharedPtr session = Sessions->ActivateSession(requestHeader.SessionAuthenticationToken, shared_from_this(), user);
+
+      if (session)
+        {
+          SetSession(session);
+        }
+
+      else
+        {
+          LOG_WARN(Logger, "opc_tcp_processor     | activation of unknown session or by another user refused");
+          response.Header.ServiceResult = StatusCode::BadSessionIdInvalid;
+        }
+
+      metrics.Serviced(response.Header.ServiceResult);
+
       SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
       secureHeader.AddSize(RawSize(algorithmHeader));
       secureHeader.AddSize(RawSize(sequence));
       secureHeader.AddSize(RawSize(response));
       ostream << secureHeader << algorithmHeader << sequence << response << flush;
+      metrics.Sent(secureHeader.Size);
       return;
     }
 
@@ -536,20 +708,22 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
 
       bool deleteSubscriptions = false;
       istream >> deleteSubscriptions;
+      metrics.Decoded();
 
-      if (deleteSubscriptions)
-        {
-          DeleteAllSubscriptions();
-        }
+      Sessions->CloseSession(CurrentSession, deleteSubscriptions);
+      CurrentSession.reset();
 
       CloseSessionResponse response;
       FillResponseHeader(requestHeader, response.Header);
 
+      metrics.Serviced(response.Header.ServiceResult);
+
       SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
       secureHeader.AddSize(RawSize(algorithmHeader));
       secureHeader.AddSize(RawSize(sequence));
       secureHeader.AddSize(RawSize(response));
       ostream << secureHeader << algorithmHeader << sequence << response << flush;
+      metrics.Sent(secureHeader.Size);
 
       LOG_DEBUG(Logger, "opc_tcp_processor     | session closed");
 
@@ -562,33 +736,32 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
 
       CreateSubscriptionRequest request;
       istream >> request.Parameters;
+      metrics.Decoded();
       request.Header = requestHeader;
 
       CreateSubscriptionResponse response;
       FillResponseHeader(requestHeader, response.Header);
 
-      SharedPtr self = shared_from_this();
-      response.Data = Server->Subscriptions()->CreateSubscription(request, [self](PublishResult i)
-      {
-        try
-          {
-            self->ForwardPublishResponse(i);
-          }
+      response.Data = Server->Subscriptions()->CreateSubscription(request, PublishCallback());
 
-        catch (std::exception & ex)
-          {
-            // TODO Disconnect client!
-            LOG_WARN(self->Logger, "error forwarding PublishResult to client: {}", ex.what());
-          }
-      });
+      if (CurrentSession)
+        {
+          Sessions->AddSubscription(CurrentSession, response.Data.SubscriptionId); //Keep a link to eventually delete subcriptions when the session ends
+        }
+
+      if (Metrics)
+        {
+          Metrics->SubscriptionCreated();
+        }
 
-      Subscriptions.push_back(response.Data.SubscriptionId); //Keep a link to eventually delete subcriptions when exiting
+      metrics.Serviced(response.Header.ServiceResult);
 
       SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
       secureHeader.AddSize(RawSize(algorithmHeader));
       secureHeader.AddSize(RawSize(sequence));
       secureHeader.AddSize(RawSize(response));
       ostream << secureHeader << algorithmHeader << sequence << response << flush;
+      metrics.Sent(secureHeader.Size);
       return;
     }
 
@@ -598,11 +771,14 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
 
       ModifySubscriptionRequest request;
       istream >> request.Parameters;
+      metrics.Decoded();
       request.Header = requestHeader;
 
       ModifySubscriptionResponse response = Server->Subscriptions()->ModifySubscription(request.Parameters);
       FillResponseHeader(requestHeader, response.Header);
 
+      metrics.Serviced(response.Header.ServiceResult);
+
       SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
       secureHeader.AddSize(RawSize(algorithmHeader));
       secureHeader.AddSize(RawSize(sequence));
@@ -611,6 +787,7 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
       LOG_DEBUG(Logger, "opc_tcp_processor     | sending response to 'Modify Subscription' request");
 
       ostream << secureHeader << algorithmHeader << sequence << response << flush;
+      metrics.Sent(secureHeader.Size);
       return;
     }
 
@@ -620,14 +797,25 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
 
       std::vector<uint32_t> ids;
       istream >> ids;
+      metrics.Decoded();
 
-      DeleteSubscriptions(ids); //remove from locale subscription lis
+      if (CurrentSession)
+        {
+          Sessions->RemoveSubscriptions(CurrentSession, ids);
+        }
 
       DeleteSubscriptionsResponse response;
       FillResponseHeader(requestHeader, response.Header);
 
       response.Results = Server->Subscriptions()->DeleteSubscriptions(ids);
 
+      if (Metrics)
+        {
+          Metrics->SubscriptionsDeleted(std::count(response.Results.begin(), response.Results.end(), StatusCode::Good));
+        }
+
+      metrics.Serviced(response.Header.ServiceResult);
+
       SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
       secureHeader.AddSize(RawSize(algorithmHeader));
       secureHeader.AddSize(RawSize(sequence));
@@ -636,6 +824,7 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
       LOG_DEBUG(Logger, "opc_tcp_processor     | sending response to 'Delete Subscription' request");
 
       ostream << secureHeader << algorithmHeader << sequence << response << flush;
+      metrics.Sent(secureHeader.Size);
       return;
     }
 
@@ -645,12 +834,15 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
 
       MonitoredItemsParameters params;
       istream >> params;
+      metrics.Decoded();
 
       CreateMonitoredItemsResponse response;
 
       response.Results = Server->Subscriptions()->CreateMonitoredItems(params);
 
       FillResponseHeader(requestHeader, response.Header);
+      metrics.Serviced(response.Header.ServiceResult);
+
       SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
       secureHeader.AddSize(RawSize(algorithmHeader));
       secureHeader.AddSize(RawSize(sequence));
@@ -659,6 +851,7 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
       LOG_DEBUG(Logger, "opc_tcp_processor     | sending response to 'Create Monitored Items' request");
 
       ostream << secureHeader << algorithmHeader << sequence << response << flush;
+      metrics.Sent(secureHeader.Size);
       return;
     }
 
@@ -668,12 +861,15 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
 
       DeleteMonitoredItemsParameters params;
       istream >> params;
+      metrics.Decoded();
 
       DeleteMonitoredItemsResponse response;
 
       response.Results = Server->Subscriptions()->DeleteMonitoredItems(params);
 
       FillResponseHeader(requestHeader, response.Header);
+      metrics.Serviced(response.Header.ServiceResult);
+
       SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
       secureHeader.AddSize(RawSize(algorithmHeader));
       secureHeader.AddSize(RawSize(sequence));
@@ -682,6 +878,7 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
       LOG_DEBUG(Logger, "opc_tcp_processor     | sending response to 'Delete Monitored Items' request");
 
       ostream << secureHeader << algorithmHeader << sequence << response << flush;
+      metrics.Sent(secureHeader.Size);
       return;
     }
 
@@ -692,6 +889,33 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
       PublishRequest request;
       request.Header = requestHeader;
       istream >> request.SubscriptionAcknowledgements;
+      metrics.Decoded();
+
+      uint32_t maxPublishRequests = 100;
+      OpcUa::Server::SubscriptionService::SharedPtr subscriptions = std::dynamic_pointer_cast<OpcUa::Server::SubscriptionService>(Server->Subscriptions());
+
+      if (subscriptions)
+        {
+          maxPublishRequests = subscriptions->GetPublishParameters().MaxPublishRequests;
+        }
+
+      if (PublishRequestQueue.size() >= maxPublishRequests)
+        {
+          LOG_WARN(Logger, "opc_tcp_processor     | too many publish requests queued: {}", PublishRequestQueue.size());
+
+          PublishResponse response;
+          FillResponseHeader(requestHeader, response.Header);
+          response.Header.ServiceResult = StatusCode::BadTooManyPublishRequests;
+          metrics.Serviced(response.Header.ServiceResult);
+
+          SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
+          secureHeader.AddSize(RawSize(algorithmHeader));
+          secureHeader.AddSize(RawSize(sequence));
+          secureHeader.AddSize(RawSize(response));
+          ostream << secureHeader << algorithmHeader << sequence << response << flush;
+          metrics.Sent(secureHeader.Size);
+          return;
+        }
 
       PublishRequestElement data;
       data.sequence = sequence;
@@ -699,6 +923,8 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
       data.requestHeader = requestHeader;
       PublishRequestQueue.push(data);
       Server->Subscriptions()->Publish(request);
+      metrics.Serviced(StatusCode::Good);
+      metrics.Completed(); // response is sent by ForwardPublishResponse
 
       --SequenceNb; //We do not send response, so do not increase sequence
 
@@ -711,12 +937,15 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
 
       PublishingModeParameters params;
       istream >> params;
+      metrics.Decoded();
 
       //FIXME: forward request to internal server!!
       SetPublishingModeResponse response;
       FillResponseHeader(requestHeader, response.Header);
       response.Result.Results.resize(params.SubscriptionIds.size(), StatusCode::Good);
 
+      metrics.Serviced(response.Header.ServiceResult);
+
       SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
       secureHeader.AddSize(RawSize(algorithmHeader));
       secureHeader.AddSize(RawSize(sequence));
@@ -725,6 +954,7 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
       LOG_DEBUG(Logger, "opc_tcp_processor     | sending response to 'Set Publishing Mode' request");
 
       ostream << secureHeader << algorithmHeader << sequence << response << flush;
+      metrics.Sent(secureHeader.Size);
       return;
     }
 
@@ -734,12 +964,15 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
 
       AddNodesParameters params;
       istream >> params;
+      metrics.Decoded();
 
       std::vector<AddNodesResult> results = Server->NodeManagement()->AddNodes(params.NodesToAdd);
 
       AddNodesResponse response;
       FillResponseHeader(requestHeader, response.Header);
-      response.results = results;
+      response.results = std::move(results);
+
+      metrics.Serviced(response.Header.ServiceResult);
 
       SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
       secureHeader.AddSize(RawSize(algorithmHeader));
@@ -749,6 +982,7 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
       LOG_DEBUG(Logger, "opc_tcp_processor     | sending response to 'Add Nodes' request");
 
       ostream << secureHeader << algorithmHeader << sequence << response << flush;
+      metrics.Sent(secureHeader.Size);
       return;
     }
 
@@ -758,12 +992,15 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
 
       AddReferencesParameters params;
       istream >> params;
+      metrics.Decoded();
 
       std::vector<StatusCode> results = Server->NodeManagement()->AddReferences(params.ReferencesToAdd);
 
       AddReferencesResponse response;
       FillResponseHeader(requestHeader, response.Header);
-      response.Results = results;
+      response.Results = std::move(results);
+
+      metrics.Serviced(response.Header.ServiceResult);
 
       SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
       secureHeader.AddSize(RawSize(algorithmHeader));
@@ -773,6 +1010,7 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
       LOG_DEBUG(Logger, "opc_tcp_processor     | sending response to 'Add References' request");
 
       ostream << secureHeader << algorithmHeader << sequence << response << flush;
+      metrics.Sent(secureHeader.Size);
       return;
     }
 
@@ -782,11 +1020,13 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
 
       RepublishParameters params;
       istream >> params;
+      metrics.Decoded();
 
-      //Not implemented so we just say we do not have that notification
-      RepublishResponse response;
+      // notifications sent while the session had no connection are kept for republishing
+      RepublishResponse response = Server->Subscriptions()->Republish(params);
       FillResponseHeader(requestHeader, response.Header);
-      response.Header.ServiceResult = StatusCode::BadMessageNotAvailable;
+
+      metrics.Serviced(response.Header.ServiceResult);
 
       SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
       secureHeader.AddSize(RawSize(algorithmHeader));
@@ -796,6 +1036,44 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
       LOG_DEBUG(Logger, "opc_tcp_processor     | sending response to 'Republish' request");
 
       ostream << secureHeader << algorithmHeader << sequence << response << flush;
+      metrics.Sent(secureHeader.Size);
+      return;
+    }
+
+    case TRANSFER_SUBSCRIPTIONS_REQUEST:
+    {
+      LOG_DEBUG(Logger, "opc_tcp_processor     | processing 'Transfer Subscriptions' request");
+
+      TransferSubscriptionsRequest request;
+      istream >> request.Parameters;
+      metrics.Decoded();
+      request.Header = requestHeader;
+
+      TransferSubscriptionsResponse response;
+      FillResponseHeader(requestHeader, response.Header);
+
+      if (!CurrentSession)
+        {
+          response.Header.ServiceResult = StatusCode::BadSessionIdInvalid;
+        }
+
+      else
+        {
+          // only subscriptions of the same user are transferred
+          response.Parameters.Results = Sessions->TransferSubscriptions(CurrentSession, request, PublishCallback());
+        }
+
+      metrics.Serviced(response.Header.ServiceResult);
+
+      SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
+      secureHeader.AddSize(RawSize(algorithmHeader));
+      secureHeader.AddSize(RawSize(sequence));
+      secureHeader.AddSize(RawSize(response));
+
+      LOG_DEBUG(Logger, "opc_tcp_processor     | sending response to 'Transfer Subscriptions' request");
+
+      ostream << secureHeader << algorithmHeader << sequence << response << flush;
+      metrics.Sent(secureHeader.Size);
       return;
     }
 
@@ -805,30 +1083,41 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
 
       CallParameters params;
       istream >> params;
-
-      CallResponse response;
-      FillResponseHeader(requestHeader, response.Header);
+      metrics.Decoded();
 
       if (std::shared_ptr<OpcUa::MethodServices> service = Server->Method())
         {
-          response.Results = service->Call(params.MethodsToCall);
+          metrics.Serviced(StatusCode::Good);
+          metrics.Completed(); // response is sent by ForwardCallResponse
+          --SequenceNb; //We do not send response yet, so do not increase sequence
+
+          // methods may run on a pool and complete after this request
+          SharedPtr self = shared_from_this();
+          service->CallAsync(params.MethodsToCall, [self, sequence, algorithmHeader, requestHeader](std::vector<CallMethodResult> results)
+          {
+            self->ForwardCallResponse(sequence, algorithmHeader, requestHeader, std::move(results));
+          });
+          return;
         }
 
-      else
+      CallResponse response;
+      FillResponseHeader(requestHeader, response.Header);
+
+      for (auto callMethodRequest : params.MethodsToCall)
         {
-          for (auto callMethodRequest : params.MethodsToCall)
-            {
-              OpcUa::CallMethodResult result;
-              result.Status = OpcUa::StatusCode::BadNotImplemented;
-              response.Results.push_back(result);
-            }
+          OpcUa::CallMethodResult result;
+          result.Status = OpcUa::StatusCode::BadNotImplemented;
+          response.Results.push_back(result);
         }
 
+      metrics.Serviced(response.Header.ServiceResult);
+
       SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
       secureHeader.AddSize(RawSize(algorithmHeader));
       secureHeader.AddSize(RawSize(sequence));
       secureHeader.AddSize(RawSize(response));
       ostream << secureHeader << algorithmHeader << sequence << response << flush;
+      metrics.Sent(secureHeader.Size);
 
       return;
     }
@@ -840,12 +1129,15 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
       RegisterNodesRequest request;
 
       istream >> request.NodesToRegister;
+      metrics.Decoded();
 
       RegisterNodesResponse response;
       response.Result = Server->Views()->RegisterNodes(request.NodesToRegister);
 
       FillResponseHeader(requestHeader, response.Header);
 
+      metrics.Serviced(response.Header.ServiceResult);
+
       SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
       secureHeader.AddSize(RawSize(algorithmHeader));
       secureHeader.AddSize(RawSize(sequence));
@@ -854,6 +1146,7 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
       LOG_DEBUG(Logger, "opc_tcp_processor     | sending response to 'Register Nodes' request");
 
       ostream << secureHeader << algorithmHeader << sequence << response << flush;
+      metrics.Sent(secureHeader.Size);
       return;
     }
 
@@ -864,12 +1157,15 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
       UnregisterNodesRequest request;
 
       istream >> request.NodesToUnregister;
+      metrics.Decoded();
 
       UnregisterNodesResponse response;
       Server->Views()->UnregisterNodes(request.NodesToUnregister);
 
       FillResponseHeader(requestHeader, response.Header);
 
+      metrics.Serviced(response.Header.ServiceResult);
+
       SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
       secureHeader.AddSize(RawSize(algorithmHeader));
       secureHeader.AddSize(RawSize(sequence));
@@ -878,15 +1174,94 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
       LOG_DEBUG(Logger, "opc_tcp_processor     | sending response to 'Unregister Nodes' request");
 
       ostream << secureHeader << algorithmHeader << sequence << response << flush;
+      metrics.Sent(secureHeader.Size);
+      return;
+    }
+
+    case OpcUa::QUERY_FIRST_REQUEST:
+    {
+      LOG_DEBUG(Logger, "opc_tcp_processor     | processing 'Query First' request");
+
+      QueryFirstParameters params;
+      istream >> params;
+      metrics.Decoded();
+
+      QueryFirstResponse response;
+      // continuation points belong to the session
+      if (CurrentSession)
+        {
+          response.Result = Sessions->QueryFirst(CurrentSession, params);
+        }
+
+      else
+        {
+          response.Result.Status = StatusCode::BadSessionIdInvalid;
+        }
+
+      FillResponseHeader(requestHeader, response.Header);
+      response.Header.ServiceResult = response.Result.Status;
+
+      metrics.Serviced(response.Header.ServiceResult);
+
+      SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
+      secureHeader.AddSize(RawSize(algorithmHeader));
+      secureHeader.AddSize(RawSize(sequence));
+      secureHeader.AddSize(RawSize(response));
+
+      LOG_DEBUG(Logger, "opc_tcp_processor     | sending response to 'Query First' request with {} data sets", response.Result.QueryDataSets.size());
+
+      ostream << secureHeader << algorithmHeader << sequence << response << flush;
+      metrics.Sent(secureHeader.Size);
+      return;
+    }
+
+    case OpcUa::QUERY_NEXT_REQUEST:
+    {
+      LOG_DEBUG(Logger, "opc_tcp_processor     | processing 'Query Next' request");
+
+      QueryNextParameters params;
+      istream >> params;
+      metrics.Decoded();
+
+      QueryNextResponse response;
+      // continuation points belong to the session
+      if (CurrentSession)
+        {
+          response.Result = Sessions->QueryNext(CurrentSession, params);
+        }
+
+      else
+        {
+          response.Result.Status = StatusCode::BadSessionIdInvalid;
+        }
+
+      FillResponseHeader(requestHeader, response.Header);
+      response.Header.ServiceResult = response.Result.Status;
+
+      metrics.Serviced(response.Header.ServiceResult);
+
+      SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
+      secureHeader.AddSize(RawSize(algorithmHeader));
+      secureHeader.AddSize(RawSize(sequence));
+      secureHeader.AddSize(RawSize(response));
+
+      LOG_DEBUG(Logger, "opc_tcp_processor     | sending response to 'Query Next' request with {} data sets", response.Result.QueryDataSets.size());
+
+      ostream << secureHeader << algorithmHeader << sequence << response << flush;
+      metrics.Sent(secureHeader.Size);
       return;
     }
 
     default:
     {
+      metrics.Decoded();
+
       ServiceFaultResponse response;
       FillResponseHeader(requestHeader, response.Header);
       response.Header.ServiceResult = StatusCode::BadNotImplemented;
 
+      metrics.Serviced(response.Header.ServiceResult);
+
       SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
       secureHeader.AddSize(RawSize(algorithmHeader));
       secureHeader.AddSize(RawSize(sequence));
@@ -895,6 +1270,7 @@ void OpcTcpMessages::ProcessRequest(IStreamBinary & istream, OStreamBinary & ost
       LOG_WARN(Logger, "opc_tcp_processor     | sending 'ServiceFaultResponse' to unsupported request of id: {}", message);
 
       ostream << secureHeader << algorithmHeader << sequence << response << flush;
+      metrics.Sent(secureHeader.Size);
       return;
     }
     }
@@ -907,26 +1283,41 @@ void OpcTcpMessages::FillResponseHeader(const RequestHeader & requestHeader, Res
   responseHeader.RequestHandle = requestHeader.RequestHandle;
 }
 
-void OpcTcpMessages::DeleteAllSubscriptions()
+std::function<void (PublishResult)> OpcTcpMessages::PublishCallback() const
 {
-  std::vector<uint32_t> subs;
-
-  for (const uint32_t & subid : Subscriptions)
-    {
-      subs.push_back(subid);
-    }
+  // the session forwards to the connection it is bound to at the time
+  Session::SharedPtr session = CurrentSession;
+  Common::Logger::SharedPtr logger = Logger;
+  return [session, logger](PublishResult result)
+  {
+    try
+      {
+        if (!session || !session->Forward(std::move(result)))
+          {
+            LOG_DEBUG(logger, "opc_tcp_processor     | session has no connection, PublishResult kept for republishing");
+          }
+      }
 
-  Server->Subscriptions()->DeleteSubscriptions(subs);
-  Subscriptions.clear();
+    catch (std::exception & ex)
+      {
+        // TODO Disconnect client!
+        LOG_WARN(logger, "error forwarding PublishResult to client: {}", ex.what());
+      }
+  };
 }
 
-void OpcTcpMessages::DeleteSubscriptions(const std::vector<uint32_t> & ids)
+void OpcTcpMessages::SetSession(Session::SharedPtr session)
 {
-  for (auto id : ids)
+  if (CurrentSession == session)
     {
-      Subscriptions.erase(std::remove_if(Subscriptions.begin(), Subscriptions.end(),
-      [&](const uint32_t d) { return (d == id) ; }), Subscriptions.end());
+      return;
     }
+
+  Sessions->DetachSession(CurrentSession, this);
+  CurrentSession = session;
+
+  // publish requests of the previous session can not be answered anymore
+  std::queue<PublishRequestElement>().swap(PublishRequestQueue);
 }
 
 } // namespace UaServer
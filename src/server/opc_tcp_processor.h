@@ -8,12 +8,16 @@
 /// http://www.gnu.org/licenses/lgpl.html)
 ///
 
+#include "session_manager.h"
+
 #include <opc/common/logger.h>
 #include <opc/ua/protocol/binary/common.h>
 #include <opc/ua/protocol/binary/stream.h>
+#include <opc/ua/server/service_metrics.h>
 #include <opc/ua/services/services.h>
 
 #include <chrono>
+#include <functional>
 #include <list>
 #include <mutex>
 #include <queue>
@@ -23,38 +27,50 @@ namespace OpcUa
 namespace Server
 {
 
-class OpcTcpMessages: public std::enable_shared_from_this<OpcTcpMessages>
+class OpcTcpMessages: public std::enable_shared_from_this<OpcTcpMessages>, public SessionChannel
 {
 public:
   DEFINE_CLASS_POINTERS(OpcTcpMessages)
 
 public:
-  OpcTcpMessages(OpcUa::Services::SharedPtr server, OpcUa::OutputChannel::SharedPtr outputChannel, const Common::Logger::SharedPtr & logger);
+  /// @param sessions shared by the connections of a server, without it sessions end with the connection.
+  OpcTcpMessages(OpcUa::Services::SharedPtr server, OpcUa::OutputChannel::SharedPtr outputChannel, const Common::Logger::SharedPtr & logger, ServiceMetrics::SharedPtr metrics = ServiceMetrics::SharedPtr(), SessionManager::SharedPtr sessions = SessionManager::SharedPtr());
   ~OpcTcpMessages();
 
-  bool ProcessMessage(Binary::MessageType msgType, Binary::IStreamBinary & iStream);
+  /// @param messageSize size of the whole message including header, used for metrics only.
+  bool ProcessMessage(Binary::MessageType msgType, Binary::IStreamBinary & iStream, std::size_t messageSize = 0);
+
+  virtual void ForwardPublishResponse(PublishResult response) override;
+  virtual void Close() override;
+
+  /// @brief Ends the connection, called by Close after the session was terminated.
+  void SetCloseHandler(std::function<void ()> handler);
 
 private:
   void HelloClient(Binary::IStreamBinary & istream, Binary::OStreamBinary & ostream);
   void OpenChannel(Binary::IStreamBinary & istream, Binary::OStreamBinary & ostream);
   void CloseChannel(Binary::IStreamBinary & istream);
-  void ProcessRequest(Binary::IStreamBinary & istream, Binary::OStreamBinary & ostream);
+  void ProcessRequest(Binary::IStreamBinary & istream, Binary::OStreamBinary & ostream, std::size_t messageSize);
   void FillResponseHeader(const RequestHeader & requestHeader, ResponseHeader & responseHeader);
-  void DeleteSubscriptions(const std::vector<uint32_t> & ids);
-  void DeleteAllSubscriptions();
-  void ForwardPublishResponse(const PublishResult response);
+  std::function<void (PublishResult)> PublishCallback() const;
+  void SetSession(Session::SharedPtr session);
+  void ForwardCallResponse(Binary::SequenceHeader sequence, const Binary::SymmetricAlgorithmHeader & algorithmHeader, const RequestHeader & requestHeader, std::vector<CallMethodResult> results);
 
 private:
-  std::mutex ProcessMutex;
+  std::recursive_mutex ProcessMutex;
   OpcUa::Services::SharedPtr Server;
   OpcUa::OutputChannel::WeakPtr OutputChannel;
   OpcUa::Binary::OStreamBinary OutputStream;
   Common::Logger::SharedPtr Logger;
+  ServiceMetrics::SharedPtr Metrics;
+  SessionManager::SharedPtr Sessions;
+  const uint32_t ConnectionId; // identifies the connection in traces
   uint32_t ChannelId;
   uint32_t TokenId;
-  ExpandedNodeId SessionId;
-  //ExpandedNodeId AuthenticationToken;
+  Session::SharedPtr CurrentSession;
   uint32_t SequenceNb;
+  bool Closing = false; // the session was terminated by the slow consumer policy
+  std::function<void ()> CloseHandler;
 
   struct PublishRequestElement
   {
@@ -63,7 +79,6 @@ private:
     Binary::SymmetricAlgorithmHeader algorithmHeader;
   };
 
-  std::list<uint32_t> Subscriptions; //Keep a list of subscriptions to query internal server at correct rate
   std::mutex PublishRequestQueueMutex;
   std::queue<PublishRequestElement> PublishRequestQueue; //Keep track of request data to answer them when we have data and
 };
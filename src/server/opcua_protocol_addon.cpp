@@ -95,7 +95,7 @@ private:
     // restrict server size code only with current message.
     OpcUa::InputFromBuffer messageChannel(&buffer[0], buffer.size());
     IStreamBinary messageStream(messageChannel);
-    messageProcessor.ProcessMessage(hdr.Type, messageStream);
+    messageProcessor.ProcessMessage(hdr.Type, messageStream, hdr.Size);
 
     if (messageChannel.GetRemainSize())
       {
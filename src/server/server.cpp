@@ -18,11 +18,14 @@
 
 #include <opc/ua/server/server.h>
 
+#include <opc/ua/server/addons/address_space.h>
 #include <opc/ua/server/addons/common_addons.h>
 #include <opc/ua/protocol/string_utils.h>
 
+#include <opc/ua/server/addons/service_metrics.h>
 #include <opc/ua/server/addons/services_registry.h>
 #include <opc/ua/server/addons/subscription_service.h>
+#include <opc/ua/server/trace_ring.h>
 #include <iostream>
 
 namespace OpcUa
@@ -73,6 +76,40 @@ void UaServer::SetServerName(const std::string & name)
   Name = name;
 }
 
+void UaServer::SetMetricsDumpFile(const std::string & path)
+{
+  MetricsDumpFile = path;
+}
+
+void UaServer::SetSendLimits(std::size_t maxQueuedBytes, unsigned stallTimeout)
+{
+  MaxSendQueueBytes = maxQueuedBytes;
+  SendStallTimeout = stallTimeout;
+}
+
+void UaServer::SetStartupThreads(unsigned threads)
+{
+  StartupThreads = threads;
+}
+
+std::vector<Common::AddonStartupTime> UaServer::GetStartupTimes() const
+{
+  CheckStarted();
+  return Addons->GetStartupTimes();
+}
+
+void UaServer::DumpMetrics(std::ostream & os) const
+{
+  CheckStarted();
+  Metrics->Dump(os);
+  Server::DumpSubscriptionDiagnostics(os, SubscriptionService->GetSubscriptionDiagnostics());
+}
+
+void UaServer::DumpTrace(std::ostream & os) const
+{
+  Server::WriteChromeTrace(os);
+}
+
 void UaServer::AddAddressSpace(const std::string & path)
 {
   XmlAddressSpaces.push_back(path);
@@ -125,6 +162,9 @@ void UaServer::Start()
 
   OpcUa::Server::Parameters params;
   params.Debug = Logger.get();
+  params.MetricsDumpFile = MetricsDumpFile;
+  params.MaxSendQueueBytes = MaxSendQueueBytes;
+  params.SendStallTimeout = SendStallTimeout;
   params.Endpoint.Server = appDesc;
   params.Endpoint.EndpointUrl = Endpoint;
   params.Endpoint.SecurityMode = SecurityMode;
@@ -136,11 +176,14 @@ void UaServer::Start()
   params.Endpoint.UserIdentityTokens.push_back(policy);
 
   Addons = Common::CreateAddonsManager(Logger);
+  Addons->SetStartupThreads(StartupThreads);
   Server::RegisterCommonAddons(params, *Addons);
   Addons->Start();
 
   Registry = Addons->GetAddon<Server::ServicesRegistry>(Server::ServicesRegistryAddonId);
+  AddressSpace = Addons->GetAddon<Server::AddressSpace>(Server::AddressSpaceRegistryAddonId);
   SubscriptionService = Addons->GetAddon<Server::SubscriptionService>(Server::SubscriptionServiceAddonId);
+  Metrics = Addons->GetAddon<Server::ServiceMetricsAddon>(Server::ServiceMetricsAddonId)->GetMetrics();
 
   Node ServerArray = GetNode(OpcUa::ObjectId::Server_ServerArray);
   ServerArray.SetValue(std::vector<std::string>({Endpoint}));
@@ -169,6 +212,54 @@ Node UaServer::GetNodeFromPath(const std::vector<std::string> & path) const
   return GetRootNode().GetChild(path);
 }
 
+std::vector<StatusCode> UaServer::UpdateValues(const std::vector<Server::ValueUpdate> & updates)
+{
+  CheckStarted();
+  return AddressSpace->UpdateValues(updates);
+}
+
+uint32_t UaServer::GetValueHandle(const NodeId & nodeid) const
+{
+  CheckStarted();
+  return AddressSpace->GetValueHandle(nodeid);
+}
+
+std::vector<StatusCode> UaServer::UpdateValues(const std::vector<Server::HandleValueUpdate> & updates)
+{
+  CheckStarted();
+  return AddressSpace->UpdateValues(updates);
+}
+
+void UaServer::EnableEncodedValueCache(const NodeId & nodeid, bool enable)
+{
+  CheckStarted();
+  CheckStatusCode(AddressSpace->EnableEncodedValueCache(nodeid, enable));
+}
+
+Server::ValueIngest::UniquePtr UaServer::CreateValueIngest(const Server::IngestParameters & params)
+{
+  CheckStarted();
+  return Server::CreateValueIngest(*AddressSpace, params);
+}
+
+void UaServer::EnableMethodPool(const Server::MethodPoolParameters & params)
+{
+  CheckStarted();
+  AddressSpace->EnableMethodPool(params);
+}
+
+void UaServer::SetAsyncMethod(const NodeId & node, std::function<Server::AsyncMethod> method)
+{
+  CheckStarted();
+  AddressSpace->SetAsyncMethod(node, method);
+}
+
+void UaServer::SetPublishParameters(const Server::PublishParameters & params)
+{
+  CheckStarted();
+  SubscriptionService->SetPublishParameters(params);
+}
+
 void UaServer::Stop()
 {
   LOG_INFO(Logger, "UaServer | stopping opcua server application");
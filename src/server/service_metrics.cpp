@@ -0,0 +1,451 @@
+/// @brief Per service request metrics of the binary protocol server.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include <opc/ua/server/service_metrics.h>
+#include <opc/ua/server/subscription_service.h>
+#include <opc/ua/server/trace_ring.h>
+#include <opc/ua/protocol/string_utils.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+using namespace OpcUa;
+
+const std::size_t LinearBuckets = 16;
+const unsigned SubBucketBits = 3;
+
+unsigned HighestBit(uint64_t value)
+{
+  unsigned bit = 0;
+
+  while (value >>= 1)
+    {
+      ++bit;
+    }
+
+  return bit;
+}
+
+void UpdateMax(std::atomic<uint64_t> & max, uint64_t value)
+{
+  uint64_t current = max.load(std::memory_order_relaxed);
+
+  while (value > current && !max.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+struct ServiceName
+{
+  MessageId Id;
+  const char * Name;
+};
+
+const ServiceName KnownServices[] =
+{
+  {GET_ENDPOINTS_REQUEST, "GetEndpoints"},
+  {FIND_ServerS_REQUEST, "FindServers"},
+  {CREATE_SESSION_REQUEST, "CreateSession"},
+  {ACTIVATE_SESSION_REQUEST, "ActivateSession"},
+  {CLOSE_SESSION_REQUEST, "CloseSession"},
+  {BROWSE_REQUEST, "Browse"},
+  {TRANSLATE_BROWSE_PATHS_TO_NODE_IdS_REQUEST, "TranslateBrowsePathsToNodeIds"},
+  {REGISTER_NODES_REQUEST, "RegisterNodes"},
+  {UNREGISTER_NODES_REQUEST, "UnregisterNodes"},
+  {QUERY_FIRST_REQUEST, "QueryFirst"},
+  {QUERY_NEXT_REQUEST, "QueryNext"},
+  {READ_REQUEST, "Read"},
+  {WRITE_REQUEST, "Write"},
+  {CALL_REQUEST, "Call"},
+  {ADD_NODES_REQUEST, "AddNodes"},
+  {ADD_REFERENCES_REQUEST, "AddReferences"},
+  {CREATE_SUBSCRIPTION_REQUEST, "CreateSubscription"},
+  {MODIFY_SUBSCRIPTION_REQUEST, "ModifySubscription"},
+  {DELETE_SUBSCRIPTION_REQUEST, "DeleteSubscriptions"},
+  {SET_PUBLISHING_MODE_REQUEST, "SetPublishingMode"},
+  {CREATE_MONITORED_ITEMS_REQUEST, "CreateMonitoredItems"},
+  {DELETE_MONITORED_ITEMS_REQUEST, "DeleteMonitoredItems"},
+  {PUBLISH_REQUEST, "Publish"},
+  {REPUBLISH_REQUEST, "Republish"},
+  {TRANSFER_SUBSCRIPTIONS_REQUEST, "TransferSubscriptions"},
+};
+
+void DumpHistogram(std::ostream & os, const std::string & service, const char * phase, const Server::LatencyHistogram & histogram)
+{
+  static const double Quantiles[] = {0.5, 0.9, 0.99, 0.999};
+  const std::string labels = "service=\"" + service + "\",phase=\"" + phase + "\"";
+
+  for (double q : Quantiles)
+    {
+      os << "opcua_service_latency_us{" << labels << ",quantile=\"" << q << "\"} " << histogram.Percentile(q) / 1000.0 << "\n";
+    }
+
+  os << "opcua_service_latency_us_max{" << labels << "} " << histogram.Max() / 1000.0 << "\n";
+  os << "opcua_service_latency_us_sum{" << labels << "} " << histogram.Sum() / 1000.0 << "\n";
+  os << "opcua_service_latency_us_count{" << labels << "} " << histogram.Count() << "\n";
+}
+
+} // namespace
+
+namespace OpcUa
+{
+namespace Server
+{
+
+LatencyHistogram::LatencyHistogram()
+  : Total(0)
+  , Maximum(0)
+{
+  for (std::atomic<uint64_t> & bucket : Buckets)
+    {
+      bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+std::size_t LatencyHistogram::GetBucketIndex(uint64_t value)
+{
+  if (value < LinearBuckets)
+    {
+      return static_cast<std::size_t>(value);
+    }
+
+  const unsigned exponent = HighestBit(value);
+  const std::size_t sub = (value >> (exponent - SubBucketBits)) & ((1 << SubBucketBits) - 1);
+  return LinearBuckets + (exponent - 4) * (1 << SubBucketBits) + sub;
+}
+
+uint64_t LatencyHistogram::GetBucketUpperBound(std::size_t index)
+{
+  if (index < LinearBuckets)
+    {
+      return index;
+    }
+
+  const unsigned exponent = static_cast<unsigned>((index - LinearBuckets) >> SubBucketBits) + 4;
+  const uint64_t sub = (index - LinearBuckets) & ((1 << SubBucketBits) - 1);
+  const unsigned shift = exponent - SubBucketBits;
+  return (((1 << SubBucketBits) + sub) << shift) + ((uint64_t(1) << shift) - 1);
+}
+
+void LatencyHistogram::Record(uint64_t value)
+{
+  Buckets[GetBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+  Total.fetch_add(value, std::memory_order_relaxed);
+  UpdateMax(Maximum, value);
+}
+
+uint64_t LatencyHistogram::Count() const
+{
+  uint64_t count = 0;
+
+  for (const std::atomic<uint64_t> & bucket : Buckets)
+    {
+      count += bucket.load(std::memory_order_relaxed);
+    }
+
+  return count;
+}
+
+uint64_t LatencyHistogram::Sum() const
+{
+  return Total.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::Max() const
+{
+  return Maximum.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::Percentile(double p) const
+{
+  const uint64_t count = Count();
+
+  if (!count)
+    {
+      return 0;
+    }
+
+  const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(p * count)));
+  uint64_t seen = 0;
+
+  for (std::size_t idx = 0; idx < BucketCount; ++idx)
+    {
+      seen += Buckets[idx].load(std::memory_order_relaxed);
+
+      if (seen >= rank)
+        {
+          return std::min(GetBucketUpperBound(idx), Max());
+        }
+    }
+
+  return Max();
+}
+
+
+ServiceCounters::ServiceCounters(MessageId id, const std::string & name)
+  : Id(id)
+  , Name(name)
+  , Requests(0)
+  , Errors(0)
+  , BytesIn(0)
+  , BytesOut(0)
+{
+}
+
+
+ServiceMetrics::ServiceMetrics()
+  : Unsupported(new ServiceCounters(INVALID, "Unsupported"))
+  , CurrentSessions(0)
+  , CumulatedSessions(0)
+  , CurrentSubscriptions(0)
+  , CumulatedSubscriptions(0)
+  , RejectedRequests(0)
+{
+  for (const ServiceName & service : KnownServices)
+    {
+      Services.emplace_back(new ServiceCounters(service.Id, service.Name));
+    }
+}
+
+ServiceCounters & ServiceMetrics::GetCounters(MessageId requestId)
+{
+  for (const std::unique_ptr<ServiceCounters> & counters : Services)
+    {
+      if (counters->Id == requestId)
+        {
+          return *counters;
+        }
+    }
+
+  return *Unsupported;
+}
+
+void ServiceMetrics::ForEachService(const std::function<void(const ServiceCounters &)> & callback) const
+{
+  for (const std::unique_ptr<ServiceCounters> & counters : Services)
+    {
+      callback(*counters);
+    }
+
+  callback(*Unsupported);
+}
+
+void ServiceMetrics::SessionCreated()
+{
+  ++CurrentSessions;
+  ++CumulatedSessions;
+}
+
+void ServiceMetrics::SessionClosed()
+{
+  --CurrentSessions;
+}
+
+void ServiceMetrics::SubscriptionCreated()
+{
+  ++CurrentSubscriptions;
+  ++CumulatedSubscriptions;
+}
+
+void ServiceMetrics::SubscriptionsDeleted(uint32_t count)
+{
+  CurrentSubscriptions -= count;
+}
+
+void ServiceMetrics::RequestRejected()
+{
+  ++RejectedRequests;
+}
+
+uint32_t ServiceMetrics::GetCurrentSessionCount() const
+{
+  return CurrentSessions;
+}
+
+uint32_t ServiceMetrics::GetCumulatedSessionCount() const
+{
+  return CumulatedSessions;
+}
+
+uint32_t ServiceMetrics::GetCurrentSubscriptionCount() const
+{
+  return CurrentSubscriptions;
+}
+
+uint32_t ServiceMetrics::GetCumulatedSubscriptionCount() const
+{
+  return CumulatedSubscriptions;
+}
+
+uint32_t ServiceMetrics::GetRejectedRequestsCount() const
+{
+  return RejectedRequests;
+}
+
+void ServiceMetrics::Dump(std::ostream & os) const
+{
+  os << "opcua_sessions_current " << GetCurrentSessionCount() << "\n";
+  os << "opcua_sessions_cumulated " << GetCumulatedSessionCount() << "\n";
+  os << "opcua_subscriptions_current " << GetCurrentSubscriptionCount() << "\n";
+  os << "opcua_subscriptions_cumulated " << GetCumulatedSubscriptionCount() << "\n";
+  os << "opcua_requests_rejected_total " << GetRejectedRequestsCount() << "\n";
+
+  ForEachService([&os](const ServiceCounters & counters)
+  {
+    if (!counters.Requests.load(std::memory_order_relaxed))
+      {
+        return;
+      }
+
+    const std::string label = "{service=\"" + counters.Name + "\"} ";
+    os << "opcua_service_requests_total" << label << counters.Requests.load(std::memory_order_relaxed) << "\n";
+    os << "opcua_service_errors_total" << label << counters.Errors.load(std::memory_order_relaxed) << "\n";
+    os << "opcua_service_bytes_in_total" << label << counters.BytesIn.load(std::memory_order_relaxed) << "\n";
+    os << "opcua_service_bytes_out_total" << label << counters.BytesOut.load(std::memory_order_relaxed) << "\n";
+    DumpHistogram(os, counters.Name, "decode", counters.DecodeTime);
+    DumpHistogram(os, counters.Name, "service", counters.ServiceTime);
+    DumpHistogram(os, counters.Name, "encode", counters.EncodeTime);
+  });
+}
+
+
+const char * GetServiceName(MessageId requestId)
+{
+  for (const ServiceName & service : KnownServices)
+    {
+      if (service.Id == requestId)
+        {
+          return service.Name;
+        }
+    }
+
+  return "Unsupported";
+}
+
+void DumpSubscriptionDiagnostics(std::ostream & os, const std::vector<SubscriptionDiagnostics> & subscriptions)
+{
+  for (const SubscriptionDiagnostics & diag : subscriptions)
+    {
+      const std::string label = "{session=\"" + ToString(diag.SessionId) + "\",subscription=\"" + std::to_string(diag.SubscriptionId) + "\"} ";
+      os << "opcua_subscription_monitored_items" << label << diag.MonitoredItemCount << "\n";
+      os << "opcua_subscription_notifications_queued" << label << diag.QueuedNotificationsCount << "\n";
+      os << "opcua_subscription_notifications_sent_total" << label << diag.DataChangeNotificationsCount + diag.EventNotificationsCount << "\n";
+      os << "opcua_subscription_notifications_dropped_total" << label << diag.DiscardedNotificationsCount << "\n";
+      os << "opcua_subscription_queue_overflows_total" << label << diag.MonitoringQueueOverflowCount << "\n";
+      os << "opcua_subscription_publish_requests_total" << label << diag.PublishRequestCount << "\n";
+      os << "opcua_subscription_late_publish_total" << label << diag.LatePublishRequestCount << "\n";
+      os << "opcua_subscription_keepalives_total" << label << diag.KeepAliveCount << "\n";
+      os << "opcua_subscription_unacknowledged_messages" << label << diag.UnacknowledgedMessageCount << "\n";
+    }
+}
+
+
+RequestMetrics::RequestMetrics(ServiceMetrics * metrics, std::size_t bytesIn)
+  : Metrics(metrics)
+  , BytesIn(bytesIn)
+{
+  if (Metrics)
+    {
+      Start = Mark = Clock::now();
+    }
+}
+
+RequestMetrics::~RequestMetrics()
+{
+  if (Started && !Done)
+    {
+      OPCUA_TRACE(ConnectionId, RequestHandle, Service, RequestAborted);
+    }
+
+  if (!Counters)
+    {
+      return;
+    }
+
+  if (!Done || Failed)
+    {
+      Counters->Errors.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void RequestMetrics::SetService(MessageId requestId, uint32_t connectionId, uint32_t requestHandle)
+{
+  Service = requestId;
+  ConnectionId = connectionId;
+  RequestHandle = requestHandle;
+  Started = true;
+  OPCUA_TRACE(ConnectionId, RequestHandle, Service, RequestBegin);
+
+  if (!Metrics)
+    {
+      return;
+    }
+
+  Counters = &Metrics->GetCounters(requestId);
+  Counters->Requests.fetch_add(1, std::memory_order_relaxed);
+  Counters->BytesIn.fetch_add(BytesIn, std::memory_order_relaxed);
+
+  if (Counters->Id == INVALID)
+    {
+      Metrics->RequestRejected();
+    }
+}
+
+void RequestMetrics::Decoded()
+{
+  OPCUA_TRACE(ConnectionId, RequestHandle, Service, RequestDecoded);
+
+  if (!Counters)
+    {
+      return;
+    }
+
+  const Clock::time_point now = Clock::now();
+  Counters->DecodeTime.Record(std::chrono::duration_cast<std::chrono::nanoseconds>(now - Start).count());
+  Mark = now;
+}
+
+void RequestMetrics::Serviced(StatusCode serviceResult)
+{
+  OPCUA_TRACE(ConnectionId, RequestHandle, Service, RequestServiced);
+
+  if (!Counters)
+    {
+      return;
+    }
+
+  const Clock::time_point now = Clock::now();
+  Counters->ServiceTime.Record(std::chrono::duration_cast<std::chrono::nanoseconds>(now - Mark).count());
+  Mark = now;
+  Failed = serviceResult != StatusCode::Good;
+}
+
+void RequestMetrics::Sent(std::size_t bytesOut)
+{
+  OPCUA_TRACE(ConnectionId, RequestHandle, Service, RequestEnd);
+  Done = true;
+
+  if (!Counters)
+    {
+      return;
+    }
+
+  Counters->EncodeTime.Record(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - Mark).count());
+  Counters->BytesOut.fetch_add(bytesOut, std::memory_order_relaxed);
+}
+
+void RequestMetrics::Completed()
+{
+  OPCUA_TRACE(ConnectionId, RequestHandle, Service, RequestDeferred);
+  Done = true;
+}
+
+} // namespace Server
+} // namespace OpcUa
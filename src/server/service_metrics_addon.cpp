@@ -0,0 +1,391 @@
+/// @brief Addon which collects request metrics and publishes them.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include <boost/asio/io_service.hpp>
+
+#include "timer.h"
+
+#include <opc/ua/node.h>
+#include <opc/ua/protocol/string_utils.h>
+#include <opc/ua/server/addons/address_space.h>
+#include <opc/ua/server/addons/asio_addon.h>
+#include <opc/ua/server/addons/service_metrics.h>
+#include <opc/ua/server/addons/services_registry.h>
+#include <opc/ua/server/addons/subscription_service.h>
+#include <opc/ua/server/subscription_service.h>
+
+#include <cstdio>
+#include <fstream>
+#include <map>
+
+namespace
+{
+using namespace OpcUa;
+using namespace OpcUa::Server;
+
+const uint16_t MetricsNamespace = 1;
+
+/// @brief Variables of one service under ServerDiagnostics/ServiceCounters.
+struct ServiceNodes
+{
+  const ServiceCounters * Counters;
+  std::vector<Node> Variables;
+};
+
+typedef uint32_t SubscriptionDiagnostics::*SubscriptionCounter;
+
+/// @brief Columns of ServerDiagnostics/SubscriptionDiagnostics, one array element per subscription.
+const std::pair<const char *, SubscriptionCounter> SubscriptionColumns[] =
+{
+  {"SubscriptionId", &SubscriptionDiagnostics::SubscriptionId},
+  {"MaxKeepAliveCount", &SubscriptionDiagnostics::MaxKeepAliveCount},
+  {"MaxLifetimeCount", &SubscriptionDiagnostics::MaxLifetimeCount},
+  {"PublishRequestCount", &SubscriptionDiagnostics::PublishRequestCount},
+  {"RepublishRequestCount", &SubscriptionDiagnostics::RepublishRequestCount},
+  {"DataChangeNotificationsCount", &SubscriptionDiagnostics::DataChangeNotificationsCount},
+  {"EventNotificationsCount", &SubscriptionDiagnostics::EventNotificationsCount},
+  {"NotificationsCount", &SubscriptionDiagnostics::NotificationsCount},
+  {"KeepAliveCount", &SubscriptionDiagnostics::KeepAliveCount},
+  {"LatePublishRequestCount", &SubscriptionDiagnostics::LatePublishRequestCount},
+  {"CurrentKeepAliveCount", &SubscriptionDiagnostics::CurrentKeepAliveCount},
+  {"UnacknowledgedMessageCount", &SubscriptionDiagnostics::UnacknowledgedMessageCount},
+  {"QueuedNotificationsCount", &SubscriptionDiagnostics::QueuedNotificationsCount},
+  {"DiscardedNotificationsCount", &SubscriptionDiagnostics::DiscardedNotificationsCount},
+  {"MonitoredItemCount", &SubscriptionDiagnostics::MonitoredItemCount},
+  {"MonitoringQueueOverflowCount", &SubscriptionDiagnostics::MonitoringQueueOverflowCount},
+};
+
+/// @brief Columns of ServerDiagnostics/SessionDiagnostics, summed over the subscriptions of a session.
+const std::pair<const char *, SubscriptionCounter> SessionColumns[] =
+{
+  {"PublishRequestCount", &SubscriptionDiagnostics::PublishRequestCount},
+  {"NotificationsCount", &SubscriptionDiagnostics::NotificationsCount},
+  {"LatePublishRequestCount", &SubscriptionDiagnostics::LatePublishRequestCount},
+  {"UnacknowledgedMessageCount", &SubscriptionDiagnostics::UnacknowledgedMessageCount},
+  {"QueuedNotificationsCount", &SubscriptionDiagnostics::QueuedNotificationsCount},
+  {"DiscardedNotificationsCount", &SubscriptionDiagnostics::DiscardedNotificationsCount},
+  {"MonitoredItemCount", &SubscriptionDiagnostics::MonitoredItemCount},
+};
+
+struct SessionDiagnostics
+{
+  uint32_t SubscriptionCount = 0;
+  SubscriptionDiagnostics Total;
+};
+
+std::map<NodeId, SessionDiagnostics> GetSessionDiagnostics(const std::vector<SubscriptionDiagnostics> & subscriptions)
+{
+  std::map<NodeId, SessionDiagnostics> sessions;
+
+  for (const SubscriptionDiagnostics & diag : subscriptions)
+    {
+      SessionDiagnostics & session = sessions[diag.SessionId];
+      ++session.SubscriptionCount;
+
+      for (const auto & column : SessionColumns)
+        {
+          session.Total.*column.second += diag.*column.second;
+        }
+    }
+
+  return sessions;
+}
+
+class ServiceMetricsAddonImpl : public ServiceMetricsAddon
+{
+public:
+  void Initialize(Common::AddonsManager & manager, const Common::AddonParameters & parameters) override
+  {
+    Logger = manager.GetLogger();
+    unsigned interval = 1;
+
+    for (const Common::Parameter & param : parameters.Parameters)
+      {
+        if (param.Name == "dump_file")
+          {
+            DumpFile = param.Value;
+          }
+
+        else if (param.Name == "update_interval")
+          {
+            interval = std::max(1, std::stoi(param.Value));
+          }
+      }
+
+    Metrics = std::make_shared<ServiceMetrics>();
+    ServicesRegistry::SharedPtr registry = manager.GetAddon<ServicesRegistry>(ServicesRegistryAddonId);
+    Server = registry->GetServer();
+    Subscriptions = manager.GetAddon<SubscriptionService>(SubscriptionServiceAddonId);
+    AddressSpace = manager.GetAddon<OpcUa::Server::AddressSpace>(AddressSpaceRegistryAddonId);
+    CreateNodes();
+    CreateSubscriptionNodes();
+
+    AsioAddon::SharedPtr asio = manager.GetAddon<AsioAddon>(AsioAddonId);
+    Timer.reset(new PeriodicTimer(asio->GetIoService()));
+    Timer->Start(boost::posix_time::seconds(interval), [this]()
+    {
+      Update();
+    });
+  }
+
+  void Stop() override
+  {
+    Timer.reset();
+
+    for (const NodeId & node : CallbackNodes)
+      {
+        AddressSpace->SetValueCallback(node, AttributeId::Value, std::function<DataValue(void)>());
+      }
+
+    CallbackNodes.clear();
+    Nodes.clear();
+    SummaryNodes.clear();
+    Subscriptions.reset();
+    AddressSpace.reset();
+    Server.reset();
+  }
+
+  ServiceMetrics::SharedPtr GetMetrics() const override
+  {
+    return Metrics;
+  }
+
+private:
+  void CreateNodes()
+  {
+    Node(Server, ObjectId::Server_ServerDiagnostics_EnabledFlag).SetValue(true);
+
+    SummaryNodes.push_back(Node(Server, ObjectId::Server_ServerDiagnostics_ServerDiagnosticsSummary_CurrentSessionCount));
+    SummaryNodes.push_back(Node(Server, ObjectId::Server_ServerDiagnostics_ServerDiagnosticsSummary_CumulatedSessionCount));
+    SummaryNodes.push_back(Node(Server, ObjectId::Server_ServerDiagnostics_ServerDiagnosticsSummary_CurrentSubscriptionCount));
+    SummaryNodes.push_back(Node(Server, ObjectId::Server_ServerDiagnostics_ServerDiagnosticsSummary_CumulatedSubscriptionCount));
+    SummaryNodes.push_back(Node(Server, ObjectId::Server_ServerDiagnostics_ServerDiagnosticsSummary_RejectedRequestsCount));
+
+    Node diagnostics(Server, ObjectId::Server_ServerDiagnostics);
+    Node root = diagnostics.AddObject(StringNodeId("ServiceCounters", MetricsNamespace), QualifiedName("ServiceCounters", MetricsNamespace));
+
+    Metrics->ForEachService([this, &root](const ServiceCounters & counters)
+    {
+      const std::string prefix = "ServiceCounters." + counters.Name;
+      Node object = root.AddObject(StringNodeId(prefix, MetricsNamespace), QualifiedName(counters.Name, MetricsNamespace));
+
+      ServiceNodes nodes;
+      nodes.Counters = &counters;
+
+      for (const char * name : {"TotalCount", "ErrorCount", "BytesIn", "BytesOut"})
+        {
+          nodes.Variables.push_back(object.AddVariable(StringNodeId(prefix + "." + name, MetricsNamespace), QualifiedName(name, MetricsNamespace), Variant(uint64_t())));
+        }
+
+      for (const char * name : {"DecodeP50Us", "DecodeP99Us", "ServiceP50Us", "ServiceP99Us", "EncodeP50Us", "EncodeP99Us"})
+        {
+          nodes.Variables.push_back(object.AddVariable(StringNodeId(prefix + "." + name, MetricsNamespace), QualifiedName(name, MetricsNamespace), Variant(double())));
+        }
+
+      Nodes.push_back(nodes);
+    });
+  }
+
+  // Subscription counters change on every publishing cycle, so they are not
+  // copied to the address space periodically but snapshotted when read.
+  void CreateSubscriptionNodes()
+  {
+    Node diagnostics(Server, ObjectId::Server_ServerDiagnostics);
+    Node subscriptions = diagnostics.AddObject(StringNodeId("SubscriptionDiagnostics", MetricsNamespace), QualifiedName("SubscriptionDiagnostics", MetricsNamespace));
+
+    AddColumn(subscriptions, "SubscriptionDiagnostics.SessionId", "SessionId", [this]()
+    {
+      std::vector<NodeId> column;
+
+      for (const SubscriptionDiagnostics & diag : Subscriptions->GetSubscriptionDiagnostics())
+        {
+          column.push_back(diag.SessionId);
+        }
+
+      return Variant(column);
+    });
+
+    AddColumn(subscriptions, "SubscriptionDiagnostics.PublishingInterval", "PublishingInterval", [this]()
+    {
+      std::vector<double> column;
+
+      for (const SubscriptionDiagnostics & diag : Subscriptions->GetSubscriptionDiagnostics())
+        {
+          column.push_back(diag.PublishingInterval);
+        }
+
+      return Variant(column);
+    });
+
+    for (const auto & counter : SubscriptionColumns)
+      {
+        const SubscriptionCounter member = counter.second;
+        AddColumn(subscriptions, std::string("SubscriptionDiagnostics.") + counter.first, counter.first, [this, member]()
+        {
+          std::vector<uint32_t> column;
+
+          for (const SubscriptionDiagnostics & diag : Subscriptions->GetSubscriptionDiagnostics())
+            {
+              column.push_back(diag.*member);
+            }
+
+          return Variant(column);
+        });
+      }
+
+    Node sessions = diagnostics.AddObject(StringNodeId("SessionDiagnostics", MetricsNamespace), QualifiedName("SessionDiagnostics", MetricsNamespace));
+
+    AddColumn(sessions, "SessionDiagnostics.SessionId", "SessionId", [this]()
+    {
+      std::vector<NodeId> column;
+
+      for (const auto & session : GetSessionDiagnostics(Subscriptions->GetSubscriptionDiagnostics()))
+        {
+          column.push_back(session.first);
+        }
+
+      return Variant(column);
+    });
+
+    AddColumn(sessions, "SessionDiagnostics.SubscriptionCount", "SubscriptionCount", [this]()
+    {
+      std::vector<uint32_t> column;
+
+      for (const auto & session : GetSessionDiagnostics(Subscriptions->GetSubscriptionDiagnostics()))
+        {
+          column.push_back(session.second.SubscriptionCount);
+        }
+
+      return Variant(column);
+    });
+
+    for (const auto & counter : SessionColumns)
+      {
+        const SubscriptionCounter member = counter.second;
+        AddColumn(sessions, std::string("SessionDiagnostics.") + counter.first, counter.first, [this, member]()
+        {
+          std::vector<uint32_t> column;
+
+          for (const auto & session : GetSessionDiagnostics(Subscriptions->GetSubscriptionDiagnostics()))
+            {
+              column.push_back(session.second.Total.*member);
+            }
+
+          return Variant(column);
+        });
+      }
+  }
+
+  void AddColumn(Node & parent, const std::string & id, const char * name, std::function<Variant()> snapshot)
+  {
+    Node variable = parent.AddVariable(StringNodeId(id, MetricsNamespace), QualifiedName(name, MetricsNamespace), snapshot());
+    AddressSpace->SetValueCallback(variable.GetId(), AttributeId::Value, [snapshot]()
+    {
+      return DataValue(snapshot());
+    });
+    CallbackNodes.push_back(variable.GetId());
+  }
+
+  void Update()
+  {
+    try
+      {
+        UpdateNodes();
+
+        if (!DumpFile.empty())
+          {
+            WriteDumpFile();
+          }
+      }
+
+    catch (const std::exception & exc)
+      {
+        LOG_ERROR(Logger, "service_metrics       | failed to publish metrics: {}", exc.what());
+      }
+  }
+
+  void UpdateNodes()
+  {
+    SummaryNodes[0].SetValue(Metrics->GetCurrentSessionCount());
+    SummaryNodes[1].SetValue(Metrics->GetCumulatedSessionCount());
+    SummaryNodes[2].SetValue(Metrics->GetCurrentSubscriptionCount());
+    SummaryNodes[3].SetValue(Metrics->GetCumulatedSubscriptionCount());
+    SummaryNodes[4].SetValue(Metrics->GetRejectedRequestsCount());
+
+    for (ServiceNodes & nodes : Nodes)
+      {
+        const ServiceCounters & counters = *nodes.Counters;
+        const uint64_t requests = counters.Requests.load(std::memory_order_relaxed);
+
+        if (!requests)
+          {
+            continue;
+          }
+
+        nodes.Variables[0].SetValue(requests);
+        nodes.Variables[1].SetValue(static_cast<uint64_t>(counters.Errors.load(std::memory_order_relaxed)));
+        nodes.Variables[2].SetValue(static_cast<uint64_t>(counters.BytesIn.load(std::memory_order_relaxed)));
+        nodes.Variables[3].SetValue(static_cast<uint64_t>(counters.BytesOut.load(std::memory_order_relaxed)));
+        nodes.Variables[4].SetValue(counters.DecodeTime.Percentile(0.5) / 1000.0);
+        nodes.Variables[5].SetValue(counters.DecodeTime.Percentile(0.99) / 1000.0);
+        nodes.Variables[6].SetValue(counters.ServiceTime.Percentile(0.5) / 1000.0);
+        nodes.Variables[7].SetValue(counters.ServiceTime.Percentile(0.99) / 1000.0);
+        nodes.Variables[8].SetValue(counters.EncodeTime.Percentile(0.5) / 1000.0);
+        nodes.Variables[9].SetValue(counters.EncodeTime.Percentile(0.99) / 1000.0);
+      }
+  }
+
+  // write to a temporary file and rename it so readers never see a partial dump
+  void WriteDumpFile()
+  {
+    const std::string tmp = DumpFile + ".tmp";
+
+    {
+      std::ofstream out(tmp.c_str(), std::ios::trunc);
+      Metrics->Dump(out);
+      DumpSubscriptionDiagnostics(out, Subscriptions->GetSubscriptionDiagnostics());
+
+      if (!out)
+        {
+          throw std::runtime_error("cannot write '" + tmp + "'");
+        }
+    }
+
+    if (std::rename(tmp.c_str(), DumpFile.c_str()))
+      {
+        throw std::runtime_error("cannot rename '" + tmp + "' to '" + DumpFile + "'");
+      }
+  }
+
+private:
+  Common::Logger::SharedPtr Logger;
+  ServiceMetrics::SharedPtr Metrics;
+  OpcUa::Services::SharedPtr Server;
+  SubscriptionService::SharedPtr Subscriptions;
+  OpcUa::Server::AddressSpace::SharedPtr AddressSpace;
+  std::vector<NodeId> CallbackNodes;
+  std::unique_ptr<PeriodicTimer> Timer;
+  std::vector<Node> SummaryNodes;
+  std::vector<ServiceNodes> Nodes;
+  std::string DumpFile;
+};
+
+} // namespace
+
+namespace OpcUa
+{
+namespace Server
+{
+
+Common::Addon::UniquePtr ServiceMetricsAddonFactory::CreateAddon()
+{
+  return Common::Addon::UniquePtr(new ServiceMetricsAddonImpl());
+}
+
+}
+}
@@ -118,6 +118,20 @@ public:
     return;
   }
 
+  virtual QueryFirstResult QueryFirst(const QueryFirstParameters & params) const
+  {
+    QueryFirstResult result;
+    result.Status = StatusCode::BadServiceUnsupported;
+    return result;
+  }
+
+  virtual QueryNextResult QueryNext(const QueryNextParameters & params) const
+  {
+    QueryNextResult result;
+    result.Status = StatusCode::BadServiceUnsupported;
+    return result;
+  }
+
   virtual std::vector<OpcUa::DataValue> Read(const OpcUa::ReadParameters & filter) const
   {
     DataValue value;
@@ -167,6 +181,13 @@ public:
     return response;
   }
 
+  virtual std::vector<TransferResult> TransferSubscriptions(const TransferSubscriptionsRequest & request, std::function<void (PublishResult)> callback)
+  {
+    TransferResult result;
+    result.Status = StatusCode::BadNotImplemented;
+    return std::vector<TransferResult>(request.Parameters.SubscriptionIds.size(), result);
+  }
+
 };
 
 class ServicesRegistry::InternalServer : public Services
@@ -0,0 +1,657 @@
+/// @brief Sessions which outlive the secure channel they were created on.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include "session_manager.h"
+
+#include <opc/ua/protocol/session.h>
+#include <opc/ua/protocol/string_utils.h>
+#include <opc/ua/server/subscription_service.h>
+
+#include <algorithm>
+#include <random>
+
+namespace
+{
+
+const double DefaultSessionTimeout = 60000;
+const double MaxSessionTimeout = 3600000;
+
+double ReviseTimeout(double requested)
+{
+  if (!(requested > 0))
+    {
+      return DefaultSessionTimeout;
+    }
+
+  return std::min(requested, MaxSessionTimeout);
+}
+
+// the token authenticates the requests of a session, it must not be predictable like the session id
+OpcUa::NodeId GenerateAuthenticationToken()
+{
+  std::random_device random;
+  OpcUa::Guid guid;
+  guid.Data1 = random();
+  guid.Data2 = static_cast<uint16_t>(random());
+  guid.Data3 = static_cast<uint16_t>(random());
+
+  for (uint8_t & byte : guid.Data4)
+    {
+      byte = static_cast<uint8_t>(random());
+    }
+
+  return OpcUa::GuidNodeId(guid, 0);
+}
+
+}
+
+namespace OpcUa
+{
+namespace Server
+{
+
+Session::Session(const NodeId & id, const NodeId & authenticationToken, double timeout, boost::asio::io_service * io)
+  : SessionId(id)
+  , AuthenticationToken(authenticationToken)
+  , Timeout(timeout)
+  , Timer(io ? new boost::asio::steady_timer(*io) : nullptr)
+{
+}
+
+bool Session::Forward(PublishResult result)
+{
+  std::shared_ptr<SessionChannel> channel;
+  {
+    std::lock_guard<std::mutex> lock(Mutex);
+    channel = Channel.lock();
+  }
+
+  if (!channel)
+    {
+      return false;
+    }
+
+  channel->ForwardPublishResponse(std::move(result));
+  return true;
+}
+
+bool Session::IsBoundTo(const SessionChannel * channel) const
+{
+  std::lock_guard<std::mutex> lock(Mutex);
+  return BoundChannel == channel;
+}
+
+std::set<uint32_t> Session::GetSubscriptions() const
+{
+  std::lock_guard<std::mutex> lock(Mutex);
+  return Subscriptions;
+}
+
+std::string Session::GetUserIdentity() const
+{
+  std::lock_guard<std::mutex> lock(Mutex);
+  return UserIdentity;
+}
+
+const std::size_t SessionManager::MaxQueryContinuationPoints;
+
+SessionManager::SessionManager(Services::SharedPtr server, boost::asio::io_service * io, const Common::Logger::SharedPtr & logger, ServiceMetrics::SharedPtr metrics)
+  : Server(server)
+  , Io(io)
+  , Logger(logger)
+  , Metrics(metrics)
+{
+}
+
+void SessionManager::Start()
+{
+  SubscriptionService::SharedPtr subscriptions = std::dynamic_pointer_cast<SubscriptionService>(Server->Subscriptions());
+
+  if (!subscriptions)
+    {
+      return;
+    }
+
+  {
+    std::lock_guard<std::mutex> lock(Mutex);
+    Started = true;
+  }
+
+  std::weak_ptr<SessionManager> weakSelf = shared_from_this();
+  subscriptions->SetSessionTerminationHandler([weakSelf](const NodeId & authenticationToken)
+  {
+    SessionManager::SharedPtr self = weakSelf.lock();
+
+    if (self)
+      {
+        self->TerminateSession(authenticationToken);
+      }
+  });
+}
+
+Session::SharedPtr SessionManager::CreateSession(double requestedTimeout, const std::shared_ptr<SessionChannel> & channel)
+{
+  Session::SharedPtr session;
+  {
+    std::lock_guard<std::mutex> lock(Mutex);
+
+    NodeId token = GenerateAuthenticationToken();
+
+    while (Sessions.count(token))
+      {
+        token = GenerateAuthenticationToken();
+      }
+
+    session = std::make_shared<Session>(GenerateSessionId(), token, ReviseTimeout(requestedTimeout), Io);
+    session->Channel = channel;
+    session->BoundChannel = channel.get();
+    Sessions[token] = session;
+  }
+
+  SubscriptionService::SharedPtr subscriptions = std::dynamic_pointer_cast<SubscriptionService>(Server->Subscriptions());
+
+  if (subscriptions)
+    {
+      subscriptions->RegisterSession(session->AuthenticationToken, session->SessionId);
+    }
+
+  LOG_INFO(Logger, "session_manager       | created session: {}, timeout: {} ms", session->SessionId, session->Timeout);
+
+  if (Metrics)
+    {
+      Metrics->SessionCreated();
+    }
+
+  return session;
+}
+
+Session::SharedPtr SessionManager::ActivateSession(const NodeId & authenticationToken, const std::shared_ptr<SessionChannel> & channel, const std::string & userIdentity)
+{
+  Session::SharedPtr session;
+  bool rebound = false;
+  {
+    std::lock_guard<std::mutex> lock(Mutex);
+
+    std::map<NodeId, Session::SharedPtr>::iterator it = Sessions.find(authenticationToken);
+
+    if (it == Sessions.end())
+      {
+        return Session::SharedPtr();
+      }
+
+    session = it->second;
+
+    std::lock_guard<std::mutex> sessionLock(session->Mutex);
+
+    if (session->Closed)
+      {
+        return Session::SharedPtr();
+      }
+
+    if (session->BoundChannel != channel.get())
+      {
+        // a lost connection is taken over by the same user only
+        if (session->Activated && session->UserIdentity != userIdentity)
+          {
+            LOG_WARN(Logger, "session_manager       | refused activation of session: {} by another user", session->SessionId);
+            return Session::SharedPtr();
+          }
+
+        // the token alone does not prove that the client of a live connection moved
+        if (session->Channel.lock() && userIdentity.empty())
+          {
+            LOG_WARN(Logger, "session_manager       | refused anonymous activation of session: {} bound to a live secure channel", session->SessionId);
+            return Session::SharedPtr();
+          }
+
+        rebound = true;
+        session->Channel = channel;
+        session->BoundChannel = channel.get();
+
+        if (session->Timer)
+          {
+            session->Timer->cancel();
+          }
+      }
+
+    // the first activation decides the user, later ones may change it on the same channel
+    session->UserIdentity = userIdentity;
+    session->Activated = true;
+  }
+
+  if (rebound)
+    {
+      LOG_INFO(Logger, "session_manager       | session: {} bound to a new secure channel", session->SessionId);
+      // publish requests of the previous channel can not be answered anymore
+      DropPublishRequests(session->AuthenticationToken);
+    }
+
+  return session;
+}
+
+void SessionManager::DetachSession(const Session::SharedPtr & session, const SessionChannel * channel)
+{
+  if (!session)
+    {
+      return;
+    }
+
+  {
+    std::lock_guard<std::mutex> lock(session->Mutex);
+
+    if (session->Closed || session->BoundChannel != channel)
+      {
+        return;
+      }
+
+    session->Channel.reset();
+    session->BoundChannel = nullptr;
+  }
+
+  LOG_DEBUG(Logger, "session_manager       | session: {} lost its secure channel", session->SessionId);
+
+  DropPublishRequests(session->AuthenticationToken);
+  StartTimeout(session);
+}
+
+void SessionManager::CloseSession(const Session::SharedPtr & session, bool deleteSubscriptions)
+{
+  if (!session)
+    {
+      return;
+    }
+
+  if (deleteSubscriptions)
+    {
+      Expire(session, false);
+      return;
+    }
+
+  std::deque<std::vector<uint8_t>> queries;
+  {
+    std::lock_guard<std::mutex> lock(session->Mutex);
+
+    if (session->Closed)
+      {
+        return;
+      }
+
+    session->Closed = true;
+    session->Channel.reset();
+    session->BoundChannel = nullptr;
+    queries.swap(session->Queries);
+  }
+
+  for (const std::vector<uint8_t> & point : queries)
+    {
+      ReleaseQuery(point);
+    }
+
+  LOG_INFO(Logger, "session_manager       | closed session: {}, its subscriptions are kept for {} ms", session->SessionId, session->Timeout);
+
+  if (Metrics)
+    {
+      Metrics->SessionClosed();
+    }
+
+  DropPublishRequests(session->AuthenticationToken);
+  StartTimeout(session);
+}
+
+void SessionManager::Shutdown()
+{
+  std::vector<Session::SharedPtr> sessions;
+  bool started = false;
+  {
+    std::lock_guard<std::mutex> lock(Mutex);
+
+    Stopped = true;
+    started = Started;
+
+    for (const auto & pair : Sessions)
+      {
+        sessions.push_back(pair.second);
+      }
+  }
+
+  for (const Session::SharedPtr & session : sessions)
+    {
+      Expire(session, false);
+    }
+
+  SubscriptionService::SharedPtr subscriptions = std::dynamic_pointer_cast<SubscriptionService>(Server->Subscriptions());
+
+  if (started && subscriptions)
+    {
+      subscriptions->SetSessionTerminationHandler(SubscriptionService::SessionTerminationHandler());
+    }
+}
+
+void SessionManager::TerminateSession(const NodeId & authenticationToken)
+{
+  Session::SharedPtr session;
+  {
+    std::lock_guard<std::mutex> lock(Mutex);
+
+    std::map<NodeId, Session::SharedPtr>::iterator it = Sessions.find(authenticationToken);
+
+    if (it == Sessions.end())
+      {
+        return;
+      }
+
+    session = it->second;
+  }
+
+  std::shared_ptr<SessionChannel> channel;
+  {
+    std::lock_guard<std::mutex> lock(session->Mutex);
+    channel = session->Channel.lock();
+  }
+
+  LOG_WARN(Logger, "session_manager       | terminating session: {}", session->SessionId);
+
+  Expire(session, false);
+
+  if (channel)
+    {
+      channel->Close();
+    }
+}
+
+void SessionManager::AddSubscription(const Session::SharedPtr & session, uint32_t id)
+{
+  std::lock_guard<std::mutex> lock(session->Mutex);
+  session->Subscriptions.insert(id);
+}
+
+void SessionManager::RemoveSubscriptions(const Session::SharedPtr & session, const std::vector<uint32_t> & ids)
+{
+  std::lock_guard<std::mutex> lock(session->Mutex);
+
+  for (uint32_t id : ids)
+    {
+      session->Subscriptions.erase(id);
+    }
+}
+
+void SessionManager::MoveSubscription(const Session::SharedPtr & session, uint32_t id)
+{
+  std::lock_guard<std::mutex> lock(Mutex);
+
+  for (const auto & pair : Sessions)
+    {
+      std::lock_guard<std::mutex> sessionLock(pair.second->Mutex);
+
+      if (pair.second == session)
+        {
+          pair.second->Subscriptions.insert(id);
+        }
+
+      else
+        {
+          pair.second->Subscriptions.erase(id);
+        }
+    }
+}
+
+std::vector<TransferResult> SessionManager::TransferSubscriptions(const Session::SharedPtr & session, const TransferSubscriptionsRequest & request, std::function<void (PublishResult)> callback)
+{
+  const std::string user = session->GetUserIdentity();
+  std::vector<TransferResult> results(request.Parameters.SubscriptionIds.size());
+  TransferSubscriptionsRequest allowed = request;
+  allowed.Header.SessionAuthenticationToken = session->AuthenticationToken;
+  allowed.Parameters.SubscriptionIds.clear();
+  std::vector<std::size_t> positions;
+  {
+    std::lock_guard<std::mutex> lock(Mutex);
+
+    for (std::size_t i = 0; i < request.Parameters.SubscriptionIds.size(); ++i)
+      {
+        const uint32_t id = request.Parameters.SubscriptionIds[i];
+        results[i].Status = StatusCode::BadSubscriptionIdInvalid;
+
+        for (const auto & pair : Sessions)
+          {
+            std::lock_guard<std::mutex> sessionLock(pair.second->Mutex);
+
+            if (!pair.second->Subscriptions.count(id))
+              {
+                continue;
+              }
+
+            if (pair.second->UserIdentity != user)
+              {
+                LOG_WARN(Logger, "session_manager       | refused transfer of subscription: {} to session: {} of another user", id, session->SessionId);
+                results[i].Status = StatusCode::BadUserAccessDenied;
+              }
+
+            else
+              {
+                allowed.Parameters.SubscriptionIds.push_back(id);
+                positions.push_back(i);
+              }
+
+            break;
+          }
+      }
+  }
+
+  if (positions.empty())
+    {
+      return results;
+    }
+
+  std::vector<TransferResult> transferred = Server->Subscriptions()->TransferSubscriptions(allowed, callback);
+
+  for (std::size_t i = 0; i < positions.size() && i < transferred.size(); ++i)
+    {
+      results[positions[i]] = transferred[i];
+
+      if (transferred[i].Status == StatusCode::Good)
+        {
+          MoveSubscription(session, allowed.Parameters.SubscriptionIds[i]);
+        }
+    }
+
+  return results;
+}
+
+QueryFirstResult SessionManager::QueryFirst(const Session::SharedPtr & session, const QueryFirstParameters & params)
+{
+  QueryFirstResult result = Server->Views()->QueryFirst(params);
+
+  if (!result.ContinuationPoint.empty())
+    {
+      ReleaseQuery(AddQuery(session, result.ContinuationPoint));
+    }
+
+  return result;
+}
+
+QueryNextResult SessionManager::QueryNext(const Session::SharedPtr & session, const QueryNextParameters & params)
+{
+  {
+    std::lock_guard<std::mutex> lock(session->Mutex);
+    std::deque<std::vector<uint8_t>>::iterator it = std::find(session->Queries.begin(), session->Queries.end(), params.ContinuationPoint);
+
+    // continuation points of other sessions are unknown to this one
+    if (it == session->Queries.end())
+      {
+        QueryNextResult result;
+        result.Status = StatusCode::BadContinuationPointInvalid;
+        return result;
+      }
+
+    session->Queries.erase(it);
+  }
+
+  QueryNextResult result = Server->Views()->QueryNext(params);
+
+  if (!result.RevisedContinuationPoint.empty())
+    {
+      ReleaseQuery(AddQuery(session, result.RevisedContinuationPoint));
+    }
+
+  return result;
+}
+
+std::vector<uint8_t> SessionManager::AddQuery(const Session::SharedPtr & session, const std::vector<uint8_t> & point)
+{
+  std::lock_guard<std::mutex> lock(session->Mutex);
+
+  // the session may have ended while the query ran
+  if (session->Closed)
+    {
+      return point;
+    }
+
+  session->Queries.push_back(point);
+
+  if (session->Queries.size() <= MaxQueryContinuationPoints)
+    {
+      return std::vector<uint8_t>();
+    }
+
+  std::vector<uint8_t> oldest = std::move(session->Queries.front());
+  session->Queries.pop_front();
+  return oldest;
+}
+
+void SessionManager::ReleaseQuery(const std::vector<uint8_t> & point)
+{
+  if (point.empty())
+    {
+      return;
+    }
+
+  QueryNextParameters params;
+  params.ReleaseContinuationPoint = true;
+  params.ContinuationPoint = point;
+  Server->Views()->QueryNext(params);
+}
+
+std::size_t SessionManager::GetSessionCount() const
+{
+  std::lock_guard<std::mutex> lock(Mutex);
+  return Sessions.size();
+}
+
+void SessionManager::StartTimeout(const Session::SharedPtr & session)
+{
+  bool expireNow = false;
+  {
+    std::lock_guard<std::mutex> lock(Mutex);
+    expireNow = Stopped || !Io;
+  }
+
+  if (expireNow)
+    {
+      Expire(session, true);
+      return;
+    }
+
+  std::weak_ptr<SessionManager> weakSelf = shared_from_this();
+  std::lock_guard<std::mutex> lock(session->Mutex);
+
+  session->Timer->expires_from_now(std::chrono::milliseconds(static_cast<int64_t>(session->Timeout)));
+  session->Timer->async_wait([weakSelf, session](const boost::system::error_code & error)
+  {
+    SessionManager::SharedPtr self = weakSelf.lock();
+
+    if (error || !self)
+      {
+        return;
+      }
+
+    LOG_INFO(self->Logger, "session_manager       | session: {} timed out", session->SessionId);
+    self->Expire(session, true);
+  });
+}
+
+void SessionManager::Expire(const Session::SharedPtr & session, bool detachedOnly)
+{
+  std::vector<uint32_t> subscriptions;
+  std::deque<std::vector<uint8_t>> queries;
+  bool wasOpen = false;
+  {
+    std::lock_guard<std::mutex> lock(Mutex);
+
+    std::map<NodeId, Session::SharedPtr>::iterator it = Sessions.find(session->AuthenticationToken);
+
+    if (it == Sessions.end() || it->second != session)
+      {
+        return;
+      }
+
+    std::lock_guard<std::mutex> sessionLock(session->Mutex);
+
+    if (detachedOnly && session->BoundChannel)
+      {
+        return;
+      }
+
+    Sessions.erase(it);
+    wasOpen = !session->Closed;
+    session->Closed = true;
+    session->Channel.reset();
+    session->BoundChannel = nullptr;
+    subscriptions.assign(session->Subscriptions.begin(), session->Subscriptions.end());
+    session->Subscriptions.clear();
+    queries.swap(session->Queries);
+
+    if (session->Timer)
+      {
+        session->Timer->cancel();
+      }
+  }
+
+  LOG_DEBUG(Logger, "session_manager       | end of session: {}, deleting {} subscriptions", session->SessionId, subscriptions.size());
+
+  if (!subscriptions.empty())
+    {
+      Server->Subscriptions()->DeleteSubscriptions(subscriptions);
+
+      if (Metrics)
+        {
+          Metrics->SubscriptionsDeleted(subscriptions.size());
+        }
+    }
+
+  DropPublishRequests(session->AuthenticationToken);
+
+  for (const std::vector<uint8_t> & point : queries)
+    {
+      ReleaseQuery(point);
+    }
+
+  SubscriptionService::SharedPtr service = std::dynamic_pointer_cast<SubscriptionService>(Server->Subscriptions());
+
+  if (service)
+    {
+      service->UnregisterSession(session->AuthenticationToken);
+    }
+
+  if (Metrics && wasOpen)
+    {
+      Metrics->SessionClosed();
+    }
+}
+
+void SessionManager::DropPublishRequests(const NodeId & session)
+{
+  SubscriptionService::SharedPtr subscriptions = std::dynamic_pointer_cast<SubscriptionService>(Server->Subscriptions());
+
+  if (subscriptions)
+    {
+      subscriptions->DropPublishRequests(session);
+    }
+}
+
+} // namespace Server
+} // namespace OpcUa
@@ -0,0 +1,144 @@
+/// @brief Sessions which outlive the secure channel they were created on.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#pragma once
+
+#include <opc/common/class_pointers.h>
+#include <opc/common/logger.h>
+#include <opc/ua/server/service_metrics.h>
+#include <opc/ua/services/services.h>
+
+#include <boost/asio.hpp>
+#include <boost/asio/steady_timer.hpp>
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+
+namespace OpcUa
+{
+namespace Server
+{
+
+/// @brief Connection a session is bound to, sends the publish results of the session's subscriptions.
+class SessionChannel
+{
+public:
+  virtual ~SessionChannel() {}
+
+  virtual void ForwardPublishResponse(PublishResult result) = 0;
+  /// @brief Ends the connection once the queued responses are sent, the session was terminated.
+  virtual void Close() {}
+};
+
+class Session
+{
+public:
+  DEFINE_CLASS_POINTERS(Session)
+
+public:
+  Session(const NodeId & id, const NodeId & authenticationToken, double timeout, boost::asio::io_service * io);
+
+  /// @brief Sends a result through the bound channel.
+  /// @return false without a channel, the result stays in the retransmission queue of the subscription.
+  bool Forward(PublishResult result);
+
+  bool IsBoundTo(const SessionChannel * channel) const;
+  std::set<uint32_t> GetSubscriptions() const;
+  /// @brief User name of the activation, empty for anonymous users.
+  std::string GetUserIdentity() const;
+
+public:
+  const NodeId SessionId;
+  const NodeId AuthenticationToken; // random, unlike SessionId it can not be guessed
+  const double Timeout; // revised session timeout in milliseconds
+
+private:
+  friend class SessionManager;
+
+  mutable std::mutex Mutex;
+  std::weak_ptr<SessionChannel> Channel;
+  const SessionChannel * BoundChannel = nullptr;
+  std::set<uint32_t> Subscriptions;
+  std::deque<std::vector<uint8_t>> Queries; // query continuation points, oldest first
+  std::string UserIdentity;
+  bool Activated = false;
+  bool Closed = false;
+  std::unique_ptr<boost::asio::steady_timer> Timer;
+};
+
+/// @brief Owns the sessions of a server. A session whose connection is lost keeps
+/// its subscriptions until its timeout expires, ActivateSession binds it to the new channel.
+class SessionManager : public std::enable_shared_from_this<SessionManager>
+{
+public:
+  DEFINE_CLASS_POINTERS(SessionManager)
+
+public:
+  /// @param io runs the session timeouts, without it sessions end with their connection.
+  SessionManager(Services::SharedPtr server, boost::asio::io_service * io, const Common::Logger::SharedPtr & logger, ServiceMetrics::SharedPtr metrics = ServiceMetrics::SharedPtr());
+
+  /// @brief Ends the sessions which the subscription service terminates.
+  void Start();
+
+  Session::SharedPtr CreateSession(double requestedTimeout, const std::shared_ptr<SessionChannel> & channel);
+  /// @brief A session still bound to another live channel is only taken over by the
+  /// user which activated it, a session of an anonymous user is never taken over.
+  /// @param userIdentity user name of the identity token, empty for anonymous users.
+  /// @return null if the token does not belong to an open session or the activation is refused.
+  Session::SharedPtr ActivateSession(const NodeId & authenticationToken, const std::shared_ptr<SessionChannel> & channel, const std::string & userIdentity = std::string());
+  /// @brief The channel of the session was lost, starts the session timeout.
+  void DetachSession(const Session::SharedPtr & session, const SessionChannel * channel);
+  /// @brief Without deleting subscriptions they can still be transferred until the session times out.
+  void CloseSession(const Session::SharedPtr & session, bool deleteSubscriptions);
+  /// @brief Ends all sessions, sessions detached afterwards end at once.
+  void Shutdown();
+  /// @brief Deletes the subscriptions of a session and closes its connection.
+  void TerminateSession(const NodeId & authenticationToken);
+
+  void AddSubscription(const Session::SharedPtr & session, uint32_t id);
+  void RemoveSubscriptions(const Session::SharedPtr & session, const std::vector<uint32_t> & ids);
+  /// @brief Records that a subscription was transferred to another session.
+  void MoveSubscription(const Session::SharedPtr & session, uint32_t id);
+  /// @brief Transfers subscriptions of sessions activated by the same user to a session.
+  /// Subscriptions of other users are refused with BadUserAccessDenied.
+  std::vector<TransferResult> TransferSubscriptions(const Session::SharedPtr & session, const TransferSubscriptionsRequest & request, std::function<void (PublishResult)> callback);
+
+  /// @brief Query whose continuation point only the session can continue.
+  /// A session keeps MaxQueryContinuationPoints, the oldest is released first.
+  QueryFirstResult QueryFirst(const Session::SharedPtr & session, const QueryFirstParameters & params);
+  QueryNextResult QueryNext(const Session::SharedPtr & session, const QueryNextParameters & params);
+
+  static const std::size_t MaxQueryContinuationPoints = 16;
+
+  std::size_t GetSessionCount() const;
+
+private:
+  void StartTimeout(const Session::SharedPtr & session);
+  /// @param detachedOnly keeps a session which was activated again meanwhile.
+  void Expire(const Session::SharedPtr & session, bool detachedOnly);
+  void DropPublishRequests(const NodeId & session);
+  /// @return continuation point to release, empty if the session is within its limit.
+  std::vector<uint8_t> AddQuery(const Session::SharedPtr & session, const std::vector<uint8_t> & point);
+  void ReleaseQuery(const std::vector<uint8_t> & point);
+
+private:
+  Services::SharedPtr Server;
+  boost::asio::io_service * Io;
+  Common::Logger::SharedPtr Logger;
+  ServiceMetrics::SharedPtr Metrics;
+  mutable std::mutex Mutex;
+  std::map<NodeId, Session::SharedPtr> Sessions; // by authentication token
+  bool Stopped = false;
+  bool Started = false; // handles the terminations of the subscription service
+};
+
+} // namespace Server
+} // namespace OpcUa
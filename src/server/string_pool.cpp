@@ -0,0 +1,153 @@
+/// @brief Pool of shared strings for the names of the address space.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include "string_pool.h"
+
+#include <boost/functional/hash.hpp>
+
+#include <algorithm>
+
+namespace OpcUa
+{
+namespace Internal
+{
+
+const std::string & InternedString::Get() const
+{
+  static const std::string empty;
+  return Data ? Data->Value : empty;
+}
+
+LocalizedText InternedText::ToLocalizedText() const
+{
+  LocalizedText result;
+  result.Encoding = Encoding;
+  result.Locale = Locale.Get();
+  result.Text = Text.Get();
+  return result;
+}
+
+const std::size_t StringPool::MinPurgeSize;
+
+StringPool::StringPool()
+  : NextPurgeSize(MinPurgeSize)
+{
+}
+
+std::size_t StringPool::Hash::operator()(boost::string_view value) const
+{
+  return boost::hash_range(value.begin(), value.end());
+}
+
+InternedString StringPool::Intern(boost::string_view value)
+{
+  if (value.empty())
+    {
+      return InternedString();
+    }
+
+  std::lock_guard<std::mutex> lock(Mutex);
+  auto it = Strings.find(value);
+
+  if (it == Strings.end())
+    {
+      if (Strings.size() >= NextPurgeSize)
+        {
+          PurgeLocked();
+        }
+
+      std::unique_ptr<InternedString::Entry> entry(new InternedString::Entry());
+      entry->Refs = 0;
+      entry->Value.assign(value.data(), value.size());
+      const boost::string_view key(entry->Value);
+      it = Strings.emplace(key, std::move(entry)).first;
+    }
+
+  return InternedString(it->second.get());
+}
+
+InternedName StringPool::Intern(const QualifiedName & name)
+{
+  InternedName result;
+  result.NamespaceIndex = name.NamespaceIndex;
+  result.Name = Intern(name.Name);
+  return result;
+}
+
+InternedText StringPool::Intern(const LocalizedText & text)
+{
+  InternedText result;
+  result.Encoding = text.Encoding;
+  result.Locale = Intern(text.Locale);
+  result.Text = Intern(text.Text);
+  return result;
+}
+
+bool StringPool::Find(boost::string_view value, InternedString & result) const
+{
+  if (value.empty())
+    {
+      result = InternedString();
+      return true;
+    }
+
+  std::lock_guard<std::mutex> lock(Mutex);
+  const auto it = Strings.find(value);
+
+  if (it == Strings.end())
+    {
+      return false;
+    }
+
+  result = InternedString(it->second.get());
+  return true;
+}
+
+bool StringPool::Find(const QualifiedName & name, InternedName & result) const
+{
+  result.NamespaceIndex = name.NamespaceIndex;
+  return Find(name.Name, result.Name);
+}
+
+std::size_t StringPool::Purge()
+{
+  std::lock_guard<std::mutex> lock(Mutex);
+  return PurgeLocked();
+}
+
+std::size_t StringPool::PurgeLocked()
+{
+  std::size_t count = 0;
+
+  for (auto it = Strings.begin(); it != Strings.end();)
+    {
+      // new handles are made only under the lock or by copying a live one
+      if (it->second->Refs.load(std::memory_order_acquire) == 0)
+        {
+          it = Strings.erase(it);
+          ++count;
+        }
+
+      else
+        {
+          ++it;
+        }
+    }
+
+  NextPurgeSize = std::max(MinPurgeSize, 2 * Strings.size());
+  return count;
+}
+
+std::size_t StringPool::Size() const
+{
+  std::lock_guard<std::mutex> lock(Mutex);
+  return Strings.size();
+}
+
+}
+}
@@ -0,0 +1,173 @@
+/// @brief Pool of shared strings for the names of the address space.
+/// Equal strings interned in one pool share a single copy, so handles of
+/// one pool are compared by pointer. Handles count their users and Purge
+/// releases the strings which are not used anymore. Intern purges by itself
+/// each time the pool has doubled since the last purge, so replaced names do
+/// not pile up and the scan costs amortized O(1) per added string.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#pragma once
+
+#include <opc/ua/protocol/types.h>
+
+#include <boost/utility/string_view.hpp>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace OpcUa
+{
+namespace Internal
+{
+
+class StringPool;
+
+/// @brief Handle of a pooled string, the empty string by default.
+class InternedString
+{
+public:
+  InternedString()
+    : Data(nullptr)
+  {
+  }
+
+  InternedString(const InternedString & other)
+    : Data(other.Data)
+  {
+    AddRef();
+  }
+
+  InternedString(InternedString && other)
+    : Data(other.Data)
+  {
+    other.Data = nullptr;
+  }
+
+  InternedString & operator=(InternedString other)
+  {
+    std::swap(Data, other.Data);
+    return *this;
+  }
+
+  ~InternedString()
+  {
+    if (Data)
+      {
+        Data->Refs.fetch_sub(1, std::memory_order_release);
+      }
+  }
+
+  const std::string & Get() const;
+
+  bool operator==(const InternedString & other) const
+  {
+    return Data == other.Data;
+  }
+
+  bool operator!=(const InternedString & other) const
+  {
+    return Data != other.Data;
+  }
+
+private:
+  friend class StringPool;
+
+  struct Entry
+  {
+    std::atomic<uint32_t> Refs;
+    std::string Value;
+  };
+
+  explicit InternedString(Entry * data)
+    : Data(data)
+  {
+    AddRef();
+  }
+
+  void AddRef()
+  {
+    if (Data)
+      {
+        Data->Refs.fetch_add(1, std::memory_order_relaxed);
+      }
+  }
+
+  Entry * Data;
+};
+
+/// @brief QualifiedName with a pooled name.
+struct InternedName
+{
+  uint16_t NamespaceIndex = 0;
+  InternedString Name;
+
+  QualifiedName ToQualifiedName() const
+  {
+    return QualifiedName(NamespaceIndex, Name.Get());
+  }
+
+  bool operator==(const InternedName & other) const
+  {
+    return Name == other.Name && NamespaceIndex == other.NamespaceIndex;
+  }
+};
+
+/// @brief LocalizedText with pooled locale and text.
+struct InternedText
+{
+  uint8_t Encoding = 0;
+  InternedString Locale;
+  InternedString Text;
+
+  LocalizedText ToLocalizedText() const;
+};
+
+class StringPool
+{
+public:
+  StringPool();
+  StringPool(const StringPool &) = delete;
+  StringPool & operator=(const StringPool &) = delete;
+
+  InternedString Intern(boost::string_view value);
+  InternedName Intern(const QualifiedName & name);
+  InternedText Intern(const LocalizedText & text);
+
+  /// @brief Handle of a pooled string without adding it.
+  /// @return false if no handle of the string exists, so nothing can equal it.
+  bool Find(boost::string_view value, InternedString & result) const;
+  bool Find(const QualifiedName & name, InternedName & result) const;
+
+  /// @brief Release strings without handles.
+  /// @return number of released strings.
+  std::size_t Purge();
+
+  /// @brief Smallest size at which Intern purges the pool by itself.
+  static const std::size_t MinPurgeSize = 1024;
+
+  std::size_t Size() const;
+
+private:
+  struct Hash
+  {
+    std::size_t operator()(boost::string_view value) const;
+  };
+
+  std::size_t PurgeLocked();
+
+  mutable std::mutex Mutex;
+  std::size_t NextPurgeSize;
+  // keys point into the values
+  std::unordered_map<boost::string_view, std::unique_ptr<InternedString::Entry>, Hash> Strings;
+};
+
+}
+}
@@ -76,6 +76,11 @@ public:
     return Subscriptions->Republish(request);
   }
 
+  std::vector<OpcUa::TransferResult> TransferSubscriptions(const OpcUa::TransferSubscriptionsRequest & request, std::function<void (OpcUa::PublishResult)> callback)
+  {
+    return Subscriptions->TransferSubscriptions(request, callback);
+  }
+
   std::vector<OpcUa::MonitoredItemCreateResult> CreateMonitoredItems(const OpcUa::MonitoredItemsParameters & parameters)
   {
     return Subscriptions->CreateMonitoredItems(parameters);
@@ -86,6 +91,41 @@ public:
     return Subscriptions->DeleteMonitoredItems(parameters);
   }
 
+  std::vector<OpcUa::Server::SubscriptionDiagnostics> GetSubscriptionDiagnostics() const
+  {
+    return Subscriptions->GetSubscriptionDiagnostics();
+  }
+
+  void SetPublishParameters(const OpcUa::Server::PublishParameters & params)
+  {
+    Subscriptions->SetPublishParameters(params);
+  }
+
+  OpcUa::Server::PublishParameters GetPublishParameters() const
+  {
+    return Subscriptions->GetPublishParameters();
+  }
+
+  void DropPublishRequests(const OpcUa::NodeId & session)
+  {
+    Subscriptions->DropPublishRequests(session);
+  }
+
+  void RegisterSession(const OpcUa::NodeId & authenticationToken, const OpcUa::NodeId & sessionId)
+  {
+    Subscriptions->RegisterSession(authenticationToken, sessionId);
+  }
+
+  void UnregisterSession(const OpcUa::NodeId & authenticationToken)
+  {
+    Subscriptions->UnregisterSession(authenticationToken);
+  }
+
+  void SetSessionTerminationHandler(SessionTerminationHandler handler)
+  {
+    Subscriptions->SetSessionTerminationHandler(handler);
+  }
+
 
 private:
   void ApplyAddonParameters(const Common::AddonParameters & addons)
@@ -89,6 +89,10 @@ std::vector<StatusCode> SubscriptionServiceInternal::DeleteSubscriptions(const s
 
           itsub->second->Stop();
           SubscriptionsMap.erase(subid);
+          {
+            std::lock_guard<std::mutex> statLock(StatisticsMutex);
+            Statistics.erase(subid);
+          }
           result.push_back(StatusCode::Good);
         }
     }
@@ -131,9 +135,13 @@ SubscriptionData SubscriptionServiceInternal::CreateSubscription(const CreateSub
 
   LOG_DEBUG(Logger, "subscription_service  | CreateSubscription id: {}", data.SubscriptionId);
 
-  std::shared_ptr<InternalSubscription> sub(new InternalSubscription(*this, data, request.Header.SessionAuthenticationToken, callback, Logger));
+  std::shared_ptr<InternalSubscription> sub(new InternalSubscription(*this, data, request.Header.SessionAuthenticationToken, callback, PublishParams, Logger));
   sub->Start();
   SubscriptionsMap[data.SubscriptionId] = sub;
+  {
+    std::lock_guard<std::mutex> statLock(StatisticsMutex);
+    Statistics[data.SubscriptionId] = sub->GetStatistics();
+  }
   return data;
 }
 
@@ -194,13 +202,17 @@ void SubscriptionServiceInternal::Publish(const PublishRequest & request)
   boost::unique_lock<boost::shared_mutex> lock(DbMutex);
 
   const NodeId& session = request.Header.SessionAuthenticationToken;
-  if (PublishRequestQueues[session] < 100)
+  if (PublishRequestQueues[session] < PublishParams.MaxPublishRequests)
     {
       PublishRequestQueues[session] += 1;
       LOG_DEBUG(Logger, "subscription_service  | push PublishRequest for session: {}: available requests: {}", session, PublishRequestQueues[session]);
     }
 
-  //FIXME: else spec says we should return error to warn client
+  // the transport answers requests beyond the limit with BadTooManyPublishRequests
+  else
+    {
+      LOG_WARN(Logger, "subscription_service  | too many PublishRequests for session: {}", session);
+    }
 
   for (SubscriptionAcknowledgement ack :  request.SubscriptionAcknowledgements)
     {
@@ -211,6 +223,15 @@ void SubscriptionServiceInternal::Publish(const PublishRequest & request)
           sub_it->second->NewAcknowlegment(ack);
         }
     }
+
+  // low latency subscriptions holding notifications were waiting for this request
+  if (PublishParams.LowLatency)
+    {
+      for (const auto & sub : SubscriptionsMap)
+        {
+          sub.second->PublishRequestReceived(session);
+        }
+    }
 }
 
 RepublishResponse SubscriptionServiceInternal::Republish(const RepublishParameters & params)
@@ -229,9 +250,131 @@ RepublishResponse SubscriptionServiceInternal::Republish(const RepublishParamete
   return sub_it->second->Republish(params);
 }
 
+std::vector<TransferResult> SubscriptionServiceInternal::TransferSubscriptions(const TransferSubscriptionsRequest & request, std::function<void (PublishResult)> callback)
+{
+  const NodeId & session = request.Header.SessionAuthenticationToken;
+  std::vector<std::shared_ptr<InternalSubscription>> subscriptions;
+  {
+    boost::shared_lock<boost::shared_mutex> lock(DbMutex);
+
+    for (uint32_t subid : request.Parameters.SubscriptionIds)
+      {
+        SubscriptionsIdMap::iterator sub_it = SubscriptionsMap.find(subid);
+        subscriptions.push_back(sub_it == SubscriptionsMap.end() ? nullptr : sub_it->second);
+      }
+  }
+
+  // not under DbMutex: the publishing cycle of a subscription calls PopPublishRequest
+  std::vector<TransferResult> results;
+
+  for (std::size_t i = 0; i < subscriptions.size(); ++i)
+    {
+      if (!subscriptions[i])
+        {
+          LOG_ERROR(Logger, "subscription_service  | got request to transfer non existing SubscriptionId: {}", request.Parameters.SubscriptionIds[i]);
+          TransferResult result;
+          result.Status = StatusCode::BadSubscriptionIdInvalid;
+          results.push_back(result);
+          continue;
+        }
+
+      LOG_DEBUG(Logger, "subscription_service  | transfer SubscriptionId: {} to session: {}", request.Parameters.SubscriptionIds[i], session);
+      results.push_back(subscriptions[i]->Transfer(session, callback, request.Parameters.SendInitialValues));
+    }
+
+  return results;
+}
+
+std::vector<Server::SubscriptionDiagnostics> SubscriptionServiceInternal::GetSubscriptionDiagnostics() const
+{
+  std::lock_guard<std::mutex> lock(StatisticsMutex);
+
+  std::vector<Server::SubscriptionDiagnostics> result;
+  result.reserve(Statistics.size());
+
+  for (const auto & stat : Statistics)
+    {
+      result.push_back(stat.second->Snapshot());
+    }
+
+  return result;
+}
+
+void SubscriptionServiceInternal::SetPublishParameters(const Server::PublishParameters & params)
+{
+  boost::unique_lock<boost::shared_mutex> lock(DbMutex);
+
+  PublishParams = params;
+}
+
+Server::PublishParameters SubscriptionServiceInternal::GetPublishParameters() const
+{
+  boost::shared_lock<boost::shared_mutex> lock(DbMutex);
+
+  return PublishParams;
+}
+
+void SubscriptionServiceInternal::DropPublishRequests(const NodeId & session)
+{
+  boost::unique_lock<boost::shared_mutex> lock(DbMutex);
+
+  LOG_DEBUG(Logger, "subscription_service  | drop PublishRequests of session: {}", session);
+  PublishRequestQueues.erase(session);
+}
+
+void SubscriptionServiceInternal::RegisterSession(const NodeId & authenticationToken, const NodeId & sessionId)
+{
+  std::lock_guard<std::mutex> lock(SessionIdsMutex);
+  SessionIds[authenticationToken] = sessionId;
+}
+
+void SubscriptionServiceInternal::UnregisterSession(const NodeId & authenticationToken)
+{
+  std::lock_guard<std::mutex> lock(SessionIdsMutex);
+  SessionIds.erase(authenticationToken);
+}
+
+NodeId SubscriptionServiceInternal::GetSessionId(const NodeId & authenticationToken) const
+{
+  std::lock_guard<std::mutex> lock(SessionIdsMutex);
+  std::map<NodeId, NodeId>::const_iterator it = SessionIds.find(authenticationToken);
+  return it == SessionIds.end() ? authenticationToken : it->second;
+}
+
+void SubscriptionServiceInternal::SetSessionTerminationHandler(SessionTerminationHandler handler)
+{
+  std::lock_guard<std::mutex> lock(TerminationMutex);
+  TerminationHandler = handler;
+}
+
+void SubscriptionServiceInternal::TerminateSession(const NodeId & session)
+{
+  SessionTerminationHandler handler;
+  {
+    std::lock_guard<std::mutex> lock(TerminationMutex);
+    handler = TerminationHandler;
+  }
+
+  LOG_WARN(Logger, "subscription_service  | terminating session: {}", session);
+
+  if (handler)
+    {
+      handler(session);
+    }
+}
+
+bool SubscriptionServiceInternal::HasPublishRequest(const NodeId & node) const
+{
+  boost::shared_lock<boost::shared_mutex> lock(DbMutex);
+
+  std::map<NodeId, uint32_t>::const_iterator queue_it = PublishRequestQueues.find(node);
+  return queue_it != PublishRequestQueues.end() && queue_it->second > 0;
+}
 
 bool SubscriptionServiceInternal::PopPublishRequest(NodeId node)
 {
+  boost::unique_lock<boost::shared_mutex> lock(DbMutex);
+
   std::map<NodeId, uint32_t>::iterator queue_it = PublishRequestQueues.find(node);
 
   if (queue_it == PublishRequestQueues.end())
@@ -26,6 +26,7 @@
 #include <limits>
 #include <list>
 #include <map>
+#include <mutex>
 #include <queue>
 #include <deque>
 #include <set>
@@ -37,6 +38,7 @@ namespace Internal
 {
 
 class InternalSubscription;
+struct SubscriptionStatistics;
 
 typedef std::map <uint32_t, std::shared_ptr<InternalSubscription>> SubscriptionsIdMap; // Map SubscptioinId, SubscriptionData
 
@@ -55,12 +57,24 @@ public:
   virtual std::vector<StatusCode> DeleteMonitoredItems(const DeleteMonitoredItemsParameters & params);
   virtual void Publish(const PublishRequest & request);
   virtual RepublishResponse Republish(const RepublishParameters & request);
+  virtual std::vector<TransferResult> TransferSubscriptions(const TransferSubscriptionsRequest & request, std::function<void (PublishResult)> callback);
+  virtual std::vector<Server::SubscriptionDiagnostics> GetSubscriptionDiagnostics() const;
+  virtual void SetPublishParameters(const Server::PublishParameters & params);
+  virtual Server::PublishParameters GetPublishParameters() const;
+  virtual void DropPublishRequests(const NodeId & session);
+  virtual void SetSessionTerminationHandler(SessionTerminationHandler handler);
+  virtual void RegisterSession(const NodeId & authenticationToken, const NodeId & sessionId);
+  virtual void UnregisterSession(const NodeId & authenticationToken);
 
   void DeleteAllSubscriptions();
   boost::asio::io_service & GetIOService();
   bool PopPublishRequest(NodeId node);
+  bool HasPublishRequest(const NodeId & node) const;
   void TriggerEvent(NodeId node, Event event);
   Server::AddressSpace & GetAddressSpace();
+  void TerminateSession(const NodeId & session);
+  /// @brief SessionId of a registered session, the token itself otherwise.
+  NodeId GetSessionId(const NodeId & authenticationToken) const;
 
 private:
   boost::asio::io_service & io;
@@ -70,6 +84,15 @@ private:
   SubscriptionsIdMap SubscriptionsMap; // Map SubscptioinId, SubscriptionData
   uint32_t LastSubscriptionId = 2;
   std::map<NodeId, uint32_t> PublishRequestQueues;
+  Server::PublishParameters PublishParams;
+  // Separate from DbMutex: diagnostics are read from address space value
+  // callbacks which must not wait for a subscription service operation.
+  mutable std::mutex StatisticsMutex;
+  std::map<uint32_t, std::shared_ptr<const SubscriptionStatistics>> Statistics;
+  mutable std::mutex SessionIdsMutex;
+  std::map<NodeId, NodeId> SessionIds; // by authentication token
+  std::mutex TerminationMutex;
+  SessionTerminationHandler TerminationHandler;
 };
 
 
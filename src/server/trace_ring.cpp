@@ -0,0 +1,307 @@
+/// @brief Per thread ring buffers of binary hot path events.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include <opc/ua/server/trace_ring.h>
+#include <opc/ua/server/service_metrics.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace
+{
+using namespace OpcUa::Server;
+
+const uint64_t RingMask = TraceRingSize - 1;
+static_assert((TraceRingSize & RingMask) == 0, "TraceRingSize must be a power of two");
+
+// Events are stored as three relaxed atomic words so that a reader copying a
+// slot that is being overwritten gets stale data instead of undefined behavior;
+// such slots are detected through Head and dropped.
+struct TraceSlot
+{
+  std::atomic<uint64_t> Timestamp;
+  std::atomic<uint64_t> Request;   // connection id << 32 | request handle
+  std::atomic<uint64_t> Service;   // service id << 8 | phase
+};
+
+struct ThreadRing
+{
+  explicit ThreadRing(uint32_t index)
+    : Index(index)
+    , Head(0)
+  {
+  }
+
+  const uint32_t Index;
+  std::atomic<uint64_t> Head;   // number of events ever written
+  TraceSlot Slots[TraceRingSize];
+};
+
+struct RingRegistry
+{
+  std::mutex Mutex;
+  std::vector<std::shared_ptr<ThreadRing>> Rings;
+  std::vector<ThreadRing *> Free; // rings of exited threads
+};
+
+RingRegistry & GetRegistry()
+{
+  static RingRegistry registry;
+  return registry;
+}
+
+// Hands the ring of an exiting thread back to the registry, so the number of
+// rings is bounded by the number of threads alive at once.
+struct RingOwner
+{
+  ThreadRing * Ring = nullptr;
+
+  ~RingOwner()
+  {
+    if (Ring)
+      {
+        RingRegistry & registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.Mutex);
+        registry.Free.push_back(Ring);
+      }
+  }
+};
+
+// Rings are owned by the registry so history of finished threads is kept
+// until a new thread reuses their ring.
+ThreadRing & GetThreadRing()
+{
+  thread_local RingOwner owner;
+
+  if (!owner.Ring)
+    {
+      RingRegistry & registry = GetRegistry();
+      std::lock_guard<std::mutex> lock(registry.Mutex);
+
+      if (!registry.Free.empty())
+        {
+          owner.Ring = registry.Free.back();
+          registry.Free.pop_back();
+        }
+
+      else
+        {
+          registry.Rings.push_back(std::make_shared<ThreadRing>(static_cast<uint32_t>(registry.Rings.size())));
+          owner.Ring = registry.Rings.back().get();
+        }
+    }
+
+  return *owner.Ring;
+}
+
+void CopyRing(const ThreadRing & ring, std::vector<TraceEvent> & events)
+{
+  const uint64_t head = ring.Head.load(std::memory_order_acquire);
+  const uint64_t begin = head > TraceRingSize ? head - TraceRingSize : 0;
+  const std::size_t offset = events.size();
+
+  for (uint64_t idx = begin; idx < head; ++idx)
+    {
+      const TraceSlot & slot = ring.Slots[idx & RingMask];
+      const uint64_t request = slot.Request.load(std::memory_order_relaxed);
+      const uint64_t service = slot.Service.load(std::memory_order_relaxed);
+
+      TraceEvent event;
+      event.Timestamp = slot.Timestamp.load(std::memory_order_relaxed);
+      event.ConnectionId = static_cast<uint32_t>(request >> 32);
+      event.RequestHandle = static_cast<uint32_t>(request);
+      event.ServiceId = static_cast<uint16_t>(service >> 8);
+      event.Phase = static_cast<TracePhase>(service & 0xff);
+      event.ThreadIndex = ring.Index;
+      events.push_back(event);
+    }
+
+  // The writer may have overwritten the oldest slots while they were copied,
+  // including the one it is writing right now.
+  std::atomic_thread_fence(std::memory_order_acquire);
+  const uint64_t after = ring.Head.load(std::memory_order_relaxed);
+  const uint64_t valid = after + 1 > TraceRingSize ? after + 1 - TraceRingSize : 0;
+
+  if (valid > begin)
+    {
+      const std::size_t overwritten = std::min<uint64_t>(valid - begin, head - begin);
+      events.erase(events.begin() + offset, events.begin() + offset + overwritten);
+    }
+}
+
+const char * GetPhaseName(TracePhase phase)
+{
+  switch (phase)
+    {
+    case TracePhase::RequestBegin:
+      return "begin";
+
+    case TracePhase::RequestDecoded:
+      return "decoded";
+
+    case TracePhase::RequestServiced:
+      return "serviced";
+
+    case TracePhase::RequestEnd:
+      return "end";
+
+    case TracePhase::RequestDeferred:
+      return "deferred";
+
+    case TracePhase::RequestAborted:
+      return "aborted";
+
+    case TracePhase::PublishCycle:
+      return "publish_cycle";
+
+    case TracePhase::PublishLate:
+      return "publish_late";
+
+    case TracePhase::PublishSent:
+      return "publish_sent";
+
+    case TracePhase::ConnectionOpened:
+      return "connection_opened";
+
+    case TracePhase::ConnectionClosed:
+      return "connection_closed";
+    }
+
+  return "unknown";
+}
+
+// 'B'egin and 'E'nd make a duration slice of a request, everything else is an instant.
+char GetChromePhase(TracePhase phase)
+{
+  switch (phase)
+    {
+    case TracePhase::RequestBegin:
+      return 'B';
+
+    case TracePhase::RequestEnd:
+    case TracePhase::RequestDeferred:
+    case TracePhase::RequestAborted:
+      return 'E';
+
+    default:
+      return 'i';
+    }
+}
+
+} // namespace
+
+namespace OpcUa
+{
+namespace Server
+{
+
+void RecordTraceEvent(uint32_t connectionId, uint32_t requestHandle, uint16_t serviceId, TracePhase phase)
+{
+  ThreadRing & ring = GetThreadRing();
+  const uint64_t head = ring.Head.load(std::memory_order_relaxed);
+  TraceSlot & slot = ring.Slots[head & RingMask];
+  const uint64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+
+  // pairs with the acquire fence of the reader: a reader which sees any word
+  // of this slot also sees Head of the previous event
+  std::atomic_thread_fence(std::memory_order_release);
+  slot.Timestamp.store(now, std::memory_order_relaxed);
+  slot.Request.store(static_cast<uint64_t>(connectionId) << 32 | requestHandle, std::memory_order_relaxed);
+  slot.Service.store(static_cast<uint64_t>(serviceId) << 8 | static_cast<uint8_t>(phase), std::memory_order_relaxed);
+  ring.Head.store(head + 1, std::memory_order_release);
+}
+
+std::vector<TraceEvent> GetTraceEvents()
+{
+  std::vector<std::shared_ptr<ThreadRing>> rings;
+  {
+    RingRegistry & registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.Mutex);
+    rings = registry.Rings;
+  }
+
+  std::vector<TraceEvent> events;
+
+  for (const std::shared_ptr<ThreadRing> & ring : rings)
+    {
+      CopyRing(*ring, events);
+    }
+
+  std::stable_sort(events.begin(), events.end(), [](const TraceEvent & lhs, const TraceEvent & rhs)
+  {
+    return lhs.Timestamp < rhs.Timestamp;
+  });
+
+  return events;
+}
+
+void WriteChromeTrace(std::ostream & os, const std::vector<TraceEvent> & events)
+{
+  const uint64_t origin = events.empty() ? 0 : events.front().Timestamp;
+  // slices cut by the ring wrap around have no begin; chrome cannot match them
+  std::map<uint32_t, unsigned> openSlices;
+  bool first = true;
+  const std::ios::fmtflags flags = os.flags();
+  const std::streamsize precision = os.precision();
+
+  os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+  for (const TraceEvent & event : events)
+    {
+      const char chromePhase = GetChromePhase(event.Phase);
+      unsigned & open = openSlices[event.ThreadIndex];
+
+      if (chromePhase == 'B')
+        {
+          ++open;
+        }
+
+      else if (chromePhase == 'E' && !open)
+        {
+          continue;
+        }
+
+      else if (chromePhase == 'E')
+        {
+          --open;
+        }
+
+      os << (first ? "\n" : ",\n");
+      first = false;
+      os << "{\"name\":\"" << (event.ServiceId == INVALID ? "Connection" : GetServiceName(static_cast<MessageId>(event.ServiceId)));
+
+      if (chromePhase == 'i')
+        {
+          os << " " << GetPhaseName(event.Phase) << "\",\"s\":\"t";
+        }
+
+      os << "\",\"cat\":\"opcua\",\"ph\":\"" << chromePhase
+         << "\",\"ts\":" << std::fixed << std::setprecision(3) << (event.Timestamp - origin) / 1000.0
+         << ",\"pid\":1,\"tid\":" << event.ThreadIndex
+         << ",\"args\":{\"connection\":" << event.ConnectionId
+         << ",\"handle\":" << event.RequestHandle
+         << ",\"phase\":\"" << GetPhaseName(event.Phase) << "\"}}";
+    }
+
+  os << "\n]}\n";
+  os.flags(flags);
+  os.precision(precision);
+}
+
+void WriteChromeTrace(std::ostream & os)
+{
+  WriteChromeTrace(os, GetTraceEvents());
+}
+
+} // namespace Server
+} // namespace OpcUa
@@ -0,0 +1,358 @@
+/// @brief Queues of values from producer threads into the address space.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include <opc/ua/server/value_ingest.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+using namespace OpcUa;
+using namespace OpcUa::Server;
+
+const std::size_t CacheLineSize = 64;
+
+// state shared by the applier and the producers
+struct IngestSignal
+{
+  std::mutex Mutex;
+  std::condition_variable Condition;
+  std::atomic<bool> Sleeping{false};
+  std::atomic<bool> Stopped{false};
+
+  void Wake()
+  {
+    // a wakeup lost to a race only delays the values by IdleInterval
+    if (Sleeping.load(std::memory_order_relaxed) && Sleeping.exchange(false))
+      {
+        Condition.notify_one();
+      }
+  }
+};
+
+uint32_t RoundUpToPowerOfTwo(uint32_t value)
+{
+  uint32_t result = 1;
+
+  while (result < value && result < (1u << 31))
+    {
+      result <<= 1;
+    }
+
+  return result;
+}
+
+class RingProducer : public IngestProducer
+{
+public:
+  RingProducer(uint32_t capacity, const std::shared_ptr<IngestSignal> & signal)
+    : Slots(RoundUpToPowerOfTwo(capacity))
+    , Mask(Slots.size() - 1)
+    , Signal(signal)
+  {
+  }
+
+  bool Push(uint32_t handle, const DataValue & value) override
+  {
+    const uint64_t head = Head.load(std::memory_order_relaxed);
+
+    if (Signal->Stopped.load(std::memory_order_relaxed) || !HasRoom(head))
+      {
+        Dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+
+    HandleValueUpdate & slot = Slots[head & Mask];
+    slot.Handle = handle;
+    slot.Value = value;
+    Head.store(head + 1, std::memory_order_release);
+    Queued.fetch_add(1, std::memory_order_relaxed);
+    Signal->Wake();
+    return true;
+  }
+
+  /// @brief Pass queued values to the applier, called only by the applier.
+  template <typename Function>
+  void Drain(Function && function)
+  {
+    const uint64_t tail = Tail.load(std::memory_order_relaxed);
+    const uint64_t head = Head.load(std::memory_order_acquire);
+
+    for (uint64_t pos = tail; pos != head; ++pos)
+      {
+        function(Slots[pos & Mask]);
+      }
+
+    Tail.store(head, std::memory_order_release);
+  }
+
+  uint32_t Depth() const
+  {
+    // tail first, so the head read afterwards is never behind it
+    const uint64_t tail = Tail.load(std::memory_order_acquire);
+    return static_cast<uint32_t>(Head.load(std::memory_order_acquire) - tail);
+  }
+
+public:
+  std::atomic<uint64_t> Queued{0};
+  std::atomic<uint64_t> Dropped{0};
+
+private:
+  bool HasRoom(uint64_t head)
+  {
+    if (head - CachedTail < Slots.size())
+      {
+        return true;
+      }
+
+    CachedTail = Tail.load(std::memory_order_acquire);
+    return head - CachedTail < Slots.size();
+  }
+
+private:
+  std::vector<HandleValueUpdate> Slots;
+  const uint64_t Mask;
+  const std::shared_ptr<IngestSignal> Signal;
+  // producer side
+  char HeadPadding[CacheLineSize];
+  std::atomic<uint64_t> Head{0};
+  uint64_t CachedTail = 0;
+  // applier side
+  char TailPadding[CacheLineSize];
+  std::atomic<uint64_t> Tail{0};
+};
+
+class ValueIngestImpl : public ValueIngest
+{
+public:
+  ValueIngestImpl(AddressSpace & addressSpace, const IngestParameters & params)
+    : Space(addressSpace)
+    , Params(params)
+    , Signal(std::make_shared<IngestSignal>())
+  {
+    Applier = std::thread([this]()
+    {
+      Run();
+    });
+  }
+
+  ~ValueIngestImpl() override
+  {
+    Stop();
+  }
+
+  IngestProducer::SharedPtr CreateProducer() override
+  {
+    std::shared_ptr<RingProducer> producer = std::make_shared<RingProducer>(Params.QueueCapacity, Signal);
+    std::lock_guard<std::mutex> lock(ProducersMutex);
+    Producers.push_back(producer);
+    return producer;
+  }
+
+  IngestStatistics GetStatistics() const override
+  {
+    IngestStatistics result;
+    result.AppliedCount = Applied.load(std::memory_order_relaxed);
+    result.CoalescedCount = Coalesced.load(std::memory_order_relaxed);
+    result.RejectedCount = Rejected.load(std::memory_order_relaxed);
+    result.DrainCount = Drains.load(std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(ProducersMutex);
+    result.QueuedCount = RetiredQueued;
+    result.DroppedCount = RetiredDropped;
+    result.ProducerCount = static_cast<uint32_t>(Producers.size());
+
+    for (const std::shared_ptr<RingProducer> & producer : Producers)
+      {
+        result.QueuedCount += producer->Queued.load(std::memory_order_relaxed);
+        result.DroppedCount += producer->Dropped.load(std::memory_order_relaxed);
+        result.QueueDepth += producer->Depth();
+      }
+
+    return result;
+  }
+
+  void Stop() override
+  {
+    {
+      std::lock_guard<std::mutex> lock(Signal->Mutex);
+      Signal->Stopped = true;
+    }
+
+    Signal->Condition.notify_one();
+
+    if (Applier.joinable())
+      {
+        Applier.join();
+      }
+  }
+
+private:
+  void Run()
+  {
+    while (!Signal->Stopped.load(std::memory_order_acquire))
+      {
+        if (Drain())
+          {
+            continue;
+          }
+
+        std::unique_lock<std::mutex> lock(Signal->Mutex);
+        Signal->Sleeping = true;
+
+        if (!Signal->Stopped && !HasQueuedValues())
+          {
+            Signal->Condition.wait_for(lock, Params.IdleInterval);
+          }
+
+        Signal->Sleeping = false;
+      }
+
+    // producers may have queued values while Stop was called
+    Drain();
+  }
+
+  bool Drain()
+  {
+    Batch.clear();
+    Positions.clear();
+    uint64_t coalesced = 0;
+
+    for (const std::shared_ptr<RingProducer> & producer : TakeProducers())
+      {
+        producer->Drain([this, &coalesced](HandleValueUpdate & update)
+        {
+          if (!Params.KeepAll)
+            {
+              const auto inserted = Positions.emplace(update.Handle, Batch.size());
+
+              if (!inserted.second)
+                {
+                  Batch[inserted.first->second].Value = std::move(update.Value);
+                  ++coalesced;
+                  return;
+                }
+            }
+
+          Batch.push_back(std::move(update));
+        });
+      }
+
+    if (Batch.empty())
+      {
+        return false;
+      }
+
+    const std::vector<StatusCode> statuses = Space.UpdateValues(Batch);
+    uint64_t rejected = 0;
+
+    for (StatusCode status : statuses)
+      {
+        if (status != StatusCode::Good)
+          {
+            ++rejected;
+          }
+      }
+
+    Applied.fetch_add(statuses.size() - rejected, std::memory_order_relaxed);
+    Rejected.fetch_add(rejected, std::memory_order_relaxed);
+    Coalesced.fetch_add(coalesced, std::memory_order_relaxed);
+    Drains.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  /// @brief Producers to drain, producers released by their threads are dropped once empty.
+  std::vector<std::shared_ptr<RingProducer>> TakeProducers()
+  {
+    std::lock_guard<std::mutex> lock(ProducersMutex);
+
+    for (auto it = Producers.begin(); it != Producers.end();)
+      {
+        if (it->use_count() == 1 && (*it)->Depth() == 0)
+          {
+            RetiredQueued += (*it)->Queued.load(std::memory_order_relaxed);
+            RetiredDropped += (*it)->Dropped.load(std::memory_order_relaxed);
+            it = Producers.erase(it);
+          }
+
+        else
+          {
+            ++it;
+          }
+      }
+
+    return Producers;
+  }
+
+  bool HasQueuedValues() const
+  {
+    std::lock_guard<std::mutex> lock(ProducersMutex);
+
+    for (const std::shared_ptr<RingProducer> & producer : Producers)
+      {
+        if (producer->Depth() != 0)
+          {
+            return true;
+          }
+      }
+
+    return false;
+  }
+
+private:
+  AddressSpace & Space;
+  const IngestParameters Params;
+  const std::shared_ptr<IngestSignal> Signal;
+
+  mutable std::mutex ProducersMutex;
+  std::vector<std::shared_ptr<RingProducer>> Producers;
+  uint64_t RetiredQueued = 0;
+  uint64_t RetiredDropped = 0;
+
+  // used only by the applier thread
+  std::vector<HandleValueUpdate> Batch;
+  std::unordered_map<uint32_t, std::size_t> Positions;
+
+  std::atomic<uint64_t> Applied{0};
+  std::atomic<uint64_t> Coalesced{0};
+  std::atomic<uint64_t> Rejected{0};
+  std::atomic<uint64_t> Drains{0};
+  std::thread Applier;
+};
+
+} // namespace
+
+namespace OpcUa
+{
+namespace Server
+{
+
+ValueIngest::UniquePtr CreateValueIngest(AddressSpace & addressSpace, const IngestParameters & params)
+{
+  return ValueIngest::UniquePtr(new ValueIngestImpl(addressSpace, params));
+}
+
+void DumpIngestStatistics(std::ostream & os, const IngestStatistics & statistics)
+{
+  os << "opcua_ingest_producers " << statistics.ProducerCount << "\n";
+  os << "opcua_ingest_queue_depth " << statistics.QueueDepth << "\n";
+  os << "opcua_ingest_values_queued_total " << statistics.QueuedCount << "\n";
+  os << "opcua_ingest_values_dropped_total " << statistics.DroppedCount << "\n";
+  os << "opcua_ingest_values_applied_total " << statistics.AppliedCount << "\n";
+  os << "opcua_ingest_values_coalesced_total " << statistics.CoalescedCount << "\n";
+  os << "opcua_ingest_values_rejected_total " << statistics.RejectedCount << "\n";
+  os << "opcua_ingest_drains_total " << statistics.DrainCount << "\n";
+}
+
+} // namespace Server
+} // namespace OpcUa
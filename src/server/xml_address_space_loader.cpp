@@ -14,6 +14,7 @@
 #include "xml_processor.h"
 
 #include <opc/ua/server/address_space.h>
+#include <opc/ua/protocol/string_utils.h>
 
 #include <libxml2/libxml/xmlmemory.h>
 #include <libxml2/libxml/parser.h>
@@ -332,9 +333,18 @@ ObjectId GetObjectIdOfType(const std::string & nodeValue)
       return ObjectId::DateTime;
     }
 
-  std::stringstream stream;
-  stream << "Unknown data type '" << nodeValue << "'.";
-  throw std::logic_error(stream.str());
+  // standard data type names like 'Double' or 'LocalizedText'
+  try
+    {
+      return ToObjectId(nodeValue);
+    }
+
+  catch (const std::exception &)
+    {
+      std::stringstream stream;
+      stream << "Unknown data type '" << nodeValue << "'.";
+      throw std::logic_error(stream.str());
+    }
 }
 
 inline ObjectId GetObjectIdOfType(xmlNode & node)
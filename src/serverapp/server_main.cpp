@@ -12,13 +12,42 @@
 #include <windows.h>
 #endif
 
+#include <opc/ua/server/addons/asio_addon.h>
 #include <opc/ua/server/addons/common_addons.h>
+#include <opc/ua/server/trace_ring.h>
 #include "daemon.h"
 #include "server_options.h"
 
+#include <boost/asio/signal_set.hpp>
+#include <csignal>
+#include <fstream>
 #include <thread>
 #include <iostream>
 
+namespace
+{
+
+#ifdef SIGUSR1
+// Dump trace history each time SIGUSR1 is received.
+void WaitTraceSignal(boost::asio::signal_set & signals, const std::string & traceFile, const Common::Logger::SharedPtr & logger)
+{
+  signals.async_wait([&signals, traceFile, logger](const boost::system::error_code & error, int)
+  {
+    if (error)
+      {
+        return;
+      }
+
+    std::ofstream out(traceFile.c_str(), std::ios::trunc);
+    OpcUa::Server::WriteChromeTrace(out);
+    LOG_INFO(logger, "server                | trace written to '{}'", traceFile);
+    WaitTraceSignal(signals, traceFile, logger);
+  });
+}
+#endif
+
+}
+
 /*
 #ifdef _WIN32
 
@@ -53,10 +82,26 @@ int main(int argc, char ** argv)
         }
 
       Common::AddonsManager::UniquePtr manager = Common::CreateAddonsManager(logger);
+      manager->SetStartupThreads(options.GetStartupThreads());
       OpcUa::Server::LoadConfiguration(options.GetConfigDir(), *manager);
 
       manager->Start();
+
+#ifdef SIGUSR1
+      std::unique_ptr<boost::asio::signal_set> traceSignal;
+
+      if (!options.GetTraceFile().empty())
+        {
+          OpcUa::Server::AsioAddon::SharedPtr asio = manager->GetAddon<OpcUa::Server::AsioAddon>(OpcUa::Server::AsioAddonId);
+          traceSignal.reset(new boost::asio::signal_set(asio->GetIoService(), SIGUSR1));
+          WaitTraceSignal(*traceSignal, options.GetTraceFile(), logger);
+        }
+#endif
+
       daemon.WaitForTerminate();
+#ifdef SIGUSR1
+      traceSignal.reset();
+#endif
       manager->Stop();
 
       return 0;
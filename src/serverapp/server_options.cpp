@@ -33,6 +33,8 @@ const char * OPTION_HELP = "help";
 const char * OPTION_CONFIG = "config-dir";
 const char * OPTION_DAEMON = "daemon";
 const char * OPTION_LOGFILE = "log-file";
+const char * OPTION_TRACEFILE = "trace-file";
+const char * OPTION_STARTUP_THREADS = "startup-threads";
 
 std::string GetConfigOptionValue(const po::variables_map & vm)
 {
@@ -60,6 +62,26 @@ std::string GetLogFile(const po::variables_map & vm)
   return DefaultLogFilePath;
 }
 
+std::string GetTraceFile(const po::variables_map & vm)
+{
+  if (vm.count(OPTION_TRACEFILE))
+    {
+      return vm[OPTION_TRACEFILE].as<std::string>();
+    }
+
+  return std::string();
+}
+
+unsigned GetStartupThreads(const po::variables_map & vm)
+{
+  if (vm.count(OPTION_STARTUP_THREADS))
+    {
+      return vm[OPTION_STARTUP_THREADS].as<unsigned>();
+    }
+
+  return 0;
+}
+
 }
 
 
@@ -71,6 +93,7 @@ namespace Server
 CommandLine::CommandLine(int argc, const char ** argv)
   : StartPossible(true)
   , IsDaemon(false)
+  , StartupThreads(0)
 {
   // Declare the supported options.
   po::options_description desc("Parameters");
@@ -79,6 +102,8 @@ CommandLine::CommandLine(int argc, const char ** argv)
   (OPTION_CONFIG, po::value<std::string>(), (std::string("Path to directory with configuration files. Default: ") + CONFIG_PATH).c_str())
   (OPTION_LOGFILE, po::value<std::string>(), "Set path to the log file. Default 'var/log/opcua/server.log")
   (OPTION_DAEMON, "Start in daemon mode.")
+  (OPTION_TRACEFILE, po::value<std::string>(), "Write recent request history in Chrome trace format to this file on SIGUSR1.")
+  (OPTION_STARTUP_THREADS, po::value<unsigned>(), "Number of threads initializing independent addons, 1 initializes them one by one. Default: one per core.")
   ;
 
   po::variables_map vm;
@@ -95,6 +120,8 @@ CommandLine::CommandLine(int argc, const char ** argv)
   IsDaemon = GetDaemonMode(vm);
   ConfigDir = GetConfigOptionValue(vm);
   LogFile = ::GetLogFile(vm);
+  TraceFile = ::GetTraceFile(vm);
+  StartupThreads = ::GetStartupThreads(vm);
 }
 
 } // namespace UaServer
@@ -49,11 +49,23 @@ public:
     return LogFile;
   }
 
+  std::string GetTraceFile() const
+  {
+    return TraceFile;
+  }
+
+  unsigned GetStartupThreads() const
+  {
+    return StartupThreads;
+  }
+
 private:
   bool StartPossible;
   bool IsDaemon;
   std::string ConfigDir;
   std::string LogFile;
+  std::string TraceFile;
+  unsigned StartupThreads;
 };
 
 }
@@ -16,6 +16,11 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 using namespace Common;
 
 namespace
@@ -56,3 +61,135 @@ TEST(AddonManager, DISABLED_CanCreateDynamicAddons)
   ASSERT_EQ(params.Parameters[0].Value, "value");
 }
 
+
+namespace
+{
+
+/// @brief Addon checking its dependencies are initialized and waiting for other addons to enter Initialize.
+class StartupTestAddon : public Addon
+{
+public:
+  StartupTestAddon(const std::vector<AddonId> & dependencies, std::atomic<int> & initializing, int waitFor, bool fail)
+    : Dependencies(dependencies)
+    , Initializing(initializing)
+    , WaitFor(waitFor)
+    , Fail(fail)
+  {
+  }
+
+  virtual void Initialize(AddonsManager & manager, const AddonParameters &)
+  {
+    for (const AddonId & id : Dependencies)
+      {
+        manager.GetAddon(id);
+      }
+
+    ++Initializing;
+    const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+    while (Initializing < WaitFor && std::chrono::steady_clock::now() < deadline)
+      {
+        std::this_thread::yield();
+      }
+
+    if (Fail)
+      {
+        throw std::runtime_error("failed");
+      }
+  }
+
+  virtual void Stop()
+  {
+  }
+
+private:
+  std::vector<AddonId> Dependencies;
+  std::atomic<int> & Initializing;
+  int WaitFor;
+  bool Fail;
+};
+
+class StartupTestFactory : public AddonFactory
+{
+public:
+  StartupTestFactory(const std::vector<AddonId> & dependencies, std::atomic<int> & initializing, int waitFor, bool fail)
+    : Dependencies(dependencies)
+    , Initializing(initializing)
+    , WaitFor(waitFor)
+    , Fail(fail)
+  {
+  }
+
+  virtual Addon::UniquePtr CreateAddon()
+  {
+    return Addon::UniquePtr(new StartupTestAddon(Dependencies, Initializing, WaitFor, Fail));
+  }
+
+private:
+  std::vector<AddonId> Dependencies;
+  std::atomic<int> & Initializing;
+  int WaitFor;
+  bool Fail;
+};
+
+AddonInformation StartupTestAddonInformation(const AddonId & id, const std::vector<AddonId> & dependencies, std::atomic<int> & initializing, int waitFor = 0, bool fail = false)
+{
+  AddonInformation config;
+  config.Id = id;
+  config.Dependencies = dependencies;
+  config.Factory = std::make_shared<StartupTestFactory>(dependencies, initializing, waitFor, fail);
+  return config;
+}
+
+}
+
+TEST(AddonManager, StartsDependenciesFirst)
+{
+  std::atomic<int> initializing(0);
+  AddonsManager::UniquePtr addonsManager = CreateAddonsManager(Common::Logger::SharedPtr());
+  addonsManager->SetStartupThreads(4);
+  addonsManager->Register(StartupTestAddonInformation("a", {}, initializing));
+  addonsManager->Register(StartupTestAddonInformation("b", {"a"}, initializing));
+  addonsManager->Register(StartupTestAddonInformation("c", {"a", "b"}, initializing));
+  addonsManager->Register(StartupTestAddonInformation("d", {}, initializing));
+  addonsManager->Start();
+
+  const std::vector<AddonStartupTime> times = addonsManager->GetStartupTimes();
+  ASSERT_EQ(4u, times.size());
+  std::vector<AddonId> order;
+
+  for (const AddonStartupTime & time : times)
+    {
+      order.push_back(time.Id);
+    }
+
+  EXPECT_LT(std::find(order.begin(), order.end(), "a"), std::find(order.begin(), order.end(), "b"));
+  EXPECT_LT(std::find(order.begin(), order.end(), "b"), std::find(order.begin(), order.end(), "c"));
+  EXPECT_NE(order.end(), std::find(order.begin(), order.end(), "d"));
+}
+
+TEST(AddonManager, StartsIndependentAddonsConcurrently)
+{
+  std::atomic<int> initializing(0);
+  AddonsManager::UniquePtr addonsManager = CreateAddonsManager(Common::Logger::SharedPtr());
+  addonsManager->SetStartupThreads(2);
+  addonsManager->Register(StartupTestAddonInformation("a", {}, initializing, 2));
+  addonsManager->Register(StartupTestAddonInformation("b", {}, initializing, 2));
+
+  const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  addonsManager->Start();
+  // each addon waits until both are initializing
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+  EXPECT_EQ(2u, addonsManager->GetStartupTimes().size());
+}
+
+TEST(AddonManager, FailsIfAddonFails)
+{
+  std::atomic<int> initializing(0);
+  AddonsManager::UniquePtr addonsManager = CreateAddonsManager(Common::Logger::SharedPtr());
+  addonsManager->SetStartupThreads(2);
+  addonsManager->Register(StartupTestAddonInformation("a", {}, initializing));
+  addonsManager->Register(StartupTestAddonInformation("b", {}, initializing, 0, true));
+  addonsManager->Register(StartupTestAddonInformation("c", {"b"}, initializing));
+  EXPECT_THROW(addonsManager->Start(), std::exception);
+}
@@ -1012,6 +1012,30 @@ TEST_F(OpcUaBinaryDeserialization, ExtensionObjectHeader)
   ASSERT_EQ(header.Encoding, HAS_BINARY_BODY);
 }
 
+//-------------------------------------------------------------------
+// ExtensionObject
+//-------------------------------------------------------------------
+
+TEST_F(OpcUaBinaryDeserialization, ExtensionObject)
+{
+  using namespace OpcUa;
+
+  const std::vector<char> expectedData =
+  {
+    1, 0, (char)0x41, 0x1, // TypeId
+    HAS_BINARY_BODY,
+    2, 0, 0, 0, 1, 2
+  };
+
+  GetChannel().SetData(expectedData);
+  ExtensionObject obj;
+  GetStream() >> obj;
+
+  ASSERT_EQ(obj.TypeId, FourByteNodeId(OpcUa::USER_IdENTIFY_TOKEN_ANONYMOUS));
+  ASSERT_EQ(obj.Encoding, HAS_BINARY_BODY);
+  ASSERT_EQ(obj.Body.Data, std::vector<uint8_t>({1, 2}));
+}
+
 //-------------------------------------------------------------------
 // QualifiedName
 //-------------------------------------------------------------------
@@ -948,6 +948,55 @@ TEST_F(OpcUaBinarySerialization, ExtensionObjectHeader)
   ASSERT_EQ(expectedData.size(), RawSize(header));
 }
 
+//-------------------------------------------------------------------
+// ExtensionObject
+//-------------------------------------------------------------------
+
+TEST_F(OpcUaBinarySerialization, ExtensionObject)
+{
+  using namespace OpcUa;
+  using namespace OpcUa::Binary;
+
+  ExtensionObject obj;
+  obj.TypeId = FourByteNodeId(OpcUa::USER_IdENTIFY_TOKEN_ANONYMOUS);
+  obj.Encoding = HAS_BINARY_BODY;
+  obj.Body = ByteString(std::vector<uint8_t> {1, 2});
+
+  GetStream() << obj << flush;
+
+  const std::vector<char> expectedData =
+  {
+    1, 0, (char)0x41, 0x1, // TypeId
+    HAS_BINARY_BODY,
+    2, 0, 0, 0, 1, 2
+  };
+
+  ASSERT_EQ(expectedData, GetChannel().SerializedData);
+  ASSERT_EQ(expectedData.size(), RawSize(obj));
+}
+
+TEST_F(OpcUaBinarySerialization, ExtensionObjectWithoutBody)
+{
+  using namespace OpcUa;
+  using namespace OpcUa::Binary;
+
+  ExtensionObject obj;
+  obj.TypeId = FourByteNodeId(OpcUa::USER_IdENTIFY_TOKEN_ANONYMOUS);
+  obj.Encoding = 0;
+  obj.Body = ByteString(std::vector<uint8_t> {1, 2});
+
+  GetStream() << obj << flush;
+
+  const std::vector<char> expectedData =
+  {
+    1, 0, (char)0x41, 0x1, // TypeId
+    0
+  };
+
+  ASSERT_EQ(expectedData, GetChannel().SerializedData);
+  ASSERT_EQ(expectedData.size(), RawSize(obj));
+}
+
 //-------------------------------------------------------------------
 // QualifiedName
 //-------------------------------------------------------------------
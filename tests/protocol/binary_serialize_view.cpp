@@ -1199,3 +1199,68 @@ TEST_F(ViewDeserialization, TranslateBrowsePathsToNodeIdsRequest)
   ASSERT_EQ(element.TargetName.NamespaceIndex, 2);
   ASSERT_EQ(element.TargetName.Name, "name");
 }
+
+//-------------------------------------------------------
+// QueryNextRequest
+//-------------------------------------------------------
+
+TEST_F(ViewSerialization, QueryNextRequest)
+{
+  using namespace OpcUa;
+  using namespace OpcUa::Binary;
+
+  QueryNextRequest request;
+  request.Parameters.ReleaseContinuationPoint = true;
+  request.Parameters.ContinuationPoint = {1, 2};
+
+  ASSERT_EQ(request.TypeId.Encoding, EV_FOUR_BYTE);
+  ASSERT_EQ(request.TypeId.FourByteData.NamespaceIndex, 0);
+  ASSERT_EQ(request.TypeId.FourByteData.Identifier, OpcUa::QUERY_NEXT_REQUEST);
+
+  FILL_TEST_REQUEST_HEADER(request.Header);
+
+  GetStream() << request << flush;
+
+  const std::vector<char> expectedData =
+  {
+    1, 0, (char)0x6D, 0x2, // TypeId
+    // RequestHeader
+    TEST_REQUEST_HEADER_BINARY_DATA,
+
+    1,          // ReleaseContinuationPoint
+    2, 0, 0, 0, // Size of ContinuationPoint
+    1, 2,       // ContinuationPoint
+  };
+
+  ASSERT_EQ(expectedData, GetChannel().SerializedData) <<
+      "Serialized: " << std::endl << PrintData(GetChannel().SerializedData) << std::endl <<
+      "Expected" << std::endl << PrintData(expectedData);
+  ASSERT_EQ(expectedData.size(), RawSize(request));
+}
+
+TEST_F(ViewDeserialization, QueryNextRequest)
+{
+  using namespace OpcUa;
+  using namespace OpcUa::Binary;
+
+  const std::vector<char> expectedData =
+  {
+    1, 0, (char)0x6D, 0x2, // TypeId
+    // RequestHeader
+    TEST_REQUEST_HEADER_BINARY_DATA,
+
+    1,          // ReleaseContinuationPoint
+    2, 0, 0, 0, // Size of ContinuationPoint
+    1, 2,       // ContinuationPoint
+  };
+
+  GetChannel().SetData(expectedData);
+
+  QueryNextRequest request;
+  GetStream() >> request;
+
+  ASSERT_EQ(request.TypeId.FourByteData.Identifier, OpcUa::QUERY_NEXT_REQUEST);
+  ASSERT_REQUEST_HEADER_EQ(request.Header);
+  ASSERT_TRUE(request.Parameters.ReleaseContinuationPoint);
+  ASSERT_EQ(request.Parameters.ContinuationPoint, std::vector<uint8_t>({1, 2}));
+}
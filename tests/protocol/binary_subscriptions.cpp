@@ -1096,3 +1096,76 @@ TEST_F(SubscriptionDeserialization, SetPublishingModeResponse)
   ASSERT_EQ(response.Result.Results.size(), 1);
   ASSERT_EQ(response.Result.DiagnosticInfos.size(), 0);
 }
+
+//-------------------------------------------------------
+// TransferSubscriptionsRequest
+//-------------------------------------------------------
+
+TEST_F(SubscriptionSerialization, TransferSubscriptionsRequest)
+{
+  using namespace OpcUa;
+  using namespace OpcUa::Binary;
+
+  TransferSubscriptionsRequest request;
+
+  ASSERT_EQ(request.TypeId.Encoding, EV_FOUR_BYTE);
+  ASSERT_EQ(request.TypeId.FourByteData.NamespaceIndex, 0);
+  ASSERT_EQ(request.TypeId.FourByteData.Identifier, OpcUa::TRANSFER_SUBSCRIPTIONS_REQUEST);
+
+  FILL_TEST_REQUEST_HEADER(request.Header);
+
+  request.Parameters.SubscriptionIds.push_back(5);
+  request.Parameters.SendInitialValues = true;
+
+  GetStream() << request << flush;
+
+  const std::vector<char> expectedData =
+  {
+    1, 0, (char)0x49, 0x3, // TypeId
+
+    // RequestHeader
+    TEST_REQUEST_HEADER_BINARY_DATA,
+
+    1, 0, 0, 0, // count of SubscriptionIds
+    5, 0, 0, 0,
+    1  // SendInitialValues
+  };
+
+  ASSERT_EQ(expectedData, GetChannel().SerializedData) << "Actual:" << std::endl << PrintData(GetChannel().SerializedData) << std::endl << "Expected" << std::endl << PrintData(expectedData);
+  ASSERT_EQ(expectedData.size(), RawSize(request));
+}
+
+TEST_F(SubscriptionDeserialization, TransferSubscriptionsResponse)
+{
+  using namespace OpcUa;
+  using namespace OpcUa::Binary;
+
+  const std::vector<char> expectedData =
+  {
+    1, 0, (char)0x4C, 0x3, // TypeId
+
+    // ResponseHeader
+    TEST_RESPONSE_HEADER_BINARY_DATA,
+
+    1, 0, 0, 0, // count of Results
+    0, 0, 0, 0, // StatusCode
+    2, 0, 0, 0, // count of AvailableSequenceNumbers
+    7, 0, 0, 0,
+    8, 0, 0, 0,
+    0, 0, 0, 0 // count of DiagnosticInfos
+  };
+
+  GetChannel().SetData(expectedData);
+
+  TransferSubscriptionsResponse response;
+  GetStream() >> response;
+
+  ASSERT_EQ(response.TypeId.FourByteData.Identifier, OpcUa::TRANSFER_SUBSCRIPTIONS_RESPONSE);
+
+  ASSERT_RESPONSE_HEADER_EQ(response.Header);
+
+  ASSERT_EQ(response.Parameters.Results.size(), 1);
+  ASSERT_EQ(response.Parameters.Results[0].Status, StatusCode::Good);
+  ASSERT_EQ(response.Parameters.Results[0].AvailableSequenceNumbers, std::vector<uint32_t>({7, 8}));
+  ASSERT_EQ(response.Parameters.DiagnosticInfos.size(), 0);
+}
@@ -112,6 +112,33 @@ TEST(Guid, InvalidString)
   EXPECT_EQ(OpcUa::ToGuid("0102030400506007080090A0B0C0D0E0F10"), OpcUa::Guid());
 }
 
+TEST(ObjectId, ToString)
+{
+  EXPECT_EQ(OpcUa::ToString(OpcUa::ObjectId::Server), "Server");
+  EXPECT_EQ(OpcUa::ToString(OpcUa::ObjectId::Null), "Null");
+  EXPECT_EQ(OpcUa::ToString(static_cast<OpcUa::ObjectId>(999999)), "unknown(999999)");
+  EXPECT_STREQ(OpcUa::GetObjectIdName(OpcUa::ObjectId::ObjectsFolder), "ObjectsFolder");
+  EXPECT_EQ(OpcUa::GetObjectIdName(static_cast<OpcUa::ObjectId>(999999)), nullptr);
+}
+
+TEST(ObjectId, FromName)
+{
+  EXPECT_EQ(OpcUa::ToObjectId("Server"), OpcUa::ObjectId::Server);
+  EXPECT_EQ(OpcUa::ToObjectId("ObjectsFolder"), OpcUa::ObjectId::ObjectsFolder);
+  EXPECT_EQ(OpcUa::ToObjectId("Null"), OpcUa::ObjectId::Null);
+  EXPECT_THROW(OpcUa::ToObjectId("Serve"), std::runtime_error);
+  EXPECT_THROW(OpcUa::ToObjectId("Servers"), std::runtime_error);
+  EXPECT_THROW(OpcUa::ToObjectId(""), std::runtime_error);
+}
+
+TEST(StatusCode, FromName)
+{
+  EXPECT_EQ(OpcUa::ToStatusCode("BadTimeout"), OpcUa::StatusCode::BadTimeout);
+  EXPECT_EQ(OpcUa::ToStatusCode("Good"), OpcUa::StatusCode::Good);
+  EXPECT_STREQ(OpcUa::GetStatusCodeName(OpcUa::StatusCode::BadNodeIdUnknown), "BadNodeIdUnknown");
+  EXPECT_THROW(OpcUa::ToStatusCode("BadTimeou"), std::runtime_error);
+}
+
 TEST(NodeId, NumericToString)
 {
   OpcUa::NodeId id = OpcUa::NumericNodeId(1, 2);
@@ -199,6 +226,9 @@ TEST(NodeId, NamespaceUriFromString)
 
   OpcUa::NodeId converted = OpcUa::ToNodeId("nsu=uri;ns=2;i=1;");
   ASSERT_EQ(converted, expected);
+  ASSERT_TRUE(converted.HasNamespaceURI());
+  ASSERT_EQ(converted.NamespaceURI, "uri");
+  ASSERT_FALSE(converted.HasServerIndex());
 }
 
 TEST(NodeId, ServerIndexToString)
@@ -217,6 +247,9 @@ TEST(NodeId, ServerIndexFromString)
 
   OpcUa::NodeId converted = OpcUa::ToNodeId("srv=3;ns=2;i=1;");
   ASSERT_EQ(converted, expected);
+  ASSERT_TRUE(converted.HasServerIndex());
+  ASSERT_EQ(converted.ServerIndex, 3u);
+  ASSERT_FALSE(converted.HasNamespaceURI());
 }
 
 TEST(NodeId, ServerIndexAndNamespaceUriToString)
@@ -237,6 +270,20 @@ TEST(NodeId, ServerIndexAndNamespaceUriString)
 
   OpcUa::NodeId converted = OpcUa::ToNodeId("srv=3;nsu=uri;ns=2;i=1;");
   ASSERT_EQ(converted, expected);
+  ASSERT_TRUE(converted.HasServerIndex());
+  ASSERT_EQ(converted.ServerIndex, 3u);
+  ASSERT_TRUE(converted.HasNamespaceURI());
+  ASSERT_EQ(converted.NamespaceURI, "uri");
+}
+
+TEST(NodeId, ServerIndexAndNamespaceUriRoundTrip)
+{
+  const OpcUa::NodeId converted = OpcUa::ToNodeId("srv=20;nsu=http://x;ns=2;i=5");
+  ASSERT_TRUE(converted.HasServerIndex());
+  ASSERT_EQ(converted.ServerIndex, 20u);
+  ASSERT_TRUE(converted.HasNamespaceURI());
+  ASSERT_EQ(converted.NamespaceURI, "http://x");
+  ASSERT_EQ(OpcUa::ToString(converted), "srv=20;nsu=http://x;ns=2;i=5;");
 }
 
 TEST(NodeId, WithDefaultNamespace)
@@ -245,3 +292,53 @@ TEST(NodeId, WithDefaultNamespace)
   OpcUa::NodeId converted = OpcUa::ToNodeId("i=1;", 2);
   ASSERT_EQ(expected, converted);
 }
+
+TEST(NodeId, FieldsInAnyOrder)
+{
+  OpcUa::NodeId expected = OpcUa::NumericNodeId(1, 2);
+  ASSERT_EQ(OpcUa::ToNodeId("i=1;ns=2"), expected);
+  ASSERT_EQ(OpcUa::ToNodeId("ns=2;i=1"), expected);
+}
+
+TEST(NodeId, LowerCaseGuidFromString)
+{
+  OpcUa::NodeId converted = OpcUa::ToNodeId("ns=1;g=0a0b0c0d-0506-0708-090a-0b0c0d0e0f10;");
+  ASSERT_TRUE(converted.IsGuid());
+  ASSERT_EQ(converted.GetGuidIdentifier().Data1, 0x0a0b0c0du);
+  ASSERT_EQ(converted.GetGuidIdentifier().Data4[7], 0x10);
+}
+
+TEST(NodeId, InvalidNumberFromString)
+{
+  EXPECT_THROW(OpcUa::ToNodeId("ns=2;i=1a;"), std::runtime_error);
+  EXPECT_THROW(OpcUa::ToNodeId("ns=70000;i=1;"), std::runtime_error);
+  EXPECT_THROW(OpcUa::ToNodeId("ns=2;i=4294967296;"), std::runtime_error);
+  EXPECT_THROW(OpcUa::ToNodeId("ns=2;"), std::runtime_error);
+}
+
+TEST(NodeId, ToChars)
+{
+  const OpcUa::NodeId id = OpcUa::StringNodeId("str", 2);
+  char buffer[16];
+  ASSERT_EQ(OpcUa::ToChars(id, buffer, sizeof(buffer)), 11u);
+  ASSERT_EQ(std::string(buffer, 11), "ns=2;s=str;");
+
+  // only the beginning fits, the whole length is still returned
+  ASSERT_EQ(OpcUa::ToChars(id, buffer, 4), 11u);
+  ASSERT_EQ(std::string(buffer, 4), "ns=2");
+  ASSERT_EQ(OpcUa::ToChars(id, nullptr, 0), 11u);
+}
+
+TEST(QualifiedName, FromString)
+{
+  ASSERT_EQ(OpcUa::ToQualifiedName("2:Name"), OpcUa::QualifiedName(2, "Name"));
+  ASSERT_EQ(OpcUa::ToQualifiedName("Name", 3), OpcUa::QualifiedName(3, "Name"));
+  EXPECT_THROW(OpcUa::ToQualifiedName("x:Name"), std::runtime_error);
+}
+
+TEST(QualifiedName, ToChars)
+{
+  char buffer[16];
+  ASSERT_EQ(OpcUa::ToChars(OpcUa::QualifiedName(2, "Name"), buffer, sizeof(buffer)), 6u);
+  ASSERT_EQ(std::string(buffer, 6), "2:Name");
+}
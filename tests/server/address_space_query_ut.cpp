@@ -0,0 +1,270 @@
+/// @brief Tests of the Query services of the address space.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include <opc/ua/protocol/expanded_object_ids.h>
+#include <opc/ua/protocol/object_ids.h>
+#include <opc/ua/protocol/status_codes.h>
+
+#include <opc/ua/server/address_space.h>
+#include <opc/ua/server/standard_address_space.h>
+
+#include <gtest/gtest.h>
+
+using namespace testing;
+
+class AddressSpaceQuery : public Test
+{
+protected:
+  virtual void SetUp()
+  {
+    spdlog::drop_all();
+    Logger = spdlog::stderr_color_mt("test");
+    Logger->set_level(spdlog::level::info);
+    NameSpace = OpcUa::Server::CreateAddressSpace(Logger);
+    OpcUa::Server::FillStandardNamespace(*NameSpace, Logger);
+
+    MachineType = AddNode("MachineType", OpcUa::NodeClass::ObjectType, OpcUa::ObjectId::BaseObjectType, OpcUa::ObjectId::HasSubtype, OpcUa::NodeId());
+    PumpType = AddNode("PumpType", OpcUa::NodeClass::ObjectType, MachineType, OpcUa::ObjectId::HasSubtype, OpcUa::NodeId());
+  }
+
+  virtual void TearDown()
+  {
+    NameSpace.reset();
+  }
+
+  OpcUa::NodeId AddNode(const std::string & name, OpcUa::NodeClass nodeClass, const OpcUa::NodeId & parent, OpcUa::ObjectId referenceType, const OpcUa::NodeId & typeDefinition)
+  {
+    OpcUa::AddNodesItem item;
+    item.BrowseName = OpcUa::QualifiedName(name);
+    item.Class = nodeClass;
+    item.ParentNodeId = parent;
+    item.ReferenceTypeId = referenceType;
+    item.TypeDefinition = typeDefinition;
+
+    if (nodeClass == OpcUa::NodeClass::Variable)
+      {
+        item.Attributes = OpcUa::VariableAttributes();
+      }
+
+    else if (nodeClass == OpcUa::NodeClass::ObjectType)
+      {
+        item.Attributes = OpcUa::ObjectTypeAttributes();
+      }
+
+    else
+      {
+        item.Attributes = OpcUa::ObjectAttributes();
+      }
+
+    std::vector<OpcUa::AddNodesResult> results = NameSpace->AddNodes({item});
+    return results[0].AddedNodeId;
+  }
+
+  /// @brief Instance with a Status variable.
+  OpcUa::NodeId AddMachine(const std::string & name, const OpcUa::NodeId & type, const std::string & status)
+  {
+    const OpcUa::NodeId machine = AddNode(name, OpcUa::NodeClass::Object, OpcUa::ObjectId::ObjectsFolder, OpcUa::ObjectId::Organizes, type);
+    const OpcUa::NodeId variable = AddNode("Status", OpcUa::NodeClass::Variable, machine, OpcUa::ObjectId::HasComponent, OpcUa::ObjectId::BaseDataVariableType);
+
+    OpcUa::WriteValue write;
+    write.NodeId = variable;
+    write.AttributeId = OpcUa::AttributeId::Value;
+    write.Value = status;
+    NameSpace->Write({write});
+    return machine;
+  }
+
+  OpcUa::NodeTypeDescription DescribeType(const OpcUa::NodeId & type, bool includeSubtypes)
+  {
+    OpcUa::NodeTypeDescription description;
+    description.TypeDefinitionNode = type;
+    description.IncludeSubtypes = includeSubtypes;
+
+    OpcUa::QueryDataDescription data;
+    OpcUa::RelativePathElement element;
+    element.TargetName = OpcUa::QualifiedName("Status");
+    data.Path.Elements.push_back(element);
+    description.DataToReturn.push_back(data);
+    return description;
+  }
+
+  /// @brief Status == value
+  std::vector<OpcUa::ContentFilterElement> StatusEquals(const std::string & value)
+  {
+    OpcUa::FilterOperand attribute;
+    attribute.Header.TypeId = OpcUa::ExpandedObjectId::SimpleAttributeOperand;
+    attribute.SimpleAttribute.BrowsePath.push_back(OpcUa::QualifiedName("Status"));
+    attribute.SimpleAttribute.Attribute = OpcUa::AttributeId::Value;
+
+    OpcUa::FilterOperand literal;
+    literal.Header.TypeId = OpcUa::ExpandedObjectId::LiteralOperand;
+    literal.Literal.Value = value;
+
+    OpcUa::ContentFilterElement element;
+    element.Operator = OpcUa::FilterOperator::Equals;
+    element.FilterOperands = {attribute, literal};
+    return {element};
+  }
+
+protected:
+  OpcUa::Server::AddressSpace::UniquePtr NameSpace;
+  Common::Logger::SharedPtr Logger;
+  OpcUa::NodeId MachineType;
+  OpcUa::NodeId PumpType;
+};
+
+TEST_F(AddressSpaceQuery, SelectsInstancesOfType)
+{
+  const OpcUa::NodeId machine = AddMachine("machine", MachineType, "OK");
+  AddMachine("pump", PumpType, "OK");
+
+  OpcUa::QueryFirstParameters params;
+  params.NodeTypes.push_back(DescribeType(MachineType, false));
+  OpcUa::QueryFirstResult result = NameSpace->QueryFirst(params);
+  ASSERT_EQ(OpcUa::StatusCode::Good, result.Status);
+  ASSERT_EQ(1u, result.QueryDataSets.size());
+  EXPECT_EQ(machine, result.QueryDataSets[0].Node);
+  EXPECT_EQ(MachineType, result.QueryDataSets[0].TypeDefinitionNode);
+  ASSERT_EQ(1u, result.QueryDataSets[0].Values.size());
+  EXPECT_EQ("OK", result.QueryDataSets[0].Values[0].As<std::string>());
+  EXPECT_TRUE(result.ContinuationPoint.empty());
+}
+
+TEST_F(AddressSpaceQuery, FiltersInstancesOfSubtypes)
+{
+  AddMachine("machine", MachineType, "OK");
+  const OpcUa::NodeId pump = AddMachine("pump", PumpType, "Fault");
+  AddMachine("other pump", PumpType, "OK");
+
+  OpcUa::QueryFirstParameters params;
+  params.NodeTypes.push_back(DescribeType(MachineType, true));
+  params.Filter = StatusEquals("Fault");
+  OpcUa::QueryFirstResult result = NameSpace->QueryFirst(params);
+  ASSERT_EQ(OpcUa::StatusCode::Good, result.Status);
+  ASSERT_EQ(1u, result.QueryDataSets.size());
+  EXPECT_EQ(pump, result.QueryDataSets[0].Node);
+  EXPECT_EQ(PumpType, result.QueryDataSets[0].TypeDefinitionNode);
+}
+
+TEST_F(AddressSpaceQuery, ContinuesWithQueryNext)
+{
+  for (int i = 0; i < 5; ++i)
+    {
+      AddMachine("machine" + std::to_string(i), MachineType, "OK");
+    }
+
+  OpcUa::QueryFirstParameters params;
+  params.NodeTypes.push_back(DescribeType(MachineType, false));
+  params.MaxDataSetsToReturn = 2;
+  OpcUa::QueryFirstResult first = NameSpace->QueryFirst(params);
+  ASSERT_EQ(2u, first.QueryDataSets.size());
+  ASSERT_FALSE(first.ContinuationPoint.empty());
+
+  OpcUa::QueryNextParameters next;
+  next.ContinuationPoint = first.ContinuationPoint;
+  OpcUa::QueryNextResult second = NameSpace->QueryNext(next);
+  ASSERT_EQ(OpcUa::StatusCode::Good, second.Status);
+  ASSERT_EQ(2u, second.QueryDataSets.size());
+  EXPECT_NE(first.QueryDataSets[1].Node, second.QueryDataSets[0].Node);
+  ASSERT_FALSE(second.RevisedContinuationPoint.empty());
+
+  next.ContinuationPoint = second.RevisedContinuationPoint;
+  OpcUa::QueryNextResult third = NameSpace->QueryNext(next);
+  EXPECT_EQ(1u, third.QueryDataSets.size());
+  EXPECT_TRUE(third.RevisedContinuationPoint.empty());
+
+  // a continuation point is used once
+  EXPECT_EQ(OpcUa::StatusCode::BadContinuationPointInvalid, NameSpace->QueryNext(next).Status);
+}
+
+TEST_F(AddressSpaceQuery, ReleasesContinuationPoint)
+{
+  AddMachine("machine1", MachineType, "OK");
+  AddMachine("machine2", MachineType, "OK");
+
+  OpcUa::QueryFirstParameters params;
+  params.NodeTypes.push_back(DescribeType(MachineType, false));
+  params.MaxDataSetsToReturn = 1;
+  OpcUa::QueryFirstResult first = NameSpace->QueryFirst(params);
+  ASSERT_FALSE(first.ContinuationPoint.empty());
+
+  OpcUa::QueryNextParameters next;
+  next.ContinuationPoint = first.ContinuationPoint;
+  next.ReleaseContinuationPoint = true;
+  OpcUa::QueryNextResult released = NameSpace->QueryNext(next);
+  EXPECT_EQ(OpcUa::StatusCode::Good, released.Status);
+  EXPECT_TRUE(released.QueryDataSets.empty());
+
+  next.ReleaseContinuationPoint = false;
+  EXPECT_EQ(OpcUa::StatusCode::BadContinuationPointInvalid, NameSpace->QueryNext(next).Status);
+}
+
+TEST_F(AddressSpaceQuery, RejectsInvalidFilter)
+{
+  OpcUa::QueryFirstParameters params;
+  params.NodeTypes.push_back(DescribeType(MachineType, false));
+  params.Filter = StatusEquals("OK");
+  params.Filter[0].FilterOperands.pop_back();
+  OpcUa::QueryFirstResult result = NameSpace->QueryFirst(params);
+  EXPECT_EQ(OpcUa::StatusCode::BadContentFilterInvalid, result.Status);
+  ASSERT_EQ(1u, result.FilterResult.ElementResults.size());
+  EXPECT_EQ(OpcUa::StatusCode::BadFilterOperandCountMismatch, result.FilterResult.ElementResults[0].Status);
+}
+
+TEST_F(AddressSpaceQuery, EvaluatesSharedSubexpressionsOnce)
+{
+  AddMachine("machine", MachineType, "OK");
+  const OpcUa::NodeId pump = AddMachine("pump", PumpType, "Fault");
+
+  // And(e[i+1], e[i+1]) down to Status == "Fault", exponential when evaluated by recursion
+  const std::size_t chain = 64;
+  OpcUa::QueryFirstParameters params;
+  params.NodeTypes.push_back(DescribeType(MachineType, true));
+
+  for (std::size_t i = 0; i < chain; ++i)
+    {
+      OpcUa::FilterOperand operand;
+      operand.Header.TypeId = OpcUa::ExpandedObjectId::ElementOperand;
+      operand.Element.Index = i + 1;
+
+      OpcUa::ContentFilterElement element;
+      element.Operator = OpcUa::FilterOperator::And;
+      element.FilterOperands = {operand, operand};
+      params.Filter.push_back(element);
+    }
+
+  params.Filter.push_back(StatusEquals("Fault")[0]);
+  OpcUa::QueryFirstResult result = NameSpace->QueryFirst(params);
+  ASSERT_EQ(OpcUa::StatusCode::Good, result.Status);
+  ASSERT_EQ(1u, result.QueryDataSets.size());
+  EXPECT_EQ(pump, result.QueryDataSets[0].Node);
+}
+
+TEST_F(AddressSpaceQuery, RejectsTooLargeFilter)
+{
+  OpcUa::QueryFirstParameters params;
+  params.NodeTypes.push_back(DescribeType(MachineType, false));
+
+  for (int i = 0; i < 1000; ++i)
+    {
+      params.Filter.push_back(StatusEquals("OK")[0]);
+    }
+
+  EXPECT_EQ(OpcUa::StatusCode::BadContentFilterInvalid, NameSpace->QueryFirst(params).Status);
+}
+
+TEST_F(AddressSpaceQuery, ReportsUnknownType)
+{
+  OpcUa::QueryFirstParameters params;
+  params.NodeTypes.push_back(DescribeType(OpcUa::NumericNodeId(12345, 7), false));
+  OpcUa::QueryFirstResult result = NameSpace->QueryFirst(params);
+  EXPECT_EQ(OpcUa::StatusCode::Good, result.Status);
+  EXPECT_TRUE(result.QueryDataSets.empty());
+  ASSERT_EQ(1u, result.ParsingResults.size());
+  EXPECT_EQ(OpcUa::StatusCode::BadNodeIdUnknown, result.ParsingResults[0].Status);
+}
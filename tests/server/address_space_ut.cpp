@@ -17,18 +17,48 @@
  *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.                *
  ******************************************************************************/
 
+#include <opc/ua/protocol/binary/common.h>
+#include <opc/ua/protocol/binary/stream.h>
 #include <opc/ua/protocol/object_ids.h>
 #include <opc/ua/protocol/attribute_ids.h>
 #include <opc/ua/protocol/status_codes.h>
 
 #include <opc/ua/server/address_space.h>
 #include <opc/ua/server/standard_address_space.h>
+#include <src/server/encoded_responses.h>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 using namespace testing;
 
+namespace
+{
+
+struct BufferAcceptor
+{
+  std::vector<char> & Data;
+
+  void Send(const char * data, std::size_t size)
+  {
+    Data.assign(data, data + size);
+  }
+};
+
+template<class T>
+std::vector<char> Serialize(const T & value)
+{
+  OpcUa::Binary::DataSerializer serializer(OpcUa::Binary::RawSize(value));
+  serializer << value;
+
+  std::vector<char> data;
+  BufferAcceptor acceptor = {data};
+  serializer.Flush(acceptor);
+  return data;
+}
+
+}
+
 class AddressSpace : public Test
 {
 protected:
@@ -152,3 +182,279 @@ TEST_F(AddressSpace, ValueCallbackIsCalled)
   EXPECT_TRUE(result[0].Encoding & OpcUa::DATA_VALUE);
   EXPECT_EQ(result[0].Value, 10);
 }
+
+TEST_F(AddressSpace, BrowseFillsOnlyRequestedFields)
+{
+  OpcUa::BrowseDescription description;
+  description.NodeToBrowse = OpcUa::ObjectId::RootFolder;
+  description.Direction = OpcUa::BrowseDirection::Forward;
+  description.ReferenceTypeId = OpcUa::ObjectId::Organizes;
+  OpcUa::NodesQuery query;
+  query.NodesToBrowse.push_back(description);
+
+  std::vector<OpcUa::BrowseResult> results = NameSpace->Browse(query);
+  ASSERT_EQ(results.size(), 1);
+  auto ref = std::find_if(results[0].Referencies.begin(), results[0].Referencies.end(), [](const OpcUa::ReferenceDescription & ref)
+  {
+    return ref.TargetNodeId == OpcUa::ObjectId::ObjectsFolder;
+  });
+  ASSERT_NE(ref, results[0].Referencies.end());
+  EXPECT_EQ(ref->ReferenceTypeId, OpcUa::ObjectId::Organizes);
+  EXPECT_TRUE(ref->IsForward);
+  EXPECT_EQ(ref->TargetNodeClass, OpcUa::NodeClass::Object);
+  EXPECT_EQ(ref->BrowseName, OpcUa::QualifiedName(OpcUa::Names::Objects));
+  EXPECT_EQ(ref->DisplayName.Text, OpcUa::Names::Objects);
+  EXPECT_EQ(ref->TargetNodeTypeDefinition, OpcUa::ObjectId::FolderType);
+
+  query.NodesToBrowse[0].ResultMask = OpcUa::BrowseResultMask::None;
+  results = NameSpace->Browse(query);
+  ASSERT_EQ(results.size(), 1);
+  ref = std::find_if(results[0].Referencies.begin(), results[0].Referencies.end(), [](const OpcUa::ReferenceDescription & ref)
+  {
+    return ref.TargetNodeId == OpcUa::ObjectId::ObjectsFolder;
+  });
+  ASSERT_NE(ref, results[0].Referencies.end());
+  EXPECT_EQ(ref->ReferenceTypeId, OpcUa::ObjectId::Null);
+  EXPECT_EQ(ref->TargetNodeClass, OpcUa::NodeClass::Unspecified);
+  EXPECT_TRUE(ref->BrowseName.Name.empty());
+  EXPECT_TRUE(ref->DisplayName.Text.empty());
+  EXPECT_EQ(ref->TargetNodeTypeDefinition, OpcUa::ObjectId::Null);
+}
+
+TEST_F(AddressSpace, BrowseCacheFollowsStructureChanges)
+{
+  OpcUa::BrowseDescription description;
+  description.NodeToBrowse = OpcUa::ObjectId::RootFolder;
+  description.Direction = OpcUa::BrowseDirection::Forward;
+  OpcUa::NodesQuery query;
+  query.NodesToBrowse.push_back(description);
+
+  std::vector<OpcUa::Server::EncodedBrowseResult> first = NameSpace->BrowseEncoded(query);
+  ASSERT_EQ(first.size(), 1);
+  ASSERT_TRUE(first[0].EncodedReferences != nullptr);
+  // the same shape is served from the cache
+  EXPECT_EQ(first[0].EncodedReferences, NameSpace->BrowseEncoded(query)[0].EncodedReferences);
+
+  const std::size_t referencesCount = NameSpace->Browse(query)[0].Referencies.size();
+  OpcUa::NodeId valueId = CreateValue();
+  std::vector<OpcUa::BrowseResult> second = NameSpace->Browse(query);
+  EXPECT_EQ(second[0].Referencies.size(), referencesCount + 1);
+  EXPECT_NE(first[0].EncodedReferences, NameSpace->BrowseEncoded(query)[0].EncodedReferences);
+
+  // renaming a target changes the result of its source
+  OpcUa::WriteValue rename;
+  rename.NodeId = valueId;
+  rename.AttributeId = OpcUa::AttributeId::BrowseName;
+  rename.Value = OpcUa::QualifiedName("renamed");
+  ASSERT_EQ(NameSpace->Write({rename})[0], OpcUa::StatusCode::Good);
+
+  std::vector<OpcUa::BrowseResult> third = NameSpace->Browse(query);
+  auto ref = std::find_if(third[0].Referencies.begin(), third[0].Referencies.end(), [&valueId](const OpcUa::ReferenceDescription & ref)
+  {
+    return ref.TargetNodeId == valueId;
+  });
+  ASSERT_NE(ref, third[0].Referencies.end());
+  EXPECT_EQ(ref->BrowseName, OpcUa::QualifiedName("renamed"));
+}
+
+TEST_F(AddressSpace, BrowseCacheKeepsResultsOfUnrelatedNodesOnNewInstance)
+{
+  OpcUa::BrowseDescription description;
+  description.NodeToBrowse = OpcUa::ObjectId::ObjectsFolder;
+  description.Direction = OpcUa::BrowseDirection::Forward;
+  OpcUa::NodesQuery query;
+  query.NodesToBrowse.push_back(description);
+  description.NodeToBrowse = OpcUa::ObjectId::TypesFolder;
+  query.NodesToBrowse.push_back(description);
+
+  std::vector<OpcUa::Server::EncodedBrowseResult> before = NameSpace->BrowseEncoded(query);
+  ASSERT_EQ(before.size(), 2);
+
+  OpcUa::AddNodesItem item;
+  item.Attributes = OpcUa::ObjectAttributes();
+  item.BrowseName = OpcUa::QualifiedName("instance");
+  item.Class = OpcUa::NodeClass::Object;
+  item.ParentNodeId = OpcUa::ObjectId::ObjectsFolder;
+  item.ReferenceTypeId = OpcUa::ObjectId::Organizes;
+  item.TypeDefinition = OpcUa::ObjectId::FolderType;
+  const OpcUa::NodeId instanceId = NameSpace->AddNodes({item})[0].AddedNodeId;
+
+  std::vector<OpcUa::Server::EncodedBrowseResult> after = NameSpace->BrowseEncoded(query);
+  EXPECT_NE(before[0].EncodedReferences, after[0].EncodedReferences);
+  EXPECT_EQ(before[1].EncodedReferences, after[1].EncodedReferences);
+
+  // the parent shows the type definition of the new instance
+  std::vector<OpcUa::BrowseResult> parent = NameSpace->Browse(query);
+  auto ref = std::find_if(parent[0].Referencies.begin(), parent[0].Referencies.end(), [&instanceId](const OpcUa::ReferenceDescription & ref)
+  {
+    return ref.TargetNodeId == instanceId;
+  });
+  ASSERT_NE(ref, parent[0].Referencies.end());
+  EXPECT_EQ(ref->TargetNodeTypeDefinition, OpcUa::ObjectId::FolderType);
+}
+
+TEST_F(AddressSpace, BrowseCacheServesEncodedResultsOfStaticNodes)
+{
+  OpcUa::NodeId valueId = CreateValue();
+
+  OpcUa::BrowseDescription description;
+  description.NodeToBrowse = OpcUa::ObjectId::RootFolder;
+  description.Direction = OpcUa::BrowseDirection::Both;
+  OpcUa::NodesQuery query;
+  query.NodesToBrowse.push_back(description);
+  description.NodeToBrowse = valueId;
+  query.NodesToBrowse.push_back(description);
+
+  std::vector<OpcUa::BrowseResult> full = NameSpace->Browse(query);
+  ASSERT_EQ(full.size(), 2);
+  ASSERT_FALSE(full[0].Referencies.empty());
+  ASSERT_FALSE(full[1].Referencies.empty());
+
+  std::vector<OpcUa::Server::EncodedBrowseResult> encoded = NameSpace->BrowseEncoded(query);
+  ASSERT_EQ(encoded.size(), 2);
+  ASSERT_TRUE(encoded[0].EncodedReferences != nullptr);
+  EXPECT_TRUE(encoded[0].Result.Referencies.empty());
+  EXPECT_EQ(OpcUa::Binary::RawSize(encoded[0]), OpcUa::Binary::RawSize(full[0]));
+  EXPECT_EQ(Serialize(encoded[0]), Serialize(full[0]));
+  // nodes created by the application are not cached
+  EXPECT_TRUE(encoded[1].EncodedReferences == nullptr);
+  EXPECT_EQ(encoded[1].Result.Referencies.size(), full[1].Referencies.size());
+}
+
+TEST_F(AddressSpace, UpdateValuesStoresBatchWithOneTimestamp)
+{
+  OpcUa::NodeId first = CreateValue();
+  OpcUa::NodeId second = CreateValue();
+  std::vector<OpcUa::DataValue> notified;
+  NameSpace->AddDataChangeCallback(second, OpcUa::AttributeId::Value, [&](const OpcUa::NodeId & id, OpcUa::AttributeId attr, const OpcUa::DataValue & value)
+  {
+    notified.push_back(value);
+  });
+
+  std::vector<OpcUa::Server::ValueUpdate> updates;
+  updates.push_back(OpcUa::Server::ValueUpdate(first, OpcUa::DataValue(1)));
+  updates.push_back(OpcUa::Server::ValueUpdate(OpcUa::NumericNodeId(99999, 7), OpcUa::DataValue(2)));
+  updates.push_back(OpcUa::Server::ValueUpdate(second, OpcUa::DataValue(3)));
+  std::vector<OpcUa::StatusCode> statuses = NameSpace->UpdateValues(updates);
+  ASSERT_EQ(statuses.size(), 3);
+  EXPECT_EQ(statuses[0], OpcUa::StatusCode::Good);
+  EXPECT_EQ(statuses[1], OpcUa::StatusCode::BadNodeIdUnknown);
+  EXPECT_EQ(statuses[2], OpcUa::StatusCode::Good);
+
+  OpcUa::ReadParameters readParams;
+  readParams.AttributesToRead.push_back(OpcUa::ToReadValueId(first, OpcUa::AttributeId::Value));
+  readParams.AttributesToRead.push_back(OpcUa::ToReadValueId(second, OpcUa::AttributeId::Value));
+  std::vector<OpcUa::DataValue> values = NameSpace->Read(readParams);
+  ASSERT_EQ(values.size(), 2);
+  EXPECT_EQ(values[0].Value, 1);
+  EXPECT_EQ(values[1].Value, 3);
+  EXPECT_EQ(values[0].ServerTimestamp, values[1].ServerTimestamp);
+
+  ASSERT_EQ(notified.size(), 1);
+  EXPECT_EQ(notified[0].Value, 3);
+  EXPECT_EQ(notified[0].ServerTimestamp, values[1].ServerTimestamp);
+}
+
+TEST_F(AddressSpace, UpdateValuesByHandle)
+{
+  OpcUa::NodeId valueId = CreateValue();
+  uint32_t handle = NameSpace->GetValueHandle(valueId);
+  EXPECT_THROW(NameSpace->GetValueHandle(OpcUa::NumericNodeId(99999, 7)), std::runtime_error);
+
+  std::vector<OpcUa::Server::HandleValueUpdate> updates;
+  updates.push_back(OpcUa::Server::HandleValueUpdate(handle, OpcUa::DataValue(10)));
+  updates.push_back(OpcUa::Server::HandleValueUpdate(NameSpace->GetValueHandle(OpcUa::ObjectId::RootFolder), OpcUa::DataValue(11)));
+  updates.push_back(OpcUa::Server::HandleValueUpdate(std::numeric_limits<uint32_t>::max(), OpcUa::DataValue(12)));
+  std::vector<OpcUa::StatusCode> statuses = NameSpace->UpdateValues(updates);
+  ASSERT_EQ(statuses.size(), 3);
+  EXPECT_EQ(statuses[0], OpcUa::StatusCode::Good);
+  EXPECT_EQ(statuses[1], OpcUa::StatusCode::BadAttributeIdInvalid);
+  EXPECT_EQ(statuses[2], OpcUa::StatusCode::BadNodeIdUnknown);
+
+  OpcUa::ReadParameters readParams;
+  readParams.AttributesToRead.push_back(OpcUa::ToReadValueId(valueId, OpcUa::AttributeId::Value));
+  std::vector<OpcUa::DataValue> values = NameSpace->Read(readParams);
+  ASSERT_EQ(values.size(), 1);
+  EXPECT_EQ(values[0].Value, 10);
+}
+
+TEST_F(AddressSpace, EncodedValueCacheFollowsValue)
+{
+  OpcUa::NodeId valueId = CreateValue();
+  EXPECT_EQ(OpcUa::StatusCode::BadNodeIdUnknown, NameSpace->EnableEncodedValueCache(OpcUa::NumericNodeId(99999, 7), true));
+  EXPECT_EQ(OpcUa::StatusCode::BadAttributeIdInvalid, NameSpace->EnableEncodedValueCache(OpcUa::ObjectId::RootFolder, true));
+  ASSERT_EQ(OpcUa::StatusCode::Good, NameSpace->EnableEncodedValueCache(valueId, true));
+
+  OpcUa::ReadParameters readParams;
+  readParams.AttributesToRead.push_back(OpcUa::ToReadValueId(valueId, OpcUa::AttributeId::Value));
+  std::vector<OpcUa::Server::EncodedDataValue> values = NameSpace->ReadEncoded(readParams);
+  ASSERT_EQ(values.size(), 1);
+  const OpcUa::Server::EncodedData initial = values[0].EncodedVariant;
+  ASSERT_TRUE(initial != nullptr);
+
+  // readers share one encoding until the value changes
+  EXPECT_EQ(initial, NameSpace->ReadEncoded(readParams)[0].EncodedVariant);
+
+  NameSpace->UpdateValues({OpcUa::Server::ValueUpdate(valueId, OpcUa::DataValue(int32_t(5)))});
+  values = NameSpace->ReadEncoded(readParams);
+  ASSERT_TRUE(values[0].EncodedVariant != nullptr);
+  EXPECT_NE(initial, values[0].EncodedVariant);
+  EXPECT_EQ(values[0].Value.Value, 5);
+  EXPECT_EQ(*OpcUa::Server::EncodeVariant(OpcUa::Variant(int32_t(5))), *values[0].EncodedVariant);
+
+
+  readParams.AttributesToRead.push_back(OpcUa::ToReadValueId(valueId, OpcUa::AttributeId::BrowseName));
+  EXPECT_TRUE(NameSpace->ReadEncoded(readParams)[1].EncodedVariant == nullptr);
+
+  ASSERT_EQ(OpcUa::StatusCode::Good, NameSpace->EnableEncodedValueCache(valueId, false));
+  EXPECT_TRUE(NameSpace->ReadEncoded(readParams)[0].EncodedVariant == nullptr);
+}
+
+TEST(EncodedReadResponse, SerializedLikeReadResponse)
+{
+  OpcUa::ReadResponse expected;
+  OpcUa::Server::EncodedReadResponse response;
+  response.Header = expected.Header;
+  EXPECT_EQ(Serialize(expected), Serialize(response));
+
+  OpcUa::DataValue value(std::string("value"));
+  value.SetServerTimestamp(OpcUa::DateTime::Current());
+  OpcUa::DataValue status;
+  status.Encoding = OpcUa::DATA_VALUE_STATUS_CODE;
+  status.Status = OpcUa::StatusCode::BadNotReadable;
+  expected.Results = {value, status, value};
+
+  OpcUa::Server::EncodedDataValue encoded;
+  encoded.Value = value;
+  encoded.EncodedVariant = OpcUa::Server::EncodeVariant(value.Value);
+  OpcUa::Server::EncodedDataValue notEncoded;
+  notEncoded.Value = status;
+  response.Results = {encoded, notEncoded, encoded};
+  response.Results[2].EncodedVariant.reset();
+
+  EXPECT_EQ(OpcUa::Binary::RawSize(expected), OpcUa::Binary::RawSize(response));
+  EXPECT_EQ(Serialize(expected), Serialize(response));
+}
+
+TEST(EncodedBrowseResponse, SerializedLikeBrowseResponse)
+{
+  OpcUa::BrowseResponse expected;
+  OpcUa::Server::EncodedBrowseResponse response;
+  response.Header = expected.Header;
+  EXPECT_EQ(Serialize(expected), Serialize(response));
+
+  OpcUa::BrowseResult result;
+  result.ContinuationPoint = {1, 2};
+  result.Referencies.resize(2);
+  result.Referencies[0].TargetNodeId = OpcUa::ObjectId::ObjectsFolder;
+  result.Referencies[1].BrowseName = OpcUa::QualifiedName("name");
+  expected.Results = {result, OpcUa::BrowseResult()};
+
+  OpcUa::Server::EncodedBrowseResult encoded;
+  encoded.Result.ContinuationPoint = result.ContinuationPoint;
+  encoded.EncodedReferences = OpcUa::Server::EncodeReferences(result.Referencies);
+  response.Results = {encoded, OpcUa::Server::EncodedBrowseResult()};
+
+  EXPECT_EQ(OpcUa::Binary::RawSize(expected), OpcUa::Binary::RawSize(response));
+  EXPECT_EQ(Serialize(expected), Serialize(response));
+}
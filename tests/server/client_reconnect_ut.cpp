@@ -0,0 +1,140 @@
+/// @brief Tests of UaClient restoring its subscriptions after the connection was lost.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include <opc/ua/client/client.h>
+#include <opc/ua/server/server.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+using namespace testing;
+
+namespace
+{
+
+const char Endpoint[] = "opc.tcp://localhost:48451/reconnect";
+const char ValueId[] = "ns=1;s=reconnect.value";
+
+class ValueHandler : public OpcUa::SubscriptionHandler
+{
+public:
+  virtual void DataChange(uint32_t handle, const OpcUa::Node &, const OpcUa::Variant & val, OpcUa::AttributeId) override
+  {
+    std::lock_guard<std::mutex> lock(Mutex);
+    Handle = handle;
+    Value = val.As<int32_t>();
+    Changed.notify_all();
+  }
+
+  bool WaitFor(int32_t value)
+  {
+    std::unique_lock<std::mutex> lock(Mutex);
+    return Changed.wait_for(lock, std::chrono::seconds(10), [this, value]() { return Value == value; });
+  }
+
+  uint32_t GetHandle()
+  {
+    std::lock_guard<std::mutex> lock(Mutex);
+    return Handle;
+  }
+
+private:
+  std::mutex Mutex;
+  std::condition_variable Changed;
+  uint32_t Handle = 0;
+  int32_t Value = -1;
+};
+
+}
+
+class ClientReconnect : public Test
+{
+protected:
+  virtual void SetUp()
+  {
+    spdlog::drop_all();
+    Logger = spdlog::stderr_color_mt("test");
+    Logger->set_level(spdlog::level::err);
+    StartServer();
+  }
+
+  virtual void TearDown()
+  {
+    Server->Stop();
+    Server.reset();
+  }
+
+  void StartServer()
+  {
+    Server.reset(new OpcUa::UaServer(Logger));
+    Server->SetEndpoint(Endpoint);
+    Server->Start();
+    Server->RegisterNamespace("http://reconnect.freeopcua.github.io");
+    Server->GetObjectsNode().AddVariable(ValueId, "value", OpcUa::Variant(int32_t(0)));
+  }
+
+  void Write(int32_t value)
+  {
+    Server->GetNode(ValueId).SetValue(OpcUa::Variant(value));
+  }
+
+protected:
+  Common::Logger::SharedPtr Logger;
+  std::unique_ptr<OpcUa::UaServer> Server;
+  ValueHandler Handler;
+};
+
+TEST_F(ClientReconnect, ResumesSubscriptionOnNewConnection)
+{
+  OpcUa::UaClient client(Logger);
+  client.Connect(Endpoint);
+
+  OpcUa::Subscription::SharedPtr subscription = client.CreateSubscription(10, Handler);
+  const uint32_t handle = subscription->SubscribeDataChange(client.GetNode(ValueId));
+  const uint32_t id = subscription->GetId();
+  ASSERT_TRUE(Handler.WaitFor(0));
+
+  ASSERT_TRUE(client.Reconnect());
+
+  Write(1);
+  ASSERT_TRUE(Handler.WaitFor(1));
+  EXPECT_EQ(handle, Handler.GetHandle());
+  // the session was activated again, the subscription kept its id
+  EXPECT_EQ(id, subscription->GetId());
+
+  client.Disconnect();
+}
+
+TEST_F(ClientReconnect, RecreatesSubscriptionAfterServerRestart)
+{
+  OpcUa::ReconnectParameters params;
+  params.Enabled = true;
+  params.InitialDelay = 10;
+  params.MaxDelay = 100;
+
+  OpcUa::UaClient client(Logger);
+  client.SetReconnectParameters(params);
+  client.Connect(Endpoint);
+
+  OpcUa::Subscription::SharedPtr subscription = client.CreateSubscription(10, Handler);
+  const uint32_t handle = subscription->SubscribeDataChange(client.GetNode(ValueId));
+  ASSERT_TRUE(Handler.WaitFor(0));
+
+  Server->Stop();
+  StartServer();
+  Write(2);
+
+  ASSERT_TRUE(Handler.WaitFor(2));
+  EXPECT_EQ(handle, Handler.GetHandle());
+
+  subscription->UnSubscribe(handle);
+  client.Disconnect();
+}
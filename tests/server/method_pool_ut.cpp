@@ -0,0 +1,294 @@
+/// @brief Tests of asynchronous methods and of the method pool.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include <opc/ua/server/address_space.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+
+using namespace testing;
+using namespace OpcUa;
+
+class MethodPool : public Test
+{
+protected:
+  virtual void SetUp()
+  {
+    spdlog::drop_all();
+    Logger = spdlog::stderr_color_mt("test");
+    Logger->set_level(spdlog::level::info);
+    Space = Server::CreateAddressSpace(Logger);
+    Object = AddNode(1, NodeClass::Object, ObjectAttributes());
+    Method = AddNode(2, NodeClass::Method, MethodAttributes());
+  }
+
+  virtual void TearDown()
+  {
+    Space.reset();
+  }
+
+  NodeId AddNode(uint32_t id, NodeClass nodeClass, const NodeAttributes & attributes)
+  {
+    AddNodesItem item;
+    item.RequestedNewNodeId = NumericNodeId(id, 2);
+    item.BrowseName = QualifiedName("Node" + std::to_string(id), 2);
+    item.Class = nodeClass;
+    item.Attributes = attributes;
+    return Space->AddNodes({item})[0].AddedNodeId;
+  }
+
+  std::vector<CallMethodRequest> Requests(std::size_t count)
+  {
+    CallMethodRequest request;
+    request.ObjectId = Object;
+    request.MethodId = Method;
+    request.InputArguments.push_back(Variant(1));
+    return std::vector<CallMethodRequest>(count, request);
+  }
+
+  /// @brief Call methods and return the future results.
+  std::future<std::vector<CallMethodResult>> CallAsync(const std::vector<CallMethodRequest> & requests)
+  {
+    std::shared_ptr<std::promise<std::vector<CallMethodResult>>> promise = std::make_shared<std::promise<std::vector<CallMethodResult>>>();
+    Space->CallAsync(requests, [promise](std::vector<CallMethodResult> results)
+    {
+      promise->set_value(std::move(results));
+    });
+    return promise->get_future();
+  }
+
+  static bool IsReady(const std::future<std::vector<CallMethodResult>> & results)
+  {
+    return results.wait_for(std::chrono::seconds(5)) == std::future_status::ready;
+  }
+
+protected:
+  Common::Logger::SharedPtr Logger;
+  Server::AddressSpace::UniquePtr Space;
+  NodeId Object;
+  NodeId Method;
+};
+
+TEST_F(MethodPool, AsyncMethodCompletesLater)
+{
+  Server::MethodCompletion::SharedPtr pending;
+  Space->SetAsyncMethod(Method, [&pending](NodeId, std::vector<Variant>, Server::MethodCompletion::SharedPtr completion)
+  {
+    pending = completion;
+  });
+
+  std::future<std::vector<CallMethodResult>> results = CallAsync(Requests(1));
+  ASSERT_TRUE(pending != nullptr);
+  EXPECT_EQ(results.wait_for(std::chrono::milliseconds(10)), std::future_status::timeout);
+
+  std::thread([&pending]()
+  {
+    pending->Complete({Variant(42)});
+  }).join();
+
+  ASSERT_TRUE(IsReady(results));
+  const std::vector<CallMethodResult> result = results.get();
+  ASSERT_EQ(result.size(), 1u);
+  EXPECT_EQ(result[0].Status, StatusCode::Good);
+  ASSERT_EQ(result[0].OutputArguments.size(), 1u);
+  EXPECT_EQ(result[0].OutputArguments[0], 42);
+  EXPECT_EQ(result[0].InputArgumentResults.size(), 1u);
+}
+
+TEST_F(MethodPool, ReleasedCompletionFailsCall)
+{
+  Space->SetAsyncMethod(Method, [](NodeId, std::vector<Variant>, Server::MethodCompletion::SharedPtr)
+  {
+  });
+
+  const std::vector<CallMethodResult> results = Space->Call(Requests(1));
+  ASSERT_EQ(results.size(), 1u);
+  EXPECT_EQ(results[0].Status, StatusCode::BadInternalError);
+}
+
+TEST_F(MethodPool, RunsMethodsOnPool)
+{
+  const std::thread::id caller = std::this_thread::get_id();
+  Space->SetMethod(Method, [caller](NodeId context, std::vector<Variant> arguments)
+  {
+    EXPECT_NE(std::this_thread::get_id(), caller);
+    return std::vector<Variant> {Variant(context.GetIntegerIdentifier()), arguments[0]};
+  });
+  Space->EnableMethodPool(Server::MethodPoolParameters());
+
+  const std::vector<CallMethodResult> results = Space->Call(Requests(3));
+  ASSERT_EQ(results.size(), 3u);
+
+  for (const CallMethodResult & result : results)
+    {
+      EXPECT_EQ(result.Status, StatusCode::Good);
+      ASSERT_EQ(result.OutputArguments.size(), 2u);
+      EXPECT_EQ(result.OutputArguments[0], 1u);
+      EXPECT_EQ(result.OutputArguments[1], 1);
+    }
+}
+
+TEST_F(MethodPool, LimitsConcurrentCallsOfMethod)
+{
+  std::atomic<int> running(0);
+  std::atomic<int> maxRunning(0);
+  Space->SetMethod(Method, [&running, &maxRunning](NodeId, std::vector<Variant>)
+  {
+    const int current = ++running;
+    int previous = maxRunning.load();
+
+    while (previous < current && !maxRunning.compare_exchange_weak(previous, current))
+      {
+      }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    --running;
+    return std::vector<Variant>();
+  });
+
+  Server::MethodPoolParameters params;
+  params.ThreadsCount = 4;
+  params.MethodConcurrencyLimits[Method] = 1;
+  Space->EnableMethodPool(params);
+
+  const std::vector<CallMethodResult> results = Space->Call(Requests(4));
+
+  for (const CallMethodResult & result : results)
+    {
+      EXPECT_EQ(result.Status, StatusCode::Good);
+    }
+
+  EXPECT_EQ(maxRunning.load(), 1);
+}
+
+TEST_F(MethodPool, TimedOutCallIgnoresLateResult)
+{
+  std::mutex mutex;
+  Server::MethodCompletion::SharedPtr pending;
+  Space->SetAsyncMethod(Method, [&](NodeId, std::vector<Variant>, Server::MethodCompletion::SharedPtr completion)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    pending = completion;
+  });
+
+  Server::MethodPoolParameters params;
+  params.Timeout = std::chrono::milliseconds(20);
+  Space->EnableMethodPool(params);
+
+  std::atomic<int> answers(0);
+  std::shared_ptr<std::promise<std::vector<CallMethodResult>>> promise = std::make_shared<std::promise<std::vector<CallMethodResult>>>();
+  Space->CallAsync(Requests(1), [promise, &answers](std::vector<CallMethodResult> results)
+  {
+    ++answers;
+    promise->set_value(std::move(results));
+  });
+
+  std::future<std::vector<CallMethodResult>> results = promise->get_future();
+  ASSERT_TRUE(IsReady(results));
+  EXPECT_EQ(results.get()[0].Status, StatusCode::BadTimeout);
+
+  std::lock_guard<std::mutex> lock(mutex);
+  ASSERT_TRUE(pending != nullptr);
+  pending->Complete({Variant(1)});
+  EXPECT_EQ(answers.load(), 1);
+}
+
+TEST_F(MethodPool, RejectsCallsWhenQueueIsFull)
+{
+  std::promise<void> entered;
+  std::promise<void> release;
+  std::shared_future<void> released = release.get_future().share();
+  Space->SetMethod(Method, [&entered, released](NodeId, std::vector<Variant>)
+  {
+    entered.set_value();
+    released.wait();
+    return std::vector<Variant>();
+  });
+
+  Server::MethodPoolParameters params;
+  params.ThreadsCount = 1;
+  params.QueueSize = 1;
+  Space->EnableMethodPool(params);
+
+  std::future<std::vector<CallMethodResult>> running = CallAsync(Requests(1));
+  ASSERT_EQ(entered.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+
+  Space->SetMethod(Method, [](NodeId, std::vector<Variant>)
+  {
+    return std::vector<Variant>();
+  });
+  std::future<std::vector<CallMethodResult>> queued = CallAsync(Requests(1));
+  std::future<std::vector<CallMethodResult>> rejected = CallAsync(Requests(1));
+
+  ASSERT_TRUE(IsReady(rejected));
+  EXPECT_EQ(rejected.get()[0].Status, StatusCode::BadTooManyOperations);
+
+  release.set_value();
+  ASSERT_TRUE(IsReady(running));
+  EXPECT_EQ(running.get()[0].Status, StatusCode::Good);
+  ASSERT_TRUE(IsReady(queued));
+  EXPECT_EQ(queued.get()[0].Status, StatusCode::Good);
+}
+
+TEST_F(MethodPool, NestedCallRunsOnCallingThread)
+{
+  const NodeId inner = AddNode(3, NodeClass::Method, MethodAttributes());
+  Space->SetMethod(inner, [](NodeId, std::vector<Variant>)
+  {
+    return std::vector<Variant> {Variant(7)};
+  });
+
+  Space->SetMethod(Method, [this, inner](NodeId, std::vector<Variant>)
+  {
+    std::vector<CallMethodRequest> requests = Requests(1);
+    requests[0].MethodId = inner;
+    return Space->Call(requests)[0].OutputArguments;
+  });
+
+  Server::MethodPoolParameters params;
+  params.ThreadsCount = 1;
+  Space->EnableMethodPool(params);
+
+  std::future<std::vector<CallMethodResult>> results = CallAsync(Requests(1));
+  ASSERT_TRUE(IsReady(results));
+  const std::vector<CallMethodResult> result = results.get();
+  EXPECT_EQ(result[0].Status, StatusCode::Good);
+  ASSERT_EQ(result[0].OutputArguments.size(), 1u);
+  EXPECT_EQ(result[0].OutputArguments[0], 7);
+}
+
+TEST_F(MethodPool, SkipsCallsTimedOutInQueue)
+{
+  std::atomic<int> calls(0);
+  Space->SetMethod(Method, [&calls](NodeId, std::vector<Variant>)
+  {
+    ++calls;
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    return std::vector<Variant>();
+  });
+
+  Server::MethodPoolParameters params;
+  params.ThreadsCount = 1;
+  params.Timeout = std::chrono::milliseconds(20);
+  Space->EnableMethodPool(params);
+
+  std::future<std::vector<CallMethodResult>> running = CallAsync(Requests(1));
+  std::future<std::vector<CallMethodResult>> queued = CallAsync(Requests(1));
+  ASSERT_TRUE(IsReady(running));
+  ASSERT_TRUE(IsReady(queued));
+  EXPECT_EQ(queued.get()[0].Status, StatusCode::BadTimeout);
+
+  // the running call returns before the queued one could be taken
+  std::this_thread::sleep_for(std::chrono::milliseconds(150));
+  EXPECT_EQ(calls.load(), 1);
+}
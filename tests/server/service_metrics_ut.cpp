@@ -0,0 +1,165 @@
+/// @brief Tests of per service request metrics.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include <opc/ua/server/service_metrics.h>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+using namespace testing;
+using namespace OpcUa;
+using namespace OpcUa::Server;
+
+
+TEST(LatencyHistogram, BucketsAreMonotonic)
+{
+  uint64_t previous = 0;
+
+  for (std::size_t idx = 1; idx < LatencyHistogram::BucketCount; ++idx)
+    {
+      const uint64_t bound = LatencyHistogram::GetBucketUpperBound(idx);
+      EXPECT_GT(bound, previous);
+      EXPECT_EQ(idx, LatencyHistogram::GetBucketIndex(bound));
+      previous = bound;
+    }
+
+  EXPECT_EQ(LatencyHistogram::BucketCount - 1, LatencyHistogram::GetBucketIndex(~uint64_t()));
+}
+
+TEST(LatencyHistogram, PercentileWithinPrecision)
+{
+  LatencyHistogram histogram;
+
+  for (uint64_t value = 1; value <= 1000; ++value)
+    {
+      histogram.Record(value * 1000);
+    }
+
+  EXPECT_EQ(1000u, histogram.Count());
+  EXPECT_EQ(1000000u, histogram.Max());
+  EXPECT_EQ(500500000u, histogram.Sum());
+
+  const uint64_t p50 = histogram.Percentile(0.5);
+  EXPECT_GE(p50, 500000u);
+  EXPECT_LE(p50, 500000u * 1125 / 1000);
+
+  const uint64_t p99 = histogram.Percentile(0.99);
+  EXPECT_GE(p99, 990000u);
+  EXPECT_LE(p99, 1000000u);
+  EXPECT_EQ(1000000u, histogram.Percentile(1.0));
+}
+
+TEST(LatencyHistogram, EmptyHistogram)
+{
+  LatencyHistogram histogram;
+  EXPECT_EQ(0u, histogram.Count());
+  EXPECT_EQ(0u, histogram.Percentile(0.99));
+}
+
+TEST(ServiceMetrics, RequestPhasesAreCounted)
+{
+  ServiceMetrics metrics;
+
+  {
+    RequestMetrics request(&metrics, 100);
+    request.SetService(READ_REQUEST);
+    request.Decoded();
+    request.Serviced(StatusCode::Good);
+    request.Sent(250);
+  }
+
+  {
+    RequestMetrics request(&metrics, 80);
+    request.SetService(READ_REQUEST);
+    request.Decoded();
+    request.Serviced(StatusCode::BadNodeIdUnknown);
+    request.Sent(40);
+  }
+
+  {
+    // destroyed before response has been sent, e.g. decoding failed
+    RequestMetrics request(&metrics, 10);
+    request.SetService(READ_REQUEST);
+  }
+
+  const ServiceCounters & read = metrics.GetCounters(READ_REQUEST);
+  EXPECT_EQ("Read", read.Name);
+  EXPECT_EQ(3u, read.Requests.load());
+  EXPECT_EQ(2u, read.Errors.load());
+  EXPECT_EQ(190u, read.BytesIn.load());
+  EXPECT_EQ(290u, read.BytesOut.load());
+  EXPECT_EQ(2u, read.DecodeTime.Count());
+  EXPECT_EQ(2u, read.ServiceTime.Count());
+  EXPECT_EQ(2u, read.EncodeTime.Count());
+  EXPECT_EQ(0u, metrics.GetCounters(WRITE_REQUEST).Requests.load());
+}
+
+TEST(ServiceMetrics, UnsupportedRequestsAreRejected)
+{
+  ServiceMetrics metrics;
+
+  {
+    RequestMetrics request(&metrics, 10);
+    request.SetService(DELETE_NODES_REQUEST);
+    request.Decoded();
+    request.Serviced(StatusCode::BadNotImplemented);
+    request.Sent(10);
+  }
+
+  EXPECT_EQ("Unsupported", metrics.GetCounters(DELETE_NODES_REQUEST).Name);
+  EXPECT_EQ(1u, metrics.GetRejectedRequestsCount());
+}
+
+TEST(ServiceMetrics, NullMetricsIsNoop)
+{
+  RequestMetrics request(nullptr, 10);
+  request.SetService(READ_REQUEST);
+  request.Decoded();
+  request.Serviced(StatusCode::Good);
+  request.Sent(10);
+}
+
+TEST(ServiceMetrics, SessionsAndSubscriptions)
+{
+  ServiceMetrics metrics;
+  metrics.SessionCreated();
+  metrics.SessionCreated();
+  metrics.SessionClosed();
+  metrics.SubscriptionCreated();
+  metrics.SubscriptionCreated();
+  metrics.SubscriptionsDeleted(2);
+
+  EXPECT_EQ(1u, metrics.GetCurrentSessionCount());
+  EXPECT_EQ(2u, metrics.GetCumulatedSessionCount());
+  EXPECT_EQ(0u, metrics.GetCurrentSubscriptionCount());
+  EXPECT_EQ(2u, metrics.GetCumulatedSubscriptionCount());
+}
+
+TEST(ServiceMetrics, DumpContainsUsedServicesOnly)
+{
+  ServiceMetrics metrics;
+
+  {
+    RequestMetrics request(&metrics, 100);
+    request.SetService(BROWSE_REQUEST);
+    request.Decoded();
+    request.Serviced(StatusCode::Good);
+    request.Sent(1000);
+  }
+
+  std::stringstream dump;
+  metrics.Dump(dump);
+  const std::string text = dump.str();
+
+  EXPECT_NE(std::string::npos, text.find("opcua_sessions_current 0\n"));
+  EXPECT_NE(std::string::npos, text.find("opcua_service_requests_total{service=\"Browse\"} 1\n"));
+  EXPECT_NE(std::string::npos, text.find("opcua_service_bytes_out_total{service=\"Browse\"} 1000\n"));
+  EXPECT_NE(std::string::npos, text.find("opcua_service_latency_us_count{service=\"Browse\",phase=\"encode\"} 1\n"));
+  EXPECT_EQ(std::string::npos, text.find("service=\"Read\""));
+}
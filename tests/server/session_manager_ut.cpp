@@ -0,0 +1,396 @@
+/// @brief Tests of sessions surviving their connection.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include <src/server/session_manager.h>
+
+#include <opc/ua/server/address_space.h>
+#include <opc/ua/server/services_registry.h>
+#include <opc/ua/server/standard_address_space.h>
+#include <opc/ua/server/subscription_service.h>
+
+#include <boost/asio/io_service.hpp>
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+using namespace testing;
+
+namespace
+{
+
+class TestChannel : public OpcUa::Server::SessionChannel
+{
+public:
+  virtual void ForwardPublishResponse(OpcUa::PublishResult result) override
+  {
+    Results.push_back(result);
+  }
+
+  virtual void Close() override
+  {
+    Closed = true;
+  }
+
+  std::vector<OpcUa::PublishResult> Results;
+  bool Closed = false;
+};
+
+}
+
+class SessionManager : public Test
+{
+protected:
+  virtual void SetUp()
+  {
+    spdlog::drop_all();
+    Logger = spdlog::stderr_color_mt("test");
+    Logger->set_level(spdlog::level::info);
+    AddressSpace = OpcUa::Server::CreateAddressSpace(Logger);
+    OpcUa::Server::FillStandardNamespace(*AddressSpace, Logger);
+    Subscriptions = OpcUa::Server::CreateSubscriptionService(AddressSpace, Io, Logger);
+    Registry = OpcUa::Server::CreateServicesRegistry();
+    Registry->RegisterSubscriptionServices(Subscriptions);
+    Registry->RegisterViewServices(AddressSpace);
+    Sessions = std::make_shared<OpcUa::Server::SessionManager>(Registry->GetServer(), &Io, Logger);
+    Value = CreateValue();
+    FirstChannel = std::make_shared<TestChannel>();
+    SecondChannel = std::make_shared<TestChannel>();
+  }
+
+  virtual void TearDown()
+  {
+    Sessions->Shutdown();
+    Sessions.reset();
+    Registry.reset();
+    Subscriptions.reset();
+    AddressSpace.reset();
+  }
+
+  OpcUa::NodeId CreateValue()
+  {
+    OpcUa::AddNodesItem item;
+    item.Attributes = OpcUa::VariableAttributes();
+    item.BrowseName = OpcUa::QualifiedName("value");
+    item.Class = OpcUa::NodeClass::Variable;
+    item.ParentNodeId = OpcUa::ObjectId::RootFolder;
+    std::vector<OpcUa::AddNodesResult> newNodesResult = AddressSpace->AddNodes({item});
+    return newNodesResult[0].AddedNodeId;
+  }
+
+  static std::function<void (OpcUa::PublishResult)> Forward(OpcUa::Server::Session::SharedPtr session)
+  {
+    return [session](OpcUa::PublishResult result) { session->Forward(result); };
+  }
+
+  /// @brief Subscription with one monitored item and a publishing interval no test waits for.
+  uint32_t Subscribe(OpcUa::Server::Session::SharedPtr session)
+  {
+    OpcUa::CreateSubscriptionRequest request;
+    request.Header.SessionAuthenticationToken = session->AuthenticationToken;
+    request.Parameters.RequestedPublishingInterval = 60000;
+    request.Parameters.RequestedLifetimeCount = 100;
+    request.Parameters.RequestedMaxKeepAliveCount = 10;
+    const uint32_t id = Subscriptions->CreateSubscription(request, Forward(session)).SubscriptionId;
+    Sessions->AddSubscription(session, id);
+
+    OpcUa::MonitoredItemCreateRequest item;
+    item.ItemToMonitor.NodeId = Value;
+    item.ItemToMonitor.AttributeId = OpcUa::AttributeId::Value;
+    item.MonitoringMode = OpcUa::MonitoringMode::Reporting;
+    item.RequestedParameters.ClientHandle = 1;
+    item.RequestedParameters.QueueSize = 1;
+
+    OpcUa::MonitoredItemsParameters params;
+    params.SubscriptionId = id;
+    params.ItemsToCreate.push_back(item);
+    Subscriptions->CreateMonitoredItems(params);
+    return id;
+  }
+
+  /// @brief Query of the folders returning one at a time.
+  static OpcUa::QueryFirstParameters QueryFolders()
+  {
+    OpcUa::NodeTypeDescription folders;
+    folders.TypeDefinitionNode = OpcUa::ObjectId::FolderType;
+
+    OpcUa::QueryFirstParameters params;
+    params.NodeTypes.push_back(folders);
+    params.MaxDataSetsToReturn = 1;
+    return params;
+  }
+
+  static OpcUa::QueryNextParameters Continue(const std::vector<uint8_t> & point)
+  {
+    OpcUa::QueryNextParameters params;
+    params.ContinuationPoint = point;
+    return params;
+  }
+
+  void Publish(OpcUa::Server::Session::SharedPtr session)
+  {
+    OpcUa::PublishRequest request;
+    request.Header.SessionAuthenticationToken = session->AuthenticationToken;
+    Subscriptions->Publish(request);
+  }
+
+protected:
+  boost::asio::io_service Io;
+  Common::Logger::SharedPtr Logger;
+  OpcUa::Server::AddressSpace::SharedPtr AddressSpace;
+  OpcUa::Server::SubscriptionService::SharedPtr Subscriptions;
+  OpcUa::Server::ServicesRegistry::SharedPtr Registry;
+  OpcUa::Server::SessionManager::SharedPtr Sessions;
+  OpcUa::NodeId Value;
+  std::shared_ptr<TestChannel> FirstChannel;
+  std::shared_ptr<TestChannel> SecondChannel;
+};
+
+TEST_F(SessionManager, RevisesTimeout)
+{
+  EXPECT_EQ(60000, Sessions->CreateSession(0, FirstChannel)->Timeout);
+  EXPECT_EQ(3600000, Sessions->CreateSession(1e9, FirstChannel)->Timeout);
+  EXPECT_EQ(5000, Sessions->CreateSession(5000, FirstChannel)->Timeout);
+}
+
+TEST_F(SessionManager, KeepsSubscriptionsOfDetachedSession)
+{
+  OpcUa::Server::Session::SharedPtr session = Sessions->CreateSession(60000, FirstChannel);
+  Subscribe(session);
+
+  Sessions->DetachSession(session, FirstChannel.get());
+  Io.poll();
+
+  EXPECT_EQ(1u, Sessions->GetSessionCount());
+  EXPECT_EQ(1u, Subscriptions->GetSubscriptionDiagnostics().size());
+  EXPECT_FALSE(session->IsBoundTo(FirstChannel.get()));
+}
+
+TEST_F(SessionManager, IgnoresDetachOfOtherChannel)
+{
+  OpcUa::Server::Session::SharedPtr session = Sessions->CreateSession(60000, FirstChannel);
+  Sessions->DetachSession(session, SecondChannel.get());
+  EXPECT_TRUE(session->IsBoundTo(FirstChannel.get()));
+}
+
+TEST_F(SessionManager, ActivateBindsNewChannel)
+{
+  OpcUa::Server::PublishParameters params;
+  params.LowLatency = true;
+  params.MinPublishSpacing = std::chrono::milliseconds(0);
+  Subscriptions->SetPublishParameters(params);
+
+  OpcUa::Server::Session::SharedPtr session = Sessions->CreateSession(60000, FirstChannel);
+  Subscribe(session);
+  Sessions->DetachSession(session, FirstChannel.get());
+  Io.poll();
+
+  ASSERT_EQ(session, Sessions->ActivateSession(session->AuthenticationToken, SecondChannel));
+  EXPECT_TRUE(session->IsBoundTo(SecondChannel.get()));
+
+  // the value queued while the session had no connection
+  Publish(session);
+  Io.poll();
+  EXPECT_TRUE(FirstChannel->Results.empty());
+  ASSERT_EQ(1u, SecondChannel->Results.size());
+  EXPECT_EQ(1u, SecondChannel->Results[0].NotificationMessage.NotificationData.size());
+}
+
+TEST_F(SessionManager, AuthenticationTokenIsNotSessionId)
+{
+  OpcUa::Server::Session::SharedPtr first = Sessions->CreateSession(60000, FirstChannel);
+  OpcUa::Server::Session::SharedPtr second = Sessions->CreateSession(60000, FirstChannel);
+
+  EXPECT_NE(first->SessionId, first->AuthenticationToken);
+  EXPECT_NE(first->AuthenticationToken, second->AuthenticationToken);
+  EXPECT_TRUE(first->AuthenticationToken.IsGuid());
+  EXPECT_FALSE(Sessions->ActivateSession(first->SessionId, FirstChannel));
+}
+
+TEST_F(SessionManager, RefusesTakeOverOfLiveSession)
+{
+  OpcUa::Server::Session::SharedPtr anonymous = Sessions->CreateSession(60000, FirstChannel);
+  ASSERT_TRUE(Sessions->ActivateSession(anonymous->AuthenticationToken, FirstChannel) != nullptr);
+
+  EXPECT_FALSE(Sessions->ActivateSession(anonymous->AuthenticationToken, SecondChannel));
+  EXPECT_TRUE(anonymous->IsBoundTo(FirstChannel.get()));
+
+  OpcUa::Server::Session::SharedPtr user = Sessions->CreateSession(60000, FirstChannel);
+  ASSERT_TRUE(Sessions->ActivateSession(user->AuthenticationToken, FirstChannel, "alice") != nullptr);
+
+  EXPECT_FALSE(Sessions->ActivateSession(user->AuthenticationToken, SecondChannel, "bob"));
+  EXPECT_FALSE(Sessions->ActivateSession(user->AuthenticationToken, SecondChannel));
+  EXPECT_TRUE(user->IsBoundTo(FirstChannel.get()));
+
+  EXPECT_EQ(user, Sessions->ActivateSession(user->AuthenticationToken, SecondChannel, "alice"));
+  EXPECT_TRUE(user->IsBoundTo(SecondChannel.get()));
+}
+
+TEST_F(SessionManager, RejectsUnknownToken)
+{
+  EXPECT_FALSE(Sessions->ActivateSession(OpcUa::NumericNodeId(12345, 7), FirstChannel));
+}
+
+TEST_F(SessionManager, DeletesSubscriptionsAfterTimeout)
+{
+  OpcUa::Server::Session::SharedPtr session = Sessions->CreateSession(1, FirstChannel);
+  Subscribe(session);
+
+  Sessions->DetachSession(session, FirstChannel.get());
+  Io.run_for(std::chrono::milliseconds(100));
+
+  EXPECT_EQ(0u, Sessions->GetSessionCount());
+  EXPECT_TRUE(Subscriptions->GetSubscriptionDiagnostics().empty());
+  EXPECT_FALSE(Sessions->ActivateSession(session->AuthenticationToken, SecondChannel));
+}
+
+TEST_F(SessionManager, ClosedSessionKeepsSubscriptionsForTransfer)
+{
+  OpcUa::Server::Session::SharedPtr session = Sessions->CreateSession(60000, FirstChannel);
+  Subscribe(session);
+
+  Sessions->CloseSession(session, false);
+
+  EXPECT_FALSE(Sessions->ActivateSession(session->AuthenticationToken, FirstChannel));
+  EXPECT_EQ(1u, Subscriptions->GetSubscriptionDiagnostics().size());
+
+  Sessions->CloseSession(session, true);
+  EXPECT_TRUE(Subscriptions->GetSubscriptionDiagnostics().empty());
+}
+
+TEST_F(SessionManager, TransfersSubscriptionWithInitialValues)
+{
+  OpcUa::Server::Session::SharedPtr first = Sessions->CreateSession(60000, FirstChannel);
+  OpcUa::Server::Session::SharedPtr second = Sessions->CreateSession(60000, SecondChannel);
+  const uint32_t id = Subscribe(first);
+
+  OpcUa::TransferSubscriptionsRequest request;
+  request.Header.SessionAuthenticationToken = second->AuthenticationToken;
+  request.Parameters.SubscriptionIds = {id, id + 100};
+  request.Parameters.SendInitialValues = true;
+  std::vector<OpcUa::TransferResult> results = Sessions->TransferSubscriptions(second, request, Forward(second));
+
+  ASSERT_EQ(2u, results.size());
+  EXPECT_EQ(OpcUa::StatusCode::Good, results[0].Status);
+  EXPECT_EQ(OpcUa::StatusCode::BadSubscriptionIdInvalid, results[1].Status);
+
+  EXPECT_TRUE(first->GetSubscriptions().empty());
+  EXPECT_EQ(std::set<uint32_t>({id}), second->GetSubscriptions());
+
+  std::vector<OpcUa::Server::SubscriptionDiagnostics> diagnostics = Subscriptions->GetSubscriptionDiagnostics();
+  ASSERT_EQ(1u, diagnostics.size());
+  EXPECT_EQ(second->SessionId, diagnostics[0].SessionId);
+  // value queued at creation and the initial value of the transfer
+  EXPECT_EQ(2u, diagnostics[0].QueuedNotificationsCount);
+
+  // ending the first session does not affect the transferred subscription
+  Sessions->CloseSession(first, true);
+  EXPECT_EQ(1u, Subscriptions->GetSubscriptionDiagnostics().size());
+}
+
+TEST_F(SessionManager, SlowConsumerPolicyTerminatesSession)
+{
+  OpcUa::Server::PublishParameters params;
+  params.LowLatency = true;
+  params.MinPublishSpacing = std::chrono::milliseconds(0);
+  params.MaxQueuedNotificationBytes = 1;
+  params.Policy = OpcUa::Server::SlowConsumerPolicy::CloseSession;
+  Subscriptions->SetPublishParameters(params);
+  Sessions->Start();
+
+  OpcUa::Server::Session::SharedPtr session = Sessions->CreateSession(60000, FirstChannel);
+  Publish(session);
+  Subscribe(session);
+  Io.poll();
+
+  ASSERT_EQ(1u, FirstChannel->Results.size());
+  ASSERT_EQ(1u, FirstChannel->Results[0].NotificationMessage.NotificationData.size());
+  EXPECT_EQ(OpcUa::StatusCode::BadResourceUnavailable, FirstChannel->Results[0].NotificationMessage.NotificationData[0].StatusChange.Status);
+  EXPECT_TRUE(FirstChannel->Closed);
+  EXPECT_EQ(0u, Sessions->GetSessionCount());
+  EXPECT_TRUE(Subscriptions->GetSubscriptionDiagnostics().empty());
+}
+
+TEST_F(SessionManager, SlowConsumerWithoutPublishRequestIsTerminated)
+{
+  OpcUa::Server::PublishParameters params;
+  params.MaxQueuedNotificationBytes = 1;
+  params.Policy = OpcUa::Server::SlowConsumerPolicy::CloseSession;
+  Subscriptions->SetPublishParameters(params);
+  Sessions->Start();
+
+  OpcUa::Server::Session::SharedPtr session = Sessions->CreateSession(60000, FirstChannel);
+  Subscribe(session);
+  Io.poll();
+
+  EXPECT_TRUE(FirstChannel->Results.empty());
+  EXPECT_TRUE(FirstChannel->Closed);
+  EXPECT_EQ(0u, Sessions->GetSessionCount());
+}
+
+TEST_F(SessionManager, RefusesTransferFromAnotherUser)
+{
+  OpcUa::Server::Session::SharedPtr first = Sessions->CreateSession(60000, FirstChannel);
+  OpcUa::Server::Session::SharedPtr second = Sessions->CreateSession(60000, SecondChannel);
+  ASSERT_TRUE(Sessions->ActivateSession(first->AuthenticationToken, FirstChannel, "alice") != nullptr);
+  ASSERT_TRUE(Sessions->ActivateSession(second->AuthenticationToken, SecondChannel, "bob") != nullptr);
+  const uint32_t id = Subscribe(first);
+
+  OpcUa::TransferSubscriptionsRequest request;
+  request.Header.SessionAuthenticationToken = second->AuthenticationToken;
+  request.Parameters.SubscriptionIds = {id};
+  std::vector<OpcUa::TransferResult> results = Sessions->TransferSubscriptions(second, request, Forward(second));
+
+  ASSERT_EQ(1u, results.size());
+  EXPECT_EQ(OpcUa::StatusCode::BadUserAccessDenied, results[0].Status);
+  EXPECT_EQ(std::set<uint32_t>({id}), first->GetSubscriptions());
+  EXPECT_TRUE(second->GetSubscriptions().empty());
+
+  std::vector<OpcUa::Server::SubscriptionDiagnostics> diagnostics = Subscriptions->GetSubscriptionDiagnostics();
+  ASSERT_EQ(1u, diagnostics.size());
+  EXPECT_EQ(first->SessionId, diagnostics[0].SessionId);
+}
+
+TEST_F(SessionManager, QueryContinuationPointsBelongToSession)
+{
+  OpcUa::Server::Session::SharedPtr first = Sessions->CreateSession(60000, FirstChannel);
+  OpcUa::Server::Session::SharedPtr second = Sessions->CreateSession(60000, SecondChannel);
+
+  const OpcUa::QueryFirstResult query = Sessions->QueryFirst(first, QueryFolders());
+  ASSERT_EQ(1u, query.QueryDataSets.size());
+  ASSERT_EQ(16u, query.ContinuationPoint.size());
+
+  EXPECT_EQ(OpcUa::StatusCode::BadContinuationPointInvalid, Sessions->QueryNext(second, Continue(query.ContinuationPoint)).Status);
+
+  const OpcUa::QueryNextResult next = Sessions->QueryNext(first, Continue(query.ContinuationPoint));
+  EXPECT_EQ(OpcUa::StatusCode::Good, next.Status);
+  EXPECT_EQ(1u, next.QueryDataSets.size());
+}
+
+TEST_F(SessionManager, LimitsQueryContinuationPointsPerSession)
+{
+  OpcUa::Server::Session::SharedPtr first = Sessions->CreateSession(60000, FirstChannel);
+  OpcUa::Server::Session::SharedPtr second = Sessions->CreateSession(60000, SecondChannel);
+
+  const std::vector<uint8_t> other = Sessions->QueryFirst(second, QueryFolders()).ContinuationPoint;
+  std::vector<std::vector<uint8_t>> points;
+
+  for (std::size_t i = 0; i <= OpcUa::Server::SessionManager::MaxQueryContinuationPoints; ++i)
+    {
+      points.push_back(Sessions->QueryFirst(first, QueryFolders()).ContinuationPoint);
+    }
+
+  // the oldest query of the session was released, the one of the other session is kept
+  EXPECT_EQ(OpcUa::StatusCode::BadContinuationPointInvalid, Sessions->QueryNext(first, Continue(points.front())).Status);
+  EXPECT_EQ(OpcUa::StatusCode::Good, Sessions->QueryNext(first, Continue(points.back())).Status);
+  EXPECT_EQ(OpcUa::StatusCode::Good, Sessions->QueryNext(second, Continue(other)).Status);
+
+  // the queries of an ended session are released
+  const std::vector<uint8_t> last = points[1];
+  Sessions->CloseSession(first, true);
+  EXPECT_EQ(OpcUa::StatusCode::BadContinuationPointInvalid, AddressSpace->QueryNext(Continue(last)).Status);
+}
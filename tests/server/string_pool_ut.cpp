@@ -0,0 +1,82 @@
+/// @brief Tests of the string pool of the address space.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include <src/server/string_pool.h>
+
+#include <gtest/gtest.h>
+
+using namespace testing;
+using namespace OpcUa::Internal;
+
+TEST(StringPool, EqualStringsShareHandles)
+{
+  StringPool pool;
+  const InternedString speed = pool.Intern("Speed");
+  const InternedString other = pool.Intern(std::string("Spe") + "ed");
+
+  EXPECT_EQ(speed, other);
+  EXPECT_EQ(&speed.Get(), &other.Get());
+  EXPECT_NE(speed, pool.Intern("Current"));
+  EXPECT_EQ("Speed", speed.Get());
+  EXPECT_EQ(2u, pool.Size());
+}
+
+TEST(StringPool, EmptyStringIsNotPooled)
+{
+  StringPool pool;
+  EXPECT_EQ(InternedString(), pool.Intern(""));
+  EXPECT_EQ("", InternedString().Get());
+  EXPECT_EQ(0u, pool.Size());
+}
+
+TEST(StringPool, FindDoesNotAdd)
+{
+  StringPool pool;
+  const InternedName name = pool.Intern(OpcUa::QualifiedName(2, "Status"));
+  InternedName found;
+
+  ASSERT_TRUE(pool.Find(OpcUa::QualifiedName(2, "Status"), found));
+  EXPECT_EQ(name, found);
+  ASSERT_TRUE(pool.Find(OpcUa::QualifiedName(3, "Status"), found));
+  EXPECT_FALSE(name == found);
+  EXPECT_FALSE(pool.Find(OpcUa::QualifiedName(2, "Speed"), found));
+  EXPECT_EQ(1u, pool.Size());
+}
+
+TEST(StringPool, PurgeReleasesUnusedStrings)
+{
+  StringPool pool;
+  const OpcUa::LocalizedText motor(std::string("Motor"), std::string("en"));
+  const InternedText text = pool.Intern(motor);
+
+  {
+    const InternedString unused = pool.Intern("Unused");
+    const InternedString copy = unused;
+    EXPECT_EQ(0u, pool.Purge());
+  }
+
+  EXPECT_EQ(1u, pool.Purge());
+  EXPECT_EQ(2u, pool.Size());
+  EXPECT_EQ(motor, text.ToLocalizedText());
+}
+
+TEST(StringPool, InternPurgesReplacedStrings)
+{
+  StringPool pool;
+  const InternedString kept = pool.Intern("Kept");
+  InternedString name;
+
+  for (std::size_t i = 0; i < 10 * StringPool::MinPurgeSize; ++i)
+    {
+      name = pool.Intern("Name" + std::to_string(i));
+    }
+
+  EXPECT_LE(pool.Size(), StringPool::MinPurgeSize + 1);
+  EXPECT_EQ("Kept", kept.Get());
+  EXPECT_EQ("Name" + std::to_string(10 * StringPool::MinPurgeSize - 1), name.Get());
+}
@@ -0,0 +1,180 @@
+/// @brief Tests of subscription diagnostics counters.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include <opc/ua/server/address_space.h>
+#include <opc/ua/server/standard_address_space.h>
+#include <opc/ua/server/subscription_service.h>
+
+#include <boost/asio/io_service.hpp>
+#include <gtest/gtest.h>
+
+using namespace testing;
+
+class SubscriptionDiagnostics : public Test
+{
+protected:
+  virtual void SetUp()
+  {
+    spdlog::drop_all();
+    Logger = spdlog::stderr_color_mt("test");
+    Logger->set_level(spdlog::level::info);
+    AddressSpace = OpcUa::Server::CreateAddressSpace(Logger);
+    OpcUa::Server::FillStandardNamespace(*AddressSpace, Logger);
+    Subscriptions = OpcUa::Server::CreateSubscriptionService(AddressSpace, Io, Logger);
+    Session = OpcUa::NumericNodeId(1, 1);
+  }
+
+  virtual void TearDown()
+  {
+    Subscriptions.reset();
+    AddressSpace.reset();
+  }
+
+  OpcUa::NodeId CreateValue()
+  {
+    OpcUa::AddNodesItem item;
+    item.Attributes = OpcUa::VariableAttributes();
+    item.BrowseName = OpcUa::QualifiedName("value");
+    item.Class = OpcUa::NodeClass::Variable;
+    item.ParentNodeId = OpcUa::ObjectId::RootFolder;
+    std::vector<OpcUa::AddNodesResult> newNodesResult = AddressSpace->AddNodes({item});
+    return newNodesResult[0].AddedNodeId;
+  }
+
+  uint32_t CreateSubscription()
+  {
+    OpcUa::CreateSubscriptionRequest request;
+    request.Header.SessionAuthenticationToken = Session;
+    request.Parameters.RequestedPublishingInterval = 10;
+    request.Parameters.RequestedLifetimeCount = 100;
+    request.Parameters.RequestedMaxKeepAliveCount = 10;
+    return Subscriptions->CreateSubscription(request, [this](OpcUa::PublishResult result) { Results.push_back(result); }).SubscriptionId;
+  }
+
+  uint32_t MonitorValue(uint32_t subscriptionId, const OpcUa::NodeId & node)
+  {
+    OpcUa::MonitoredItemCreateRequest item;
+    item.ItemToMonitor.NodeId = node;
+    item.ItemToMonitor.AttributeId = OpcUa::AttributeId::Value;
+    item.MonitoringMode = OpcUa::MonitoringMode::Reporting;
+    item.RequestedParameters.ClientHandle = 1;
+    item.RequestedParameters.SamplingInterval = 10;
+    item.RequestedParameters.QueueSize = 1;
+    item.RequestedParameters.DiscardOldest = true;
+
+    OpcUa::MonitoredItemsParameters params;
+    params.SubscriptionId = subscriptionId;
+    params.ItemsToCreate.push_back(item);
+    return Subscriptions->CreateMonitoredItems(params).at(0).MonitoredItemId;
+  }
+
+  void WriteValue(const OpcUa::NodeId & node, int value)
+  {
+    OpcUa::WriteValue write;
+    write.AttributeId = OpcUa::AttributeId::Value;
+    write.NodeId = node;
+    write.Value = value;
+    AddressSpace->Write({write});
+  }
+
+  OpcUa::Server::SubscriptionDiagnostics GetDiagnostics()
+  {
+    std::vector<OpcUa::Server::SubscriptionDiagnostics> diagnostics = Subscriptions->GetSubscriptionDiagnostics();
+    EXPECT_EQ(1u, diagnostics.size());
+    return diagnostics.empty() ? OpcUa::Server::SubscriptionDiagnostics() : diagnostics[0];
+  }
+
+protected:
+  boost::asio::io_service Io;
+  Common::Logger::SharedPtr Logger;
+  OpcUa::Server::AddressSpace::SharedPtr AddressSpace;
+  OpcUa::Server::SubscriptionService::SharedPtr Subscriptions;
+  OpcUa::NodeId Session;
+  std::vector<OpcUa::PublishResult> Results;
+};
+
+TEST_F(SubscriptionDiagnostics, Created)
+{
+  const uint32_t id = CreateSubscription();
+
+  OpcUa::Server::SubscriptionDiagnostics diag = GetDiagnostics();
+  EXPECT_EQ(id, diag.SubscriptionId);
+  EXPECT_EQ(Session, diag.SessionId);
+  EXPECT_EQ(10, diag.PublishingInterval);
+  EXPECT_EQ(10u, diag.MaxKeepAliveCount);
+  EXPECT_EQ(100u, diag.MaxLifetimeCount);
+  EXPECT_EQ(0u, diag.MonitoredItemCount);
+  EXPECT_EQ(0u, diag.QueuedNotificationsCount);
+}
+
+TEST_F(SubscriptionDiagnostics, CountsQueuedAndDroppedNotifications)
+{
+  const OpcUa::NodeId valueId = CreateValue();
+  const uint32_t id = CreateSubscription();
+  const uint32_t itemId = MonitorValue(id, valueId);
+
+  // initial value is queued on creation
+  EXPECT_EQ(1u, GetDiagnostics().MonitoredItemCount);
+  EXPECT_EQ(1u, GetDiagnostics().QueuedNotificationsCount);
+
+  WriteValue(valueId, 1);
+  WriteValue(valueId, 2);
+
+  OpcUa::Server::SubscriptionDiagnostics diag = GetDiagnostics();
+  EXPECT_EQ(2u, diag.QueuedNotificationsCount);
+  EXPECT_EQ(1u, diag.MonitoringQueueOverflowCount);
+
+  OpcUa::DeleteMonitoredItemsParameters params;
+  params.SubscriptionId = id;
+  params.MonitoredItemIds.push_back(itemId);
+  Subscriptions->DeleteMonitoredItems(params);
+
+  diag = GetDiagnostics();
+  EXPECT_EQ(0u, diag.MonitoredItemCount);
+  EXPECT_EQ(0u, diag.QueuedNotificationsCount);
+  EXPECT_EQ(2u, diag.DiscardedNotificationsCount);
+}
+
+TEST_F(SubscriptionDiagnostics, CountsPublishCycles)
+{
+  const OpcUa::NodeId valueId = CreateValue();
+  const uint32_t id = CreateSubscription();
+  MonitorValue(id, valueId);
+
+  // no publish request: the cycle is late
+  Io.run_one();
+  EXPECT_EQ(1u, GetDiagnostics().LatePublishRequestCount);
+  EXPECT_TRUE(Results.empty());
+
+  OpcUa::PublishRequest request;
+  request.Header.SessionAuthenticationToken = Session;
+  Subscriptions->Publish(request);
+  Io.run_one();
+
+  ASSERT_EQ(1u, Results.size());
+  OpcUa::Server::SubscriptionDiagnostics diag = GetDiagnostics();
+  EXPECT_EQ(1u, diag.PublishRequestCount);
+  EXPECT_EQ(1u, diag.NotificationsCount);
+  EXPECT_EQ(1u, diag.DataChangeNotificationsCount);
+  EXPECT_EQ(0u, diag.QueuedNotificationsCount);
+  EXPECT_EQ(1u, diag.UnacknowledgedMessageCount);
+
+  OpcUa::SubscriptionAcknowledgement ack;
+  ack.SubscriptionId = id;
+  ack.SequenceNumber = Results[0].NotificationMessage.SequenceNumber;
+  request.SubscriptionAcknowledgements.push_back(ack);
+  Subscriptions->Publish(request);
+  EXPECT_EQ(0u, GetDiagnostics().UnacknowledgedMessageCount);
+}
+
+TEST_F(SubscriptionDiagnostics, RemovedWithSubscription)
+{
+  const uint32_t id = CreateSubscription();
+  Subscriptions->DeleteSubscriptions({id});
+  EXPECT_TRUE(Subscriptions->GetSubscriptionDiagnostics().empty());
+}
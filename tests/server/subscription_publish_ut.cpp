@@ -0,0 +1,252 @@
+/// @brief Tests of subscription publishing modes.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include <opc/ua/server/address_space.h>
+#include <opc/ua/server/standard_address_space.h>
+#include <opc/ua/server/subscription_service.h>
+
+#include <boost/asio/io_service.hpp>
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+using namespace testing;
+
+class SubscriptionPublish : public Test
+{
+protected:
+  virtual void SetUp()
+  {
+    spdlog::drop_all();
+    Logger = spdlog::stderr_color_mt("test");
+    Logger->set_level(spdlog::level::info);
+    AddressSpace = OpcUa::Server::CreateAddressSpace(Logger);
+    OpcUa::Server::FillStandardNamespace(*AddressSpace, Logger);
+    Subscriptions = OpcUa::Server::CreateSubscriptionService(AddressSpace, Io, Logger);
+    Session = OpcUa::NumericNodeId(1, 1);
+    Value = CreateValue();
+  }
+
+  virtual void TearDown()
+  {
+    Subscriptions.reset();
+    AddressSpace.reset();
+  }
+
+  OpcUa::NodeId CreateValue()
+  {
+    OpcUa::AddNodesItem item;
+    item.Attributes = OpcUa::VariableAttributes();
+    item.BrowseName = OpcUa::QualifiedName("value");
+    item.Class = OpcUa::NodeClass::Variable;
+    item.ParentNodeId = OpcUa::ObjectId::RootFolder;
+    std::vector<OpcUa::AddNodesResult> newNodesResult = AddressSpace->AddNodes({item});
+    return newNodesResult[0].AddedNodeId;
+  }
+
+  /// @brief Subscription with a publishing interval no test waits for.
+  void Subscribe()
+  {
+    OpcUa::CreateSubscriptionRequest request;
+    request.Header.SessionAuthenticationToken = Session;
+    request.Parameters.RequestedPublishingInterval = 60000;
+    request.Parameters.RequestedLifetimeCount = 100;
+    request.Parameters.RequestedMaxKeepAliveCount = 10;
+    const uint32_t id = Subscriptions->CreateSubscription(request, [this](OpcUa::PublishResult result) { Results.push_back(result); }).SubscriptionId;
+
+    OpcUa::MonitoredItemCreateRequest item;
+    item.ItemToMonitor.NodeId = Value;
+    item.ItemToMonitor.AttributeId = OpcUa::AttributeId::Value;
+    item.MonitoringMode = OpcUa::MonitoringMode::Reporting;
+    item.RequestedParameters.ClientHandle = 1;
+    item.RequestedParameters.QueueSize = 1;
+
+    OpcUa::MonitoredItemsParameters params;
+    params.SubscriptionId = id;
+    params.ItemsToCreate.push_back(item);
+    Subscriptions->CreateMonitoredItems(params);
+  }
+
+  void Publish()
+  {
+    OpcUa::PublishRequest request;
+    request.Header.SessionAuthenticationToken = Session;
+    Subscriptions->Publish(request);
+  }
+
+  void WriteValue(int value)
+  {
+    OpcUa::WriteValue write;
+    write.AttributeId = OpcUa::AttributeId::Value;
+    write.NodeId = Value;
+    write.Value = value;
+    AddressSpace->Write({write});
+  }
+
+protected:
+  boost::asio::io_service Io;
+  Common::Logger::SharedPtr Logger;
+  OpcUa::Server::AddressSpace::SharedPtr AddressSpace;
+  OpcUa::Server::SubscriptionService::SharedPtr Subscriptions;
+  OpcUa::NodeId Session;
+  OpcUa::NodeId Value;
+  std::vector<OpcUa::PublishResult> Results;
+};
+
+TEST_F(SubscriptionPublish, WaitsForCycleByDefault)
+{
+  Subscribe();
+  Publish();
+  WriteValue(1);
+  Io.poll();
+  EXPECT_TRUE(Results.empty());
+}
+
+TEST_F(SubscriptionPublish, LowLatencySendsOnceRequestIsAvailable)
+{
+  OpcUa::Server::PublishParameters params;
+  params.LowLatency = true;
+  params.MinPublishSpacing = std::chrono::milliseconds(0);
+  Subscriptions->SetPublishParameters(params);
+  Subscribe();
+
+  // the initial value waits for a publish request
+  Io.poll();
+  EXPECT_TRUE(Results.empty());
+
+  Publish();
+  Io.poll();
+  ASSERT_EQ(1u, Results.size());
+
+  Publish();
+  WriteValue(1);
+  Io.poll();
+  ASSERT_EQ(2u, Results.size());
+  EXPECT_EQ(Results[0].NotificationMessage.SequenceNumber + 1, Results[1].NotificationMessage.SequenceNumber);
+
+  std::vector<OpcUa::Server::SubscriptionDiagnostics> diagnostics = Subscriptions->GetSubscriptionDiagnostics();
+  ASSERT_EQ(1u, diagnostics.size());
+  EXPECT_EQ(2u, diagnostics[0].NotificationsCount);
+  EXPECT_EQ(0u, diagnostics[0].KeepAliveCount);
+  EXPECT_EQ(0u, diagnostics[0].CurrentKeepAliveCount);
+  EXPECT_EQ(0u, diagnostics[0].LatePublishRequestCount);
+}
+
+TEST_F(SubscriptionPublish, LowLatencyKeepsMinimumSpacing)
+{
+  OpcUa::Server::PublishParameters params;
+  params.LowLatency = true;
+  params.MinPublishSpacing = std::chrono::milliseconds(100);
+  Subscriptions->SetPublishParameters(params);
+  Subscribe();
+  Publish();
+  Io.poll();
+  ASSERT_EQ(1u, Results.size());
+
+  const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  Publish();
+  WriteValue(1);
+  Io.poll();
+  EXPECT_EQ(1u, Results.size());
+
+  Io.run_one();
+  ASSERT_EQ(2u, Results.size());
+  const std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - start;
+  EXPECT_GE(elapsed, std::chrono::milliseconds(50));
+  EXPECT_LT(elapsed, std::chrono::seconds(10));
+}
+
+TEST_F(SubscriptionPublish, PublishRequestsAreLimited)
+{
+  OpcUa::Server::PublishParameters params;
+  params.LowLatency = true;
+  params.MinPublishSpacing = std::chrono::milliseconds(0);
+  params.MaxPublishRequests = 2;
+  Subscriptions->SetPublishParameters(params);
+  Subscribe();
+
+  Publish();
+  Publish();
+  Publish();
+  Io.poll();
+  ASSERT_EQ(1u, Results.size());
+
+  WriteValue(1);
+  Io.poll();
+  ASSERT_EQ(2u, Results.size());
+
+  WriteValue(2);
+  Io.poll();
+  EXPECT_EQ(2u, Results.size());
+}
+
+TEST_F(SubscriptionPublish, CoalesceLatestKeepsLatestValue)
+{
+  OpcUa::Server::PublishParameters params;
+  params.LowLatency = true;
+  params.MinPublishSpacing = std::chrono::milliseconds(0);
+  params.Policy = OpcUa::Server::SlowConsumerPolicy::CoalesceLatest;
+  Subscriptions->SetPublishParameters(params);
+  Subscribe();
+
+  WriteValue(1);
+  WriteValue(2);
+  Publish();
+  Io.poll();
+  ASSERT_EQ(1u, Results.size());
+  ASSERT_EQ(1u, Results[0].NotificationMessage.NotificationData.size());
+  const std::vector<OpcUa::MonitoredItems> & items = Results[0].NotificationMessage.NotificationData[0].DataChange.Notification;
+  ASSERT_EQ(2u, items.size());
+  EXPECT_EQ(2, items[1].Value.Value.As<int32_t>());
+}
+
+TEST_F(SubscriptionPublish, ByteLimitDropsOldest)
+{
+  OpcUa::Server::PublishParameters params;
+  params.LowLatency = true;
+  params.MinPublishSpacing = std::chrono::milliseconds(0);
+  params.MaxQueuedNotificationBytes = 20; // room for one notification of an int value
+  Subscriptions->SetPublishParameters(params);
+  Subscribe();
+
+  WriteValue(1);
+  Publish();
+  Io.poll();
+  ASSERT_EQ(1u, Results.size());
+  ASSERT_EQ(1u, Results[0].NotificationMessage.NotificationData.size());
+  const std::vector<OpcUa::MonitoredItems> & items = Results[0].NotificationMessage.NotificationData[0].DataChange.Notification;
+  ASSERT_EQ(1u, items.size());
+  EXPECT_EQ(1, items[0].Value.Value.As<int32_t>());
+
+  std::vector<OpcUa::Server::SubscriptionDiagnostics> diagnostics = Subscriptions->GetSubscriptionDiagnostics();
+  ASSERT_EQ(1u, diagnostics.size());
+  EXPECT_EQ(1u, diagnostics[0].DiscardedNotificationsCount);
+}
+
+TEST_F(SubscriptionPublish, CloseSessionSendsStatusChange)
+{
+  OpcUa::Server::PublishParameters params;
+  params.LowLatency = true;
+  params.MinPublishSpacing = std::chrono::milliseconds(0);
+  params.MaxQueuedNotificationBytes = 1;
+  params.Policy = OpcUa::Server::SlowConsumerPolicy::CloseSession;
+  Subscriptions->SetPublishParameters(params);
+  Subscribe();
+
+  Publish();
+  Io.poll();
+  ASSERT_EQ(1u, Results.size());
+  ASSERT_EQ(1u, Results[0].NotificationMessage.NotificationData.size());
+  EXPECT_EQ(OpcUa::StatusCode::BadResourceUnavailable, Results[0].NotificationMessage.NotificationData[0].StatusChange.Status);
+
+  // nothing is queued for the closing session any more
+  Publish();
+  WriteValue(1);
+  Io.poll();
+  EXPECT_EQ(1u, Results.size());
+}
@@ -30,6 +30,13 @@ TEST(ServerOptions, ParsesCommandLine)
   EXPECT_TRUE(cmdline.IsDaemonMode());
 }
 
+TEST(ServerOptions, ParsesTraceFile)
+{
+  const char * argv[3] = { "test.exe", "--config=" TEST_CORE_CONFIG_PATH, "--trace-file=/tmp/trace.json" };
+  OpcUa::Server::CommandLine cmdline(3, argv);
+  EXPECT_EQ(cmdline.GetTraceFile(), "/tmp/trace.json");
+}
+
 
 TEST(ServerOptions, ParsesConfigurationFiles)
 {
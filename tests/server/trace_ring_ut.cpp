@@ -0,0 +1,111 @@
+/// @brief Tests of trace ring buffers.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include <opc/ua/server/trace_ring.h>
+#include <opc/ua/protocol/message_identifiers.h>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <thread>
+
+using namespace testing;
+using namespace OpcUa::Server;
+
+namespace
+{
+const uint32_t TestConnection = 0xfeed;
+
+// Events recorded by this test in a thread of its own.
+std::vector<TraceEvent> GetThreadEvents(uint32_t requestHandle)
+{
+  std::vector<TraceEvent> result;
+
+  for (const TraceEvent & event : GetTraceEvents())
+    {
+      if (event.ConnectionId == TestConnection && event.RequestHandle == requestHandle)
+        {
+          result.push_back(event);
+        }
+    }
+
+  return result;
+}
+}
+
+TEST(TraceRing, RecordsEventsInOrder)
+{
+  std::thread([]()
+  {
+    RecordTraceEvent(TestConnection, 1, OpcUa::READ_REQUEST, TracePhase::RequestBegin);
+    RecordTraceEvent(TestConnection, 1, OpcUa::READ_REQUEST, TracePhase::RequestDecoded);
+    RecordTraceEvent(TestConnection, 1, OpcUa::READ_REQUEST, TracePhase::RequestEnd);
+  }).join();
+
+  const std::vector<TraceEvent> events = GetThreadEvents(1);
+  ASSERT_EQ(3u, events.size());
+  EXPECT_EQ(TracePhase::RequestBegin, events[0].Phase);
+  EXPECT_EQ(TracePhase::RequestDecoded, events[1].Phase);
+  EXPECT_EQ(TracePhase::RequestEnd, events[2].Phase);
+  EXPECT_EQ(OpcUa::READ_REQUEST, events[0].ServiceId);
+  EXPECT_EQ(events[0].ThreadIndex, events[2].ThreadIndex);
+  EXPECT_LE(events[0].Timestamp, events[2].Timestamp);
+}
+
+TEST(TraceRing, KeepsNewestEvents)
+{
+  std::thread([]()
+  {
+    for (uint32_t idx = 0; idx < TraceRingSize + 10; ++idx)
+      {
+        RecordTraceEvent(TestConnection, 2, static_cast<uint16_t>(idx % 1000 + 1), TracePhase::PublishCycle);
+      }
+  }).join();
+
+  const std::vector<TraceEvent> events = GetThreadEvents(2);
+  // the slot next to be written is never read
+  ASSERT_EQ(TraceRingSize - 1, events.size());
+  EXPECT_EQ(11 % 1000 + 1, events.front().ServiceId);
+  EXPECT_EQ((TraceRingSize + 9) % 1000 + 1, events.back().ServiceId);
+}
+
+TEST(TraceRing, ReusesRingsOfExitedThreads)
+{
+  for (uint32_t handle = 3; handle < 5; ++handle)
+    {
+      std::thread([handle]()
+      {
+        RecordTraceEvent(TestConnection, handle, OpcUa::READ_REQUEST, TracePhase::RequestBegin);
+      }).join();
+    }
+
+  const std::vector<TraceEvent> first = GetThreadEvents(3);
+  const std::vector<TraceEvent> second = GetThreadEvents(4);
+  ASSERT_EQ(1u, first.size());
+  ASSERT_EQ(1u, second.size());
+  EXPECT_EQ(first[0].ThreadIndex, second[0].ThreadIndex);
+}
+
+TEST(TraceRing, WritesChromeTrace)
+{
+  std::vector<TraceEvent> events(3);
+  events[0] = {1000, 1, 5, OpcUa::READ_REQUEST, TracePhase::RequestEnd, 0};
+  events[1] = {2000, 1, 6, OpcUa::READ_REQUEST, TracePhase::RequestBegin, 0};
+  events[2] = {3500, 1, 6, OpcUa::READ_REQUEST, TracePhase::RequestEnd, 0};
+
+  std::ostringstream os;
+  WriteChromeTrace(os, events);
+  const std::string trace = os.str();
+
+  EXPECT_NE(std::string::npos, trace.find("\"traceEvents\""));
+  EXPECT_NE(std::string::npos, trace.find("\"name\":\"Read\""));
+  EXPECT_NE(std::string::npos, trace.find("\"ph\":\"B\""));
+  EXPECT_NE(std::string::npos, trace.find("\"ph\":\"E\",\"ts\":2.500"));
+  // end without begin is dropped
+  EXPECT_EQ(std::string::npos, trace.find("\"handle\":5"));
+}
@@ -0,0 +1,200 @@
+/// @brief Tests of the queues from producer threads into the address space.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include <opc/ua/server/address_space.h>
+#include <opc/ua/server/value_ingest.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <functional>
+#include <future>
+#include <limits>
+#include <thread>
+
+using namespace testing;
+using namespace OpcUa;
+
+class ValueIngest : public Test
+{
+protected:
+  virtual void SetUp()
+  {
+    spdlog::drop_all();
+    Logger = spdlog::stderr_color_mt("test");
+    Logger->set_level(spdlog::level::info);
+    Space = Server::CreateAddressSpace(Logger);
+    Gate = AddVariable(1);
+    Value = AddVariable(2);
+
+    // the applier waits in the callback of Gate until Release is set
+    Space->AddDataChangeCallback(Gate, AttributeId::Value, [this](const NodeId &, AttributeId, const DataValue &)
+    {
+      Entered.set_value();
+      Release.get_future().wait();
+    });
+  }
+
+  virtual void TearDown()
+  {
+    Space.reset();
+  }
+
+  NodeId AddVariable(uint32_t id)
+  {
+    AddNodesItem item;
+    item.RequestedNewNodeId = NumericNodeId(id, 2);
+    item.BrowseName = QualifiedName("Var" + std::to_string(id), 2);
+    item.Class = NodeClass::Variable;
+    item.Attributes = VariableAttributes();
+    return Space->AddNodes({item})[0].AddedNodeId;
+  }
+
+  // queue a value of Gate and wait until the applier blocks on it
+  void BlockApplier(Server::IngestProducer & producer)
+  {
+    ASSERT_TRUE(producer.Push(Space->GetValueHandle(Gate), DataValue(0)));
+    ASSERT_EQ(Entered.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+  }
+
+  static bool WaitFor(std::function<bool()> condition)
+  {
+    for (unsigned i = 0; i < 500; ++i)
+      {
+        if (condition())
+          {
+            return true;
+          }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      }
+
+    return false;
+  }
+
+  Variant ReadValue(const NodeId & node)
+  {
+    ReadParameters params;
+    params.AttributesToRead.push_back(ToReadValueId(node, AttributeId::Value));
+    return Space->Read(params)[0].Value;
+  }
+
+protected:
+  Common::Logger::SharedPtr Logger;
+  Server::AddressSpace::UniquePtr Space;
+  NodeId Gate;
+  NodeId Value;
+  std::promise<void> Entered;
+  std::promise<void> Release;
+};
+
+TEST_F(ValueIngest, StoresQueuedValues)
+{
+  Server::ValueIngest::UniquePtr ingest = Server::CreateValueIngest(*Space);
+  Server::IngestProducer::SharedPtr producer = ingest->CreateProducer();
+  Release.set_value();
+
+  EXPECT_TRUE(producer->Push(Space->GetValueHandle(Value), DataValue(42)));
+  EXPECT_TRUE(WaitFor([&]()
+  {
+    return ingest->GetStatistics().AppliedCount == 1;
+  }));
+  EXPECT_EQ(ReadValue(Value), 42);
+
+  EXPECT_TRUE(producer->Push(std::numeric_limits<uint32_t>::max(), DataValue(1)));
+  EXPECT_TRUE(WaitFor([&]()
+  {
+    return ingest->GetStatistics().RejectedCount == 1;
+  }));
+
+  const Server::IngestStatistics stats = ingest->GetStatistics();
+  EXPECT_EQ(stats.QueuedCount, 2u);
+  EXPECT_EQ(stats.QueueDepth, 0u);
+  EXPECT_EQ(stats.ProducerCount, 1u);
+}
+
+TEST_F(ValueIngest, LastValueOfNodeWins)
+{
+  std::vector<DataValue> notified;
+  Space->AddDataChangeCallback(Value, AttributeId::Value, [&](const NodeId &, AttributeId, const DataValue & value)
+  {
+    notified.push_back(value);
+  });
+
+  Server::ValueIngest::UniquePtr ingest = Server::CreateValueIngest(*Space);
+  Server::IngestProducer::SharedPtr producer = ingest->CreateProducer();
+  BlockApplier(*producer);
+
+  const uint32_t handle = Space->GetValueHandle(Value);
+  producer->Push(handle, DataValue(1));
+  producer->Push(handle, DataValue(2));
+  producer->Push(handle, DataValue(3));
+  Release.set_value();
+  ingest->Stop();
+
+  ASSERT_EQ(notified.size(), 1u);
+  EXPECT_EQ(notified[0].Value, 3);
+  EXPECT_EQ(ingest->GetStatistics().CoalescedCount, 2u);
+  EXPECT_EQ(ingest->GetStatistics().AppliedCount, 2u);
+}
+
+TEST_F(ValueIngest, KeepAllStoresEveryValue)
+{
+  std::vector<DataValue> notified;
+  Space->AddDataChangeCallback(Value, AttributeId::Value, [&](const NodeId &, AttributeId, const DataValue & value)
+  {
+    notified.push_back(value);
+  });
+
+  Server::IngestParameters params;
+  params.KeepAll = true;
+  Server::ValueIngest::UniquePtr ingest = Server::CreateValueIngest(*Space, params);
+  Server::IngestProducer::SharedPtr producer = ingest->CreateProducer();
+  BlockApplier(*producer);
+
+  const uint32_t handle = Space->GetValueHandle(Value);
+  producer->Push(handle, DataValue(1));
+  producer->Push(handle, DataValue(2));
+  producer->Push(handle, DataValue(3));
+  Release.set_value();
+  ingest->Stop();
+
+  ASSERT_EQ(notified.size(), 3u);
+  EXPECT_EQ(notified[0].Value, 1);
+  EXPECT_EQ(notified[1].Value, 2);
+  EXPECT_EQ(notified[2].Value, 3);
+  EXPECT_EQ(ingest->GetStatistics().CoalescedCount, 0u);
+}
+
+TEST_F(ValueIngest, DropsValuesWhenQueueIsFull)
+{
+  Server::IngestParameters params;
+  params.QueueCapacity = 2;
+  Server::ValueIngest::UniquePtr ingest = Server::CreateValueIngest(*Space, params);
+  Server::IngestProducer::SharedPtr producer = ingest->CreateProducer();
+  BlockApplier(*producer);
+
+  const uint32_t handle = Space->GetValueHandle(Value);
+  EXPECT_TRUE(producer->Push(handle, DataValue(1)));
+  EXPECT_TRUE(producer->Push(handle, DataValue(2)));
+  EXPECT_FALSE(producer->Push(handle, DataValue(3)));
+
+  Server::IngestStatistics stats = ingest->GetStatistics();
+  EXPECT_EQ(stats.QueueDepth, 2u);
+  EXPECT_EQ(stats.DroppedCount, 1u);
+
+  Release.set_value();
+  ingest->Stop();
+  EXPECT_EQ(ReadValue(Value), 2);
+  EXPECT_FALSE(producer->Push(handle, DataValue(4)));
+
+  stats = ingest->GetStatistics();
+  EXPECT_EQ(stats.QueueDepth, 0u);
+  EXPECT_EQ(stats.QueuedCount, 3u);
+  EXPECT_EQ(stats.DroppedCount, 2u);
+}